@@ -7,6 +7,7 @@
 
 // First Party
 #include "Entity.h"
+#include "Profiler.h"
 #pragma endregion Includes
 
 namespace Library
@@ -17,6 +18,7 @@ namespace Library
 		{
 			{
 				{ EntityPrototypeKey, Types::Scope, true, 1, 0 },
+				{ CountKey, Types::Integer, false, 1, offsetof(ActionCreate, mCount) },
 			},
 
 			Entity::TypeIdClass()
@@ -29,23 +31,102 @@ namespace Library
 	{
 	}
 
+	ActionCreate::~ActionCreate()
+	{
+		delete mTemplate;
+	}
+
+	ActionCreate::ActionCreate(const ActionCreate& rhs) : Entity(rhs),
+		mCount(rhs.mCount)
+	{
+	}
+
+	ActionCreate& ActionCreate::operator=(const ActionCreate& rhs)
+	{
+		if (this != &rhs)
+		{
+			Entity::operator=(rhs);
+			mCount = rhs.mCount;
+			InvalidatePrototype();
+		}
+
+		return *this;
+	}
+
+	ActionCreate::ActionCreate(ActionCreate&& rhs) noexcept : Entity(std::move(rhs)),
+		mCount(rhs.mCount), mTemplate(rhs.mTemplate), mTemplateSource(rhs.mTemplateSource)
+	{
+		rhs.mTemplate = nullptr;
+		rhs.mTemplateSource = EntityHandle();
+	}
+
+	ActionCreate& ActionCreate::operator=(ActionCreate&& rhs) noexcept
+	{
+		if (this != &rhs)
+		{
+			Entity::operator=(std::move(rhs));
+			mCount = rhs.mCount;
+
+			delete mTemplate;
+			mTemplate = rhs.mTemplate;
+			mTemplateSource = rhs.mTemplateSource;
+
+			rhs.mTemplate = nullptr;
+			rhs.mTemplateSource = EntityHandle();
+		}
+
+		return *this;
+	}
+
 	gsl::owner<Scope*> ActionCreate::Clone() const
 	{
 		return new ActionCreate(*this);
 	}
 
-	void ActionCreate::Update(WorldState&)
+	bool ActionCreate::IsCompiled() const
+	{
+		return mTemplate != nullptr;
+	}
+
+	std::size_t ActionCreate::CreateN(const std::size_t count)
 	{
 		Entity* parent = GetParent();
-		
-		if (parent != nullptr)
+		if (parent == nullptr || count == 0) return 0;
+
+		const Entity* prototype = FindChild(EntityPrototypeKey);
+		if (prototype == nullptr) return 0;
+
+		PROFILE_SCOPE("ActionCreate::CreateN");
+
+		// Attribute values are edited through references, so no version tracks them. Comparing against the template catches
+		// every edit at the cost of one walk over the prototype, which is small next to cloning it count times.
+		if (mTemplate == nullptr || mTemplateSource != prototype->Handle() || *mTemplate != *prototype)
 		{
-			Entity* child = FindChild(EntityPrototypeKey);
+			Compile(*prototype);
+		}
 
-			if (child != nullptr)
-			{
-				parent->AddChild(static_cast<Entity&>(*child->Clone()));
-			}
+		parent->ReserveChildren(count);
+
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			parent->AddChild(static_cast<Entity&>(*mTemplate->Clone()));
+		}
+
+		return count;
+	}
+
+	void ActionCreate::InvalidatePrototype()
+	{
+		delete mTemplate;
+		mTemplate = nullptr;
+		mTemplateSource = EntityHandle();
+	}
+
+	void ActionCreate::Update(WorldState&)
+	{
+		if (mCount > 0)
+		{
+			CreateN(static_cast<std::size_t>(mCount));
 		}
 	}
 
@@ -55,4 +136,36 @@ namespace Library
 		oss << Name() << " (ActionCreate)";
 		return oss.str();
 	}
-}
\ No newline at end of file
+
+	void ActionCreate::Compile(const Entity& prototype)
+	{
+		gsl::owner<Entity*> compiled = static_cast<Entity*>(prototype.Clone());
+		Compact(*compiled);
+
+		delete mTemplate;
+		mTemplate = compiled;
+		mTemplateSource = prototype.Handle();
+	}
+
+	void ActionCreate::Compact(Scope& scope)
+	{
+		scope.Compact();
+
+		for (std::size_t i = 0; i < scope.Size(); ++i)
+		{
+			Data& data = scope[i];
+			if (data.Type() != Types::Scope) continue;
+
+			for (std::size_t j = 0; j < data.Size(); ++j)
+			{
+				Scope* nested = data.Get<Scope*>(j);
+
+				// Only owned Scopes are compacted, never ones merely referenced by pointer.
+				if (nested != nullptr && nested->GetParent() == &scope)
+				{
+					Compact(*nested);
+				}
+			}
+		}
+	}
+}
@@ -11,6 +11,12 @@ namespace Library
 	/// <summary>
 	/// Represents an Action for creating Scopes.
 	/// </summary>
+	/// <remarks>
+	/// The prototype is compiled once into a template: a private copy whose Scopes are compacted to the smallest table that holds them.
+	/// Every spawn clones the template rather than the prototype, so instances inherit the compact layout.
+	/// The template is rebuilt when the prototype Attribute points at a different Entity, or when the prototype no longer compares equal
+	/// to the template, which covers edits to its Attribute values, its children and their nested Scopes.
+	/// </remarks>
 	class ActionCreate final : public Entity
 	{
 		RTTI_DECLARATIONS(ActionCreate, Entity)
@@ -22,6 +28,11 @@ namespace Library
 		/// </summary>
 		inline static const std::string EntityPrototypeKey = "Entity";
 
+		/// <summary>
+		/// Key for the Count Attribute used to specify how many instances are created per Update.
+		/// </summary>
+		inline static const std::string CountKey = "Count";
+
 	public:
 		/// <summary>
 		/// Getter for the class TypeInfo, used for registration with the TypeManager.
@@ -37,35 +48,35 @@ namespace Library
 		explicit ActionCreate(std::string name=std::string());
 
 		/// <summary>
-		/// Default destructor.
+		/// Destructor.
 		/// </summary>
-		~ActionCreate() = default;
+		virtual ~ActionCreate() override;
 
 		/// <summary>
-		/// Copy constructor.
+		/// Copy constructor. The compiled template is not copied, and is rebuilt on the first spawn.
 		/// </summary>
 		/// <param name="rhs">ActionCreate to be copied.</param>
-		ActionCreate(const ActionCreate& rhs) = default;
+		ActionCreate(const ActionCreate& rhs);
 
 		/// <summary>
-		/// Copy assignment operator.
+		/// Copy assignment operator. The compiled template is not copied, and is rebuilt on the first spawn.
 		/// </summary>
 		/// <param name="rhs">ActionCreate to be copied.</param>
 		/// <returns>Newly copied into left hand side ActionCreate.</returns>
-		ActionCreate& operator=(const ActionCreate& rhs) = default;
+		ActionCreate& operator=(const ActionCreate& rhs);
 
 		/// <summary>
 		/// Move constructor.
 		/// </summary>
 		/// <param name="rhs">ActionCreate to be moved.</param>
-		ActionCreate(ActionCreate&& rhs) noexcept = default;
+		ActionCreate(ActionCreate&& rhs) noexcept;
 
 		/// <summary>
 		/// Move assignment operator.
 		/// </summary>
 		/// <param name="rhs">ActionCreate to be moved.</param>
 		/// <returns>Newly moved into left hand side ActionCreate.</returns>
-		ActionCreate& operator=(ActionCreate&& rhs) noexcept = default;
+		ActionCreate& operator=(ActionCreate&& rhs) noexcept;
 #pragma endregion Special Members
 
 #pragma region Virtual Copy Constructor
@@ -77,10 +88,35 @@ namespace Library
 		virtual gsl::owner<Scope*> Clone() const override;
 #pragma endregion Virtual Copy Constructor
 
+#pragma region Accessors
+	public:
+		/// <summary>
+		/// Gets whether the prototype has been compiled into a template.
+		/// </summary>
+		/// <returns>True when a template is cached. Otherwise, false.</returns>
+		bool IsCompiled() const;
+#pragma endregion Accessors
+
+#pragma region Modifiers
+	public:
+		/// <summary>
+		/// Creates a number of instances of the prototype as children of the parent of the ActionCreate, compiling the prototype first if needed.
+		/// </summary>
+		/// <param name="count">Number of instances to be created.</param>
+		/// <returns>Number of instances created, which is zero when there is no parent or prototype.</returns>
+		std::size_t CreateN(const std::size_t count);
+
+		/// <summary>
+		/// Discards the compiled template, so that the next spawn picks up changes made to the prototype.
+		/// </summary>
+		void InvalidatePrototype();
+#pragma endregion Modifiers
+
 #pragma region Game Loop
 	public:
 		/// <summary>
 		/// Virtual update method called by the containing object.
+		/// Creates Count instances of the prototype.
 		/// </summary>
 		virtual void Update(WorldState&) override;
 #pragma endregion Game Loop
@@ -93,6 +129,39 @@ namespace Library
 		/// <returns></returns>
 		virtual std::string ToString() const override;
 #pragma endregion RTTI Overrides
+
+#pragma region Helper Methods
+	private:
+		/// <summary>
+		/// Replaces the template with a compacted copy of the prototype.
+		/// </summary>
+		/// <param name="prototype">Entity to be compiled.</param>
+		void Compile(const Entity& prototype);
+
+		/// <summary>
+		/// Compacts a Scope and all of its nested Scopes.
+		/// </summary>
+		/// <param name="scope">Root of the hierarchy to be compacted.</param>
+		static void Compact(Scope& scope);
+#pragma endregion Helper Methods
+
+#pragma region Data Members
+	private:
+		/// <summary>
+		/// Number of instances created per Update.
+		/// </summary>
+		int mCount{ 1 };
+
+		/// <summary>
+		/// Compacted copy of the prototype, cloned for every spawn.
+		/// </summary>
+		gsl::owner<Entity*> mTemplate{ nullptr };
+
+		/// <summary>
+		/// Prototype the template was compiled from. Held by handle, so a new prototype allocated at the same address is not mistaken for it.
+		/// </summary>
+		EntityHandle mTemplateSource;
+#pragma endregion Data Members
 	};
 
 #pragma region Factory
@@ -34,19 +34,38 @@ namespace Library
 		return new ActionDestroy(*this);
 	}
 
+	void ActionDestroy::SetTarget(const Entity& target)
+	{
+		mTargetName = target.Name();
+		mTarget = target.Handle();
+	}
+
 	void ActionDestroy::Update(WorldState&)
 	{
 		Entity* parent = GetParent();
-		
-		if (parent != nullptr)
+		if (parent == nullptr) return;
+
+		Entity* target = mTarget.Resolve();
+
+		if (target == nullptr || target->GetParent() != parent || target->Name() != mTargetName)
 		{
-			Entity* child = parent->FindChild(mTargetName);
+			if (mMissParent == parent->Handle() && mMissVersion == parent->ChildSetVersion() && mMissName == mTargetName) return;
 
-			if (child != nullptr)
+			target = parent->FindChild(mTargetName);
+			mTarget = target ? target->Handle() : EntityHandle();
+
+			if (target == nullptr)
 			{
-				parent->DestroyChild(*child);
+				mMissParent = parent->Handle();
+				mMissVersion = parent->ChildSetVersion();
+				mMissName = mTargetName;
 			}
 		}
+
+		if (target != nullptr)
+		{
+			parent->DestroyChild(*target);
+		}
 	}
 
 	std::string ActionDestroy::ToString() const
@@ -77,10 +77,21 @@ namespace Library
 		virtual gsl::owner<Scope*> Clone() const override;
 #pragma endregion Virtual Copy Constructor
 
+#pragma region Accessors
+	public:
+		/// <summary>
+		/// Targets the given Entity, caching its handle so that it is found without a name lookup.
+		/// </summary>
+		/// <param name="target">Sibling Entity to be destroyed.</param>
+		void SetTarget(const Entity& target);
+#pragma endregion Accessors
+
 #pragma region Game Loop
 	public:
 		/// <summary>
 		/// Virtual update method called by the containing object.
+		/// Destroys the sibling Entity named by the Target attribute, resolving it through a cached handle when still valid.
+		/// A failed lookup is remembered until the parent gains or loses a child, or the Target attribute changes.
 		/// </summary>
 		virtual void Update(WorldState&) override;
 #pragma endregion Game Loop
@@ -100,6 +111,26 @@ namespace Library
 		/// Name for the Attribute of the Attribute to create.
 		/// </summary>
 		std::string mTargetName;
+
+		/// <summary>
+		/// Cached handle of the last resolved target.
+		/// </summary>
+		EntityHandle mTarget;
+
+		/// <summary>
+		/// Parent searched by the last failed lookup.
+		/// </summary>
+		EntityHandle mMissParent;
+
+		/// <summary>
+		/// Child set version of the parent at the last failed lookup.
+		/// </summary>
+		std::uint64_t mMissVersion{ 0 };
+
+		/// <summary>
+		/// Target name of the last failed lookup.
+		/// </summary>
+		std::string mMissName;
 #pragma endregion Data Members
 	};
 
@@ -10,6 +10,7 @@
 
 // First Party
 #include "Entity.h"
+#include "World.h"
 #pragma endregion Includes
 
 namespace Library
@@ -20,7 +21,8 @@ namespace Library
 		{
 			{
 				{ ExpressionKey, Types::String, false, 1, offsetof(ActionExpression, mExpression) },
-				{ ResultKey, Types::Reference, false, 1, offsetof(ActionExpression, mResultPtr) }
+				{ ResultKey, Types::Reference, false, 1, offsetof(ActionExpression, mResultPtr) },
+				{ BatchedKey, Types::Integer, false, 1, offsetof(ActionExpression, mBatched) }
 			},
 
 			Entity::TypeIdClass()
@@ -33,8 +35,30 @@ namespace Library
 	{
 	}
 
+	ActionExpression::ActionExpression(const ActionExpression& rhs) : Entity(rhs),
+		mResult(rhs.mResult), mExpression(rhs.mExpression), mResultPtr(rhs.mResultPtr == &rhs.mResult ? &mResult : rhs.mResultPtr),
+		mBatched(rhs.mBatched)
+	{
+	}
+
+	ActionExpression& ActionExpression::operator=(const ActionExpression& rhs)
+	{
+		if (this != &rhs)
+		{
+			Entity::operator=(rhs);
+			mResult = rhs.mResult;
+			mExpression = rhs.mExpression;
+			mResultPtr = rhs.mResultPtr == &rhs.mResult ? &mResult : rhs.mResultPtr;
+			mBatched = rhs.mBatched;
+			ResetProgram();
+		}
+
+		return *this;
+	}
+
 	ActionExpression::ActionExpression(ActionExpression&& rhs) noexcept : Entity(std::move(rhs)), 
-		mResult(std::move(rhs.mResult))
+		mResult(std::move(rhs.mResult)), mProgramVersion(rhs.mProgramVersion + 1), mExpression(std::move(rhs.mExpression)), 
+		mResultPtr(rhs.mResultPtr == &rhs.mResult ? &mResult : rhs.mResultPtr), mBatched(rhs.mBatched)
 	{
 	}
 
@@ -42,6 +66,11 @@ namespace Library
 	{
 		Entity::operator=(std::move(rhs));
 		mResult = std::move(rhs.mResult);
+		mExpression = std::move(rhs.mExpression);
+		mResultPtr = rhs.mResultPtr == &rhs.mResult ? &mResult : rhs.mResultPtr;
+		mBatched = rhs.mBatched;
+		mProgramVersion = rhs.mProgramVersion;
+		ResetProgram();
 
 		return *this;
 	}
@@ -51,20 +80,83 @@ namespace Library
 		return new ActionExpression(*this);
 	}
 
-	void ActionExpression::Update(WorldState&)
+	const std::string& ActionExpression::Expression() const
 	{
-		TokenizeExpression();
+		return mExpression;
+	}
+
+	const CompiledExpression& ActionExpression::Program() const
+	{
+		return mProgram;
+	}
+
+	bool ActionExpression::IsCompiled() const
+	{
+		return mIsCompiled && mCompiledExpression == mExpression && mBoundLineage.Matches(*this);
+	}
+
+	bool ActionExpression::IsBatched() const
+	{
+		return mBatched != 0;
+	}
+
+	void ActionExpression::SetExpression(std::string expression)
+	{
+		mExpression = std::move(expression);
+		ResetProgram();
+	}
+
+	void ActionExpression::SetBatched(const bool batched)
+	{
+		mBatched = batched;
+	}
+
+	void ActionExpression::Compile()
+	{
+		CompiledExpression program = CompiledExpression::Compile(mExpression, *this);
+		
+		ResetProgram();
+		mProgram = std::move(program);
+		mBoundLineage = Lineage(*this);
+		mCompiledExpression = mExpression;
+		mIsCompiled = true;
+	}
+
+	void ActionExpression::Initialize(WorldState& worldState)
+	{
+		Compile();
+
+		Entity::Initialize(worldState);
+	}
+
+	void ActionExpression::Update(WorldState& worldState)
+	{
+		if (!IsCompiled()) Compile();
+
+		if (mBatched && worldState.World)
+		{
+			if (!mIsBatchQueued) worldState.World->GetExpressionBatch().Add(*this);
+		}
+		else if (mResultPtr != nullptr)
+		{
+			mProgram.Evaluate(*mResultPtr);
+		}
 	}
 
 	std::string ActionExpression::ToString() const
 	{
 		std::ostringstream oss;
-		oss << Name() << ": '" << mResult.ToString() << "' (ActionExpression)";
+		oss << Name() << ": '" << (mResult.Size() > 0 ? mResult.ToString() : std::string()) << "' (ActionExpression)";
 		return oss.str();
 	}
 
-	void ActionExpression::TokenizeExpression()
+	void ActionExpression::ResetProgram()
 	{
-		std::istringstream iss(mExpression);
+		mProgram = CompiledExpression();
+		mBoundLineage.Clear();
+		mCompiledExpression.clear();
+		mIsCompiled = false;
+		mIsBatchQueued = false;
+		++mProgramVersion;
 	}
-}
\ No newline at end of file
+}
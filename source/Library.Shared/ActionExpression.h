@@ -4,7 +4,7 @@
 // First Party
 #include "Entity.h"
 #include "Factory.h"
-#include "Stack.h"
+#include "CompiledExpression.h"
 #pragma endregion Includes
 
 namespace Library
@@ -12,10 +12,17 @@ namespace Library
 	/// <summary>
 	/// Represents an Action that evaluates an algebraic expression.
 	/// </summary>
+	/// <remarks>
+	/// The expression is compiled once, on Initialize or on the first Update, binding its operand names to their Datum.
+	/// Each Update then evaluates the compiled bytecode into the Result Datum without any lookups or allocation.
+	/// The expression is recompiled on its next Update once it changes, or the Scope hierarchy its operands are searched in changes structure, as tracked by a Scope::Lineage.
+	/// </remarks>
 	class ActionExpression final : public Entity
 	{
 		RTTI_DECLARATIONS(ActionExpression, Entity)
 
+		friend class ExpressionBatch;
+
 #pragma region Type Definitions, Constants
 	public:
 		/// <summary>
@@ -28,6 +35,13 @@ namespace Library
 		/// </summary>
 		inline static const std::string ResultKey = "Result";
 
+		/// <summary>
+		/// Key for the name of the integer Attribute selecting batched evaluation.
+		/// When non-zero within a World, the expression is evaluated by the ExpressionBatch of the World at the end of its Update,
+		/// together with every other batched expression of the same shape, instead of during the Update of the ActionExpression.
+		/// </summary>
+		inline static const std::string BatchedKey = "Batched";
+
 	public:
 		/// <summary>
 		/// Getter for the class TypeInfo, used for registration with the TypeManager.
@@ -51,14 +65,16 @@ namespace Library
 		/// Copy constructor.
 		/// </summary>
 		/// <param name="rhs">ActionExpression to be copied.</param>
-		ActionExpression(const ActionExpression& rhs) = default;
+		/// <remarks>The copy is recompiled on its next Update, binding operands relative to its own Scope.</remarks>
+		ActionExpression(const ActionExpression& rhs);
 
 		/// <summary>
 		/// Copy assignment operator.
 		/// </summary>
 		/// <param name="rhs">ActionExpression to be copied.</param>
 		/// <returns>Newly copied into left hand side ActionExpression.</returns>
-		ActionExpression& operator=(const ActionExpression& rhs) = default;
+		/// <remarks>The copy is recompiled on its next Update, binding operands relative to its own Scope.</remarks>
+		ActionExpression& operator=(const ActionExpression& rhs);
 
 		/// <summary>
 		/// Move constructor.
@@ -83,10 +99,67 @@ namespace Library
 		virtual gsl::owner<Scope*> Clone() const override;
 #pragma endregion Virtual Copy Constructor
 
+#pragma region Accessors
+	public:
+		/// <summary>
+		/// Gets the algebraic expression.
+		/// </summary>
+		/// <returns>Expression string.</returns>
+		const std::string& Expression() const;
+
+		/// <summary>
+		/// Gets the compiled form of the expression.
+		/// </summary>
+		/// <returns>CompiledExpression, empty until compiled.</returns>
+		const CompiledExpression& Program() const;
+
+		/// <summary>
+		/// Gets whether the expression has been compiled since it last changed, against the current Scope hierarchy.
+		/// </summary>
+		/// <returns>True when compiled. Otherwise, false.</returns>
+		bool IsCompiled() const;
+
+		/// <summary>
+		/// Gets whether the expression is evaluated by the ExpressionBatch of its World.
+		/// </summary>
+		/// <returns>True when batched. Otherwise, false.</returns>
+		bool IsBatched() const;
+#pragma endregion Accessors
+
+#pragma region Modifiers
+	public:
+		/// <summary>
+		/// Sets the algebraic expression, to be compiled on the next Update.
+		/// </summary>
+		/// <param name="expression">Expression string.</param>
+		void SetExpression(std::string expression);
+
+		/// <summary>
+		/// Sets whether the expression is evaluated by the ExpressionBatch of its World.
+		/// </summary>
+		/// <param name="batched">True to batch the expression. Otherwise, false.</param>
+		void SetBatched(const bool batched);
+
+		/// <summary>
+		/// Compiles the expression, binding its operand names within the Scope hierarchy of the ActionExpression.
+		/// </summary>
+		/// <exception cref="std::runtime_error">Expression is malformed, or an operand is missing or is not an integer or float.</exception>
+		void Compile();
+#pragma endregion Modifiers
+
 #pragma region Game Loop
 	public:
+		/// <summary>
+		/// Virtual initialization method called by the containing object.
+		/// Compiles the expression, so that errors surface before the first Update.
+		/// </summary>
+		/// <param name="worldState">WorldState context for the current processing step.</param>
+		virtual void Initialize(WorldState& worldState) override;
+
 		/// <summary>
 		/// Virtual update method called by the containing object.
+		/// Evaluates the expression into the Result Datum, compiling it first if needed.
+		/// A batched expression within a World is instead queued with the ExpressionBatch of the World, for evaluation at the end of the World's Update.
 		/// </summary>
 		/// <param name="worldState">WorldState context for the current processing step.</param>
 		virtual void Update(WorldState& worldState) override;
@@ -103,7 +176,10 @@ namespace Library
 
 #pragma region Helper Methods
 	private:
-		void TokenizeExpression();
+		/// <summary>
+		/// Discards the compiled expression, invalidating any queued ExpressionBatch evaluation.
+		/// </summary>
+		void ResetProgram();
 #pragma endregion Helper Methods
 
 #pragma region Data Members
@@ -113,7 +189,35 @@ namespace Library
 		/// </summary>
 		Data mResult;
 
-		Stack<std::string> mTokenStack;
+		/// <summary>
+		/// Compiled form of the expression.
+		/// </summary>
+		CompiledExpression mProgram;
+
+		/// <summary>
+		/// Whether mProgram reflects the current expression.
+		/// </summary>
+		bool mIsCompiled{ false };
+
+		/// <summary>
+		/// Lineage of the ActionExpression at the time of compilation. Operands found through it are rebound once it no longer matches.
+		/// </summary>
+		Lineage mBoundLineage;
+
+		/// <summary>
+		/// Expression at the time of compilation.
+		/// </summary>
+		std::string mCompiledExpression;
+
+		/// <summary>
+		/// Incremented whenever mProgram changes, so that an ExpressionBatch can detect stale queued instances.
+		/// </summary>
+		std::uint32_t mProgramVersion{ 0 };
+
+		/// <summary>
+		/// Whether mProgram is queued with an ExpressionBatch for its next evaluation.
+		/// </summary>
+		bool mIsBatchQueued{ false };
 
 #pragma region Prescribed Attributes
 	private:
@@ -126,6 +230,11 @@ namespace Library
 		/// Algebraic expression evaluation result pointer.
 		/// </summary>
 		Data* mResultPtr{ &mResult };
+
+		/// <summary>
+		/// Whether the expression is evaluated by the ExpressionBatch of its World.
+		/// </summary>
+		int mBatched{ 0 };
 #pragma endregion Prescribed Attributes
 #pragma endregion Data Members
 	};
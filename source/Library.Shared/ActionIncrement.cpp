@@ -7,6 +7,8 @@
 
 // First Party
 #include "Entity.h"
+#include "World.h"
+#include "WorldState.h"
 #pragma endregion Includes
 
 namespace Library
@@ -17,7 +19,8 @@ namespace Library
 		{
 			{
 				{ OperandKey, Types::String, false, 1, offsetof(ActionIncrement, mOperand) },
-				{ IncrementStepKey, Types::Integer, false, 1, offsetof(ActionIncrement, mIncrementStep) }
+				{ IncrementStepKey, Types::Integer, false, 1, offsetof(ActionIncrement, mIncrementStep) },
+				{ BatchedKey, Types::Integer, false, 1, offsetof(ActionIncrement, mBatched) }
 			},
 
 			Entity::TypeIdClass()
@@ -30,18 +33,110 @@ namespace Library
 	{
 	}
 
+	ActionIncrement::ActionIncrement(const ActionIncrement& rhs) : Entity(rhs),
+		mOperand(rhs.mOperand), mIncrementStep(rhs.mIncrementStep), mBatched(rhs.mBatched)
+	{
+	}
+
+	ActionIncrement& ActionIncrement::operator=(const ActionIncrement& rhs)
+	{
+		if (this != &rhs)
+		{
+			Entity::operator=(rhs);
+			mOperand = rhs.mOperand;
+			mIncrementStep = rhs.mIncrementStep;
+			mBatched = rhs.mBatched;
+			ResetBinding();
+		}
+
+		return *this;
+	}
+
+	ActionIncrement::ActionIncrement(ActionIncrement&& rhs) noexcept : Entity(std::move(rhs)),
+		mBindingVersion(rhs.mBindingVersion + 1), mOperand(std::move(rhs.mOperand)), mIncrementStep(rhs.mIncrementStep), mBatched(rhs.mBatched)
+	{
+	}
+
+	ActionIncrement& ActionIncrement::operator=(ActionIncrement&& rhs) noexcept
+	{
+		Entity::operator=(std::move(rhs));
+		mOperand = std::move(rhs.mOperand);
+		mIncrementStep = rhs.mIncrementStep;
+		mBatched = rhs.mBatched;
+		mBindingVersion = rhs.mBindingVersion;
+		ResetBinding();
+
+		return *this;
+	}
+
 	gsl::owner<Scope*> ActionIncrement::Clone() const
 	{
 		return new ActionIncrement(*this);
 	}
 
-	void ActionIncrement::Update(WorldState&)
+	const std::string& ActionIncrement::Operand() const
+	{
+		return mOperand;
+	}
+
+	ActionIncrement::Data* ActionIncrement::Target() const
 	{
-		Data* operand = Search(mOperand);
+		return mTarget;
+	}
+
+	bool ActionIncrement::IsBound() const
+	{
+		return mTarget != nullptr && mBoundOperand == mOperand && mBoundLineage.Matches(*this) && mTarget->Type() == Types::Integer && mTarget->Size() > 0;
+	}
 
-		if (operand && operand->Type() == Types::Integer && operand->Size() > 0)
+	bool ActionIncrement::IsBatched() const
+	{
+		return mBatched != 0;
+	}
+
+	void ActionIncrement::SetOperand(std::string operand)
+	{
+		mOperand = std::move(operand);
+		ResetBinding();
+	}
+
+	void ActionIncrement::SetBatched(const bool batched)
+	{
+		mBatched = batched;
+	}
+
+	void ActionIncrement::Bind()
+	{
+		Data* target = Search(mOperand);
+		
+		ResetBinding();
+
+		if (target && target->Type() == Types::Integer && target->Size() > 0)
+		{
+			mTarget = target;
+			mBoundLineage = Lineage(*this);
+			mBoundOperand = mOperand;
+		}
+	}
+
+	void ActionIncrement::Initialize(WorldState& worldState)
+	{
+		Bind();
+
+		Entity::Initialize(worldState);
+	}
+
+	void ActionIncrement::Update(WorldState& worldState)
+	{
+		if (!IsBound()) Bind();
+
+		if (mBatched && worldState.World)
+		{
+			worldState.World->GetIncrementBatch().Add(*this);
+		}
+		else if (mTarget != nullptr)
 		{
-			operand->Get<int>() += mIncrementStep;
+			mTarget->Get<int>() += mIncrementStep;
 		}
 	}
 
@@ -51,4 +146,13 @@ namespace Library
 		oss << Name() << " (ActionIncrement)";
 		return oss.str();
 	}
-}
\ No newline at end of file
+
+	void ActionIncrement::ResetBinding()
+	{
+		mTarget = nullptr;
+		mBoundLineage.Clear();
+		mBoundOperand.clear();
+		mIsBatchQueued = false;
+		++mBindingVersion;
+	}
+}
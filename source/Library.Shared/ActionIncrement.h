@@ -11,10 +11,17 @@ namespace Library
 	/// <summary>
 	/// Represents an Action for incrementing an integer Attribute.
 	/// </summary>
+	/// <remarks>
+	/// The operand name is bound once, on Initialize or on the first Update, to the integer Datum it resolves to.
+	/// The binding is redone automatically when the operand name changes, or the Scope hierarchy the operand is searched in changes structure, as tracked by a Scope::Lineage.
+	/// An operand that does not resolve to an integer is searched for again on every Update, so that it is found once added.
+	/// </remarks>
 	class ActionIncrement final : public Entity
 	{
 		RTTI_DECLARATIONS(ActionIncrement, Entity)
 
+		friend class IncrementBatch;
+
 #pragma region Type Definitions, Constants
 	public:
 		/// <summary>
@@ -27,6 +34,15 @@ namespace Library
 		/// </summary>
 		inline static const std::string IncrementStepKey = "IncrementStep";
 
+		/// <summary>
+		/// Key for the name of the integer Attribute selecting batched application.
+		/// When non-zero within a World, the increment is applied by the IncrementBatch of the World at the end of its Update,
+		/// summed with every other batched increment bound to the same Datum, instead of during the Update of the ActionIncrement.
+		/// Every Update counts, including several within a frame, but the Datum only changes at the end of the frame,
+		/// so an increment that a loop condition depends on, as within an ActionListWhile, must not be batched.
+		/// </summary>
+		inline static const std::string BatchedKey = "Batched";
+
 	public:
 		/// <summary>
 		/// Getter for the class TypeInfo, used for registration with the TypeManager.
@@ -50,27 +66,27 @@ namespace Library
 		/// Copy constructor.
 		/// </summary>
 		/// <param name="rhs">ActionIncrement to be copied.</param>
-		ActionIncrement(const ActionIncrement& rhs) = default;
+		ActionIncrement(const ActionIncrement& rhs);
 
 		/// <summary>
 		/// Copy assignment operator.
 		/// </summary>
 		/// <param name="rhs">ActionIncrement to be copied.</param>
 		/// <returns>Newly copied into left hand side ActionIncrement.</returns>
-		ActionIncrement& operator=(const ActionIncrement& rhs) = default;
+		ActionIncrement& operator=(const ActionIncrement& rhs);
 
 		/// <summary>
 		/// Move constructor.
 		/// </summary>
 		/// <param name="rhs">ActionIncrement to be moved.</param>
-		ActionIncrement(ActionIncrement&& rhs) noexcept = default;
+		ActionIncrement(ActionIncrement&& rhs) noexcept;
 
 		/// <summary>
 		/// Move assignment operator.
 		/// </summary>
 		/// <param name="rhs">ActionIncrement to be moved.</param>
 		/// <returns>Newly moved into left hand side ActionIncrement.</returns>
-		ActionIncrement& operator=(ActionIncrement&& rhs) noexcept = default;
+		ActionIncrement& operator=(ActionIncrement&& rhs) noexcept;
 #pragma endregion Special Members
 
 #pragma region Virtual Copy Constructor
@@ -82,12 +98,69 @@ namespace Library
 		virtual gsl::owner<Scope*> Clone() const override;
 #pragma endregion Virtual Copy Constructor
 
+#pragma region Accessors
+	public:
+		/// <summary>
+		/// Gets the name of the integer Attribute to increment.
+		/// </summary>
+		/// <returns>Name of the operand.</returns>
+		const std::string& Operand() const;
+
+		/// <summary>
+		/// Gets the integer Datum the operand is bound to.
+		/// </summary>
+		/// <returns>Pointer to the bound Datum, or null when unbound or the operand does not resolve to an integer.</returns>
+		Data* Target() const;
+
+		/// <summary>
+		/// Gets whether the operand is bound, and the binding reflects the current operand name and Scope hierarchy.
+		/// </summary>
+		/// <returns>True when bound. Otherwise, false.</returns>
+		bool IsBound() const;
+
+		/// <summary>
+		/// Gets whether the increment is applied by the IncrementBatch of its World.
+		/// </summary>
+		/// <returns>True when batched. Otherwise, false.</returns>
+		bool IsBatched() const;
+#pragma endregion Accessors
+
+#pragma region Modifiers
+	public:
+		/// <summary>
+		/// Sets the name of the integer Attribute to increment, discarding the current binding.
+		/// </summary>
+		/// <param name="operand">Name of the operand.</param>
+		void SetOperand(std::string operand);
+
+		/// <summary>
+		/// Sets whether the increment is applied by the IncrementBatch of its World.
+		/// </summary>
+		/// <param name="batched">True to batch the increment.</param>
+		void SetBatched(const bool batched);
+
+		/// <summary>
+		/// Binds the operand name to the integer Datum it resolves to within the Scope hierarchy of the ActionIncrement.
+		/// Leaves the ActionIncrement unbound when the operand does not resolve to an integer.
+		/// </summary>
+		void Bind();
+#pragma endregion Modifiers
+
 #pragma region Game Loop
 	public:
+		/// <summary>
+		/// Binds the operand, so that a missing operand is found before the first Update.
+		/// </summary>
+		/// <param name="worldState">WorldState context for the current processing step.</param>
+		virtual void Initialize(WorldState& worldState) override;
+
 		/// <summary>
 		/// Virtual update method called by the containing object.
+		/// Binds the operand if needed, then increments the bound Datum.
+		/// A batched increment within a World is instead queued with the IncrementBatch of the World, for application at the end of the World's Update.
 		/// </summary>
-		virtual void Update(WorldState&) override;
+		/// <param name="worldState">WorldState context for the current processing step.</param>
+		virtual void Update(WorldState& worldState) override;
 #pragma endregion Game Loop
 
 #pragma region RTTI Overrides
@@ -99,7 +172,47 @@ namespace Library
 		virtual std::string ToString() const override;
 #pragma endregion RTTI Overrides
 
+#pragma region Helper Methods
+	private:
+		/// <summary>
+		/// Discards the binding, invalidating any queued IncrementBatch application.
+		/// </summary>
+		void ResetBinding();
+#pragma endregion Helper Methods
+
 #pragma region Data Members
+	private:
+		/// <summary>
+		/// Integer Datum the operand is bound to.
+		/// </summary>
+		Data* mTarget{ nullptr };
+
+		/// <summary>
+		/// Lineage of the ActionIncrement at the time of binding, empty when unbound.
+		/// </summary>
+		Lineage mBoundLineage;
+
+		/// <summary>
+		/// Operand name at the time of binding.
+		/// </summary>
+		std::string mBoundOperand;
+
+		/// <summary>
+		/// Incremented whenever the binding changes, so that an IncrementBatch can detect stale queued instances.
+		/// </summary>
+		std::uint32_t mBindingVersion{ 0 };
+
+		/// <summary>
+		/// Whether the binding is queued with an IncrementBatch for its next application.
+		/// </summary>
+		bool mIsBatchQueued{ false };
+
+		/// <summary>
+		/// Index of the queued binding within its IncrementBatch target, while queued.
+		/// </summary>
+		std::size_t mBatchIndex{ 0 };
+
+#pragma region Prescribed Attributes
 	private:
 		/// <summary>
 		/// Name for the integer Attribute to increment.
@@ -110,6 +223,12 @@ namespace Library
 		/// Amount to increment the integer Attribute.
 		/// </summary>
 		int mIncrementStep{ 1 };
+
+		/// <summary>
+		/// Whether the increment is applied by the IncrementBatch of its World.
+		/// </summary>
+		int mBatched{ 0 };
+#pragma endregion Prescribed Attributes
 #pragma endregion Data Members
 	};
 
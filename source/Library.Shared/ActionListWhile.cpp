@@ -5,8 +5,14 @@
 // Header
 #include "ActionListWhile.h"
 
+// Standard
+#include <chrono>
+
 // First Party
 #include "Entity.h"
+#include "Profiler.h"
+#include "StopWatch.h"
+#include "WorldState.h"
 #pragma endregion Includes
 
 namespace Library
@@ -16,7 +22,11 @@ namespace Library
 		static const TypeManager::TypeInfo typeInfo
 		{
 			{
-				{ ConditionKey, Types::Integer, false, 1, offsetof(ActionListWhile, mCondition) }
+				{ ConditionKey, Types::Integer, false, 1, offsetof(ActionListWhile, mCondition) },
+				{ MaxIterationsKey, Types::Integer, false, 1, offsetof(ActionListWhile, mMaxIterations) },
+				{ BudgetKey, Types::Float, false, 1, offsetof(ActionListWhile, mBudget) },
+				{ IterationsKey, Types::Integer, false, 1, offsetof(ActionListWhile, mIterations) },
+				{ OverrunsKey, Types::Integer, false, 1, offsetof(ActionListWhile, mOverruns) }
 			},
 
 			Entity::TypeIdClass()
@@ -34,11 +44,77 @@ namespace Library
 		return new ActionListWhile(*this);
 	}
 
+	int ActionListWhile::Iterations() const
+	{
+		return mIterations;
+	}
+
+	int ActionListWhile::Overruns() const
+	{
+		return mOverruns;
+	}
+
+	bool ActionListWhile::IsSuspended() const
+	{
+		return mResumeIndex != 0;
+	}
+
 	void ActionListWhile::Update(WorldState& worldState)
 	{
-		while (mCondition)
+		mIterations = 0;
+
+		if (!Enabled() || (!mCondition && mResumeIndex == 0)) return;
+
+		const bool hasBudget = mBudget > 0.0f;
+		const std::chrono::duration<float, std::milli> budget(mBudget);
+
+		StopWatch stopWatch;
+		if (hasBudget) stopWatch.Start();
+
+		const auto isOverBudget = [&hasBudget, &budget, &stopWatch]
+		{
+			return hasBudget && stopWatch.Split() >= budget;
+		};
+
+		while (mResumeIndex != 0 || mCondition)
 		{
-			Entity::Update(worldState);
+			if (mMaxIterations > 0 && mIterations >= mMaxIterations)
+			{
+				YieldToNextFrame();
+				return;
+			}
+
+			{
+				PROFILE_SCOPE("ActionListWhile::Iteration");
+
+				mResumeIndex = ForEachActiveChildFrom(mResumeIndex, [&worldState, &isOverBudget](Entity& entity)
+				{
+					PROFILE_SCOPE(entity.TypeNameInstance());
+
+					worldState.Entity = &entity;
+					worldState.Entity->Update(worldState);
+
+					return !isOverBudget();
+				});
+			}
+
+			worldState.Entity = nullptr;
+
+			// Pending children are only applied between iterations, so that a suspended iteration resumes against the same schedule.
+			if (mResumeIndex != 0)
+			{
+				YieldToNextFrame();
+				return;
+			}
+
+			++mIterations;
+			UpdatePendingChildren();
+
+			if (mCondition && isOverBudget())
+			{
+				YieldToNextFrame();
+				return;
+			}
 		}
 	}
 
@@ -48,4 +124,11 @@ namespace Library
 		oss << Name() << " (ActionListWhile)";
 		return oss.str();
 	}
-}
\ No newline at end of file
+
+	void ActionListWhile::YieldToNextFrame()
+	{
+		PROFILE_SCOPE("ActionListWhile::Overrun");
+
+		++mOverruns;
+	}
+}
@@ -11,6 +11,11 @@ namespace Library
 	/// <summary>
 	/// Represents an Action for looping while a condition is true.
 	/// </summary>
+	/// <remarks>
+	/// Each Update runs at most MaxIterations iterations, and stops once Budget milliseconds have elapsed.
+	/// A loop that hits either limit yields, counting an overrun, and resumes on the next Update from the child it stopped at,
+	/// so a condition that is never cleared can no longer hang the frame.
+	/// </remarks>
 	class ActionListWhile final : public Entity
 	{
 		RTTI_DECLARATIONS(ActionListWhile, Entity)
@@ -22,6 +27,31 @@ namespace Library
 		/// </summary>
 		inline static const std::string ConditionKey = "Condition";
 
+		/// <summary>
+		/// Key for the maximum number of iterations run per Update. Zero or less disables the cap.
+		/// </summary>
+		inline static const std::string MaxIterationsKey = "MaxIterations";
+
+		/// <summary>
+		/// Key for the time budget per Update, in milliseconds. Zero or less disables the budget.
+		/// </summary>
+		inline static const std::string BudgetKey = "Budget";
+
+		/// <summary>
+		/// Key for the number of iterations completed during the last Update.
+		/// </summary>
+		inline static const std::string IterationsKey = "Iterations";
+
+		/// <summary>
+		/// Key for the number of Updates that yielded before the loop finished.
+		/// </summary>
+		inline static const std::string OverrunsKey = "Overruns";
+
+		/// <summary>
+		/// Default maximum number of iterations run per Update.
+		/// </summary>
+		static constexpr int DefaultMaxIterations = 1000;
+
 	public:
 		/// <summary>
 		/// Getter for the class TypeInfo, used for registration with the TypeManager.
@@ -77,10 +107,32 @@ namespace Library
 		virtual gsl::owner<Scope*> Clone() const override;
 #pragma endregion Virtual Copy Constructor
 
+#pragma region Accessors
+	public:
+		/// <summary>
+		/// Gets the number of iterations completed during the last Update.
+		/// </summary>
+		/// <returns>Number of iterations.</returns>
+		int Iterations() const;
+
+		/// <summary>
+		/// Gets the number of Updates that yielded, due to the iteration cap or time budget, before the loop finished.
+		/// </summary>
+		/// <returns>Number of overruns.</returns>
+		int Overruns() const;
+
+		/// <summary>
+		/// Gets whether the loop yielded part way through an iteration, and will resume from a later child on the next Update.
+		/// </summary>
+		/// <returns>True when suspended mid iteration. Otherwise, false.</returns>
+		bool IsSuspended() const;
+#pragma endregion Accessors
+
 #pragma region Game Loop
 	public:
 		/// <summary>
 		/// Virtual update method called by the containing object.
+		/// Iterates while the condition is not zero, until the iteration cap or time budget is reached.
 		/// </summary>
 		/// <param name="worldState">WorldState context for the current processing step.</param>
 		virtual void Update(WorldState& worldState) override;
@@ -95,12 +147,45 @@ namespace Library
 		virtual std::string ToString() const override;
 #pragma endregion RTTI Overrides
 
+#pragma region Helper Methods
+	private:
+		/// <summary>
+		/// Records that the loop yielded before finishing, to resume on the next Update. Not named Yield, which WinBase.h defines as a macro.
+		/// </summary>
+		void YieldToNextFrame();
+#pragma endregion Helper Methods
+
 #pragma region Data Members
 	private:
 		/// <summary>
 		/// Condition determining whether the loop runs. Runs while condition is not zero.
 		/// </summary>
 		int mCondition{ 0 };
+
+		/// <summary>
+		/// Maximum number of iterations run per Update.
+		/// </summary>
+		int mMaxIterations{ DefaultMaxIterations };
+
+		/// <summary>
+		/// Time budget per Update, in milliseconds.
+		/// </summary>
+		float mBudget{ 0.0f };
+
+		/// <summary>
+		/// Number of iterations completed during the last Update.
+		/// </summary>
+		int mIterations{ 0 };
+
+		/// <summary>
+		/// Number of Updates that yielded before the loop finished.
+		/// </summary>
+		int mOverruns{ 0 };
+
+		/// <summary>
+		/// Index into the update schedule of the child to resume from. Zero when not suspended mid iteration.
+		/// </summary>
+		std::size_t mResumeIndex{ 0 };
 #pragma endregion Data Members
 	};
 
@@ -0,0 +1,180 @@
+#pragma region Includes
+// Pre-compiled Header
+#include "pch.h"
+
+// Header
+#include "ActionSequence.h"
+
+// First Party
+#include "Profiler.h"
+#include "WorldState.h"
+#pragma endregion Includes
+
+namespace Library
+{
+	const TypeManager::TypeInfo& ActionSequence::TypeInfo()
+	{
+		static const TypeManager::TypeInfo typeInfo
+		{
+			{
+				{ StepsKey, Types::String, true, 0, 0 },
+			},
+
+			Entity::TypeIdClass()
+		};
+
+		return typeInfo;
+	}
+
+	ActionSequence::ActionSequence(std::string name) : Entity(TypeIdClass(), std::move(name))
+	{
+	}
+
+	ActionSequence::ActionSequence(const ActionSequence& rhs) : Entity(rhs),
+		mCurrentStep(rhs.mCurrentStep)
+	{
+	}
+
+	ActionSequence& ActionSequence::operator=(const ActionSequence& rhs)
+	{
+		if (this != &rhs)
+		{
+			Entity::operator=(rhs);
+			mSteps.Clear();
+			mHasSteps = false;
+			mCurrentStep = rhs.mCurrentStep;
+		}
+
+		return *this;
+	}
+
+	gsl::owner<Scope*> ActionSequence::Clone() const
+	{
+		return new ActionSequence(*this);
+	}
+
+	std::size_t ActionSequence::CurrentStep() const
+	{
+		return mCurrentStep;
+	}
+
+	void ActionSequence::Update(WorldState& worldState)
+	{
+		if (!Enabled()) return;
+
+		RefreshSteps();
+
+		while (mCurrentStep < mSteps.Size())
+		{
+			Entity* stepPtr = FindChild(mSteps[mCurrentStep]);
+
+			if (stepPtr == nullptr || !stepPtr->Enabled())
+			{
+				++mCurrentStep;
+				continue;
+			}
+
+			Entity& step = *stepPtr;
+
+			if (!step.IsSleeping())
+			{
+				PROFILE_SCOPE(step.TypeNameInstance());
+
+				worldState.Entity = &step;
+				step.Update(worldState);
+				worldState.Entity = nullptr;
+			}
+
+			if (step.IsSleeping())
+			{
+				Sleep();
+				break;
+			}
+
+			++mCurrentStep;
+		}
+
+		if (mCurrentStep >= mSteps.Size())
+		{
+			mCurrentStep = 0;
+		}
+
+		UpdatePendingChildren();
+	}
+
+	void ActionSequence::ChildWoken(Entity& child)
+	{
+		if (!IsSleeping()) return;
+
+		RefreshSteps();
+
+		if (mCurrentStep < mSteps.Size() && FindChild(mSteps[mCurrentStep]) == &child)
+		{
+			Wake();
+		}
+	}
+
+	void ActionSequence::RefreshSteps()
+	{
+		const Data& stepNames = *Find(StepsKey);
+		const bool namesChanged = mHasSteps && stepNames != mStepNames;
+
+		if (mHasSteps && mStepsVersion == ChildSetVersion() && !namesChanged) return;
+
+		// Children keep their relative order and new ones are added last, so the current step, or the first one
+		// after it when removed, follows every surviving earlier step. A reordered script starts over instead.
+		std::size_t currentStep = mCurrentStep;
+
+		if (namesChanged)
+		{
+			currentStep = 0;
+		}
+		else if (mHasSteps)
+		{
+			currentStep = 0;
+
+			for (std::size_t i = 0; i < mCurrentStep && i < mSteps.Size(); ++i)
+			{
+				if (FindChild(mSteps[i]) != nullptr) ++currentStep;
+			}
+		}
+
+		mSteps.Clear();
+
+		const ActionSequence& self = *this;
+
+		if (stepNames.IsEmpty())
+		{
+			mSteps.Reserve(ChildCount());
+
+			self.ForEachChild([this](const Entity& child)
+			{
+				mSteps.EmplaceBack(GetChildHandle(child));
+			});
+		}
+		else
+		{
+			mSteps.Reserve(stepNames.Size());
+
+			for (std::size_t i = 0; i < stepNames.Size(); ++i)
+			{
+				for (const Entity* child : self.FindChildArray(stepNames.Get<std::string>(i)))
+				{
+					mSteps.EmplaceBack(GetChildHandle(*child));
+				}
+			}
+		}
+
+		mStepNames = stepNames;
+		mCurrentStep = currentStep;
+		mStepsVersion = ChildSetVersion();
+		mHasSteps = true;
+	}
+
+	std::string ActionSequence::ToString() const
+	{
+		std::ostringstream oss;
+		oss << Name() << " (ActionSequence)";
+		return oss.str();
+	}
+}
@@ -0,0 +1,170 @@
+#pragma once
+
+#pragma region Includes
+// First Party
+#include "Entity.h"
+#include "Factory.h"
+#pragma endregion Includes
+
+namespace Library
+{
+	/// <summary>
+	/// Represents an Action list that runs its children one after another, as steps of a script.
+	/// </summary>
+	/// <remarks>
+	/// Each Update runs steps in order, until a step goes to sleep during its Update, e.g. an ActionWait or ActionWaitForEvent.
+	/// The ActionSequence then goes to sleep as well, costing nothing until that step is woken, and resumes from that step on its next Update.
+	/// Once every step has completed, the ActionSequence starts over on its next Update.
+	/// Steps are tracked by handle, so removing or adding steps while the sequence is underway neither skips nor repeats a step.
+	/// Steps run in the order of the names listed in the Steps Attribute, or in child order when it is empty.
+	/// Children parsed from JSON are added in the order the parser visits their keys, which is not necessarily the order they are written in,
+	/// so scripts loaded from JSON list their steps explicitly.
+	/// </remarks>
+	class ActionSequence final : public Entity
+	{
+		RTTI_DECLARATIONS(ActionSequence, Entity)
+
+#pragma region Static Members
+	public:
+		/// <summary>
+		/// Key for the Steps Attribute, naming the child Entity objects run as steps, in order.
+		/// Children sharing a name run in child order, and children not named are not run.
+		/// </summary>
+		inline static const std::string StepsKey = "Steps";
+
+	public:
+		/// <summary>
+		/// Getter for the class TypeInfo, used for registration with the TypeManager.
+		/// </summary>
+		static const TypeManager::TypeInfo& TypeInfo();
+#pragma endregion Static Members
+
+#pragma region Special Members
+	public:
+		/// <summary>
+		/// Default constructor.
+		/// </summary>
+		explicit ActionSequence(std::string name=std::string());
+
+		/// <summary>
+		/// Default destructor.
+		/// </summary>
+		~ActionSequence() = default;
+
+		/// <summary>
+		/// Copy constructor.
+		/// </summary>
+		/// <param name="rhs">ActionSequence to be copied.</param>
+		ActionSequence(const ActionSequence& rhs);
+
+		/// <summary>
+		/// Copy assignment operator.
+		/// </summary>
+		/// <param name="rhs">ActionSequence to be copied.</param>
+		/// <returns>Newly copied into left hand side ActionSequence.</returns>
+		ActionSequence& operator=(const ActionSequence& rhs);
+
+		/// <summary>
+		/// Move constructor.
+		/// </summary>
+		/// <param name="rhs">ActionSequence to be moved.</param>
+		ActionSequence(ActionSequence&& rhs) noexcept = default;
+
+		/// <summary>
+		/// Move assignment operator.
+		/// </summary>
+		/// <param name="rhs">ActionSequence to be moved.</param>
+		/// <returns>Newly moved into left hand side ActionSequence.</returns>
+		ActionSequence& operator=(ActionSequence&& rhs) noexcept = default;
+#pragma endregion Special Members
+
+#pragma region Virtual Copy Constructor
+	public:
+		/// <summary>
+		/// Virtual copy constructor.
+		/// </summary>
+		/// <returns>Owning pointer to a newly heap allocated copy of the ActionSequence.</returns>
+		virtual gsl::owner<Scope*> Clone() const override;
+#pragma endregion Virtual Copy Constructor
+
+#pragma region Accessors
+	public:
+		/// <summary>
+		/// Gets the index of the step the ActionSequence runs next, as of its last Update.
+		/// </summary>
+		/// <returns>Index of the current step.</returns>
+		std::size_t CurrentStep() const;
+#pragma endregion Accessors
+
+#pragma region Game Loop
+	public:
+		/// <summary>
+		/// Virtual update method called by the containing object.
+		/// Runs steps from the current one, until one goes to sleep or every step has completed.
+		/// </summary>
+		/// <param name="worldState">WorldState context for the current processing step.</param>
+		virtual void Update(WorldState& worldState) override;
+
+	protected:
+		/// <summary>
+		/// Wakes the ActionSequence when the step it is sleeping on is woken.
+		/// </summary>
+		/// <param name="child">Child Entity that was woken.</param>
+		virtual void ChildWoken(Entity& child) override;
+#pragma endregion Game Loop
+
+#pragma region RTTI Overrides
+	public:
+		/// <summary>
+		/// Virtual override for representing the Action as a std::string.
+		/// </summary>
+		/// <returns></returns>
+		virtual std::string ToString() const override;
+#pragma endregion RTTI Overrides
+
+#pragma region Helper Methods
+	private:
+		/// <summary>
+		/// Rebuilds the step list after children were added or removed, keeping the current step,
+		/// or moving to the first step after it when it was removed.
+		/// Restarts from the first step when the Steps Attribute was edited.
+		/// </summary>
+		void RefreshSteps();
+#pragma endregion Helper Methods
+
+#pragma region Data Members
+	private:
+		/// <summary>
+		/// Handles of the steps, in the order they run.
+		/// </summary>
+		Vector<ChildHandle> mSteps{ Vector<ChildHandle>::EqualityFunctor() };
+
+		/// <summary>
+		/// Copy of the Steps Attribute the step list was built for.
+		/// </summary>
+		Data mStepNames;
+
+		/// <summary>
+		/// Child set version the step list was built for.
+		/// </summary>
+		std::uint64_t mStepsVersion{ 0 };
+
+		/// <summary>
+		/// Whether the step list refers to the children of this ActionSequence, i.e. it is not yet to be built after a construction or copy.
+		/// </summary>
+		bool mHasSteps{ false };
+
+		/// <summary>
+		/// Index of the step the ActionSequence runs next.
+		/// </summary>
+		std::size_t mCurrentStep{ 0 };
+#pragma endregion Data Members
+	};
+
+#pragma region Factory
+	/// <summary>
+	/// ActionSequenceFactory class declaration.
+	/// </summary>
+	ConcreteFactory(ActionSequence, Entity)
+#pragma endregion Factory
+}
@@ -0,0 +1,66 @@
+#pragma region Includes
+// Pre-compiled Header
+#include "pch.h"
+
+// Header
+#include "ActionWait.h"
+
+// Standard
+#include <chrono>
+
+// First Party
+#include "WorldState.h"
+#pragma endregion Includes
+
+namespace Library
+{
+	const TypeManager::TypeInfo& ActionWait::TypeInfo()
+	{
+		static const TypeManager::TypeInfo typeInfo
+		{
+			{
+				{ DurationKey, Types::Integer, false, 1, offsetof(ActionWait, mDuration) }
+			},
+
+			Entity::TypeIdClass()
+		};
+
+		return typeInfo;
+	}
+
+	ActionWait::ActionWait(std::string name, const int duration) : Entity(TypeIdClass(), std::move(name)),
+		mDuration(duration)
+	{
+	}
+
+	gsl::owner<Scope*> ActionWait::Clone() const
+	{
+		return new ActionWait(*this);
+	}
+
+	bool ActionWait::IsWaiting() const
+	{
+		return mIsWaiting;
+	}
+
+	void ActionWait::Update(WorldState& worldState)
+	{
+		if (mIsWaiting)
+		{
+			mIsWaiting = false;
+			return;
+		}
+
+		if (mDuration <= 0) return;
+
+		SleepFor(worldState, std::chrono::milliseconds(mDuration));
+		mIsWaiting = true;
+	}
+
+	std::string ActionWait::ToString() const
+	{
+		std::ostringstream oss;
+		oss << Name() << " (ActionWait)";
+		return oss.str();
+	}
+}
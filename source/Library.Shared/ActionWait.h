@@ -0,0 +1,133 @@
+#pragma once
+
+#pragma region Includes
+// First Party
+#include "Entity.h"
+#include "Factory.h"
+#pragma endregion Includes
+
+namespace Library
+{
+	/// <summary>
+	/// Represents a latent Action that waits for an amount of game time to pass.
+	/// </summary>
+	/// <remarks>
+	/// The first Update puts the ActionWait to sleep, scheduling a wake with the World. While asleep it is off the update schedule of its parent and costs nothing.
+	/// The Update after it wakes completes the wait, so that an enclosing ActionSequence moves on to its next step.
+	/// </remarks>
+	class ActionWait final : public Entity
+	{
+		RTTI_DECLARATIONS(ActionWait, Entity)
+
+#pragma region Static Members
+	public:
+		/// <summary>
+		/// Key for the Duration Attribute used to specify how long in milliseconds to wait.
+		/// </summary>
+		inline static const std::string DurationKey = "Duration";
+
+	public:
+		/// <summary>
+		/// Getter for the class TypeInfo, used for registration with the TypeManager.
+		/// </summary>
+		static const TypeManager::TypeInfo& TypeInfo();
+#pragma endregion Static Members
+
+#pragma region Special Members
+	public:
+		/// <summary>
+		/// Default constructor.
+		/// </summary>
+		explicit ActionWait(std::string name=std::string(), const int duration=0);
+
+		/// <summary>
+		/// Default destructor.
+		/// </summary>
+		~ActionWait() = default;
+
+		/// <summary>
+		/// Copy constructor.
+		/// </summary>
+		/// <param name="rhs">ActionWait to be copied.</param>
+		ActionWait(const ActionWait& rhs) = default;
+
+		/// <summary>
+		/// Copy assignment operator.
+		/// </summary>
+		/// <param name="rhs">ActionWait to be copied.</param>
+		/// <returns>Newly copied into left hand side ActionWait.</returns>
+		ActionWait& operator=(const ActionWait& rhs) = default;
+
+		/// <summary>
+		/// Move constructor.
+		/// </summary>
+		/// <param name="rhs">ActionWait to be moved.</param>
+		ActionWait(ActionWait&& rhs) noexcept = default;
+
+		/// <summary>
+		/// Move assignment operator.
+		/// </summary>
+		/// <param name="rhs">ActionWait to be moved.</param>
+		/// <returns>Newly moved into left hand side ActionWait.</returns>
+		ActionWait& operator=(ActionWait&& rhs) noexcept = default;
+#pragma endregion Special Members
+
+#pragma region Virtual Copy Constructor
+	public:
+		/// <summary>
+		/// Virtual copy constructor.
+		/// </summary>
+		/// <returns>Owning pointer to a newly heap allocated copy of the ActionWait.</returns>
+		virtual gsl::owner<Scope*> Clone() const override;
+#pragma endregion Virtual Copy Constructor
+
+#pragma region Accessors
+	public:
+		/// <summary>
+		/// Gets whether the ActionWait has started waiting and not yet completed.
+		/// </summary>
+		/// <returns>True when waiting. Otherwise, false.</returns>
+		bool IsWaiting() const;
+#pragma endregion Accessors
+
+#pragma region Game Loop
+	public:
+		/// <summary>
+		/// Virtual update method called by the containing object.
+		/// Starts the wait by sleeping for the Duration, or completes it once woken.
+		/// </summary>
+		/// <param name="worldState">WorldState context for the current processing step.</param>
+		/// <exception cref="std::runtime_error">WorldState has no World to schedule the wake.</exception>
+		virtual void Update(WorldState& worldState) override;
+#pragma endregion Game Loop
+
+#pragma region RTTI Overrides
+	public:
+		/// <summary>
+		/// Virtual override for representing the Action as a std::string.
+		/// </summary>
+		/// <returns></returns>
+		virtual std::string ToString() const override;
+#pragma endregion RTTI Overrides
+
+#pragma region Data Members
+	private:
+		/// <summary>
+		/// Game time to wait for, in milliseconds.
+		/// </summary>
+		int mDuration{ 0 };
+
+		/// <summary>
+		/// Represents whether the wait has started and not yet completed.
+		/// </summary>
+		bool mIsWaiting{ false };
+#pragma endregion Data Members
+	};
+
+#pragma region Factory
+	/// <summary>
+	/// ActionWaitFactory class declaration.
+	/// </summary>
+	ConcreteFactory(ActionWait, Entity)
+#pragma endregion Factory
+}
@@ -0,0 +1,135 @@
+#pragma region Includes
+// Pre-compiled Header
+#include "pch.h"
+
+// Header
+#include "ActionWaitForEvent.h"
+
+// Standard
+#include <iostream>
+
+// First Party
+#include "EventMessageAttributed.h"
+#include "EventPublisher.h"
+#include "Event.h"
+#pragma endregion Includes
+
+using namespace std::string_literals;
+
+namespace Library
+{
+#pragma region Static Members
+	const TypeManager::TypeInfo& ActionWaitForEvent::TypeInfo()
+	{
+		static const TypeManager::TypeInfo typeInfo
+		{
+			{
+				{ SubtypeKey, Types::String, false, 1, offsetof(ActionWaitForEvent, mSubtype) }
+			},
+
+			Entity::TypeIdClass()
+		};
+
+		return typeInfo;
+	}
+#pragma endregion Static Members
+
+#pragma region Special Members
+	ActionWaitForEvent::ActionWaitForEvent(std::string name, std::string subtype) : Entity(TypeIdClass(), std::move(name)),
+		mSubtype(std::move(subtype))
+	{
+		Event<EventMessageAttributed>::Subscribe(*this);
+	}
+
+	ActionWaitForEvent::~ActionWaitForEvent()
+	{
+		try
+		{
+			Event<EventMessageAttributed>::Unsubscribe(*this);
+		}
+		catch (...)
+		{
+			std::cerr	<< "ActionWaitForEvent instance unsubscribe from Event<EventMessageAttributed> on destruction failed."s << std::endl;
+		}
+	}
+
+	ActionWaitForEvent::ActionWaitForEvent(const ActionWaitForEvent& rhs) : Entity(rhs), IEventSubscriber(rhs),
+		mSubtype(rhs.mSubtype), mIsWaiting(rhs.mIsWaiting), mIsTriggered(rhs.mIsTriggered)
+	{
+		Event<EventMessageAttributed>::Subscribe(*this);
+	}
+
+	ActionWaitForEvent::ActionWaitForEvent(ActionWaitForEvent&& rhs) noexcept : Entity(std::move(rhs)), IEventSubscriber(std::move(rhs)),
+		mSubtype(std::move(rhs.mSubtype)), mIsWaiting(rhs.mIsWaiting), mIsTriggered(rhs.mIsTriggered)
+	{
+		try
+		{
+			Event<EventMessageAttributed>::Subscribe(*this);
+		}
+		catch (...)
+		{
+			std::cerr	<< "ActionWaitForEvent instance subscription to Event<EventMessageAttributed> failed."s << std::endl;
+		}
+	}
+#pragma endregion Special Members
+
+#pragma region Virtual Copy Constructor
+	gsl::owner<Scope*> ActionWaitForEvent::Clone() const
+	{
+		return new ActionWaitForEvent(*this);
+	}
+#pragma endregion Virtual Copy Constructor
+
+#pragma region Accessors
+	bool ActionWaitForEvent::IsWaiting() const
+	{
+		return mIsWaiting;
+	}
+#pragma endregion Accessors
+
+#pragma region Game Loop
+	void ActionWaitForEvent::Update(WorldState&)
+	{
+		if (mIsTriggered)
+		{
+			mIsTriggered = false;
+			return;
+		}
+
+		mIsWaiting = true;
+		Sleep();
+	}
+#pragma endregion Game Loop
+
+#pragma region Event Subscriber Overrides
+	void ActionWaitForEvent::Notify(EventPublisher& eventPublisher)
+	{
+		assert(eventPublisher.Is(Event<EventMessageAttributed>::TypeIdClass()));
+
+		if (!mIsWaiting) return;
+
+		const auto& message = static_cast<Event<EventMessageAttributed>*>(&eventPublisher)->Message;
+
+		if (mSubtype == message.GetSubtype())
+		{
+			mIsWaiting = false;
+			mIsTriggered = true;
+			Wake();
+		}
+	}
+
+	void ActionWaitForEvent::Retired()
+	{
+		Event<EventMessageAttributed>::Unsubscribe(*this);
+	}
+#pragma endregion Event Subscriber Overrides
+
+#pragma region RTTI Overrides
+	std::string ActionWaitForEvent::ToString() const
+	{
+		std::ostringstream oss;
+		oss << Name() << " (ActionWaitForEvent)";
+		return oss.str();
+	}
+#pragma endregion RTTI Overrides
+}
@@ -0,0 +1,157 @@
+#pragma once
+
+#pragma region Includes
+// First Party
+#include "Entity.h"
+#include "Factory.h"
+#include "IEventSubscriber.h"
+#pragma endregion Includes
+
+namespace Library
+{
+	/// <summary>
+	/// Represents a latent Action that waits for an EventMessageAttributed of a given subtype to be published.
+	/// </summary>
+	/// <remarks>
+	/// An Update puts the ActionWaitForEvent to sleep, where it stays off the update schedule of its parent until a matching Event wakes it.
+	/// The Update after it wakes completes the wait, so that an enclosing ActionSequence moves on to its next step.
+	/// Events published while it is not waiting are ignored.
+	/// </remarks>
+	class ActionWaitForEvent final : public Entity, public IEventSubscriber
+	{
+		RTTI_DECLARATIONS(ActionWaitForEvent, Entity)
+
+#pragma region Static Members
+	public:
+		/// <summary>
+		/// Key for the Subtype Attribute used to specify the EventMessageAttributed subtype to wait for.
+		/// </summary>
+		inline static const std::string SubtypeKey = "Subtype";
+
+	public:
+		/// <summary>
+		/// Getter for the class TypeInfo, used for registration with the TypeManager.
+		/// </summary>
+		static const TypeManager::TypeInfo& TypeInfo();
+#pragma endregion Static Members
+
+#pragma region Special Members
+	public:
+		/// <summary>
+		/// Default constructor.
+		/// </summary>
+		/// <param name="name">Name of the Action.</param>
+		/// <param name="subtype">EventMessageAttributed subtype to wait for.</param>
+		explicit ActionWaitForEvent(std::string name=std::string(), std::string subtype=std::string());
+
+		/// <summary>
+		/// Default destructor.
+		/// </summary>
+		virtual ~ActionWaitForEvent() override;
+
+		/// <summary>
+		/// Copy constructor.
+		/// </summary>
+		/// <param name="rhs">ActionWaitForEvent to be copied.</param>
+		ActionWaitForEvent(const ActionWaitForEvent& rhs);
+
+		/// <summary>
+		/// Copy assignment operator.
+		/// </summary>
+		/// <param name="rhs">ActionWaitForEvent to be copied.</param>
+		/// <returns>Newly copied into left hand side ActionWaitForEvent.</returns>
+		ActionWaitForEvent& operator=(const ActionWaitForEvent& rhs) = default;
+
+		/// <summary>
+		/// Move constructor.
+		/// </summary>
+		/// <param name="rhs">ActionWaitForEvent to be moved.</param>
+		ActionWaitForEvent(ActionWaitForEvent&& rhs) noexcept;
+
+		/// <summary>
+		/// Move assignment operator.
+		/// </summary>
+		/// <param name="rhs">ActionWaitForEvent to be moved.</param>
+		/// <returns>Newly moved into left hand side ActionWaitForEvent.</returns>
+		ActionWaitForEvent& operator=(ActionWaitForEvent&& rhs) noexcept = default;
+#pragma endregion Special Members
+
+#pragma region Virtual Copy Constructor
+	public:
+		/// <summary>
+		/// Virtual copy constructor.
+		/// </summary>
+		/// <returns>Owning pointer to a newly heap allocated copy of the ActionWaitForEvent.</returns>
+		virtual gsl::owner<Scope*> Clone() const override;
+#pragma endregion Virtual Copy Constructor
+
+#pragma region Accessors
+	public:
+		/// <summary>
+		/// Gets whether the ActionWaitForEvent has started waiting and not yet received a matching Event.
+		/// </summary>
+		/// <returns>True when waiting. Otherwise, false.</returns>
+		bool IsWaiting() const;
+#pragma endregion Accessors
+
+#pragma region Game Loop
+	public:
+		/// <summary>
+		/// Virtual update method called by the containing object.
+		/// Starts the wait by sleeping until a matching Event, or completes it once woken by one.
+		/// </summary>
+		/// <param name="worldState">WorldState context for the current processing step.</param>
+		virtual void Update(WorldState& worldState) override;
+#pragma endregion Game Loop
+
+#pragma region Event Subscriber Overrides
+	protected:
+		/// <summary>
+		/// Interface method called by an EventPublisher during Publish to receive the Event.
+		/// Wakes the ActionWaitForEvent when it is waiting and the Event has a matching subtype.
+		/// </summary>
+		/// <param name="eventPublisher">Reference to an Event as an EventPublisher.</param>
+		virtual void Notify(EventPublisher& eventPublisher) override;
+
+		/// <summary>
+		/// Unsubscribes from Event&lt;EventMessageAttributed&gt; once the ActionWaitForEvent is queued for destruction,
+		/// so Events published before it is deleted, possibly on another thread, no longer reach it.
+		/// </summary>
+		virtual void Retired() override;
+#pragma endregion Event Subscriber Overrides
+
+#pragma region RTTI Overrides
+	public:
+		/// <summary>
+		/// Virtual override for representing the Action as a std::string.
+		/// </summary>
+		/// <returns></returns>
+		virtual std::string ToString() const override;
+#pragma endregion RTTI Overrides
+
+#pragma region Data Members
+	private:
+		/// <summary>
+		/// EventMessageAttributed subtype to wait for.
+		/// </summary>
+		std::string mSubtype;
+
+		/// <summary>
+		/// Represents whether the wait has started and no matching Event has been received.
+		/// </summary>
+		bool mIsWaiting{ false };
+
+		/// <summary>
+		/// Represents whether a matching Event has been received, and the next Update completes the wait.
+		/// </summary>
+		bool mIsTriggered{ false };
+#pragma endregion Data Members
+	};
+
+#pragma region Factory
+	/// <summary>
+	/// ActionWaitForEventFactory class declaration.
+	/// </summary>
+	ConcreteFactory(ActionWaitForEvent, Entity)
+#pragma endregion Factory
+}
@@ -0,0 +1,192 @@
+#pragma region Includes
+// Pre-compiled Header
+#include "pch.h"
+
+// Header
+#include "AnimationBatch.h"
+
+// Standard
+#include <atomic>
+#include <cmath>
+#include <future>
+#include <thread>
+
+// First Party
+#include "AnimatorComponent.h"
+#include "AnimationClip.h"
+#include "Profiler.h"
+#pragma endregion Includes
+
+namespace Library
+{
+#pragma region Special Members
+	AnimationBatch::AnimationBatch(const std::size_t threadCount)
+	{
+		SetThreadCount(threadCount);
+	}
+#pragma endregion Special Members
+
+#pragma region Accessors
+	void AnimationBatch::SetThreadCount(const std::size_t threadCount)
+	{
+		mThreadCount = threadCount > 0 ? threadCount : std::max(std::size_t(std::thread::hardware_concurrency()), std::size_t(1));
+	}
+#pragma endregion Accessors
+
+#pragma region Modifiers
+	void AnimationBatch::Add(AnimatorComponent& animator)
+	{
+		// The index is checked against the queue, so a stale index, or one copied from another component, is never mistaken for queued.
+		if (animator.mBatchIndex < mAnimators.Size() && mAnimators[animator.mBatchIndex] == &animator) return;
+
+		animator.mBatchIndex = mAnimators.Size();
+		mAnimators.EmplaceBack(&animator);
+	}
+
+	void AnimationBatch::Evaluate()
+	{
+		PROFILE_SCOPE("AnimationBatch::Evaluate");
+
+		// Offsets are assigned up front, so workers write disjoint ranges of the palette without synchronization.
+		std::size_t paletteSize = 0;
+
+		for (auto* animator : mAnimators)
+		{
+			animator->mPaletteOffset = paletteSize;
+			paletteSize += animator->BoneTransforms().Size();
+		}
+
+		mPalette.Resize(paletteSize);
+		Schedule();
+
+		std::atomic<std::size_t> nextAnimator{ 0 };
+
+		auto worker = [this, &nextAnimator]
+		{
+			for (std::size_t first = nextAnimator.fetch_add(ChunkSize); first < mAnimators.Size(); first = nextAnimator.fetch_add(ChunkSize))
+			{
+				const std::size_t last = std::min(first + ChunkSize, mAnimators.Size());
+
+				for (std::size_t i = first; i < last; ++i)
+				{
+					AnimatorComponent& animator = *mAnimators[i];
+
+					if (animator.mIsLodUpdateScheduled)
+					{
+						animator.mIsLodUpdateScheduled = false;
+						animator.UpdateLodPose(UpdateInterval(animator.mImportance), MaxDepth(animator.mImportance));
+					}
+					else if (animator.mImportance > 0.0f)
+					{
+						animator.InterpolateLodPose();
+					}
+
+					const auto& boneTransforms = animator.BoneTransforms();
+					if (boneTransforms.IsEmpty()) continue;
+
+					std::copy(&boneTransforms[0], &boneTransforms[0] + boneTransforms.Size(), &mPalette[animator.mPaletteOffset]);
+				}
+			}
+		};
+
+		const std::size_t workerCount = std::min(mThreadCount, (mAnimators.Size() + MinimumPerWorker - 1) / MinimumPerWorker);
+
+		Vector<std::future<void>> workers(workerCount, Vector<std::future<void>>::EqualityFunctor());
+
+		for (std::size_t i = 1; i < workerCount; ++i)
+		{
+			workers.EmplaceBack(std::async(std::launch::async, worker));
+		}
+
+		std::exception_ptr exception;
+
+		try
+		{
+			if (workerCount > 0) worker();
+		}
+		catch (...)
+		{
+			exception = std::current_exception();
+			nextAnimator = mAnimators.Size();
+		}
+
+		for (auto& future : workers)
+		{
+			try
+			{
+				future.get();
+			}
+			catch (...)
+			{
+				if (!exception) exception = std::current_exception();
+			}
+		}
+
+		mAnimators.Clear();
+
+		if (exception) std::rethrow_exception(exception);
+	}
+#pragma endregion Modifiers
+
+#pragma region Helper Methods
+	std::uint32_t AnimationBatch::UpdateInterval(const float importance)
+	{
+		if (importance >= 1.0f) return 1;
+
+		return std::min(static_cast<std::uint32_t>(std::ceil(1.0f / importance)), MaxUpdateInterval);
+	}
+
+	std::uint32_t AnimationBatch::MaxDepth(const float importance)
+	{
+		return (importance < ReducedSkeletonImportance ? ReducedSkeletonDepth : AnimationClip::AllDepths);
+	}
+
+	void AnimationBatch::Schedule()
+	{
+		mDueAnimators.Clear();
+
+		for (auto* animator : mAnimators)
+		{
+			// Frozen components keep their pose, but grow stale so they are due as soon as they thaw.
+			if (animator->mImportance <= 0.0f)
+			{
+				++animator->mFramesSinceUpdate;
+				continue;
+			}
+
+			// Due once their interval has passed, or the shorter interval of a since raised importance.
+			if (animator->mFramesSinceUpdate >= std::min(animator->mUpdateInterval, UpdateInterval(animator->mImportance)))
+			{
+				mDueAnimators.EmplaceBack(animator);
+			}
+		}
+
+		std::size_t scheduledCount = mDueAnimators.Size();
+
+		if (mBoneBudget > 0)
+		{
+			std::sort(mDueAnimators.begin(), mDueAnimators.end(), [](const AnimatorComponent* lhs, const AnimatorComponent* rhs)
+			{
+				return lhs->mImportance * lhs->mFramesSinceUpdate > rhs->mImportance * rhs->mFramesSinceUpdate;
+			});
+
+			std::size_t boneCount = 0;
+
+			for (scheduledCount = 0; scheduledCount < mDueAnimators.Size(); ++scheduledCount)
+			{
+				const std::size_t animatorBoneCount = mDueAnimators[scheduledCount]->BoneTransforms().Size();
+				if (scheduledCount > 0 && boneCount + animatorBoneCount > mBoneBudget) break;
+
+				boneCount += animatorBoneCount;
+			}
+		}
+
+		for (std::size_t i = 0; i < scheduledCount; ++i)
+		{
+			mDueAnimators[i]->mIsLodUpdateScheduled = true;
+		}
+
+		mEvaluatedCount = scheduledCount;
+	}
+#pragma endregion Helper Methods
+}
@@ -0,0 +1,230 @@
+#pragma once
+
+#pragma region Includes
+// Standard
+#include <cstdint>
+
+// Third Party
+#include <gsl/gsl>
+
+#pragma warning(disable : 26812)
+#include <glm/glm.hpp>
+#pragma warning(default : 26812)
+
+// First Party
+#include "Vector.h"
+#pragma endregion Includes
+
+namespace Library
+{
+	// Forward Declarations
+	class AnimatorComponent;
+
+	/// <summary>
+	/// Evaluates the poses of many AnimatorComponent instances together, across a pool of worker threads.
+	/// </summary>
+	/// <remarks>
+	/// Playing components register themselves during Update, and are evaluated once the Entity traversal is complete.
+	/// Components are independent, so each worker claims chunks of them until none remain.
+	/// Bone transforms are gathered into a single contiguous skinning palette, with each component's offset recorded on the component.
+	/// The batch also schedules animation level of detail: each component's importance sets how often its pose is evaluated and how much of
+	/// its skeleton is sampled, and an optional bone budget bounds the evaluation work of a frame.
+	/// </remarks>
+	class AnimationBatch final
+	{
+#pragma region Type Definitions, Constants
+	public:
+		/// <summary>
+		/// Minimum number of components given to each worker, so small batches are not spread across threads for no gain.
+		/// </summary>
+		inline static constexpr std::size_t MinimumPerWorker = 16;
+
+		/// <summary>
+		/// Longest interval, in frames, between evaluations of a component.
+		/// </summary>
+		inline static constexpr std::uint32_t MaxUpdateInterval = 8;
+
+		/// <summary>
+		/// Importance below which components sample a reduced skeleton.
+		/// </summary>
+		inline static constexpr float ReducedSkeletonImportance = 0.25f;
+
+		/// <summary>
+		/// Deepest bone sampled by components with a reduced skeleton.
+		/// </summary>
+		inline static constexpr std::uint32_t ReducedSkeletonDepth = 4;
+
+	private:
+		/// <summary>
+		/// Number of components claimed by a worker at a time.
+		/// </summary>
+		inline static constexpr std::size_t ChunkSize = 4;
+#pragma endregion Type Definitions, Constants
+
+#pragma region Special Members
+	public:
+		/// <summary>
+		/// Constructor.
+		/// </summary>
+		/// <param name="threadCount">Maximum number of threads evaluating poses, including the calling thread. Zero uses the hardware concurrency.</param>
+		explicit AnimationBatch(const std::size_t threadCount=0);
+
+		/// <summary>
+		/// Default destructor.
+		/// </summary>
+		~AnimationBatch() = default;
+
+		/// <summary>
+		/// Deleted copy constructor. Components must not be evaluated by more than one batch.
+		/// </summary>
+		AnimationBatch(const AnimationBatch&) = delete;
+
+		/// <summary>
+		/// Deleted copy assignment operator. Components must not be evaluated by more than one batch.
+		/// </summary>
+		AnimationBatch& operator=(const AnimationBatch&) = delete;
+
+		/// <summary>
+		/// Move constructor.
+		/// </summary>
+		/// <param name="rhs">AnimationBatch to be moved.</param>
+		AnimationBatch(AnimationBatch&& rhs) noexcept = default;
+
+		/// <summary>
+		/// Move assignment operator.
+		/// </summary>
+		/// <param name="rhs">AnimationBatch to be moved.</param>
+		/// <returns>Newly moved into left hand side AnimationBatch.</returns>
+		AnimationBatch& operator=(AnimationBatch&& rhs) noexcept = default;
+#pragma endregion Special Members
+
+#pragma region Accessors
+	public:
+		/// <summary>
+		/// Gets the maximum number of threads evaluating poses, including the calling thread.
+		/// </summary>
+		/// <returns>Number of threads.</returns>
+		std::size_t ThreadCount() const;
+
+		/// <summary>
+		/// Sets the maximum number of threads evaluating poses, including the calling thread.
+		/// </summary>
+		/// <param name="threadCount">Number of threads. Zero uses the hardware concurrency.</param>
+		void SetThreadCount(const std::size_t threadCount);
+
+		/// <summary>
+		/// Gets the number of components awaiting evaluation.
+		/// </summary>
+		/// <returns>Number of components.</returns>
+		std::size_t Size() const;
+
+		/// <summary>
+		/// Gets whether no components await evaluation.
+		/// </summary>
+		/// <returns>True when empty. Otherwise, false.</returns>
+		bool IsEmpty() const;
+
+		/// <summary>
+		/// Gets the skinning palette written by the last evaluation.
+		/// A component's bone transforms begin at its AnimatorComponent::PaletteOffset.
+		/// </summary>
+		/// <returns>Span of bone transforms.</returns>
+		gsl::span<const glm::mat4x4> Palette() const;
+
+		/// <summary>
+		/// Gets the most bones evaluated by a single evaluation.
+		/// </summary>
+		/// <returns>Number of bones. Zero is unlimited.</returns>
+		std::size_t BoneBudget() const;
+
+		/// <summary>
+		/// Sets the most bones evaluated by a single evaluation. Components due beyond the budget are deferred, most important and stalest first,
+		/// and keep interpolating toward their last evaluation. At least one due component is always evaluated.
+		/// </summary>
+		/// <param name="boneBudget">Number of bones. Zero is unlimited.</param>
+		void SetBoneBudget(const std::size_t boneBudget);
+
+		/// <summary>
+		/// Gets the number of components whose pose was evaluated by the last evaluation. The others were interpolated or frozen.
+		/// </summary>
+		/// <returns>Number of components.</returns>
+		std::size_t EvaluatedCount() const;
+#pragma endregion Accessors
+
+#pragma region Modifiers
+	public:
+		/// <summary>
+		/// Registers an AnimatorComponent for evaluation. Components are registered for a single evaluation,
+		/// and registering a component again before then has no effect.
+		/// </summary>
+		/// <param name="animator">AnimatorComponent to be evaluated.</param>
+		void Add(AnimatorComponent& animator);
+
+		/// <summary>
+		/// Removes every registered component, without evaluating them.
+		/// </summary>
+		void Clear();
+
+		/// <summary>
+		/// Evaluates the pose of every registered component due for evaluation, interpolates the others,
+		/// writes the skinning palette, and clears the registered components.
+		/// </summary>
+		/// <exception cref="std::exception">Rethrows the first exception thrown while evaluating a pose.</exception>
+		void Evaluate();
+#pragma endregion Modifiers
+
+#pragma region Helper Methods
+	private:
+		/// <summary>
+		/// Gets the interval, in frames, between evaluations of a component of a given importance.
+		/// </summary>
+		static std::uint32_t UpdateInterval(const float importance);
+
+		/// <summary>
+		/// Gets the deepest bone sampled by a component of a given importance.
+		/// </summary>
+		static std::uint32_t MaxDepth(const float importance);
+
+		/// <summary>
+		/// Selects the registered components due for evaluation, within the bone budget, and marks them as scheduled.
+		/// </summary>
+		void Schedule();
+#pragma endregion Helper Methods
+
+#pragma region Data Members
+	private:
+		/// <summary>
+		/// Components registered for the next evaluation.
+		/// </summary>
+		Vector<AnimatorComponent*> mAnimators;
+
+		/// <summary>
+		/// Bone transforms of every component of the last evaluation, in registration order.
+		/// </summary>
+		Vector<glm::mat4x4> mPalette;
+
+		/// <summary>
+		/// Components due for evaluation, reused across evaluations.
+		/// </summary>
+		Vector<AnimatorComponent*> mDueAnimators;
+
+		/// <summary>
+		/// Most bones evaluated by a single evaluation, or zero.
+		/// </summary>
+		std::size_t mBoneBudget{ 0 };
+
+		/// <summary>
+		/// Number of components evaluated by the last evaluation.
+		/// </summary>
+		std::size_t mEvaluatedCount{ 0 };
+
+		/// <summary>
+		/// Maximum number of threads evaluating poses.
+		/// </summary>
+		std::size_t mThreadCount;
+#pragma endregion Data Members
+	};
+}
+
+// Inline File
+#include "AnimationBatch.inl"
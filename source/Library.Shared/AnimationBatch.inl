@@ -0,0 +1,51 @@
+#pragma once
+
+// Header
+#include "AnimationBatch.h"
+
+namespace Library
+{
+#pragma region Accessors
+	inline std::size_t AnimationBatch::ThreadCount() const
+	{
+		return mThreadCount;
+	}
+
+	inline std::size_t AnimationBatch::Size() const
+	{
+		return mAnimators.Size();
+	}
+
+	inline bool AnimationBatch::IsEmpty() const
+	{
+		return mAnimators.IsEmpty();
+	}
+
+	inline gsl::span<const glm::mat4x4> AnimationBatch::Palette() const
+	{
+		return mPalette.IsEmpty() ? gsl::span<const glm::mat4x4>() : gsl::span<const glm::mat4x4>(&mPalette[0], mPalette.Size());
+	}
+
+	inline std::size_t AnimationBatch::BoneBudget() const
+	{
+		return mBoneBudget;
+	}
+
+	inline void AnimationBatch::SetBoneBudget(const std::size_t boneBudget)
+	{
+		mBoneBudget = boneBudget;
+	}
+
+	inline std::size_t AnimationBatch::EvaluatedCount() const
+	{
+		return mEvaluatedCount;
+	}
+#pragma endregion Accessors
+
+#pragma region Modifiers
+	inline void AnimationBatch::Clear()
+	{
+		mAnimators.Clear();
+	}
+#pragma endregion Modifiers
+}
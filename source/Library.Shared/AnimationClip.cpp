@@ -5,13 +5,57 @@
 // Header
 #include "AnimationClip.h"
 
+// Standard
+#include <cmath>
+
 // First Party
 #include "BoneAnimation.h"
 #include "Bone.h"
 #include "StreamHelper.h"
 #include "Transform.h"
+#include "Float4.h"
 #pragma endregion Includes
 
+namespace
+{
+	using namespace Library;
+
+	/// <summary>
+	/// Keyframe pairs of four tracks, gathered into lanes.
+	/// </summary>
+	struct KeyframeLanes final
+	{
+		float Factor[4];
+		float TranslationOne[3][4];
+		float TranslationTwo[3][4];
+		float RotationOne[4][4];
+		float RotationTwo[4][4];
+		float ScaleOne[3][4];
+		float ScaleTwo[3][4];
+	};
+
+	void GatherVector(const glm::vec3& value, float (&lanes)[3][4], const std::size_t lane)
+	{
+		for (glm::length_t component = 0; component < 3; ++component)
+		{
+			lanes[component][lane] = value[component];
+		}
+	}
+
+	void GatherQuaternion(const glm::quat& value, float (&lanes)[4][4], const std::size_t lane)
+	{
+		lanes[0][lane] = value.x;
+		lanes[1][lane] = value.y;
+		lanes[2][lane] = value.z;
+		lanes[3][lane] = value.w;
+	}
+
+	glm::mat4x4 ComposeMatrix(const glm::vec3& translation, const glm::quat& rotation, const glm::vec3& scale)
+	{
+		return glm::translate(translation) * glm::mat4_cast(rotation) * glm::scale(scale);
+	}
+}
+
 namespace Library
 {
 #pragma region AnimationClipData
@@ -21,16 +65,27 @@ namespace Library
 	{
 	}
 
+#pragma endregion
+
+#pragma region BonePose
+
+	glm::mat4x4 BonePose::Matrix() const
+	{
+		return ComposeMatrix(Translation, Rotation, Scale);
+	}
+
 #pragma endregion
 
 	AnimationClip::AnimationClip(Model& model, InputStreamHelper& streamHelper)
 	{
 		Load(model, streamHelper);
+		BuildTracks();
 	}
 
 	AnimationClip::AnimationClip(AnimationClipData&& animationClipData) :
 		mData(std::move(animationClipData))
-	{		
+	{
+		BuildTracks();
 	}
 
 	const std::string& AnimationClip::Name() const
@@ -63,6 +118,16 @@ namespace Library
 		return mData.KeyframeCount;
 	}
 
+	const Vector<std::uint32_t>& AnimationClip::AnimatedBoneIndices() const
+	{
+		return mTrackBoneIndices;
+	}
+
+	bool AnimationClip::IsCompressed() const
+	{
+		return std::any_of(mTracks.begin(), mTracks.end(), [](const BoneAnimation* track) { return track->IsCompressed(); });
+	}
+
 	std::uint32_t AnimationClip::GetTransform(const float time, const Bone& bone, Transform& transform) const
 	{
 		const auto& foundBoneAnimation = mData.BoneAnimationsByBone.Find(&bone);
@@ -128,6 +193,242 @@ namespace Library
 		}
 	}
 
+	std::uint32_t AnimationClip::SamplePose(const float time, gsl::span<std::uint32_t> cursors, gsl::span<glm::mat4x4> localTransforms, const std::uint32_t maxDepth) const
+	{
+		const std::size_t trackCount = TrackCount(maxDepth);
+		std::uint32_t keyframeIndex = 0;
+
+		for (std::size_t i = 0; i < trackCount; ++i)
+		{
+			const BoneAnimation& track = *mTracks[i];
+			const std::uint32_t boneIndex = mTrackBoneIndices[i];
+
+			keyframeIndex = track.FindKeyframeIndex(time, cursors[boneIndex]);
+			localTransforms[boneIndex] = ComposeMatrix(track.Translation(keyframeIndex), track.Rotation(keyframeIndex), track.Scale(keyframeIndex));
+		}
+
+		return keyframeIndex;
+	}
+
+	template <typename TWriter>
+	void AnimationClip::SampleLanes(const float time, gsl::span<std::uint32_t> cursors, const std::size_t trackCount, TWriter writeLanes) const
+	{
+		for (std::size_t first = 0; first < trackCount; first += 4)
+		{
+			const std::size_t laneCount = std::min(trackCount - first, std::size_t(4));
+
+			// Gather each track's keyframe pair into a lane. Lanes past the last track repeat it, so every lane holds valid data.
+			KeyframeLanes lanes;
+
+			for (std::size_t lane = 0; lane < 4; ++lane)
+			{
+				const std::size_t trackIndex = first + std::min(lane, laneCount - 1);
+				const BoneAnimation& track = *mTracks[trackIndex];
+				const auto& times = track.Times();
+
+				std::uint32_t indexOne;
+				std::uint32_t indexTwo;
+				float factor = 0.0f;
+
+				if (time <= times.Front())
+				{
+					indexOne = indexTwo = 0;
+				}
+				else if (time >= times.Back())
+				{
+					indexOne = indexTwo = track.KeyframeCount() - 1;
+				}
+				else
+				{
+					indexOne = track.FindKeyframeIndex(time, cursors[mTrackBoneIndices[trackIndex]]);
+					indexTwo = indexOne + 1;
+					factor = (time - times[indexOne]) / (times[indexTwo] - times[indexOne]);
+				}
+
+				lanes.Factor[lane] = factor;
+				GatherVector(track.Translation(indexOne), lanes.TranslationOne, lane);
+				GatherVector(track.Translation(indexTwo), lanes.TranslationTwo, lane);
+				GatherQuaternion(track.Rotation(indexOne), lanes.RotationOne, lane);
+				GatherQuaternion(track.Rotation(indexTwo), lanes.RotationTwo, lane);
+				GatherVector(track.Scale(indexOne), lanes.ScaleOne, lane);
+				GatherVector(track.Scale(indexTwo), lanes.ScaleTwo, lane);
+			}
+
+			const Float4 factor = Float4::Load(lanes.Factor);
+
+			Float4 translation[3];
+			Float4 scale[3];
+
+			for (std::size_t component = 0; component < 3; ++component)
+			{
+				translation[component] = Float4::Lerp(Float4::Load(lanes.TranslationOne[component]), Float4::Load(lanes.TranslationTwo[component]), factor);
+				scale[component] = Float4::Lerp(Float4::Load(lanes.ScaleOne[component]), Float4::Load(lanes.ScaleTwo[component]), factor);
+			}
+
+			// Slerp as glm::slerp does: along the shortest path, and linearly when the rotations are nearly parallel.
+			Float4 rotationOne[4];
+			Float4 rotationTwo[4];
+			Float4 cosTheta(0.0f);
+
+			for (std::size_t component = 0; component < 4; ++component)
+			{
+				rotationOne[component] = Float4::Load(lanes.RotationOne[component]);
+				rotationTwo[component] = Float4::Load(lanes.RotationTwo[component]);
+				cosTheta = cosTheta + rotationOne[component] * rotationTwo[component];
+			}
+
+			const Float4 isOpposed = cosTheta < Float4(0.0f);
+			cosTheta = Float4::Select(isOpposed, -cosTheta, cosTheta);
+
+			for (auto& component : rotationTwo)
+			{
+				component = Float4::Select(isOpposed, -component, component);
+			}
+
+			// SSE has no trigonometry, so only the slerp weights are computed per lane.
+			float cosThetas[4];
+			float weightsOne[4];
+			float weightsTwo[4];
+			cosTheta.Store(cosThetas);
+
+			for (std::size_t lane = 0; lane < 4; ++lane)
+			{
+				const float laneFactor = lanes.Factor[lane];
+
+				if (cosThetas[lane] > 1.0f - glm::epsilon<float>())
+				{
+					weightsOne[lane] = 1.0f - laneFactor;
+					weightsTwo[lane] = laneFactor;
+				}
+				else
+				{
+					const float angle = std::acos(cosThetas[lane]);
+					const float sinAngle = std::sin(angle);
+					weightsOne[lane] = std::sin((1.0f - laneFactor) * angle) / sinAngle;
+					weightsTwo[lane] = std::sin(laneFactor * angle) / sinAngle;
+				}
+			}
+
+			const Float4 weightOne = Float4::Load(weightsOne);
+			const Float4 weightTwo = Float4::Load(weightsTwo);
+
+			const Float4 rotation[] =
+			{
+				rotationOne[0] * weightOne + rotationTwo[0] * weightTwo,
+				rotationOne[1] * weightOne + rotationTwo[1] * weightTwo,
+				rotationOne[2] * weightOne + rotationTwo[2] * weightTwo,
+				rotationOne[3] * weightOne + rotationTwo[3] * weightTwo
+			};
+
+			writeLanes(first, laneCount, translation, rotation, scale);
+		}
+	}
+
+	std::uint32_t AnimationClip::SamplePose(const float time, gsl::span<std::uint32_t> cursors, gsl::span<BonePose> poses) const
+	{
+		std::uint32_t keyframeIndex = 0;
+
+		for (std::size_t i = 0; i < mTracks.Size(); ++i)
+		{
+			const BoneAnimation& track = *mTracks[i];
+			const std::uint32_t boneIndex = mTrackBoneIndices[i];
+
+			keyframeIndex = track.FindKeyframeIndex(time, cursors[boneIndex]);
+			poses[boneIndex] = BonePose{ track.Translation(keyframeIndex), track.Rotation(keyframeIndex), track.Scale(keyframeIndex) };
+		}
+
+		return keyframeIndex;
+	}
+
+	void AnimationClip::SampleInterpolatedPose(const float time, gsl::span<std::uint32_t> cursors, gsl::span<glm::mat4x4> localTransforms, const std::uint32_t maxDepth) const
+	{
+		SampleLanes(time, cursors, TrackCount(maxDepth), [this, localTransforms](const std::size_t first, const std::size_t laneCount, const Float4 (&translation)[3], const Float4 (&rotation)[4], const Float4 (&scale)[3])
+		{
+			const Float4& x = rotation[0];
+			const Float4& y = rotation[1];
+			const Float4& z = rotation[2];
+			const Float4& w = rotation[3];
+
+			// Translation * rotation * scale, with the rotation expanded as glm::mat3_cast does.
+			const Float4 one(1.0f);
+			const Float4 two(2.0f);
+			const Float4 xx = x * x, yy = y * y, zz = z * z;
+			const Float4 xy = x * y, xz = x * z, yz = y * z;
+			const Float4 wx = w * x, wy = w * y, wz = w * z;
+
+			float columns[3][3][4];
+			(scale[0] * (one - two * (yy + zz))).Store(columns[0][0]);
+			(scale[0] * (two * (xy + wz))).Store(columns[0][1]);
+			(scale[0] * (two * (xz - wy))).Store(columns[0][2]);
+			(scale[1] * (two * (xy - wz))).Store(columns[1][0]);
+			(scale[1] * (one - two * (xx + zz))).Store(columns[1][1]);
+			(scale[1] * (two * (yz + wx))).Store(columns[1][2]);
+			(scale[2] * (two * (xz + wy))).Store(columns[2][0]);
+			(scale[2] * (two * (yz - wx))).Store(columns[2][1]);
+			(scale[2] * (one - two * (xx + yy))).Store(columns[2][2]);
+
+			float translations[3][4];
+			for (std::size_t component = 0; component < 3; ++component)
+			{
+				translation[component].Store(translations[component]);
+			}
+
+			for (std::size_t lane = 0; lane < laneCount; ++lane)
+			{
+				glm::mat4x4& matrix = localTransforms[mTrackBoneIndices[first + lane]];
+
+				for (glm::length_t column = 0; column < 3; ++column)
+				{
+					matrix[column] = glm::vec4(columns[column][0][lane], columns[column][1][lane], columns[column][2][lane], 0.0f);
+				}
+
+				matrix[3] = glm::vec4(translations[0][lane], translations[1][lane], translations[2][lane], 1.0f);
+			}
+		});
+	}
+
+	void AnimationClip::SampleInterpolatedPose(const float time, gsl::span<std::uint32_t> cursors, gsl::span<BonePose> poses) const
+	{
+		SampleLanes(time, cursors, mTracks.Size(), [this, poses](const std::size_t first, const std::size_t laneCount, const Float4 (&translation)[3], const Float4 (&rotation)[4], const Float4 (&scale)[3])
+		{
+			float translations[3][4];
+			float rotations[4][4];
+			float scales[3][4];
+
+			for (std::size_t component = 0; component < 3; ++component)
+			{
+				translation[component].Store(translations[component]);
+				scale[component].Store(scales[component]);
+			}
+
+			for (std::size_t component = 0; component < 4; ++component)
+			{
+				rotation[component].Store(rotations[component]);
+			}
+
+			for (std::size_t lane = 0; lane < laneCount; ++lane)
+			{
+				BonePose& pose = poses[mTrackBoneIndices[first + lane]];
+				pose.Translation = glm::vec3(translations[0][lane], translations[1][lane], translations[2][lane]);
+				pose.Rotation = glm::quat(rotations[3][lane], rotations[0][lane], rotations[1][lane], rotations[2][lane]);
+				pose.Scale = glm::vec3(scales[0][lane], scales[1][lane], scales[2][lane]);
+			}
+		});
+	}
+
+	void AnimationClip::OrderTracksByDepth(gsl::span<const std::uint32_t> boneDepths)
+	{
+		mBoneDepths.Clear();
+		mBoneDepths.Reserve(boneDepths.size());
+
+		for (const std::uint32_t depth : boneDepths)
+		{
+			mBoneDepths.EmplaceBack(depth);
+		}
+
+		BuildTracks();
+	}
+
 	void AnimationClip::Save(OutputStreamHelper& streamHelper) const
 	{
 		streamHelper << mData.Name << mData.Duration << mData.TicksPerSecond;
@@ -160,4 +461,61 @@ namespace Library
 
 		streamHelper >> mData.KeyframeCount;
 	}
+
+	void AnimationClip::BuildTracks()
+	{
+		mTracks.Clear();
+		mTrackBoneIndices.Clear();
+
+		mTracks.Reserve(mData.BoneAnimations.Size());
+		mTrackBoneIndices.Reserve(mData.BoneAnimations.Size());
+
+		for (const auto& boneAnimation : mData.BoneAnimations)
+		{
+			mTracks.EmplaceBack(boneAnimation.get());
+			mTrackBoneIndices.EmplaceBack(boneAnimation->GetBone().Index());
+		}
+
+		mTrackDepths.Clear();
+		if (mBoneDepths.IsEmpty()) return;
+
+		// Stable, so bones of equal depth keep the clip's order.
+		Vector<std::size_t> order;
+		order.Reserve(mTracks.Size());
+		for (std::size_t i = 0; i < mTracks.Size(); ++i)
+		{
+			order.EmplaceBack(i);
+		}
+
+		std::stable_sort(order.begin(), order.end(), [this](const std::size_t lhs, const std::size_t rhs)
+		{
+			return mBoneDepths[mTrackBoneIndices[lhs]] < mBoneDepths[mTrackBoneIndices[rhs]];
+		});
+
+		Vector<const BoneAnimation*> tracks;
+		Vector<std::uint32_t> trackBoneIndices;
+		tracks.Reserve(mTracks.Size());
+		trackBoneIndices.Reserve(mTracks.Size());
+		mTrackDepths.Reserve(mTracks.Size());
+
+		for (const std::size_t i : order)
+		{
+			tracks.EmplaceBack(mTracks[i]);
+			trackBoneIndices.EmplaceBack(mTrackBoneIndices[i]);
+			mTrackDepths.EmplaceBack(mBoneDepths[mTrackBoneIndices[i]]);
+		}
+
+		mTracks = std::move(tracks);
+		mTrackBoneIndices = std::move(trackBoneIndices);
+	}
+
+	std::size_t AnimationClip::TrackCount(const std::uint32_t maxDepth) const
+	{
+		if (mTrackDepths.IsEmpty() || maxDepth == AllDepths)
+		{
+			return mTracks.Size();
+		}
+
+		return static_cast<std::size_t>(std::upper_bound(mTrackDepths.begin(), mTrackDepths.end(), maxDepth) - mTrackDepths.begin());
+	}
 }
@@ -1,6 +1,14 @@
 #pragma once
 
 #pragma region Includes
+// Third Party
+#include <gsl/gsl>
+
+#pragma warning(disable : 26812 4201)
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+#pragma warning(default : 26812 4201)
+
 // First Party
 #include "Vector.h"
 #include "HashMap.h"
@@ -16,6 +24,29 @@ namespace Library
 	class OutputStreamHelper;
 	class InputStreamHelper;
 
+	/// <summary>
+	/// To parent transform of a bone, decomposed so poses can be blended.
+	/// </summary>
+	struct BonePose final
+	{
+		glm::vec3 Translation{ 0.0f };
+		glm::quat Rotation{ 1.0f, 0.0f, 0.0f, 0.0f };
+		glm::vec3 Scale{ 1.0f };
+
+		glm::mat4x4 Matrix() const;
+
+		bool operator==(const BonePose& rhs) const noexcept
+		{
+			if (this == &rhs) return true;
+			return Translation == rhs.Translation && Rotation == rhs.Rotation && Scale == rhs.Scale;
+		}
+
+		bool operator!=(const BonePose& rhs) const noexcept
+		{
+			return !operator==(rhs);
+		}
+	};
+
 	struct AnimationClipData final
 	{
 		AnimationClipData() = default;
@@ -36,7 +67,14 @@ namespace Library
 
     class AnimationClip final
     {
+		friend class AnimationCompressor;
+
     public:
+		/// <summary>
+		/// Depth limit of a sample covering every bone.
+		/// </summary>
+		inline static constexpr std::uint32_t AllDepths = 0xFFFFFFFF;
+
 		AnimationClip(Model& model, InputStreamHelper& streamHelper);
 		explicit AnimationClip(AnimationClipData&& animationClipData);
 		AnimationClip(const AnimationClip&) = default;
@@ -52,20 +90,89 @@ namespace Library
 		const HashMap<const Bone*, std::shared_ptr<const BoneAnimation>>& BoneAnimationsByBone() const;
 		std::uint32_t KeyframeCount() const;
 
+		/// <summary>
+		/// Gets the index of each bone the clip animates, in sampling order.
+		/// </summary>
+		const Vector<std::uint32_t>& AnimatedBoneIndices() const;
+
+		/// <summary>
+		/// Gets whether any track was compressed by AnimationCompressor.
+		/// Tracks of a compressed clip keep different keyframes, so a keyframe index no longer addresses the same time across them.
+		/// </summary>
+		bool IsCompressed() const;
+
 		std::uint32_t GetTransform(const float time, const Bone& bone, Transform& transform) const;
 		void GetTransforms(const float time, Vector<Transform>& boneTransforms) const;
 		
+		/// <summary>
+		/// Gets the transforms at a keyframe index, clamped to the last keyframe of each track.
+		/// On a compressed clip, the index refers to the keyframes each track kept.
+		/// </summary>
 		void GetTransformAtKeyframe(const std::uint32_t keyframe, const Bone& bone, Transform& transform) const;
 		void GetTransformsAtKeyframe(const std::uint32_t keyframe, Vector<Transform>& boneTransforms) const;
 
 		void GetInterpolatedTransform(const float time, const Bone& bone, Transform& transform) const;
 		void GetInterpolatedTransforms(const float time, Vector<Transform>& boneTransforms) const;
 
+		/// <summary>
+		/// Samples the keyframe at a time for every animated bone, writing to parent matrices.
+		/// </summary>
+		/// <param name="cursors">Keyframe cursor of each bone, by bone index, owned by the caller's playback instance.</param>
+		/// <param name="localTransforms">To parent transform of each bone, by bone index. Bones the clip does not animate are left unchanged.</param>
+		/// <param name="maxDepth">Deepest bone sampled, once tracks are ordered by depth. Deeper bones are left unchanged.</param>
+		/// <returns>Keyframe index sampled for the last animated bone, or zero if no bones are animated.</returns>
+		std::uint32_t SamplePose(const float time, gsl::span<std::uint32_t> cursors, gsl::span<glm::mat4x4> localTransforms, const std::uint32_t maxDepth=AllDepths) const;
+
+		/// <summary>
+		/// Interpolates between the keyframes around a time for every animated bone, writing to parent matrices.
+		/// Bones are gathered four at a time into lanes, decoding compressed tracks, then interpolated and converted to matrices together with SIMD.
+		/// </summary>
+		/// <param name="cursors">Keyframe cursor of each bone, by bone index, owned by the caller's playback instance.</param>
+		/// <param name="localTransforms">To parent transform of each bone, by bone index. Bones the clip does not animate are left unchanged.</param>
+		/// <param name="maxDepth">Deepest bone sampled, once tracks are ordered by depth. Deeper bones are left unchanged.</param>
+		void SampleInterpolatedPose(const float time, gsl::span<std::uint32_t> cursors, gsl::span<glm::mat4x4> localTransforms, const std::uint32_t maxDepth=AllDepths) const;
+
+		/// <summary>
+		/// Samples the keyframe at a time for every animated bone, writing decomposed poses for blending.
+		/// </summary>
+		/// <param name="cursors">Keyframe cursor of each bone, by bone index, owned by the caller's playback instance.</param>
+		/// <param name="poses">Pose of each bone, by bone index. Bones the clip does not animate are left unchanged.</param>
+		/// <returns>Keyframe index sampled for the last animated bone, or zero if no bones are animated.</returns>
+		std::uint32_t SamplePose(const float time, gsl::span<std::uint32_t> cursors, gsl::span<BonePose> poses) const;
+
+		/// <summary>
+		/// Interpolates between the keyframes around a time for every animated bone, writing decomposed poses for blending.
+		/// </summary>
+		/// <param name="cursors">Keyframe cursor of each bone, by bone index, owned by the caller's playback instance.</param>
+		/// <param name="poses">Pose of each bone, by bone index. Bones the clip does not animate are left unchanged.</param>
+		void SampleInterpolatedPose(const float time, gsl::span<std::uint32_t> cursors, gsl::span<BonePose> poses) const;
+
+		/// <summary>
+		/// Orders the tracks by the depth of their bones, so samples limited to a depth cover a prefix of the tracks.
+		/// Called by Model once its skeleton is flattened.
+		/// </summary>
+		/// <param name="boneDepths">Depth of each bone below the root node, by bone index.</param>
+		void OrderTracksByDepth(gsl::span<const std::uint32_t> boneDepths);
+
 		void Save(OutputStreamHelper& streamHelper) const;
 
     private:
 		void Load(Model& model, InputStreamHelper& streamHelper);
+		void BuildTracks();
+		std::size_t TrackCount(const std::uint32_t maxDepth) const;
+
+		/// <summary>
+		/// Gathers the tracks four at a time into lanes and interpolates them, passing each group's translations, rotations and scales to a writer.
+		/// </summary>
+		/// <param name="trackCount">Number of tracks sampled, from the first.</param>
+		/// <param name="writeLanes">Callable taking the first track index, the number of valid lanes, and the interpolated Float4 components.</param>
+		template <typename TWriter>
+		void SampleLanes(const float time, gsl::span<std::uint32_t> cursors, const std::size_t trackCount, TWriter writeLanes) const;
 
 		AnimationClipData mData;
+		Vector<const BoneAnimation*> mTracks;		// Bone animations, contiguous for sampling
+		Vector<std::uint32_t> mTrackBoneIndices;	// Bone index of each track
+		Vector<std::uint32_t> mTrackDepths;			// Bone depth of each track, once ordered by depth
+		Vector<std::uint32_t> mBoneDepths;			// Depth of each bone, by bone index, once ordered by depth
     };
 }
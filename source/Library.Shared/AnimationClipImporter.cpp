@@ -42,9 +42,9 @@ namespace Library
 
 		for (auto& boneAnimation : animationClipData.BoneAnimations)
 		{
-			if (boneAnimation->Keyframes().Size() > animationClipData.KeyframeCount)
+			if (boneAnimation->KeyframeCount() > animationClipData.KeyframeCount)
 			{
-				animationClipData.KeyframeCount = gsl::narrow_cast<uint32_t>(boneAnimation->Keyframes().Size());
+				animationClipData.KeyframeCount = boneAnimation->KeyframeCount();
 			}
 		}
 
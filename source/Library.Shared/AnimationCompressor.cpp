@@ -0,0 +1,202 @@
+#pragma region Includes
+// Pre-compiled Header
+#include "pch.h"
+
+// Header
+#include "AnimationCompressor.h"
+
+// Standard
+#include <cmath>
+
+// First Party
+#include "AnimationClip.h"
+#include "BoneAnimation.h"
+#include "Bone.h"
+#include "MathUtility.h"
+#pragma endregion Includes
+
+namespace
+{
+	float RotationError(const glm::quat& lhs, const glm::quat& rhs)
+	{
+		// q and -q are the same rotation. atan2 stays accurate for the small angles compared here, where acos of the dot product does not.
+		const glm::vec4 first(lhs.x, lhs.y, lhs.z, lhs.w);
+		glm::vec4 second(rhs.x, rhs.y, rhs.z, rhs.w);
+		if (glm::dot(first, second) < 0.0f) second = -second;
+
+		return 4.0f * std::atan2(glm::length(first - second), glm::length(first + second));
+	}
+}
+
+namespace Library
+{
+	float AnimationCompressionReport::CompressionRatio() const
+	{
+		return (CompressedSize > 0 ? static_cast<float>(UncompressedSize) / static_cast<float>(CompressedSize) : 1.0f);
+	}
+
+	AnimationCompressionReport AnimationCompressor::Compress(AnimationClip& clip, const AnimationCompressionSettings& settings)
+	{
+		AnimationCompressionReport report;
+		report.ClipName = clip.mData.Name;
+
+		std::uint32_t keyframeCount = 0;
+
+		for (auto& boneAnimation : clip.mData.BoneAnimations)
+		{
+			const std::shared_ptr<BoneAnimation> compressed = CompressBoneAnimation(*boneAnimation, settings, report);
+
+			report.UncompressedSize += boneAnimation->SizeInBytes();
+			report.CompressedSize += compressed->SizeInBytes();
+			keyframeCount = std::max(keyframeCount, compressed->KeyframeCount());
+
+			clip.mData.BoneAnimationsByBone[&(compressed->GetBone())] = compressed;
+			boneAnimation = compressed;
+		}
+
+		clip.mData.KeyframeCount = keyframeCount;
+		clip.BuildTracks();
+
+		return report;
+	}
+
+	std::shared_ptr<BoneAnimation> AnimationCompressor::CompressBoneAnimation(const BoneAnimation& source, const AnimationCompressionSettings& settings, AnimationCompressionReport& report)
+	{
+		const Vector<std::uint32_t> keptKeyframes = ReduceKeyframes(source, settings);
+
+		auto compressed = std::make_shared<BoneAnimation>(source);
+		compressed->mTimes.Clear();
+		compressed->mTranslations.Clear();
+		compressed->mRotations.Clear();
+		compressed->mPackedRotations.Clear();
+		compressed->mScales.Clear();
+
+		for (const std::uint32_t keyframeIndex : keptKeyframes)
+		{
+			compressed->mTimes.EmplaceBack(source.Times()[keyframeIndex]);
+			compressed->mTranslations.EmplaceBack(source.Translation(keyframeIndex));
+			compressed->mRotations.EmplaceBack(glm::normalize(source.Rotation(keyframeIndex)));
+			compressed->mScales.EmplaceBack(source.Scale(keyframeIndex));
+		}
+
+		// Channels staying within tolerance of their first value, across all of the source keyframes, keep only that value.
+		bool isTranslationConstant = true;
+		bool isRotationConstant = true;
+		bool isScaleConstant = true;
+
+		for (std::uint32_t i = 1; i < source.KeyframeCount(); ++i)
+		{
+			isTranslationConstant = isTranslationConstant && glm::distance(source.Translation(i), source.Translation(0)) <= settings.TranslationTolerance;
+			isRotationConstant = isRotationConstant && RotationError(source.Rotation(i), source.Rotation(0)) <= settings.RotationTolerance;
+			isScaleConstant = isScaleConstant && glm::distance(source.Scale(i), source.Scale(0)) <= settings.ScaleTolerance;
+		}
+
+		if (keptKeyframes.Size() > 1)
+		{
+			if (isTranslationConstant)
+			{
+				compressed->mTranslations.Resize(1);
+				++report.ConstantTrackCount;
+			}
+
+			if (isRotationConstant)
+			{
+				compressed->mRotations.Resize(1);
+				++report.ConstantTrackCount;
+			}
+
+			if (isScaleConstant)
+			{
+				compressed->mScales.Resize(1);
+				++report.ConstantTrackCount;
+			}
+		}
+
+		if (settings.PackRotations)
+		{
+			compressed->mPackedRotations.Reserve(compressed->mRotations.Size());
+			for (const auto& rotation : compressed->mRotations)
+			{
+				compressed->mPackedRotations.EmplaceBack(Math::PackQuaternion(rotation));
+			}
+
+			compressed->mRotations.Clear();
+			compressed->mRotations.ShrinkToFit();
+		}
+
+		report.KeyframeCount += source.KeyframeCount();
+		report.RemovedKeyframeCount += source.KeyframeCount() - gsl::narrow_cast<std::uint32_t>(keptKeyframes.Size());
+		MeasureError(source, *compressed, report);
+
+		return compressed;
+	}
+
+	Vector<std::uint32_t> AnimationCompressor::ReduceKeyframes(const BoneAnimation& source, const AnimationCompressionSettings& settings)
+	{
+		const std::uint32_t keyframeCount = source.KeyframeCount();
+
+		Vector<std::uint32_t> keptKeyframes;
+		if (keyframeCount == 0) return keptKeyframes;
+
+		keptKeyframes.EmplaceBack(0U);
+
+		// Grow a span from the last kept keyframe until interpolating across it exceeds a tolerance, then keep the keyframe before the span's end.
+		std::uint32_t first = 0;
+
+		for (std::uint32_t last = 2; last < keyframeCount; ++last)
+		{
+			if (!IsWithinTolerance(source, first, last, settings))
+			{
+				first = last - 1;
+				keptKeyframes.EmplaceBack(first);
+			}
+		}
+
+		if (keyframeCount > 1)
+		{
+			keptKeyframes.EmplaceBack(keyframeCount - 1);
+		}
+
+		return keptKeyframes;
+	}
+
+	bool AnimationCompressor::IsWithinTolerance(const BoneAnimation& source, const std::uint32_t first, const std::uint32_t last, const AnimationCompressionSettings& settings)
+	{
+		const Vector<float>& times = source.Times();
+
+		for (std::uint32_t i = first + 1; i < last; ++i)
+		{
+			const float lerpValue = (times[i] - times[first]) / (times[last] - times[first]);
+
+			const glm::vec3 translation = glm::lerp(source.Translation(first), source.Translation(last), lerpValue);
+			const glm::quat rotation = glm::slerp(source.Rotation(first), source.Rotation(last), lerpValue);
+			const glm::vec3 scale = glm::lerp(source.Scale(first), source.Scale(last), lerpValue);
+
+			if (glm::distance(translation, source.Translation(i)) > settings.TranslationTolerance ||
+				RotationError(rotation, source.Rotation(i)) > settings.RotationTolerance ||
+				glm::distance(scale, source.Scale(i)) > settings.ScaleTolerance)
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	void AnimationCompressor::MeasureError(const BoneAnimation& source, const BoneAnimation& compressed, AnimationCompressionReport& report)
+	{
+		std::uint32_t cursor = 0;
+
+		for (std::uint32_t i = 0; i < source.KeyframeCount(); ++i)
+		{
+			glm::vec3 translation;
+			glm::quat rotation;
+			glm::vec3 scale;
+			compressed.Sample(source.Times()[i], cursor, translation, rotation, scale);
+
+			report.MaxTranslationError = std::max(report.MaxTranslationError, glm::distance(translation, source.Translation(i)));
+			report.MaxRotationError = std::max(report.MaxRotationError, RotationError(rotation, source.Rotation(i)));
+			report.MaxScaleError = std::max(report.MaxScaleError, glm::distance(scale, source.Scale(i)));
+		}
+	}
+}
@@ -0,0 +1,102 @@
+#pragma once
+
+#pragma region Includes
+// Standard
+#include <cstdint>
+#include <memory>
+#include <string>
+
+// First Party
+#include "Vector.h"
+#pragma endregion Includes
+
+namespace Library
+{
+	// Forward Declarations
+	class AnimationClip;
+	class BoneAnimation;
+
+	/// <summary>
+	/// Error tolerances and options of an AnimationCompressor pass.
+	/// </summary>
+	struct AnimationCompressionSettings final
+	{
+		/// <summary>
+		/// Largest distance a translation may move by when keyframes are removed or tracks made constant.
+		/// </summary>
+		float TranslationTolerance{ 0.001f };
+
+		/// <summary>
+		/// Largest angle, in radians, a rotation may turn by when keyframes are removed or tracks made constant.
+		/// </summary>
+		float RotationTolerance{ 0.001f };
+
+		/// <summary>
+		/// Largest distance a scale may move by when keyframes are removed or tracks made constant.
+		/// </summary>
+		float ScaleTolerance{ 0.001f };
+
+		/// <summary>
+		/// Whether rotations are packed to 48 bits. Packing adds under 1e-4 to each rotation component.
+		/// </summary>
+		bool PackRotations{ true };
+	};
+
+	/// <summary>
+	/// Outcome of compressing an AnimationClip.
+	/// </summary>
+	struct AnimationCompressionReport final
+	{
+		std::string ClipName;
+		std::size_t UncompressedSize{ 0 };
+		std::size_t CompressedSize{ 0 };
+		std::uint32_t KeyframeCount{ 0 };
+		std::uint32_t RemovedKeyframeCount{ 0 };
+		std::uint32_t ConstantTrackCount{ 0 };
+
+		// Largest differences between the original keyframes and the compressed clip sampled at their times.
+		float MaxTranslationError{ 0.0f };
+		float MaxRotationError{ 0.0f };
+		float MaxScaleError{ 0.0f };
+
+		/// <summary>
+		/// Gets the ratio of the uncompressed size to the compressed size.
+		/// </summary>
+		float CompressionRatio() const;
+	};
+
+	/// <summary>
+	/// Offline compression pass for AnimationClip keyframes.
+	/// </summary>
+	/// <remarks>
+	/// Keyframes are removed while interpolating across them stays within tolerance, channels that stay within tolerance of their first value become constant,
+	/// and rotations are packed with the smallest three encoding. BoneAnimation decodes compressed tracks while sampling, and saves them in a compressed layout.
+	/// Keyframe indices of a compressed clip refer to the keyframes that remain.
+	/// </remarks>
+	class AnimationCompressor final
+	{
+	public:
+		AnimationCompressor() = delete;
+		~AnimationCompressor() = delete;
+		AnimationCompressor(const AnimationCompressor&) = delete;
+		AnimationCompressor& operator=(const AnimationCompressor&) = delete;
+		AnimationCompressor(AnimationCompressor&&) = delete;
+		AnimationCompressor& operator=(AnimationCompressor&&) = delete;
+
+		/// <summary>
+		/// Replaces the bone animations of a clip with compressed ones. References to the replaced bone animations are invalidated,
+		/// though AnimatorComponents playing the clip read them through the clip, and so continue with the compressed ones.
+		/// Must not be called while the clip is being evaluated.
+		/// </summary>
+		/// <param name="clip">Clip to be compressed.</param>
+		/// <param name="settings">Error tolerances and options.</param>
+		/// <returns>Sizes, keyframe counts and measured errors of the pass.</returns>
+		static AnimationCompressionReport Compress(AnimationClip& clip, const AnimationCompressionSettings& settings=AnimationCompressionSettings());
+
+	private:
+		static std::shared_ptr<BoneAnimation> CompressBoneAnimation(const BoneAnimation& source, const AnimationCompressionSettings& settings, AnimationCompressionReport& report);
+		static Vector<std::uint32_t> ReduceKeyframes(const BoneAnimation& source, const AnimationCompressionSettings& settings);
+		static bool IsWithinTolerance(const BoneAnimation& source, const std::uint32_t first, const std::uint32_t last, const AnimationCompressionSettings& settings);
+		static void MeasureError(const BoneAnimation& source, const BoneAnimation& compressed, AnimationCompressionReport& report);
+	};
+}
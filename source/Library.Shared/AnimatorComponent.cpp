@@ -5,21 +5,81 @@
 // Header
 #include "AnimatorComponent.h"
 
+// Standard
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
 // First Party
 #include "Model.h"
 #include "Bone.h"
 #include "AnimationClip.h"
+#include "BoneAnimation.h"
 #include "WorldState.h"
 #include "GameTime.h"
 #include "Transform.h"
+#include "World.h"
 #pragma endregion Includes
 
+namespace
+{
+	using namespace Library;
+
+	template <typename T>
+	gsl::span<T> MakeSpan(Vector<T>& vector)
+	{
+		return vector.IsEmpty() ? gsl::span<T>() : gsl::span<T>(&vector[0], vector.Size());
+	}
+
+	float LookaheadTime(const AnimationClip& clip, const float time, const bool isLooped, const float lookaheadSeconds)
+	{
+		const float aheadTime = time + lookaheadSeconds * clip.TicksPerSecond();
+		if (aheadTime < clip.Duration()) return aheadTime;
+
+		return (isLooped && clip.Duration() > 0.0f ? std::fmod(aheadTime, clip.Duration()) : clip.Duration());
+	}
+
+	glm::quat Nlerp(const glm::quat& from, const glm::quat& to, const float weight)
+	{
+		// Along the shortest path. Cheaper than slerp, and indistinguishable at blending weights.
+		const glm::quat target = (glm::dot(from, to) < 0.0f ? -to : to);
+		return glm::normalize(from * (1.0f - weight) + target * weight);
+	}
+
+	glm::vec3 ScaleRatio(const glm::vec3& scale, const glm::vec3& referenceScale)
+	{
+		// An axis with no reference scale has no relative change to add, so it is left as it is.
+		glm::vec3 ratio(1.0f);
+
+		for (glm::length_t i = 0; i < 3; ++i)
+		{
+			if (std::abs(referenceScale[i]) > std::numeric_limits<float>::epsilon())
+			{
+				ratio[i] = scale[i] / referenceScale[i];
+			}
+		}
+
+		return ratio;
+	}
+
+	bool ContainsAll(const Vector<std::uint32_t>& boneIndices, const Vector<std::uint32_t>& containedBoneIndices)
+	{
+		return std::all_of(containedBoneIndices.begin(), containedBoneIndices.end(), [&boneIndices](const std::uint32_t boneIndex)
+		{
+			return std::find(boneIndices.begin(), boneIndices.end(), boneIndex) != boneIndices.end();
+		});
+	}
+}
+
 namespace Library
 {
 	AnimatorComponent::AnimatorComponent(std::shared_ptr<Model> model, std::string name, const bool interpolationEnabled) : Entity(AnimatorComponent::TypeIdClass(), std::move(name)),
 		mModel(std::move(model)), mInterpolationEnabled(interpolationEnabled)
 	{
 		mFinalTransforms.Resize(mModel->Bones().Size());
+		mKeyframeCursors.Resize(mModel->Bones().Size());
+		mLocalTransforms.Resize(mModel->Bones().Size());
+		mPose.Resize(mModel->Bones().Size());
 	}
 
 	const std::shared_ptr<Model>& AnimatorComponent::GetModel() const
@@ -47,6 +107,11 @@ namespace Library
 		return mFinalTransforms;
 	}
 
+	std::size_t AnimatorComponent::PaletteOffset() const
+	{
+		return mPaletteOffset;
+	}
+
 	bool AnimatorComponent::InterpolationEnabled() const
 	{
 		return mInterpolationEnabled;
@@ -67,6 +132,16 @@ namespace Library
 		mInterpolationEnabled = enabled;
 	}
 
+	float AnimatorComponent::Importance() const
+	{
+		return mImportance;
+	}
+
+	void AnimatorComponent::SetImportance(const float importance)
+	{
+		mImportance = importance;
+	}
+
 	void AnimatorComponent::StartClip(const std::shared_ptr<AnimationClip>& clip)
 	{
 		mCurrentClip = clip;
@@ -74,8 +149,14 @@ namespace Library
 		mCurrentKeyframe = 0;
 		mIsPlayingClip = true;
 
+		std::fill(mKeyframeCursors.begin(), mKeyframeCursors.end(), 0U);
+		std::fill(mLocalTransforms.begin(), mLocalTransforms.end(), glm::identity<glm::mat4x4>());
+		std::fill(mPose.begin(), mPose.end(), BonePose());
+
 		mInverseRootTransform = glm::inverse(mModel->RootNode()->GetTransform());
-		GetPose(mCurrentTime, *(mModel->RootNode()));
+		mUpdateInterval = 1;
+		mFramesSinceUpdate = 1;
+		GetPose(mCurrentTime);
 	}
 
 	void AnimatorComponent::PauseClip()
@@ -99,13 +180,101 @@ namespace Library
 		}
 	}
 
+	std::size_t AnimatorComponent::AddLayer(const std::shared_ptr<AnimationClip>& clip, const float weight, const AnimationBlendMode blendMode, const bool isLooped)
+	{
+		Layer layer;
+
+		if (!mLayerPool.IsEmpty())
+		{
+			layer = std::move(mLayerPool.Back());
+			mLayerPool.PopBack();
+		}
+		else
+		{
+			layer.KeyframeCursors.Resize(mModel->Bones().Size());
+			layer.Pose.Resize(mModel->Bones().Size());
+			layer.ReferencePose.Resize(mModel->Bones().Size());
+		}
+
+		layer.Clip = clip;
+		layer.BlendMode = blendMode;
+		layer.Time = 0.0f;
+		layer.Weight = weight;
+		layer.TargetWeight = weight;
+		layer.FadeRate = 0.0f;
+		layer.IsLooped = isLooped;
+
+		if (blendMode == AnimationBlendMode::Additive)
+		{
+			std::fill(layer.KeyframeCursors.begin(), layer.KeyframeCursors.end(), 0U);
+			clip->SamplePose(0.0f, MakeSpan(layer.KeyframeCursors), MakeSpan(layer.ReferencePose));
+		}
+
+		std::fill(layer.KeyframeCursors.begin(), layer.KeyframeCursors.end(), 0U);
+
+		mLayers.EmplaceBack(std::move(layer));
+		return mLayers.Size() - 1;
+	}
+
+	void AnimatorComponent::RemoveLayer(const std::size_t index)
+	{
+		Layer& layer = mLayers.At(index);
+		layer.Clip.reset();
+
+		mLayerPool.EmplaceBack(std::move(layer));
+		mLayers.Remove(mLayers.begin() + index);
+	}
+
+	void AnimatorComponent::ClearLayers()
+	{
+		while (!mLayers.IsEmpty())
+		{
+			RemoveLayer(mLayers.Size() - 1);
+		}
+	}
+
+	std::size_t AnimatorComponent::LayerCount() const
+	{
+		return mLayers.Size();
+	}
+
+	float AnimatorComponent::LayerWeight(const std::size_t index) const
+	{
+		return mLayers.At(index).Weight;
+	}
+
+	void AnimatorComponent::SetLayerWeight(const std::size_t index, const float weight)
+	{
+		Layer& layer = mLayers.At(index);
+		layer.Weight = weight;
+		layer.TargetWeight = weight;
+		layer.FadeRate = 0.0f;
+	}
+
+	void AnimatorComponent::FadeLayer(const std::size_t index, const float targetWeight, const float duration)
+	{
+		Layer& layer = mLayers.At(index);
+		layer.TargetWeight = targetWeight;
+
+		if (duration > 0.0f)
+		{
+			layer.FadeRate = std::abs(targetWeight - layer.Weight) / duration;
+		}
+		else
+		{
+			layer.Weight = targetWeight;
+			layer.FadeRate = 0.0f;
+		}
+	}
+
 	void AnimatorComponent::Update(WorldState& worldState)
 	{
 		if (mIsPlayingClip)
 		{
 			assert(mCurrentClip != nullptr);
 
-			mCurrentTime += worldState.GameTime->ElapsedGameTimeSeconds().count() * mCurrentClip->TicksPerSecond();
+			mElapsedSeconds = worldState.GameTime->ElapsedGameTimeSeconds().count();
+			mCurrentTime += mElapsedSeconds * mCurrentClip->TicksPerSecond();
 			if (mCurrentTime >= mCurrentClip->Duration())
 			{
 				if (mIsClipLooped)
@@ -119,170 +288,284 @@ namespace Library
 				}
 			}
 
-			const auto& rootNode = *(mModel->RootNode());
-			
-			if (mInterpolationEnabled)
+			// After the current clip, as a completed crossfade may replace it.
+			AdvanceLayers(mElapsedSeconds);
+
+			if (worldState.World != nullptr)
 			{
-				GetInterpolatedPose(mCurrentTime, rootNode);
+				worldState.World->GetAnimationBatch().Add(*this);
 			}
 			else
 			{
-				GetPose(mCurrentTime, rootNode);
+				UpdatePose();
 			}
 		}
 	}
 
-	void AnimatorComponent::SetCurrentKeyFrame(const std::uint32_t keyframe)
+	void AnimatorComponent::UpdatePose()
 	{
-		mCurrentKeyframe = keyframe;
-		GetPoseAtKeyframe(mCurrentKeyframe, *(mModel->RootNode()));
+		UpdatePose(0.0f, AnimationClip::AllDepths);
 	}
 
-	void AnimatorComponent::GetBindPoseBottomUp(const SceneNode& sceneNode)
+	void AnimatorComponent::UpdatePose(const float lookaheadSeconds, const std::uint32_t maxDepth)
 	{
-		glm::mat4x4 toRootTransform = sceneNode.GetTransform();
+		assert(mCurrentClip != nullptr);
 
-		auto parentNode = sceneNode.GetParent().lock();
-		while (parentNode != nullptr)
+		if (!mLayers.IsEmpty())
 		{
-			toRootTransform = toRootTransform * parentNode->GetTransform();
-			parentNode = parentNode->GetParent().lock();
+			GetBlendedPose(lookaheadSeconds);
 		}
-
-		const Bone* bone = sceneNode.As<Bone>();
-
-		if (bone != nullptr)
+		else if (mInterpolationEnabled)
 		{
-			mFinalTransforms[bone->Index()] = bone->OffsetTransform() * toRootTransform * mInverseRootTransform;
+			GetInterpolatedPose(LookaheadTime(*mCurrentClip, mCurrentTime, mIsClipLooped, lookaheadSeconds), maxDepth);
 		}
-
-		for (const auto& childNode : sceneNode.Children())
+		else
 		{
-			GetBindPoseBottomUp(*childNode);
+			GetPose(LookaheadTime(*mCurrentClip, mCurrentTime, mIsClipLooped, lookaheadSeconds), maxDepth);
 		}
 	}
 
-	void AnimatorComponent::GetBindPose()
+	void AnimatorComponent::UpdateLodPose(const std::uint32_t updateInterval, const std::uint32_t maxDepth)
 	{
-		GetBindPose(*(mModel->RootNode()));
+		mUpdateInterval = updateInterval;
+		mFramesSinceUpdate = 0;
+
+		if (updateInterval > 1)
+		{
+			// Evaluated at the time of the next evaluation, so the interpolated transforms arrive there on time.
+			mStartTransforms.Resize(mFinalTransforms.Size());
+			mTargetTransforms.Resize(mFinalTransforms.Size());
+
+			std::swap(mStartTransforms, mFinalTransforms);
+			UpdatePose(mElapsedSeconds * (updateInterval - 1), maxDepth);
+			std::swap(mTargetTransforms, mFinalTransforms);
+		}
+		else
+		{
+			UpdatePose(0.0f, maxDepth);
+		}
+
+		InterpolateLodPose();
 	}
 
-	void AnimatorComponent::GetBindPose(const SceneNode& sceneNode)
+	void AnimatorComponent::InterpolateLodPose()
 	{
-		const glm::mat4x4 toParentTransform = sceneNode.GetTransform();
-		const auto parentNode = sceneNode.GetParent().lock();
-		const glm::mat4x4 toRootTransform = (parentNode != nullptr ? toParentTransform * mToRootTransforms.At(parentNode.get()) : toParentTransform);
-		mToRootTransforms[&sceneNode] = toRootTransform;		
+		++mFramesSinceUpdate;
+		if (mUpdateInterval <= 1 || mFramesSinceUpdate > mUpdateInterval) return;
 
-		const Bone* bone = sceneNode.As<Bone>();
+		const float weight = static_cast<float>(mFramesSinceUpdate) / static_cast<float>(mUpdateInterval);
 
-		if (bone != nullptr)
+		for (std::size_t i = 0; i < mFinalTransforms.Size(); ++i)
 		{
-			mFinalTransforms[bone->Index()] = bone->OffsetTransform() * toRootTransform * mInverseRootTransform;
+			mFinalTransforms[i] = mStartTransforms[i] + (mTargetTransforms[i] - mStartTransforms[i]) * weight;
 		}
+	}
 
-		for (const auto& childNode : sceneNode.Children())
+	void AnimatorComponent::SetCurrentKeyFrame(const std::uint32_t keyframe)
+	{
+		if (mCurrentClip != nullptr && mCurrentClip->IsCompressed())
 		{
-			GetBindPose(*childNode);
+			throw std::runtime_error("Keyframes of a compressed clip cannot be addressed.");
 		}
+
+		mCurrentKeyframe = keyframe;
+		GetPoseAtKeyframe(mCurrentKeyframe);
 	}
 
-	void AnimatorComponent::GetPose(const float time, const SceneNode& sceneNode)
+	template <typename TSampler>
+	void AnimatorComponent::EvaluatePose(TSampler sampleBone)
 	{
-		Transform toParentTransform;
-		glm::mat4x4 toParentTransformMatrix;
-		const Bone* bone = sceneNode.As<Bone>();
+		const SkeletonData& skeleton = mModel->Skeleton();
+		const std::size_t nodeCount = skeleton.Parents.Size();
+
+		mToRootTransforms.Resize(nodeCount);
 
-		if (bone != nullptr)
+		// Parents precede their children, so each parent's to root transform is ready when its children need it.
+		for (std::size_t i = 0; i < nodeCount; ++i)
 		{
-			const auto keyframe = mCurrentClip->GetTransform(time, *bone, toParentTransform);
-			
-			if (keyframe != std::numeric_limits<std::uint32_t>::max())
+			const std::uint32_t boneIndex = skeleton.BoneIndices[i];
+			const std::uint32_t parentIndex = skeleton.Parents[i];
+
+			const glm::mat4x4 toParentTransform = (boneIndex != SkeletonData::NoBone ? sampleBone(boneIndex, skeleton.Transforms[i]) : skeleton.Transforms[i]);
+			const glm::mat4x4 toRootTransform = (parentIndex != SkeletonData::NoParent ? toParentTransform * mToRootTransforms[parentIndex] : toParentTransform);
+			mToRootTransforms[i] = toRootTransform;
+
+			if (boneIndex != SkeletonData::NoBone)
 			{
-				mCurrentKeyframe = keyframe;
+				mFinalTransforms[boneIndex] = skeleton.OffsetTransforms[boneIndex] * toRootTransform * mInverseRootTransform;
 			}
-
-			toParentTransformMatrix = toParentTransform.Matrix();
 		}
-		else
+	}
+
+	void AnimatorComponent::GetBindPose()
+	{
+		EvaluatePose([](std::uint32_t, const glm::mat4x4& bindTransform) { return bindTransform; });
+	}
+
+	void AnimatorComponent::GetPose(const float time, const std::uint32_t maxDepth)
+	{
+		if (!mCurrentClip->BoneAnimations().IsEmpty())
 		{
-			toParentTransformMatrix = sceneNode.GetTransform();
+			mCurrentKeyframe = mCurrentClip->SamplePose(time, MakeSpan(mKeyframeCursors), MakeSpan(mLocalTransforms), maxDepth);
 		}
 
-		const auto parentNode = sceneNode.GetParent().lock();
-		const glm::mat4x4 toRootTransform = (parentNode != nullptr ? toParentTransformMatrix * mToRootTransforms.At(parentNode.get()) : toParentTransformMatrix);
-		mToRootTransforms[&sceneNode] = toRootTransform;
+		EvaluatePose([this](const std::uint32_t boneIndex, const glm::mat4x4&) { return mLocalTransforms[boneIndex]; });
+	}
+
+	void AnimatorComponent::GetPoseAtKeyframe(const std::uint32_t keyframe)
+	{
+		// Read through the clip rather than cached, as AnimationCompressor replaces the clip's bone animations.
+		std::fill(mLocalTransforms.begin(), mLocalTransforms.end(), glm::identity<glm::mat4x4>());
 
-		if (bone != nullptr)
+		if (mCurrentClip != nullptr)
 		{
-			mFinalTransforms[bone->Index()] = bone->OffsetTransform() * toRootTransform * mInverseRootTransform;
+			for (const auto& boneAnimation : mCurrentClip->BoneAnimations())
+			{
+				Transform toParentTransform = Transform::Identity;
+				boneAnimation->GetTransformAtKeyframe(keyframe, toParentTransform);
+				mLocalTransforms[boneAnimation->GetBone().Index()] = toParentTransform.Matrix();
+			}
 		}
 
-		for (const auto& childNode : sceneNode.Children())
+		EvaluatePose([this](const std::uint32_t boneIndex, const glm::mat4x4&) { return mLocalTransforms[boneIndex]; });
+	}
+
+	void AnimatorComponent::GetInterpolatedPose(const float time, const std::uint32_t maxDepth)
+	{
+		if (!mCurrentClip->BoneAnimations().IsEmpty())
 		{
-			GetPose(time, *childNode);
+			mCurrentClip->SampleInterpolatedPose(time, MakeSpan(mKeyframeCursors), MakeSpan(mLocalTransforms), maxDepth);
 		}
+
+		EvaluatePose([this](const std::uint32_t boneIndex, const glm::mat4x4&) { return mLocalTransforms[boneIndex]; });
 	}
 
-	void AnimatorComponent::GetPoseAtKeyframe(const std::uint32_t keyframe, const SceneNode& sceneNode)
+	void AnimatorComponent::GetBlendedPose(const float lookaheadSeconds)
 	{
-		Transform toParentTransform;
-		glm::mat4x4 toParentTransformMatrix;
-		const Bone* bone = sceneNode.As<Bone>();
+		// Bones the current clip does not animate start from identity, as they do without layers.
+		std::fill(mPose.begin(), mPose.end(), BonePose());
 
-		if (bone != nullptr)
+		const float time = LookaheadTime(*mCurrentClip, mCurrentTime, mIsClipLooped, lookaheadSeconds);
+
+		if (!mInterpolationEnabled && !mCurrentClip->AnimatedBoneIndices().IsEmpty())
 		{
-			mCurrentClip->GetTransformAtKeyframe(keyframe, *bone, toParentTransform);
-			toParentTransformMatrix = toParentTransform.Matrix();
+			mCurrentKeyframe = mCurrentClip->SamplePose(time, MakeSpan(mKeyframeCursors), MakeSpan(mPose));
 		}
 		else
 		{
-			toParentTransformMatrix = sceneNode.GetTransform();
+			SampleLayer(*mCurrentClip, time, mKeyframeCursors, mPose);
 		}
 
-		const auto& parentNode = sceneNode.GetParent().lock();
-		const glm::mat4x4 toRootTransform = (parentNode != nullptr ? toParentTransformMatrix * mToRootTransforms.At(parentNode.get()) : toParentTransformMatrix);
-		mToRootTransforms[&sceneNode] = toRootTransform;
+		for (auto& layer : mLayers)
+		{
+			const float weight = std::clamp(layer.Weight, 0.0f, 1.0f);
+			if (weight <= 0.0f) continue;
+
+			SampleLayer(*layer.Clip, LookaheadTime(*layer.Clip, layer.Time, layer.IsLooped, lookaheadSeconds), layer.KeyframeCursors, layer.Pose);
+
+			for (const std::uint32_t boneIndex : layer.Clip->AnimatedBoneIndices())
+			{
+				BonePose& pose = mPose[boneIndex];
+				const BonePose& layerPose = layer.Pose[boneIndex];
+
+				if (layer.BlendMode == AnimationBlendMode::Override)
+				{
+					pose.Translation = glm::mix(pose.Translation, layerPose.Translation, weight);
+					pose.Rotation = Nlerp(pose.Rotation, layerPose.Rotation, weight);
+					pose.Scale = glm::mix(pose.Scale, layerPose.Scale, weight);
+				}
+				else
+				{
+					const BonePose& referencePose = layer.ReferencePose[boneIndex];
+					const glm::quat rotationDelta = layerPose.Rotation * glm::inverse(referencePose.Rotation);
+
+					pose.Translation += (layerPose.Translation - referencePose.Translation) * weight;
+					pose.Rotation = glm::normalize(Nlerp(glm::quat(1.0f, 0.0f, 0.0f, 0.0f), rotationDelta, weight) * pose.Rotation);
+					pose.Scale *= glm::mix(glm::vec3(1.0f), ScaleRatio(layerPose.Scale, referencePose.Scale), weight);
+				}
+			}
+		}
 
-		if (bone != nullptr)
+		for (std::size_t i = 0; i < mPose.Size(); ++i)
 		{
-			mFinalTransforms[bone->Index()] = bone->OffsetTransform() * toRootTransform * mInverseRootTransform;
+			mLocalTransforms[i] = mPose[i].Matrix();
 		}
 
-		for (const auto& childNode : sceneNode.Children())
+		EvaluatePose([this](const std::uint32_t boneIndex, const glm::mat4x4&) { return mLocalTransforms[boneIndex]; });
+	}
+
+	void AnimatorComponent::SampleLayer(const AnimationClip& clip, const float time, Vector<std::uint32_t>& cursors, Vector<BonePose>& pose) const
+	{
+		if (mInterpolationEnabled)
 		{
-			GetPoseAtKeyframe(keyframe, *childNode);
+			clip.SampleInterpolatedPose(time, MakeSpan(cursors), MakeSpan(pose));
+		}
+		else
+		{
+			clip.SamplePose(time, MakeSpan(cursors), MakeSpan(pose));
 		}
 	}
 
-	void AnimatorComponent::GetInterpolatedPose(const float time, const SceneNode& sceneNode)
+	void AnimatorComponent::AdvanceLayers(const float elapsedSeconds)
 	{
-		Transform toParentTransform;
-		glm::mat4x4 toParentTransformMatrix;
-		const Bone* bone = sceneNode.As<Bone>();
+		std::size_t promotedIndex = mLayers.Size();
 
-		if (bone != nullptr)
+		for (std::size_t i = 0; i < mLayers.Size(); ++i)
 		{
-			mCurrentClip->GetInterpolatedTransform(time, *bone, toParentTransform);
-			toParentTransformMatrix = toParentTransform.Matrix();
+			Layer& layer = mLayers[i];
+
+			layer.Time += elapsedSeconds * layer.Clip->TicksPerSecond();
+			if (layer.Time >= layer.Clip->Duration())
+			{
+				layer.Time = (layer.IsLooped ? 0.0f : layer.Clip->Duration());
+			}
+
+			if (layer.FadeRate <= 0.0f) continue;
+
+			const float step = layer.FadeRate * elapsedSeconds;
+			layer.Weight = (layer.Weight < layer.TargetWeight ? std::min(layer.Weight + step, layer.TargetWeight) : std::max(layer.Weight - step, layer.TargetWeight));
+			if (layer.Weight != layer.TargetWeight) continue;
+
+			// The fade is complete, so coverage is checked once rather than every frame.
+			layer.FadeRate = 0.0f;
+
+			if (layer.BlendMode == AnimationBlendMode::Override && layer.Weight >= 1.0f && CoversLayersBeneath(i))
+			{
+				promotedIndex = i;
+			}
 		}
-		else
+
+		if (promotedIndex < mLayers.Size())
 		{
-			toParentTransformMatrix = sceneNode.GetTransform();
+			PromoteLayer(promotedIndex);
 		}
+	}
 
-		const auto& parentNode = sceneNode.GetParent().lock();
-		const glm::mat4x4 toRootTransform = (parentNode != nullptr ? toParentTransformMatrix * mToRootTransforms.At(parentNode.get()) : toParentTransformMatrix);
-		mToRootTransforms[&sceneNode] = toRootTransform;
+	bool AnimatorComponent::CoversLayersBeneath(const std::size_t index) const
+	{
+		const Vector<std::uint32_t>& boneIndices = mLayers[index].Clip->AnimatedBoneIndices();
+		if (!ContainsAll(boneIndices, mCurrentClip->AnimatedBoneIndices())) return false;
 
-		if (bone != nullptr)
+		for (std::size_t i = 0; i < index; ++i)
 		{
-			mFinalTransforms[bone->Index()] = bone->OffsetTransform() * toRootTransform * mInverseRootTransform;
+			if (!ContainsAll(boneIndices, mLayers[i].Clip->AnimatedBoneIndices())) return false;
 		}
 
-		for (const auto& childNode : sceneNode.Children())
+		return true;
+	}
+
+	void AnimatorComponent::PromoteLayer(const std::size_t index)
+	{
+		// At full weight, the layer hides the current clip and the layers beneath it, so it carries on as the current clip.
+		Layer& layer = mLayers[index];
+		mCurrentClip = layer.Clip;
+		mCurrentTime = layer.Time;
+		mIsClipLooped = layer.IsLooped;
+		std::swap(mKeyframeCursors, layer.KeyframeCursors);
+
+		for (std::size_t i = index + 1; i > 0; --i)
 		{
-			GetInterpolatedPose(time, *childNode);
+			RemoveLayer(i - 1);
 		}
 	}
 }
@@ -3,6 +3,7 @@
 #pragma region Includes
 // First Party
 #include "Entity.h"
+#include "AnimationClip.h"
 #pragma endregion Includes
 
 namespace Library
@@ -10,7 +11,16 @@ namespace Library
 	// Forward Declarations
 	class Model;
 	class SceneNode;
-	class AnimationClip;
+	class BoneAnimation;
+
+	/// <summary>
+	/// How an animation layer combines with the pose beneath it.
+	/// </summary>
+	enum class AnimationBlendMode
+	{
+		Override,	// Blends toward the layer's pose by its weight
+		Additive	// Adds the layer's motion relative to its first keyframe, scaled by its weight
+	};
 
 	/// <summary>
 	/// A entity component that enables animation of a model.
@@ -18,6 +28,8 @@ namespace Library
     class AnimatorComponent final : public Entity
     {
 		RTTI_DECLARATIONS_ABSTRACT(AnimatorComponent, Entity)
+
+		friend class AnimationBatch;
     	
     public:
 		AnimatorComponent() = delete;
@@ -34,10 +46,26 @@ namespace Library
 		float CurrentTime() const;
 		std::uint32_t CurrentKeyframe() const;
 		const Vector<glm::mat4x4>& BoneTransforms() const;
+
+		/// <summary>
+		/// Gets the offset of this component's bone transforms within the skinning palette of the World's AnimationBatch.
+		/// Valid once the batch has evaluated the component.
+		/// </summary>
+		std::size_t PaletteOffset() const;
 		
 		bool InterpolationEnabled() const;
 		void SetInterpolationEnabled(const bool enabled);
 
+		float Importance() const;
+
+		/// <summary>
+		/// Sets the importance driving this component's animation level of detail, as scheduled by the World's AnimationBatch.
+		/// At one, the pose is evaluated every frame. Lower values evaluate less often, interpolating between evaluations,
+		/// and below AnimationBatch::ReducedSkeletonImportance only the bones nearest the root are sampled. Zero freezes the pose.
+		/// </summary>
+		/// <param name="importance">Importance, typically from zero for an invisible character to one for a character near the camera.</param>
+		void SetImportance(const float importance);
+
 		bool IsPlayingClip() const;
 		bool IsClipLooped() const;
 
@@ -45,24 +73,124 @@ namespace Library
 		void PauseClip();
 		void ResumeClip();
 		void RestartClip();
+
+		/// <summary>
+		/// Poses the model at a keyframe of the current clip. Bones the clip does not animate take the identity transform.
+		/// </summary>
+		/// <param name="keyframe">Keyframe index, clamped to the last keyframe of each bone.</param>
+		/// <exception cref="std::runtime_error">Current clip is compressed, so its keyframe indices differ between bones.</exception>
 		void SetCurrentKeyFrame(std::uint32_t keyframe);
+
 		void GetBindPose();
 
+		/// <summary>
+		/// Adds a clip played over the current clip. Layers are applied in order, each over the result of those beneath it,
+		/// and are evaluated in the same pass as the current clip. Buffers of removed layers are reused.
+		/// </summary>
+		/// <param name="clip">Clip played by the layer, from its start.</param>
+		/// <param name="weight">Weight of the layer, from zero to one.</param>
+		/// <param name="blendMode">How the layer combines with the pose beneath it.</param>
+		/// <param name="isLooped">Whether the clip loops, or holds its last keyframe.</param>
+		/// <returns>Index of the layer.</returns>
+		std::size_t AddLayer(const std::shared_ptr<AnimationClip>& clip, const float weight=1.0f, const AnimationBlendMode blendMode=AnimationBlendMode::Override, const bool isLooped=true);
+
+		/// <summary>
+		/// Removes a layer. Layers above it move down an index.
+		/// </summary>
+		/// <exception cref="std::out_of_range">Index is out of bounds.</exception>
+		void RemoveLayer(const std::size_t index);
+
+		void ClearLayers();
+		std::size_t LayerCount() const;
+		float LayerWeight(const std::size_t index) const;
+		void SetLayerWeight(const std::size_t index, const float weight);
+
+		/// <summary>
+		/// Moves a layer's weight linearly to a target over a duration. A crossfade fades in a new layer over the pose beneath it.
+		/// Once an Override layer fades in to full weight, if it animates every bone of the current clip and of the layers beneath it,
+		/// it becomes the current clip and is removed along with those layers, moving the layers above it down.
+		/// </summary>
+		/// <param name="targetWeight">Weight at the end of the fade.</param>
+		/// <param name="duration">Duration of the fade in seconds. Zero sets the weight immediately.</param>
+		/// <exception cref="std::out_of_range">Index is out of bounds.</exception>
+		void FadeLayer(const std::size_t index, const float targetWeight, const float duration);
+
+		/// <summary>
+		/// Evaluates the pose of the current clip at the current time.
+		/// Reads only shared, immutable Model and clip data, so distinct components may be evaluated concurrently.
+		/// </summary>
+		void UpdatePose();
+
+		/// <summary>
+		/// Advances the current clip. Within a World, the pose is evaluated later by the World's AnimationBatch; otherwise, immediately.
+		/// </summary>
 		virtual void Update(WorldState& worldState) override;
 
     private:
-		void GetBindPose(const SceneNode& sceneNode);
-		void GetBindPoseBottomUp(const SceneNode& sceneNode);
-		void GetPose(const float time, const SceneNode& sceneNode);
-		void GetPoseAtKeyframe(std::uint32_t keyframe, const SceneNode& sceneNode);
-		void GetInterpolatedPose(const float time, const SceneNode& sceneNode);		
+		struct Layer final
+		{
+			std::shared_ptr<AnimationClip> Clip;
+			AnimationBlendMode BlendMode{ AnimationBlendMode::Override };
+			float Time{ 0.0f };
+			float Weight{ 0.0f };
+			float TargetWeight{ 0.0f };
+			float FadeRate{ 0.0f };					// Weight change per second
+			bool IsLooped{ true };
+			Vector<std::uint32_t> KeyframeCursors;	// By bone index
+			Vector<BonePose> Pose;					// By bone index
+			Vector<BonePose> ReferencePose;			// First keyframe of an additive clip, by bone index
+		};
+
+		void UpdatePose(const float lookaheadSeconds, const std::uint32_t maxDepth);
+
+		/// <summary>
+		/// Evaluates the pose a number of frames ahead, then starts interpolating the bone transforms toward it.
+		/// </summary>
+		/// <param name="updateInterval">Frames until the next evaluation.</param>
+		/// <param name="maxDepth">Deepest bone sampled. Deeper bones keep their last sampled transforms.</param>
+		void UpdateLodPose(const std::uint32_t updateInterval, const std::uint32_t maxDepth);
+
+		/// <summary>
+		/// Counts a frame since the last evaluation, advancing the bone transforms toward it.
+		/// </summary>
+		void InterpolateLodPose();
+
+		void GetPose(const float time, const std::uint32_t maxDepth=AnimationClip::AllDepths);
+		void GetPoseAtKeyframe(std::uint32_t keyframe);
+		void GetInterpolatedPose(const float time, const std::uint32_t maxDepth=AnimationClip::AllDepths);
+		void GetBlendedPose(const float lookaheadSeconds);
+		void SampleLayer(const AnimationClip& clip, const float time, Vector<std::uint32_t>& cursors, Vector<BonePose>& pose) const;
+		void AdvanceLayers(const float elapsedSeconds);
+		bool CoversLayersBeneath(const std::size_t index) const;
+		void PromoteLayer(const std::size_t index);
+
+		/// <summary>
+		/// Evaluates the pose in a single pass over the Model's flattened skeleton.
+		/// </summary>
+		/// <param name="sampleBone">Callable returning the to parent transform of a bone, given its bone index and bind transform.</param>
+		template <typename TSampler>
+		void EvaluatePose(TSampler sampleBone);
 
 		std::shared_ptr<Model> mModel;
 		std::shared_ptr<AnimationClip> mCurrentClip;
 		float mCurrentTime{ 0.0f };
 		std::uint32_t mCurrentKeyframe{ 0 };
-		HashMap<const SceneNode*, glm::mat4x4> mToRootTransforms;
+		Vector<std::uint32_t> mKeyframeCursors;			// Last keyframe sampled for each bone, by bone index
+		Vector<glm::mat4x4> mLocalTransforms;			// Sampled to parent transform of each bone, by bone index
+		Vector<BonePose> mPose;							// Blended pose of each bone, by bone index
+		Vector<Layer> mLayers{ Vector<Layer>::EqualityFunctor() };
+		Vector<Layer> mLayerPool{ Vector<Layer>::EqualityFunctor() };	// Removed layers, keeping their buffers
+		Vector<glm::mat4x4> mToRootTransforms;			// By skeleton node index
 		Vector<glm::mat4x4> mFinalTransforms;
+		Vector<glm::mat4x4> mStartTransforms;			// Bone transforms when the last level of detail evaluation began
+		Vector<glm::mat4x4> mTargetTransforms;			// Bone transforms of the last level of detail evaluation
+		std::size_t mPaletteOffset{ 0 };
+		float mImportance{ 1.0f };
+		float mElapsedSeconds{ 0.0f };					// Game time advanced by the last Update
+		std::uint32_t mUpdateInterval{ 1 };				// Frames between level of detail evaluations
+		std::uint32_t mFramesSinceUpdate{ 0 };
+		bool mIsLodUpdateScheduled{ false };
+		std::size_t mBatchIndex{ 0 };					// Index within the AnimationBatch this component was last queued with
 		glm::mat4x4 mInverseRootTransform{ glm::identity<glm::mat4x4>() };
 		bool mInterpolationEnabled;
 		bool mIsPlayingClip{ false };
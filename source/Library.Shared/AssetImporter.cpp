@@ -78,6 +78,8 @@ namespace Library
 			}
 		}
 
+		model.FlattenSkeleton();
+
 		return model;
 	}
 
@@ -198,6 +198,11 @@ namespace Library
 #pragma endregion RTTI Overrides
 
 #pragma region Helper Methods
+	std::size_t Attributed::PinnedAttributeCount() const
+	{
+		return mNumPrescribed;
+	}
+
 	void Attributed::Populate(const TypeManager::TypeInfo* typeInfo)
 	{
 		const auto* parentTypeInfo = TypeManager::Instance()->Find(typeInfo->ParentTypeId);
@@ -170,6 +170,13 @@ namespace Library
 #pragma endregion RTTI Overrides
 
 #pragma region Helper Methods
+	protected:
+		/// <summary>
+		/// Keeps the prescribed Attributes in place when Attributes left without children are erased.
+		/// </summary>
+		/// <returns>Number of prescribed Attributes.</returns>
+		virtual std::size_t PinnedAttributeCount() const override;
+
 	private:
 		/// <summary>
 		/// Helper method for populating the Scope attributes during construction.
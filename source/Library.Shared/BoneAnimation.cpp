@@ -22,14 +22,18 @@ namespace Library
 	}
 
 	BoneAnimation::BoneAnimation(Model& model, const BoneAnimationData& boneAnimationData) :
-		mModel(&model), mBone(model.Bones().At(boneAnimationData.BoneIndex)), mKeyframes(boneAnimationData.Keyframes)
+		mModel(&model), mBone(model.Bones().At(boneAnimationData.BoneIndex))
 	{
+		AddKeyframes(boneAnimationData.Keyframes);
 	}
 
 	BoneAnimation::BoneAnimation(Model& model, BoneAnimationData&& boneAnimationData) :
-		mModel(&model), mBone(model.Bones().At(boneAnimationData.BoneIndex)), mKeyframes(move(boneAnimationData.Keyframes))
+		mModel(&model), mBone(model.Bones().At(boneAnimationData.BoneIndex))
 	{
+		AddKeyframes(boneAnimationData.Keyframes);
+
 		boneAnimationData.BoneIndex = 0U;
+		boneAnimationData.Keyframes.Clear();
 	}
 
 	const Bone& BoneAnimation::GetBone() const
@@ -39,17 +43,58 @@ namespace Library
 		
 		return *bone;
 	}
-	
-	const Vector<std::shared_ptr<const Keyframe>>& BoneAnimation::Keyframes() const
+
+	std::uint32_t BoneAnimation::KeyframeCount() const
+	{
+		return gsl::narrow_cast<std::uint32_t>(mTimes.Size());
+	}
+
+	const Vector<float>& BoneAnimation::Times() const
+	{
+		return mTimes;
+	}
+
+	glm::vec3 BoneAnimation::Translation(const std::uint32_t keyframeIndex) const
+	{
+		return mTranslations[mTranslations.Size() > 1 ? keyframeIndex : 0];
+	}
+
+	glm::quat BoneAnimation::Rotation(const std::uint32_t keyframeIndex) const
+	{
+		if (mPackedRotations.IsEmpty())
+		{
+			return mRotations[mRotations.Size() > 1 ? keyframeIndex : 0];
+		}
+
+		return Math::UnpackQuaternion(mPackedRotations[mPackedRotations.Size() > 1 ? keyframeIndex : 0]);
+	}
+
+	glm::vec3 BoneAnimation::Scale(const std::uint32_t keyframeIndex) const
+	{
+		return mScales[mScales.Size() > 1 ? keyframeIndex : 0];
+	}
+
+	bool BoneAnimation::IsCompressed() const
+	{
+		return !mPackedRotations.IsEmpty() || mTranslations.Size() != mTimes.Size() || mRotations.Size() != mTimes.Size() || mScales.Size() != mTimes.Size();
+	}
+
+	std::size_t BoneAnimation::SizeInBytes() const
 	{
-		return mKeyframes;
+		return mTimes.Size() * sizeof(float) + mTranslations.Size() * sizeof(glm::vec3) + mRotations.Size() * sizeof(glm::quat) +
+			mPackedRotations.Size() * sizeof(Math::PackedQuaternion) + mScales.Size() * sizeof(glm::vec3);
 	}
 
 	uint32_t BoneAnimation::GetTransform(const float time, Transform& transform) const
 	{
-		const std::uint32_t keyframeIndex = FindKeyframeIndex(time);
-		const std::shared_ptr<const Keyframe>& keyframe = mKeyframes[keyframeIndex];
-		transform = keyframe->TransformationMatrix();
+		std::uint32_t cursor = 0;
+		return GetTransform(time, transform, cursor);
+	}
+
+	uint32_t BoneAnimation::GetTransform(const float time, Transform& transform, std::uint32_t& cursor) const
+	{
+		const std::uint32_t keyframeIndex = FindKeyframeIndex(time, cursor);
+		transform = GetTransformAt(keyframeIndex);
 
 		return keyframeIndex;
 	}
@@ -57,52 +102,28 @@ namespace Library
 	void BoneAnimation::GetTransformAtKeyframe(std::uint32_t keyframeIndex, Transform& transform) const
 	{
 		// Clamp the keyframe
-		if (keyframeIndex >= mKeyframes.Size())
+		if (keyframeIndex >= mTimes.Size())
 		{
-			keyframeIndex = gsl::narrow_cast<std::uint32_t>(mKeyframes.Size() - 1);
+			keyframeIndex = gsl::narrow_cast<std::uint32_t>(mTimes.Size() - 1);
 		}
 		
-		const std::shared_ptr<const Keyframe>& keyframe = mKeyframes[keyframeIndex];
-		transform = keyframe->TransformationMatrix();
+		transform = GetTransformAt(keyframeIndex);
 	}
 
 	void BoneAnimation::GetInterpolatedTransform(const float time, Transform& transform) const
 	{
-		const std::shared_ptr<const Keyframe>& firstKeyframe = mKeyframes.Front();
-		const std::shared_ptr<const Keyframe>& lastKeyframe = mKeyframes.Back();
-
-		if (time <= firstKeyframe->Time())
-		{
-			// Specified time is before the start time of the animation, so return the first keyframe
-			transform = firstKeyframe->TransformationMatrix();
-		}
-		else if (time >= lastKeyframe->Time())
-		{
-			// Specified time is after the end time of the animation, so return the last keyframe
-			transform = lastKeyframe->TransformationMatrix();
-		}
-		else
-		{
-			// Interpolate the transform between keyframes
-			const uint32_t keyframeIndex = FindKeyframeIndex(time);
-			const std::shared_ptr<const Keyframe>& keyframeOne = mKeyframes[keyframeIndex];
-			const std::shared_ptr<const Keyframe>& keyframeTwo = mKeyframes[static_cast<std::size_t>(keyframeIndex) + 1];
-
-			const glm::vec3 translationOne = keyframeOne->TranslationVector();
-			const glm::quat rotationQuaternionOne = keyframeOne->RotationQuaternionVector();
-			const glm::vec3 scaleOne = keyframeOne->ScaleVector();
-			
-			const glm::vec3 translationTwo = keyframeTwo->TranslationVector();
-			const glm::quat rotationQuaternionTwo = keyframeTwo->RotationQuaternionVector();
-			const glm::vec3 scaleTwo = keyframeTwo->ScaleVector();
+		std::uint32_t cursor = 0;
+		GetInterpolatedTransform(time, transform, cursor);
+	}
 
-			const float lerpValue = ((time - keyframeOne->Time()) / (keyframeTwo->Time() - keyframeOne->Time()));
-			const glm::vec3 translation = glm::lerp(translationOne, translationTwo, lerpValue);
-			const glm::quat rotationQuaternion = glm::slerp(rotationQuaternionOne, rotationQuaternionTwo, lerpValue);
-			const glm::vec3 scale = glm::lerp(scaleOne, scaleTwo, lerpValue);
+	void BoneAnimation::GetInterpolatedTransform(const float time, Transform& transform, std::uint32_t& cursor) const
+	{
+		glm::vec3 translation;
+		glm::quat rotationQuaternion;
+		glm::vec3 scale;
+		Sample(time, cursor, translation, rotationQuaternion, scale);
 
-			transform = Transform(scale, rotationQuaternion, translation);
-		}
+		transform = Transform(translation, rotationQuaternion, scale);
 	}
 
 	void BoneAnimation::Save(OutputStreamHelper& streamHelper) const
@@ -110,10 +131,30 @@ namespace Library
 		const Bone& bone = GetBone();
 		streamHelper << bone.Name();
 
-		streamHelper << gsl::narrow_cast<uint32_t>(mKeyframes.Size());
-		for (const auto& keyframe: mKeyframes)
+		if (IsCompressed())
 		{
-			keyframe->Save(streamHelper);
+			SaveCompressed(streamHelper);
+			return;
+		}
+
+		// Keyframes are saved interleaved, gathered into one buffer so they are written at once.
+		Vector<float> values(mTimes.Size() * Keyframe::SerializedFloatCount);
+		for (std::size_t i = 0; i < mTimes.Size(); ++i)
+		{
+			const glm::vec3& translation = mTranslations[i];
+			const glm::quat& rotation = mRotations[i];
+			const glm::vec3& scale = mScales[i];
+
+			for (const float value : { mTimes[i], translation.x, translation.y, translation.z, rotation.x, rotation.y, rotation.z, rotation.w, scale.x, scale.y, scale.z })
+			{
+				values.EmplaceBack(value);
+			}
+		}
+
+		streamHelper << KeyframeCount();
+		if (!values.IsEmpty())
+		{
+			streamHelper.WriteArray(gsl::span<const float>(&values[0], values.Size()));
 		}
 	}
 
@@ -128,31 +169,203 @@ namespace Library
 		// Deserialize the keyframes
 		uint32_t keyframeCount;
 		streamHelper >> keyframeCount;
-		mKeyframes.Reserve(keyframeCount);
+
+		if (keyframeCount == CompressedMarker)
+		{
+			LoadCompressed(streamHelper);
+			return;
+		}
+
+		if (keyframeCount == 0)
+		{
+			return;
+		}
+
+		// Keyframes are saved interleaved, read at once and then split into the tracks.
+		Vector<float> values;
+		values.Resize(std::size_t(keyframeCount) * Keyframe::SerializedFloatCount);
+		streamHelper.ReadArray(gsl::span<float>(&values[0], values.Size()));
+
+		mTimes.Resize(keyframeCount);
+		mTranslations.Resize(keyframeCount);
+		mRotations.Resize(keyframeCount);
+		mScales.Resize(keyframeCount);
+
 		for (uint32_t i = 0; i < keyframeCount; i++)
 		{
-			mKeyframes.EmplaceBack(std::make_shared<Keyframe>(streamHelper));
+			const float* keyframe = &values[std::size_t(i) * Keyframe::SerializedFloatCount];
+			mTimes[i] = keyframe[0];
+			mTranslations[i] = glm::vec3(keyframe[1], keyframe[2], keyframe[3]);
+			mRotations[i] = glm::quat(keyframe[7], keyframe[4], keyframe[5], keyframe[6]);
+			mScales[i] = glm::vec3(keyframe[8], keyframe[9], keyframe[10]);
 		}
 	}
 
+	void BoneAnimation::LoadCompressed(InputStreamHelper& streamHelper)
+	{
+		streamHelper.ReadArray(mTimes);
+		streamHelper.ReadArray(mTranslations);
+
+		bool isRotationPacked;
+		streamHelper >> isRotationPacked;
+
+		if (isRotationPacked)
+		{
+			Vector<std::uint64_t> packedBits;
+			streamHelper.ReadArray(packedBits);
+
+			mPackedRotations.Resize(packedBits.Size());
+			for (std::size_t i = 0; i < packedBits.Size(); ++i)
+			{
+				const std::uint64_t bits = packedBits[i];
+				mPackedRotations[i].Bits[0] = static_cast<std::uint16_t>(bits);
+				mPackedRotations[i].Bits[1] = static_cast<std::uint16_t>(bits >> 16);
+				mPackedRotations[i].Bits[2] = static_cast<std::uint16_t>(bits >> 32);
+			}
+		}
+		else
+		{
+			// glm stores quaternions as x, y, z, w, the order they are saved in.
+			streamHelper.ReadArray(mRotations);
+		}
+
+		streamHelper.ReadArray(mScales);
+	}
+
+	void BoneAnimation::SaveCompressed(OutputStreamHelper& streamHelper) const
+	{
+		streamHelper << CompressedMarker;
+
+		streamHelper.WriteArray(mTimes);
+		streamHelper.WriteArray(mTranslations);
+
+		const bool isRotationPacked = !mPackedRotations.IsEmpty();
+		streamHelper << isRotationPacked;
+
+		if (isRotationPacked)
+		{
+			Vector<std::uint64_t> packedBits(mPackedRotations.Size());
+			for (const auto& packedRotation : mPackedRotations)
+			{
+				packedBits.EmplaceBack(std::uint64_t(packedRotation.Bits[0]) | (std::uint64_t(packedRotation.Bits[1]) << 16) | (std::uint64_t(packedRotation.Bits[2]) << 32));
+			}
+
+			streamHelper.WriteArray(packedBits);
+		}
+		else
+		{
+			streamHelper.WriteArray(mRotations);
+		}
+
+		streamHelper.WriteArray(mScales);
+	}
+
+	void BoneAnimation::Sample(const float time, std::uint32_t& cursor, glm::vec3& translation, glm::quat& rotation, glm::vec3& scale) const
+	{
+		if (time <= mTimes.Front())
+		{
+			// Specified time is before the start time of the animation, so return the first keyframe
+			translation = Translation(0);
+			rotation = Rotation(0);
+			scale = Scale(0);
+		}
+		else if (time >= mTimes.Back())
+		{
+			// Specified time is after the end time of the animation, so return the last keyframe
+			const std::uint32_t lastIndex = KeyframeCount() - 1;
+			translation = Translation(lastIndex);
+			rotation = Rotation(lastIndex);
+			scale = Scale(lastIndex);
+		}
+		else
+		{
+			// Interpolate the transform between keyframes
+			const std::uint32_t indexOne = FindKeyframeIndex(time, cursor);
+			const std::uint32_t indexTwo = indexOne + 1;
+
+			const float lerpValue = ((time - mTimes[indexOne]) / (mTimes[indexTwo] - mTimes[indexOne]));
+			translation = glm::lerp(Translation(indexOne), Translation(indexTwo), lerpValue);
+			rotation = glm::slerp(Rotation(indexOne), Rotation(indexTwo), lerpValue);
+			scale = glm::lerp(Scale(indexOne), Scale(indexTwo), lerpValue);
+		}
+	}
+
+	void BoneAnimation::AddKeyframes(const Vector<std::shared_ptr<const Keyframe>>& keyframes)
+	{
+		mTimes.Reserve(keyframes.Size());
+		mTranslations.Reserve(keyframes.Size());
+		mRotations.Reserve(keyframes.Size());
+		mScales.Reserve(keyframes.Size());
+
+		for (const auto& keyframe : keyframes)
+		{
+			AddKeyframe(*keyframe);
+		}
+	}
+
+	void BoneAnimation::AddKeyframe(const Keyframe& keyframe)
+	{
+		mTimes.EmplaceBack(keyframe.Time());
+		mTranslations.EmplaceBack(keyframe.Translation());
+		mRotations.EmplaceBack(keyframe.RotationQuaternion());
+		mScales.EmplaceBack(keyframe.Scale());
+	}
+
+	Transform BoneAnimation::GetTransformAt(const std::uint32_t keyframeIndex) const
+	{
+		return Transform(Translation(keyframeIndex), Rotation(keyframeIndex), Scale(keyframeIndex));
+	}
+
 	uint32_t BoneAnimation::FindKeyframeIndex(const float time) const
 	{
-		const std::shared_ptr<const Keyframe>& firstKeyframe = mKeyframes.Front();
-		if (time <= firstKeyframe->Time())
+		if (time <= mTimes.Front())
 		{
 			return 0;
 		}
 
-		const std::shared_ptr<const Keyframe>& lastKeyframe = mKeyframes.Back();
-		if (time >= lastKeyframe->Time())
+		if (time >= mTimes.Back())
+		{
+			return gsl::narrow_cast<uint32_t>(mTimes.Size() - 1);
+		}
+
+		// Binary search for the first keyframe after the time, within the interior keyframes.
+		std::size_t low = 1;
+		std::size_t high = mTimes.Size() - 1;
+
+		while (low < high)
 		{
-			return gsl::narrow_cast<uint32_t>(mKeyframes.Size() - 1);
+			const std::size_t middle = low + (high - low) / 2;
+
+			if (time >= mTimes[middle])
+			{
+				low = middle + 1;
+			}
+			else
+			{
+				high = middle;
+			}
 		}
 
-		uint32_t keyframeIndex = 1;
+		return gsl::narrow_cast<uint32_t>(low - 1);
+	}
 
-		for (; keyframeIndex < mKeyframes.Size() - 1 && time >= mKeyframes[keyframeIndex]->Time(); keyframeIndex++);
+	uint32_t BoneAnimation::FindKeyframeIndex(const float time, std::uint32_t& cursor) const
+	{
+		// Playback mostly moves forward by less than a keyframe per call, so the cursor or its successor usually holds the time.
+		if (cursor + std::size_t(1) < mTimes.Size() && time >= mTimes[cursor])
+		{
+			if (time < mTimes[cursor + std::size_t(1)])
+			{
+				return cursor;
+			}
+
+			if (cursor + std::size_t(2) < mTimes.Size() && time < mTimes[cursor + std::size_t(2)])
+			{
+				return ++cursor;
+			}
+		}
 
-		return keyframeIndex - 1;
+		cursor = FindKeyframeIndex(time);
+		return cursor;
 	}
 }
@@ -1,8 +1,15 @@
 #pragma once
 
 #pragma region Includes
+// Third Party
+#pragma warning(disable : 4201)
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+#pragma warning(default : 4201)
+
 // First Party
 #include "Vector.h"
+#include "MathUtility.h"
 #pragma endregion Includes
 
 namespace Library
@@ -23,6 +30,8 @@ namespace Library
 
     class BoneAnimation final
     {
+		friend class AnimationCompressor;
+
     public:
 		BoneAnimation(Model& model, InputStreamHelper& streamHelper);
 		BoneAnimation(Model& model, const BoneAnimationData& boneAnimationData);
@@ -33,21 +42,73 @@ namespace Library
 		BoneAnimation& operator=(BoneAnimation&& rhs) = default;
 		~BoneAnimation() = default;
 
-		const Bone& GetBone() const;    	
-		const Vector<std::shared_ptr<const Keyframe>>& Keyframes() const;
+		const Bone& GetBone() const;
+		std::uint32_t KeyframeCount() const;
+
+		// Keyframe tracks, stored as parallel arrays indexed by keyframe. Constant tracks hold a single value, and rotations may be packed.
+		const Vector<float>& Times() const;
+		glm::vec3 Translation(const std::uint32_t keyframeIndex) const;
+		glm::quat Rotation(const std::uint32_t keyframeIndex) const;
+		glm::vec3 Scale(const std::uint32_t keyframeIndex) const;
+
+		/// <summary>
+		/// Gets whether the tracks were compressed by AnimationCompressor, having constant tracks or packed rotations.
+		/// </summary>
+		bool IsCompressed() const;
+
+		/// <summary>
+		/// Gets the memory used by the keyframe tracks.
+		/// </summary>
+		/// <returns>Size of the tracks in bytes.</returns>
+		std::size_t SizeInBytes() const;
 
 		std::uint32_t GetTransform(const float time, Transform& transform) const;
 		void GetTransformAtKeyframe(std::uint32_t keyframeIndex, Transform& transform) const;
 		void GetInterpolatedTransform(const float time, Transform& transform) const;
 
+		/// <summary>
+		/// Samples the keyframe at a time, starting the search from a cursor owned by the caller's playback instance.
+		/// </summary>
+		/// <param name="cursor">Keyframe index found by the previous call, updated to the index found by this call.</param>
+		/// <returns>Index of the keyframe sampled.</returns>
+		std::uint32_t GetTransform(const float time, Transform& transform, std::uint32_t& cursor) const;
+
+		/// <summary>
+		/// Interpolates between the keyframes around a time, starting the search from a cursor owned by the caller's playback instance.
+		/// </summary>
+		/// <param name="cursor">Keyframe index found by the previous call, updated to the index found by this call.</param>
+		void GetInterpolatedTransform(const float time, Transform& transform, std::uint32_t& cursor) const;
+
+		/// <summary>
+		/// Finds the keyframe at or before a time, starting the search from a cursor owned by the caller's playback instance.
+		/// </summary>
+		/// <param name="cursor">Keyframe index found by the previous call, updated to the index found by this call.</param>
+		/// <returns>Index of the keyframe, clamped to the first and last keyframes.</returns>
+		std::uint32_t FindKeyframeIndex(const float time, std::uint32_t& cursor) const;
+
 		void Save(OutputStreamHelper& streamHelper) const;
 
     private:
+		/// <summary>
+		/// Keyframe count written in place of the keyframes' own, marking a compressed track layout.
+		/// </summary>
+		inline static constexpr std::uint32_t CompressedMarker = 0xFFFFFFFF;
+
 		void Load(InputStreamHelper& streamHelper);
+		void LoadCompressed(InputStreamHelper& streamHelper);
+		void SaveCompressed(OutputStreamHelper& streamHelper) const;
+		void Sample(const float time, std::uint32_t& cursor, glm::vec3& translation, glm::quat& rotation, glm::vec3& scale) const;
+		void AddKeyframes(const Vector<std::shared_ptr<const Keyframe>>& keyframes);
+		void AddKeyframe(const Keyframe& keyframe);
+		Transform GetTransformAt(const std::uint32_t keyframeIndex) const;
 		std::uint32_t FindKeyframeIndex(const float time) const;
 
 		Model* mModel;
 		std::weak_ptr<Bone> mBone;
-		Vector<std::shared_ptr<const Keyframe>> mKeyframes;
+		Vector<float> mTimes;
+		Vector<glm::vec3> mTranslations;
+		Vector<glm::quat> mRotations;
+		Vector<Math::PackedQuaternion> mPackedRotations{ Vector<Math::PackedQuaternion>::EqualityFunctor() };	// Used in place of mRotations when rotations are packed
+		Vector<glm::vec3> mScales;
     };
 }
@@ -0,0 +1,492 @@
+#pragma region Includes
+// Pre-compiled Header
+#include "pch.h"
+
+// Header
+#include "CompiledExpression.h"
+
+// Standard
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+
+// First Party
+#include "Scope.h"
+#pragma endregion Includes
+
+namespace Library
+{
+#pragma region Compiler
+	class CompiledExpression::Compiler final
+	{
+	public:
+		Compiler(const std::string& source, Scope& context, CompiledExpression& expression) :
+			mSource(source), mContext(context), mExpression(expression)
+		{
+		}
+
+		/// <summary>
+		/// Compiles the whole source, leaving the result type and stack size set on the expression.
+		/// </summary>
+		void Run()
+		{
+			SkipWhitespace();
+			if (AtEnd()) return;
+
+			mExpression.mResultType = ParseOr();
+
+			SkipWhitespace();
+			if (!AtEnd()) throw std::runtime_error("Unexpected character in expression.");
+
+			mExpression.mStack.Resize(mMaxDepth + 1);
+		}
+
+	private:
+		using Types = Datum::Types;
+
+		/// <summary>
+		/// Binary operator, with the instructions emitted for integer and float operands.
+		/// </summary>
+		struct BinaryOperator final
+		{
+			const char* Token;
+			OpCode IntegerOp;
+			OpCode FloatOp;
+		};
+
+#pragma region Grammar
+		Types ParseOr()
+		{
+			Types type = ParseAnd();
+
+			while (Match("||"))
+			{
+				type = EmitLogical(type, ParseAnd(), OpCode::Or);
+			}
+
+			return type;
+		}
+
+		Types ParseAnd()
+		{
+			Types type = ParseEquality();
+
+			while (Match("&&"))
+			{
+				type = EmitLogical(type, ParseEquality(), OpCode::And);
+			}
+
+			return type;
+		}
+
+		Types ParseEquality()
+		{
+			static const BinaryOperator operators[] =
+			{
+				{ "==", OpCode::EqualInteger, OpCode::EqualFloat },
+				{ "!=", OpCode::NotEqualInteger, OpCode::NotEqualFloat }
+			};
+
+			return ParseBinary(operators, &Compiler::ParseRelational, true);
+		}
+
+		Types ParseRelational()
+		{
+			static const BinaryOperator operators[] =
+			{
+				{ "<=", OpCode::LessEqualInteger, OpCode::LessEqualFloat },
+				{ ">=", OpCode::GreaterEqualInteger, OpCode::GreaterEqualFloat },
+				{ "<", OpCode::LessInteger, OpCode::LessFloat },
+				{ ">", OpCode::GreaterInteger, OpCode::GreaterFloat }
+			};
+
+			return ParseBinary(operators, &Compiler::ParseAdditive, true);
+		}
+
+		Types ParseAdditive()
+		{
+			static const BinaryOperator operators[] =
+			{
+				{ "+", OpCode::AddInteger, OpCode::AddFloat },
+				{ "-", OpCode::SubtractInteger, OpCode::SubtractFloat }
+			};
+
+			return ParseBinary(operators, &Compiler::ParseMultiplicative, false);
+		}
+
+		Types ParseMultiplicative()
+		{
+			static const BinaryOperator operators[] =
+			{
+				{ "*", OpCode::MultiplyInteger, OpCode::MultiplyFloat },
+				{ "/", OpCode::DivideInteger, OpCode::DivideFloat },
+				{ "%", OpCode::Modulo, OpCode::Modulo }
+			};
+
+			return ParseBinary(operators, &Compiler::ParseUnary, false);
+		}
+
+		template <std::size_t Count>
+		Types ParseBinary(const BinaryOperator (&operators)[Count], Types (Compiler::*parseOperand)(), const bool isComparison)
+		{
+			Types type = (this->*parseOperand)();
+
+			for (;;)
+			{
+				const BinaryOperator* matched = nullptr;
+
+				for (const auto& binaryOperator : operators)
+				{
+					if (MatchOperator(binaryOperator.Token))
+					{
+						matched = &binaryOperator;
+						break;
+					}
+				}
+
+				if (matched == nullptr) return type;
+
+				const Types rhsType = (this->*parseOperand)();
+
+				if (matched->IntegerOp == OpCode::Modulo && (type != Types::Integer || rhsType != Types::Integer))
+				{
+					throw std::runtime_error("Modulo requires integer operands.");
+				}
+
+				const Types operandType = Promote(type, rhsType);
+				Emit(operandType == Types::Float ? matched->FloatOp : matched->IntegerOp);
+				Pop();
+
+				type = isComparison ? Types::Integer : operandType;
+			}
+		}
+
+		Types ParseUnary()
+		{
+			SkipWhitespace();
+
+			if (MatchOperator("-"))
+			{
+				const Types type = ParseUnary();
+				Emit(type == Types::Float ? OpCode::NegateFloat : OpCode::NegateInteger);
+				return type;
+			}
+
+			if (MatchOperator("!"))
+			{
+				if (ParseUnary() == Types::Float) Emit(OpCode::FloatToBoolean);
+				Emit(OpCode::Not);
+				return Types::Integer;
+			}
+
+			return ParsePrimary();
+		}
+
+		Types ParsePrimary()
+		{
+			SkipWhitespace();
+			if (AtEnd()) throw std::runtime_error("Unexpected end of expression.");
+
+			const char current = mSource[mPosition];
+
+			if (current == '(')
+			{
+				++mPosition;
+				const Types type = ParseOr();
+				if (!Match(")")) throw std::runtime_error("Missing closing parenthesis in expression.");
+				return type;
+			}
+
+			if (std::isdigit(static_cast<unsigned char>(current)) || current == '.')
+			{
+				return ParseNumber();
+			}
+
+			if (std::isalpha(static_cast<unsigned char>(current)) || current == '_')
+			{
+				return ParseOperand();
+			}
+
+			throw std::runtime_error("Unexpected character in expression.");
+		}
+
+		Types ParseNumber()
+		{
+			const char* begin = mSource.c_str() + mPosition;
+			char* end = nullptr;
+
+			const std::size_t length = std::strspn(begin, "0123456789.");
+			const bool isFloat = std::memchr(begin, '.', length) != nullptr;
+
+			Value value;
+			if (isFloat)	value.Float = std::strtof(begin, &end);
+			else			value.Integer = static_cast<int>(std::strtol(begin, &end, 10));
+
+			if (end == begin) throw std::runtime_error("Malformed number in expression.");
+			mPosition += static_cast<std::size_t>(end - begin);
+
+			mExpression.mConstants.PushBack(value);
+			Emit(OpCode::Constant, Index(mExpression.mConstants.Size() - 1));
+			Push();
+
+			return isFloat ? Types::Float : Types::Integer;
+		}
+
+		Types ParseOperand()
+		{
+			const std::size_t begin = mPosition;
+
+			while (!AtEnd() && (std::isalnum(static_cast<unsigned char>(mSource[mPosition])) || mSource[mPosition] == '_'))
+			{
+				++mPosition;
+			}
+
+			Datum* operand = mContext.Search(mSource.substr(begin, mPosition - begin));
+			if (operand == nullptr) throw std::runtime_error("Expression operand not found.");
+
+			const Types type = operand->Type();
+			if ((type != Types::Integer && type != Types::Float) || operand->Size() == 0)
+			{
+				throw std::runtime_error("Expression operand must be a non-empty integer or float.");
+			}
+
+			std::size_t index = 0;
+			while (index < mExpression.mOperands.Size() && mExpression.mOperands[index] != operand) ++index;
+			if (index == mExpression.mOperands.Size()) mExpression.mOperands.PushBack(operand);
+
+			Emit(type == Types::Float ? OpCode::LoadFloat : OpCode::LoadInteger, Index(index));
+			Push();
+
+			return type;
+		}
+#pragma endregion Grammar
+
+#pragma region Emission
+		/// <summary>
+		/// Converts the top two operands to a common type, returning that type.
+		/// </summary>
+		Types Promote(const Types lhs, const Types rhs)
+		{
+			if (lhs == rhs) return lhs;
+
+			Emit(lhs == Types::Integer ? OpCode::IntegerToFloatBelow : OpCode::IntegerToFloat);
+			return Types::Float;
+		}
+
+		/// <summary>
+		/// Converts the top two operands to booleans and emits a logical operator.
+		/// </summary>
+		Types EmitLogical(const Types lhs, const Types rhs, const OpCode op)
+		{
+			if (lhs == Types::Float) Emit(OpCode::FloatToBooleanBelow);
+			if (rhs == Types::Float) Emit(OpCode::FloatToBoolean);
+
+			Emit(op);
+			Pop();
+
+			return Types::Integer;
+		}
+
+		void Emit(const OpCode op, const std::uint16_t argument=0)
+		{
+			mExpression.mCode.PushBack({ op, argument });
+		}
+
+		static std::uint16_t Index(const std::size_t index)
+		{
+			if (index > std::numeric_limits<std::uint16_t>::max()) throw std::runtime_error("Expression is too large.");
+			return static_cast<std::uint16_t>(index);
+		}
+
+		void Push()
+		{
+			mMaxDepth = std::max(mMaxDepth, ++mDepth);
+		}
+
+		void Pop()
+		{
+			--mDepth;
+		}
+#pragma endregion Emission
+
+#pragma region Lexing
+		bool AtEnd() const
+		{
+			return mPosition >= mSource.size();
+		}
+
+		void SkipWhitespace()
+		{
+			while (!AtEnd() && std::isspace(static_cast<unsigned char>(mSource[mPosition]))) ++mPosition;
+		}
+
+		/// <summary>
+		/// Consumes a token if it is next in the source.
+		/// </summary>
+		bool Match(const char* token)
+		{
+			SkipWhitespace();
+
+			const std::size_t length = std::strlen(token);
+			if (mSource.compare(mPosition, length, token) != 0) return false;
+
+			mPosition += length;
+			return true;
+		}
+
+		/// <summary>
+		/// Consumes a single character operator, unless it begins a longer operator.
+		/// </summary>
+		bool MatchOperator(const char* token)
+		{
+			SkipWhitespace();
+
+			const std::size_t length = std::strlen(token);
+			if (mSource.compare(mPosition, length, token) != 0) return false;
+
+			if (length == 1 && mPosition + 1 < mSource.size())
+			{
+				const char next = mSource[mPosition + 1];
+				if (next == '=' && (*token == '<' || *token == '>' || *token == '!')) return false;
+			}
+
+			mPosition += length;
+			return true;
+		}
+#pragma endregion Lexing
+
+	private:
+		const std::string& mSource;
+		Scope& mContext;
+		CompiledExpression& mExpression;
+
+		std::size_t mPosition{ 0 };
+		std::size_t mDepth{ 0 };
+		std::size_t mMaxDepth{ 0 };
+	};
+#pragma endregion Compiler
+
+#pragma region Special Members
+	CompiledExpression CompiledExpression::Compile(const std::string& source, Scope& context)
+	{
+		CompiledExpression expression;
+		Compiler(source, context, expression).Run();
+		return expression;
+	}
+#pragma endregion Special Members
+
+#pragma region Accessors
+	std::string CompiledExpression::ShapeKey() const
+	{
+		std::string key;
+		if (IsEmpty()) return key;
+
+		const std::size_t codeSize = mCode.Size();
+		key.reserve(sizeof(codeSize) + codeSize * (sizeof(OpCode) + sizeof(std::uint16_t)) + mConstants.Size() * sizeof(Value));
+		key.append(reinterpret_cast<const char*>(&codeSize), sizeof(codeSize));
+
+		for (const auto& instruction : mCode)
+		{
+			key.append(reinterpret_cast<const char*>(&instruction.Op), sizeof(instruction.Op));
+			key.append(reinterpret_cast<const char*>(&instruction.Argument), sizeof(instruction.Argument));
+		}
+
+		for (const auto& constant : mConstants)
+		{
+			key.append(reinterpret_cast<const char*>(&constant), sizeof(constant));
+		}
+
+		return key;
+	}
+#pragma endregion Accessors
+
+#pragma region Evaluation
+	CompiledExpression::Value CompiledExpression::Evaluate() const
+	{
+		if (IsEmpty()) return Value{ 0 };
+
+		// Slot zero is left unused, so that top always points at the topmost value.
+		Value* const stack = &mStack[0];
+		Value* top = stack;
+
+		for (const auto& instruction : mCode)
+		{
+			switch (instruction.Op)
+			{
+			case OpCode::LoadInteger:			(++top)->Integer = mOperands[instruction.Argument]->Get<int>();				break;
+			case OpCode::LoadFloat:				(++top)->Float = mOperands[instruction.Argument]->Get<float>();				break;
+			case OpCode::Constant:				*++top = mConstants[instruction.Argument];									break;
+			case OpCode::IntegerToFloat:		top->Float = static_cast<float>(top->Integer);								break;
+			case OpCode::IntegerToFloatBelow:	top[-1].Float = static_cast<float>(top[-1].Integer);						break;
+			case OpCode::FloatToBoolean:		top->Integer = top->Float != 0.0f;											break;
+			case OpCode::FloatToBooleanBelow:	top[-1].Integer = top[-1].Float != 0.0f;									break;
+
+			case OpCode::NegateInteger:			top->Integer = -top->Integer;												break;
+			case OpCode::NegateFloat:			top->Float = -top->Float;													break;
+			case OpCode::Not:					top->Integer = !top->Integer;												break;
+
+			case OpCode::AddInteger:			top[-1].Integer += top->Integer; --top;										break;
+			case OpCode::AddFloat:				top[-1].Float += top->Float; --top;											break;
+			case OpCode::SubtractInteger:		top[-1].Integer -= top->Integer; --top;										break;
+			case OpCode::SubtractFloat:			top[-1].Float -= top->Float; --top;											break;
+			case OpCode::MultiplyInteger:		top[-1].Integer *= top->Integer; --top;										break;
+			case OpCode::MultiplyFloat:			top[-1].Float *= top->Float; --top;											break;
+			case OpCode::DivideFloat:			top[-1].Float /= top->Float; --top;											break;
+
+			// Dividing the smallest integer by -1 overflows, which traps rather than wrapping, so -1 is negated with wrapping instead.
+			case OpCode::DivideInteger:
+				if (top->Integer == 0) throw std::runtime_error("Integer division by zero.");
+				top[-1].Integer = top->Integer == -1 ? static_cast<int>(0u - static_cast<unsigned int>(top[-1].Integer)) : top[-1].Integer / top->Integer; --top;
+				break;
+
+			case OpCode::Modulo:
+				if (top->Integer == 0) throw std::runtime_error("Integer division by zero.");
+				top[-1].Integer = top->Integer == -1 ? 0 : top[-1].Integer % top->Integer; --top;
+				break;
+
+			case OpCode::LessInteger:			top[-1].Integer = top[-1].Integer < top->Integer; --top;					break;
+			case OpCode::LessFloat:				top[-1].Integer = top[-1].Float < top->Float; --top;						break;
+			case OpCode::LessEqualInteger:		top[-1].Integer = top[-1].Integer <= top->Integer; --top;					break;
+			case OpCode::LessEqualFloat:		top[-1].Integer = top[-1].Float <= top->Float; --top;						break;
+			case OpCode::GreaterInteger:		top[-1].Integer = top[-1].Integer > top->Integer; --top;					break;
+			case OpCode::GreaterFloat:			top[-1].Integer = top[-1].Float > top->Float; --top;						break;
+			case OpCode::GreaterEqualInteger:	top[-1].Integer = top[-1].Integer >= top->Integer; --top;					break;
+			case OpCode::GreaterEqualFloat:		top[-1].Integer = top[-1].Float >= top->Float; --top;						break;
+			case OpCode::EqualInteger:			top[-1].Integer = top[-1].Integer == top->Integer; --top;					break;
+			case OpCode::EqualFloat:			top[-1].Integer = top[-1].Float == top->Float; --top;						break;
+			case OpCode::NotEqualInteger:		top[-1].Integer = top[-1].Integer != top->Integer; --top;					break;
+			case OpCode::NotEqualFloat:			top[-1].Integer = top[-1].Float != top->Float; --top;						break;
+
+			case OpCode::And:					top[-1].Integer = top[-1].Integer != 0 && top->Integer != 0; --top;			break;
+			case OpCode::Or:					top[-1].Integer = top[-1].Integer != 0 || top->Integer != 0; --top;			break;
+
+			default:							throw std::runtime_error("Invalid expression instruction.");
+			}
+		}
+
+		assert(top == stack + 1);
+		return *top;
+	}
+
+	void CompiledExpression::Store(const Value value, const Datum::Types type, Datum& result)
+	{
+		if (result.Type() == Datum::Types::Unknown) result.SetType(type);
+		if (result.Size() == 0) result.Resize(1);
+
+		switch (result.Type())
+		{
+		case Datum::Types::Integer:
+			result.Get<int>() = type == Datum::Types::Float ? static_cast<int>(value.Float) : value.Integer;
+			break;
+
+		case Datum::Types::Float:
+			result.Get<float>() = type == Datum::Types::Float ? value.Float : static_cast<float>(value.Integer);
+			break;
+
+		default:
+			throw std::runtime_error("Expression result must be an integer or float.");
+		}
+	}
+#pragma endregion Evaluation
+}
@@ -0,0 +1,262 @@
+#pragma once
+
+#pragma region Includes
+// Standard
+#include <cstdint>
+#include <string>
+
+// First Party
+#include "Datum.h"
+#include "Vector.h"
+#pragma endregion Includes
+
+namespace Library
+{
+	// Forward Declarations
+	class Scope;
+
+	/// <summary>
+	/// Algebraic expression compiled to stack machine bytecode over integer and float Datum operands.
+	/// </summary>
+	/// <remarks>
+	/// Supports integer and float literals, operand names resolved with Scope::Search, parentheses,
+	/// unary - and !, and the binary operators * / % + - &lt; &lt;= &gt; &gt;= == != &amp;&amp; ||, with C precedence.
+	/// Mixed integer and float arithmetic is promoted to float. Comparisons and logical operators yield integers.
+	/// Operands are bound to their Datum when compiled, so evaluation performs no lookups, string handling, or allocation.
+	/// </remarks>
+	class CompiledExpression final
+	{
+#pragma region Type Definitions, Constants
+	public:
+		/// <summary>
+		/// Bytecode instruction set. Typed variants are selected at compile time.
+		/// </summary>
+		enum class OpCode : std::uint8_t
+		{
+			LoadInteger,
+			LoadFloat,
+			Constant,
+			IntegerToFloat,
+			IntegerToFloatBelow,
+			FloatToBoolean,
+			FloatToBooleanBelow,
+
+			NegateInteger,
+			NegateFloat,
+			Not,
+
+			AddInteger,
+			AddFloat,
+			SubtractInteger,
+			SubtractFloat,
+			MultiplyInteger,
+			MultiplyFloat,
+			DivideInteger,
+			DivideFloat,
+			Modulo,
+
+			LessInteger,
+			LessFloat,
+			LessEqualInteger,
+			LessEqualFloat,
+			GreaterInteger,
+			GreaterFloat,
+			GreaterEqualInteger,
+			GreaterEqualFloat,
+			EqualInteger,
+			EqualFloat,
+			NotEqualInteger,
+			NotEqualFloat,
+
+			And,
+			Or
+		};
+
+		/// <summary>
+		/// Single bytecode instruction.
+		/// </summary>
+		struct Instruction final
+		{
+			/// <summary>
+			/// Operation to perform.
+			/// </summary>
+			OpCode Op;
+
+			/// <summary>
+			/// Index into the operand or constant table, for instructions that load a value.
+			/// </summary>
+			std::uint16_t Argument{ 0 };
+		};
+
+		/// <summary>
+		/// Untyped stack slot. The active member is known from the bytecode.
+		/// </summary>
+		union Value
+		{
+			int Integer;
+			float Float;
+		};
+#pragma endregion Type Definitions, Constants
+
+#pragma region Special Members
+	public:
+		/// <summary>
+		/// Default constructor. Creates an empty expression that evaluates to nothing.
+		/// </summary>
+		CompiledExpression() = default;
+
+		/// <summary>
+		/// Default destructor.
+		/// </summary>
+		~CompiledExpression() = default;
+
+		/// <summary>
+		/// Copy constructor.
+		/// </summary>
+		/// <param name="rhs">CompiledExpression to be copied.</param>
+		CompiledExpression(const CompiledExpression& rhs) = default;
+
+		/// <summary>
+		/// Copy assignment operator.
+		/// </summary>
+		/// <param name="rhs">CompiledExpression to be copied.</param>
+		/// <returns>Newly copied into left hand side CompiledExpression.</returns>
+		CompiledExpression& operator=(const CompiledExpression& rhs) = default;
+
+		/// <summary>
+		/// Move constructor.
+		/// </summary>
+		/// <param name="rhs">CompiledExpression to be moved.</param>
+		CompiledExpression(CompiledExpression&& rhs) noexcept = default;
+
+		/// <summary>
+		/// Move assignment operator.
+		/// </summary>
+		/// <param name="rhs">CompiledExpression to be moved.</param>
+		/// <returns>Newly moved into left hand side CompiledExpression.</returns>
+		CompiledExpression& operator=(CompiledExpression&& rhs) noexcept = default;
+
+		/// <summary>
+		/// Parses and compiles an expression, binding its operand names within the given Scope.
+		/// </summary>
+		/// <param name="source">Expression to be compiled. An empty or blank expression compiles to an empty CompiledExpression.</param>
+		/// <param name="context">Scope from which operand names are searched.</param>
+		/// <returns>Compiled expression.</returns>
+		/// <exception cref="std::runtime_error">Expression is malformed, or an operand is missing or is not an integer or float.</exception>
+		static CompiledExpression Compile(const std::string& source, Scope& context);
+#pragma endregion Special Members
+
+#pragma region Accessors
+	public:
+		/// <summary>
+		/// Gets whether the expression has no instructions.
+		/// </summary>
+		/// <returns>True when empty. Otherwise, false.</returns>
+		bool IsEmpty() const;
+
+		/// <summary>
+		/// Gets the type the expression evaluates to.
+		/// </summary>
+		/// <returns>Types::Integer or Types::Float, or Types::Unknown when empty.</returns>
+		Datum::Types ResultType() const;
+
+		/// <summary>
+		/// Gets the bytecode of the expression.
+		/// </summary>
+		/// <returns>Instructions, in evaluation order.</returns>
+		const Vector<Instruction>& Code() const;
+
+		/// <summary>
+		/// Gets the Datum operands bound by the expression, indexed by load instructions.
+		/// </summary>
+		/// <returns>Operand Datum pointers.</returns>
+		const Vector<Datum*>& Operands() const;
+
+		/// <summary>
+		/// Gets the literal constants of the expression, indexed by Constant instructions.
+		/// </summary>
+		/// <returns>Constant values.</returns>
+		const Vector<Value>& Constants() const;
+
+		/// <summary>
+		/// Gets the maximum number of values on the evaluation stack at once.
+		/// </summary>
+		/// <returns>Maximum stack depth.</returns>
+		std::size_t StackDepth() const;
+
+		/// <summary>
+		/// Gets a key identifying the shape of the expression, i.e. its bytecode and constants, independent of the Datum its operands are bound to.
+		/// Expressions with equal shape keys may be evaluated together, e.g. by an ExpressionBatch.
+		/// </summary>
+		/// <returns>Shape key. Empty when the expression is empty.</returns>
+		std::string ShapeKey() const;
+#pragma endregion Accessors
+
+#pragma region Evaluation
+	public:
+		/// <summary>
+		/// Evaluates the expression.
+		/// </summary>
+		/// <returns>Resulting value, interpreted according to ResultType.</returns>
+		/// <exception cref="std::runtime_error">Integer division or modulo by zero.</exception>
+		Value Evaluate() const;
+
+		/// <summary>
+		/// Evaluates the expression, storing the result as the first element of the given Datum.
+		/// An untyped Datum takes on the result type, and an empty Datum is grown to a single element.
+		/// Otherwise, the result is converted to the integer or float type of the Datum.
+		/// </summary>
+		/// <param name="result">Datum receiving the result.</param>
+		/// <exception cref="std::runtime_error">Result Datum is neither an integer nor a float.</exception>
+		void Evaluate(Datum& result) const;
+
+		/// <summary>
+		/// Stores a value of the given type as the first element of a Datum, as Evaluate does.
+		/// </summary>
+		/// <param name="value">Value to be stored.</param>
+		/// <param name="type">Type of the value, either Types::Integer or Types::Float.</param>
+		/// <param name="result">Datum receiving the value.</param>
+		/// <exception cref="std::runtime_error">Result Datum is neither an integer nor a float.</exception>
+		static void Store(const Value value, const Datum::Types type, Datum& result);
+#pragma endregion Evaluation
+
+#pragma region Helper Types
+	private:
+		/// <summary>
+		/// Recursive descent parser emitting bytecode into a CompiledExpression.
+		/// </summary>
+		class Compiler;
+#pragma endregion Helper Types
+
+#pragma region Data Members
+	private:
+		/// <summary>
+		/// Bytecode, in evaluation order.
+		/// </summary>
+		Vector<Instruction> mCode{ Vector<Instruction>::EqualityFunctor() };
+
+		/// <summary>
+		/// Datum operands referenced by load instructions.
+		/// </summary>
+		Vector<Datum*> mOperands;
+
+		/// <summary>
+		/// Literal constants referenced by Constant instructions.
+		/// </summary>
+		Vector<Value> mConstants{ Vector<Value>::EqualityFunctor() };
+
+		/// <summary>
+		/// Preallocated evaluation stack, sized to the maximum depth reached by the bytecode, plus an unused bottom slot.
+		/// </summary>
+		mutable Vector<Value> mStack{ Vector<Value>::EqualityFunctor() };
+
+		/// <summary>
+		/// Type the expression evaluates to.
+		/// </summary>
+		Datum::Types mResultType{ Datum::Types::Unknown };
+#pragma endregion Data Members
+	};
+}
+
+// Inline File
+#include "CompiledExpression.inl"
@@ -0,0 +1,48 @@
+#pragma once
+
+// Header
+#include "CompiledExpression.h"
+
+namespace Library
+{
+#pragma region Accessors
+	inline bool CompiledExpression::IsEmpty() const
+	{
+		return mCode.IsEmpty();
+	}
+
+	inline Datum::Types CompiledExpression::ResultType() const
+	{
+		return mResultType;
+	}
+
+	inline const Vector<CompiledExpression::Instruction>& CompiledExpression::Code() const
+	{
+		return mCode;
+	}
+
+	inline const Vector<Datum*>& CompiledExpression::Operands() const
+	{
+		return mOperands;
+	}
+
+	inline const Vector<CompiledExpression::Value>& CompiledExpression::Constants() const
+	{
+		return mConstants;
+	}
+
+	inline std::size_t CompiledExpression::StackDepth() const
+	{
+		return mStack.IsEmpty() ? 0 : mStack.Size() - 1;
+	}
+#pragma endregion Accessors
+
+#pragma region Evaluation
+	inline void CompiledExpression::Evaluate(Datum& result) const
+	{
+		if (IsEmpty()) return;
+
+		Store(Evaluate(), mResultType, result);
+	}
+#pragma endregion Evaluation
+}
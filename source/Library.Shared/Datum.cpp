@@ -657,7 +657,7 @@ namespace Library
 		}
 
 		const std::size_t size = TypeSizeLUT[static_cast<std::size_t>(mType)];
-		std::memmove(&mData.BytePtr[index * size], &mData.BytePtr[(index * size) + size], size * (mSize - index));
+		std::memmove(&mData.BytePtr[index * size], &mData.BytePtr[(index * size) + size], size * (mSize - index - 1));
 
 		--mSize;
 	}
@@ -5,6 +5,9 @@
 // Header
 #include "Entity.h"
 #include "WorldState.h"
+#include "World.h"
+#include "ReclamationQueue.h"
+#include "Profiler.h"
 #pragma endregion Includes
 
 namespace Library
@@ -21,21 +24,14 @@ namespace Library
 	}
 
 	Entity::Entity(std::string name) : Attributed(TypeIdClass()), 
-		mName(std::move(name))
+		mName(std::move(name)), mHandle(EntityHandle::Register(*this))
 	{
 	}
 
 	Entity::Entity(const Entity& rhs) : Attributed(rhs),
-		mName(rhs.mName)
+		mName(rhs.mName), mHandle(EntityHandle::Register(*this))
 	{
-		rhs.ForEachChild([this](const Entity& rhsChild)
-		{
-			assert(Find(rhsChild.mName) && Find(rhsChild.mName)->Size() > 0 
-				&& Find(rhsChild.mName)->Type() == Types::Scope 
-				&& Find(rhsChild.mName)->Get<Scope*>()->Is(Entity::TypeIdClass()));
-			
-			mChildren.EmplaceBack(Find(rhsChild.Name())->Get<Scope*>()->As<Entity>());
-		});
+		CopyChildEntries(rhs);
 	}
 
 	Entity& Entity::operator=(const Entity& rhs)
@@ -43,40 +39,98 @@ namespace Library
 		if (this == &rhs) return *this;
 
 		mName = rhs.mName;
-		Attributed::operator=(rhs);
 
-		rhs.ForEachChild([this](const Entity& rhsChild)
+		while (!mChildren.IsEmpty())
 		{
-			assert(Find(rhsChild.mName));
-			assert(Find(rhsChild.mName)->Size() > 0);
-			assert(Find(rhsChild.mName)->Type() == Types::Scope);
-			assert(Find(rhsChild.mName)->Get<Scope*>()->Is(Entity::TypeIdClass()));
+			RemoveChildEntry(*mChildren.Back());
+		}
 
-			mChildren.EmplaceBack(Find(rhsChild.Name())->Get<Scope*>()->As<Entity>());
-		});
+		Attributed::operator=(rhs);
+
+		CopyChildEntries(rhs);
 		
 		return *this;
 	}
 
 	Entity::Entity(Entity&& rhs) noexcept : Attributed(std::move(rhs)),
-		mName(std::move(rhs.mName)), mChildren(std::move(rhs.mChildren))
+		mName(std::move(rhs.mName)), mEnabled(rhs.mEnabled), mSleeping(rhs.mSleeping), 
+		mChildren(std::move(rhs.mChildren)), mChildHoleCount(rhs.mChildHoleCount), mActiveChildren(std::move(rhs.mActiveChildren)), 
+		mActiveHoleCount(rhs.mActiveHoleCount), mActiveChildrenOrdered(rhs.mActiveChildrenOrdered), mActivePassSuspended(rhs.mActivePassSuspended),
+		mLastActiveOrder(rhs.mLastActiveOrder), mNextChildOrder(rhs.mNextChildOrder), mChildSetVersion(rhs.mChildSetVersion),
+		mChildSlots(std::move(rhs.mChildSlots)), mFreeChildSlot(rhs.mFreeChildSlot), mHandle(rhs.mHandle)
 	{
+		rhs.mChildHoleCount = 0;
+		rhs.mActiveHoleCount = 0;
+		rhs.mFreeChildSlot = InvalidSlot;
+		rhs.mHandle = EntityHandle();
+		EntityHandle::Retarget(mHandle, *this);
+
+		ReplaceInParent(rhs);
 	}
 
 	Entity& Entity::operator=(Entity&& rhs) noexcept
 	{
 		if (this == &rhs) return *this;
 
+		if (Entity* parent = GetParent())
+		{
+			parent->RemoveChildEntry(*this);
+		}
+
+		if (mWakeScheduler)
+		{
+			mWakeScheduler->CancelWake(*this);
+		}
+
 		mName = std::move(rhs.mName);
+		mEnabled = rhs.mEnabled;
+		mSleeping = rhs.mSleeping;
 		mChildren = std::move(rhs.mChildren);
+		mChildHoleCount = rhs.mChildHoleCount;
+		rhs.mChildHoleCount = 0;
+		mActiveChildren = std::move(rhs.mActiveChildren);
+		mActiveHoleCount = rhs.mActiveHoleCount;
+		mActiveChildrenOrdered = rhs.mActiveChildrenOrdered;
+		mActivePassSuspended = rhs.mActivePassSuspended;
+		mLastActiveOrder = rhs.mLastActiveOrder;
+		mNextChildOrder = rhs.mNextChildOrder;
+		mChildSetVersion = rhs.mChildSetVersion;
+		rhs.mActiveHoleCount = 0;
+		mChildSlots = std::move(rhs.mChildSlots);
+		mFreeChildSlot = rhs.mFreeChildSlot;
+		rhs.mFreeChildSlot = InvalidSlot;
+
+		EntityHandle::Unregister(mHandle);
+		mHandle = rhs.mHandle;
+		rhs.mHandle = EntityHandle();
+		EntityHandle::Retarget(mHandle, *this);
 		
 		Attributed::operator=(std::move(rhs));
+
+		ReplaceInParent(rhs);
 		
 		return *this;
 	}
 
+	Entity::~Entity()
+	{
+		if (mWakeScheduler)
+		{
+			mWakeScheduler->CancelWake(*this);
+		}
+
+		Scope* parent = Scope::GetParent();
+
+		if (parent && parent->Is(Entity::TypeIdClass()))
+		{
+			static_cast<Entity*>(parent)->RemoveChildEntry(*this);
+		}
+
+		EntityHandle::Unregister(mHandle);
+	}
+
 	Entity::Entity(const IdType typeId, std::string name) : Attributed(typeId),
-		mName(std::move(name))
+		mName(std::move(name)), mHandle(EntityHandle::Register(*this))
 	{
 	}
 
@@ -99,36 +153,70 @@ namespace Library
 		if (entity == nullptr)
 		{
 			Entity* parent = GetParent();
-			if (parent) parent->Orphan(*this);
+
+			if (parent)
+			{
+				parent->RemoveChildEntry(*this);
+				parent->Orphan(*this);
+			}
 		}
 		else
 		{
-			entity->Adopt(*this, mName);
+			entity->AddChild(*this);
 		}
 	}
 
+	void Entity::SetEnabled(const bool enabled)
+	{
+		mEnabled = enabled;
+
+		Entity* parent = GetParent();
+		if (mEnabled && parent) parent->ActivateChild(*this);
+	}
+
 	void Entity::ForEachChild(const std::function<void(Entity&)>& functor)
 	{
 		mUpdatingChildren = true;
 		
 		for (auto* child : mChildren)
 		{
-			assert(child != nullptr);
-			functor(*child);
+			if (child) functor(*child);
 		};
 
 		mUpdatingChildren = false;
+
+		if (mChildHoleCount * 2 > mChildren.Size()) CompactChildren();
 	}
 
 	void Entity::ForEachChild(const std::function<void(const Entity&)>& functor) const
 	{		
 		for (auto* child : mChildren)
 		{
-			assert(child != nullptr);
-			functor(*child);
+			if (child) functor(*child);
 		};
 	}
 
+	Entity& Entity::ChildAt(const std::size_t index)
+	{
+		if (mChildHoleCount > 0 && !mUpdatingChildren) CompactChildren();
+
+		return const_cast<Entity&>(static_cast<const Entity*>(this)->ChildAt(index));
+	}
+
+	const Entity& Entity::ChildAt(const std::size_t index) const
+	{
+		if (mChildHoleCount == 0) return *mChildren.At(index);
+
+		std::size_t remaining = index;
+
+		for (auto* child : mChildren)
+		{
+			if (child && remaining-- == 0) return *child;
+		}
+
+		throw std::out_of_range("Index is out of bounds.");
+	}
+
 	Entity& Entity::AddChild(Entity& child)
 	{
 		if (mUpdatingChildren)
@@ -143,8 +231,12 @@ namespace Library
 		}
 		else
 		{
+			Entity* oldParent = child.GetParent();
+
 			Adopt(child, child.Name());
-			mChildren.EmplaceBack(&child);
+
+			if (oldParent) oldParent->RemoveChildEntry(child);
+			InsertChildEntry(child);
 		}
 
 		return child;
@@ -164,9 +256,25 @@ namespace Library
 		}
 		else
 		{
-			mChildren.Remove(&child);
-			delete Orphan(child);
+			RemoveChildEntry(child);
+			ReclaimChild(child, FindReclamationQueue());
+		}
+	}
+
+	void Entity::DestroyChild(const ChildHandle& handle)
+	{
+		Entity* child = FindChild(handle);
+		if (child) DestroyChild(*child);
+	}
+
+	Entity::ChildHandle Entity::GetChildHandle(const Entity& child) const
+	{
+		if (child.GetParent() != this || child.mSlot == InvalidSlot)
+		{
+			throw std::runtime_error("Entity is not a child.");
 		}
+
+		return { child.mSlot, mChildSlots[child.mSlot].Generation };
 	}
 
 	Entity& Entity::CreateChild(const std::string& className, const std::string& name)
@@ -193,12 +301,60 @@ namespace Library
 		else
 		{
 			Adopt(*child, name);
-			mChildren.EmplaceBack(child);
+			InsertChildEntry(*child);
 		}
 
 		return *child;
 	}
 
+	void Entity::ReserveChildren(const std::size_t count)
+	{
+		if (mUpdatingChildren) mPendingChildren.Reserve(mPendingChildren.Size() + count);
+
+		mChildren.Reserve(mChildren.Size() + count);
+		mActiveChildren.Reserve(mActiveChildren.Size() + count);
+		mChildSlots.Reserve(mChildSlots.Size() + count);
+	}
+
+	void Entity::Sleep()
+	{
+		if (mWakeScheduler)
+		{
+			mWakeScheduler->CancelWake(*this);
+		}
+
+		mSleeping = true;
+	}
+
+	void Entity::SleepFor(WorldState& worldState, const std::chrono::milliseconds& duration)
+	{
+		if (worldState.World == nullptr)
+		{
+			throw std::runtime_error("Timed sleep requires a World.");
+		}
+
+		Sleep();
+		worldState.World->ScheduleWake(*this, duration);
+	}
+
+	void Entity::Wake()
+	{
+		if (mWakeScheduler)
+		{
+			mWakeScheduler->CancelWake(*this);
+		}
+
+		mSleeping = false;
+
+		Entity* parent = GetParent();
+
+		if (parent)
+		{
+			parent->ActivateChild(*this);
+			parent->ChildWoken(*this);
+		}
+	}
+
 	void Entity::Initialize(WorldState& worldState)
 	{
 		if (!mEnabled) return;
@@ -218,8 +374,10 @@ namespace Library
 	{
 		if (!mEnabled) return;
 				
-		ForEachChild([&worldState](Entity& entity)
+		ForEachActiveChild([&worldState](Entity& entity)
 		{
+			PROFILE_SCOPE(entity.TypeNameInstance());
+
 			worldState.Entity = &entity;
 			worldState.Entity->Update(worldState);
 		});
@@ -244,6 +402,14 @@ namespace Library
 		UpdatePendingChildren();
 	}
 
+	void Entity::ChildWoken(Entity&)
+	{
+	}
+
+	void Entity::Retired()
+	{
+	}
+
 	std::string Entity::ToString() const
 	{
 		std::ostringstream oss;
@@ -253,16 +419,26 @@ namespace Library
 
 	void Entity::UpdatePendingChildren()
 	{
+		if (mPendingChildren.IsEmpty()) return;
+
+		Vector<Entity*> removedChildren;
+
 		for (PendingChild& pendingChild : mPendingChildren)
 		{
+			Entity& child = pendingChild.Child;
+
 			switch (pendingChild.ChildState)
 			{
 			case PendingChild::State::ToAdd:
-				AddChild(pendingChild.Child);
+				AddChild(child);
 				break;
 
 			case PendingChild::State::ToRemove:
-				DestroyChild(pendingChild.Child);
+				if (child.GetParent() == this && child.mSlot != InvalidSlot)
+				{
+					RemoveChildEntry(child);
+					removedChildren.EmplaceBack(&child);
+				}
 				break;
 
 			default:
@@ -271,5 +447,275 @@ namespace Library
 		}
 		
 		mPendingChildren.Clear();
+
+		if (removedChildren.IsEmpty()) return;
+
+		ReclamationQueue* reclamationQueue = FindReclamationQueue();
+
+		for (auto* child : removedChildren)
+		{
+			if (child->GetParent() == this)
+			{
+				ReclaimChild(*child, reclamationQueue);
+			}
+		}
+	}
+
+	void Entity::ActivateChild(Entity& child)
+	{
+		assert(child.GetParent() == this);
+
+		if (child.mActiveIndex != InactiveIndex || !child.IsActive()) return;
+
+		// A woken child older than the last scheduled child is appended for now, and moved back into place by the next compaction.
+		if (mActiveChildrenOrdered && !mActiveChildren.IsEmpty() && child.mChildOrder < mLastActiveOrder)
+		{
+			mActiveChildrenOrdered = false;
+		}
+		else if (mActiveChildrenOrdered)
+		{
+			mLastActiveOrder = child.mChildOrder;
+		}
+
+		child.mActiveIndex = mActiveChildren.Size();
+		mActiveChildren.EmplaceBack(&child);
+	}
+
+	void Entity::DeactivateChild(Entity& child)
+	{
+		if (child.mActiveIndex == InactiveIndex) return;
+
+		assert(child.mActiveIndex < mActiveChildren.Size() && mActiveChildren[child.mActiveIndex] == &child);
+
+		mActiveChildren[child.mActiveIndex] = nullptr;
+		child.mActiveIndex = InactiveIndex;
+		++mActiveHoleCount;
+
+		if (!mUpdatingChildren && !mActivePassSuspended && mActiveHoleCount * 2 > mActiveChildren.Size())
+		{
+			CompactActiveChildren();
+		}
+	}
+
+	void Entity::CompactActiveChildren()
+	{
+		if (mActiveHoleCount == 0 && mActiveChildrenOrdered) return;
+
+		std::size_t count = 0;
+
+		for (auto* child : mActiveChildren)
+		{
+			if (child) mActiveChildren[count++] = child;
+		}
+
+		mActiveChildren.Resize(count);
+		mActiveHoleCount = 0;
+
+		if (!mActiveChildrenOrdered)
+		{
+			std::sort(mActiveChildren.begin(), mActiveChildren.end(), [](const Entity* lhs, const Entity* rhs)
+			{
+				return lhs->mChildOrder < rhs->mChildOrder;
+			});
+
+			mActiveChildrenOrdered = true;
+		}
+
+		for (std::size_t i = 0; i < mActiveChildren.Size(); ++i)
+		{
+			mActiveChildren[i]->mActiveIndex = i;
+		}
+
+		if (!mActiveChildren.IsEmpty()) mLastActiveOrder = mActiveChildren.Back()->mChildOrder;
+	}
+
+	void Entity::CopyChildEntries(const Entity& rhs)
+	{
+		if (rhs.mChildren.IsEmpty()) return;
+
+		// Scope copies nested Scopes attribute by attribute and element by element, so each copied child
+		// sits at the same position as its original. Gather them in the child order of the original.
+		Vector<Entity*> copies(rhs.mChildren.Size());
+		copies.Resize(rhs.mChildren.Size(), nullptr);
+
+		for (std::size_t i = 0; i < rhs.Size(); ++i)
+		{
+			const Data& rhsData = rhs[i];
+			if (rhsData.Type() != Types::Scope) continue;
+
+			const Data& data = (*this)[i];
+			assert(data.Type() == Types::Scope && data.Size() == rhsData.Size());
+
+			for (std::size_t j = 0; j < rhsData.Size(); ++j)
+			{
+				const Entity* rhsChild = rhsData.Get<Scope*>(j)->As<Entity>();
+
+				if (rhsChild && rhsChild->mSlot != InvalidSlot && rhsChild->GetParent() == &rhs)
+				{
+					copies[rhs.mChildSlots[rhsChild->mSlot].Index] = data.Get<Scope*>(j)->As<Entity>();
+				}
+			}
+		}
+
+		for (auto* copy : copies)
+		{
+			if (copy) InsertChildEntry(*copy);
+		}
+	}
+
+	void Entity::InsertChildEntry(Entity& child)
+	{
+		assert(child.mSlot == InvalidSlot);
+
+		if (mFreeChildSlot == InvalidSlot)
+		{
+			child.mSlot = static_cast<std::uint32_t>(mChildSlots.Size());
+			mChildSlots.EmplaceBack(ChildSlot{ 0, 0 });
+		}
+		else
+		{
+			child.mSlot = mFreeChildSlot;
+			mFreeChildSlot = mChildSlots[child.mSlot].Index;
+		}
+
+		mChildSlots[child.mSlot].Index = static_cast<std::uint32_t>(mChildren.Size());
+		mChildren.EmplaceBack(&child);
+		child.mChildOrder = mNextChildOrder++;
+		++mChildSetVersion;
+
+		ActivateChild(child);
+	}
+
+	void Entity::RemoveChildEntry(Entity& child)
+	{
+		DeactivateChild(child);
+
+		if (child.mSlot == InvalidSlot) return;
+
+		ChildSlot& slot = mChildSlots[child.mSlot];
+		assert(mChildren[slot.Index] == &child);
+
+		if (slot.Index != mChildren.Size() - 1)
+		{
+			mChildren[slot.Index] = nullptr;
+			++mChildHoleCount;
+		}
+		else
+		{
+			mChildren.PopBack();
+
+			while (!mChildren.IsEmpty() && mChildren.Back() == nullptr)
+			{
+				mChildren.PopBack();
+				--mChildHoleCount;
+			}
+		}
+
+		slot.Index = mFreeChildSlot;
+		++slot.Generation;
+		mFreeChildSlot = child.mSlot;
+
+		child.mSlot = InvalidSlot;
+		++mChildSetVersion;
+
+		if (!mUpdatingChildren && mChildHoleCount * 2 > mChildren.Size())
+		{
+			CompactChildren();
+		}
+	}
+
+	void Entity::CompactChildren()
+	{
+		if (mChildHoleCount == 0) return;
+
+		std::size_t count = 0;
+
+		for (auto* child : mChildren)
+		{
+			if (child == nullptr) continue;
+
+			mChildSlots[child->mSlot].Index = static_cast<std::uint32_t>(count);
+			mChildren[count++] = child;
+		}
+
+		mChildren.Resize(count);
+		mChildHoleCount = 0;
+	}
+
+	void Entity::ReclaimChild(Entity& child, ReclamationQueue* reclamationQueue)
+	{
+		gsl::owner<Scope*> orphan = Orphan(child, child.Name());
+
+		if (reclamationQueue)
+		{
+			child.Retire();
+			reclamationQueue->Enqueue(orphan);
+		}
+		else
+		{
+			delete orphan;
+		}
+	}
+
+	ReclamationQueue* Entity::FindReclamationQueue()
+	{
+		Entity* root = this;
+
+		while (Entity* parent = root->GetParent())
+		{
+			root = parent;
+		}
+
+		World* world = root->As<World>();
+		return world ? &world->mReclamationQueue : nullptr;
+	}
+
+	void Entity::Retire()
+	{
+		if (mWakeScheduler)
+		{
+			mWakeScheduler->CancelWake(*this);
+		}
+
+		mEnabled = false;
+		Retired();
+
+		for (auto* child : mChildren)
+		{
+			if (child) child->Retire();
+		}
+	}
+
+	void Entity::ReplaceInParent(Entity& rhs)
+	{
+		mActiveIndex = rhs.mActiveIndex;
+		rhs.mActiveIndex = InactiveIndex;
+
+		mSlot = rhs.mSlot;
+		rhs.mSlot = InvalidSlot;
+
+		mChildOrder = rhs.mChildOrder;
+
+		mWakeScheduler = rhs.mWakeScheduler;
+		mWakeIndex = rhs.mWakeIndex;
+		rhs.mWakeScheduler = nullptr;
+
+		if (mWakeScheduler)
+		{
+			mWakeScheduler->RetargetWake(rhs, *this);
+		}
+
+		Entity* parent = GetParent();
+		if (parent == nullptr) return;
+
+		if (mSlot != InvalidSlot)
+		{
+			parent->mChildren[parent->mChildSlots[mSlot].Index] = this;
+		}
+
+		if (mActiveIndex != InactiveIndex)
+		{
+			parent->mActiveChildren[mActiveIndex] = this;
+		}
 	}
 }
\ No newline at end of file
@@ -2,10 +2,13 @@
 
 #pragma region Includes
 // Standard
+#include <chrono>
+#include <limits>
 #include <optional>
 
 // First Party
 #include "Attributed.h"
+#include "EntityHandle.h"
 #include "Factory.h"
 #pragma endregion Includes
 
@@ -13,6 +16,8 @@ namespace Library
 {
 	// Forward Declarations
 	struct WorldState;
+	class World;
+	class ReclamationQueue;
 
 	/// <summary>
 	/// Represents a base object within the reflection system.
@@ -21,6 +26,8 @@ namespace Library
 	{
 		RTTI_DECLARATIONS(Entity, Attributed)
 
+		friend class World;
+
 #pragma region Hidden Inheritance
 	private:
 		using Attributed::Adopt;
@@ -28,7 +35,66 @@ namespace Library
 #pragma endregion Hidden Inheritance
 		
 #pragma region Type Definitions
+	public:
+		/// <summary>
+		/// Slot index representing the absence of a slot.
+		/// </summary>
+		inline static constexpr std::uint32_t InvalidSlot = std::numeric_limits<std::uint32_t>::max();
+
+		/// <summary>
+		/// Generational handle to a child Entity, resolved by its parent in constant time.
+		/// Becomes invalid once the child is removed from the parent, even if its slot is reused.
+		/// </summary>
+		struct ChildHandle final
+		{
+			/// <summary>
+			/// Index of the slot within the child slot table of the parent.
+			/// </summary>
+			std::uint32_t Slot{ InvalidSlot };
+
+			/// <summary>
+			/// Generation of the slot at the time the handle was created.
+			/// </summary>
+			std::uint32_t Generation{ 0 };
+
+			/// <summary>
+			/// Equality operator.
+			/// </summary>
+			/// <param name="rhs">ChildHandle to be compared against.</param>
+			/// <returns>True when both the slot and generation match. Otherwise, false.</returns>
+			bool operator==(const ChildHandle& rhs) const noexcept
+			{
+				return Slot == rhs.Slot && Generation == rhs.Generation;
+			}
+
+			/// <summary>
+			/// Inequality operator.
+			/// </summary>
+			/// <param name="rhs">ChildHandle to be compared against.</param>
+			/// <returns>True when either the slot or generation differ. Otherwise, false.</returns>
+			bool operator!=(const ChildHandle& rhs) const noexcept
+			{
+				return !operator==(rhs);
+			}
+		};
+
 	private:
+		/// <summary>
+		/// Entry within the child slot table, mapping a stable slot to the current index of a child within the child list.
+		/// </summary>
+		struct ChildSlot final
+		{
+			/// <summary>
+			/// Index of the child within the child list while occupied, or the next free slot while free.
+			/// </summary>
+			std::uint32_t Index;
+
+			/// <summary>
+			/// Incremented each time the slot is freed, invalidating outstanding handles.
+			/// </summary>
+			std::uint32_t Generation;
+		};
+
 		/// <summary>
 		/// Data structure for performing an action on a given Scope at the end of an Update call.
 		/// </summary>
@@ -52,6 +118,11 @@ namespace Library
 				End
 			} ChildState;
 		};
+
+		/// <summary>
+		/// Active index of an Entity that is not in the active child list of its parent.
+		/// </summary>
+		inline static constexpr std::size_t InactiveIndex = std::numeric_limits<std::size_t>::max();
 #pragma endregion Type Definitions
 		
 #pragma region Static Members
@@ -71,9 +142,9 @@ namespace Library
 		explicit Entity(std::string name=std::string());
 
 		/// <summary>
-		/// Default destructor.
+		/// Destructor. Removes the Entity from the child lists of its parent, cancels any scheduled wake, and invalidates its handle.
 		/// </summary>
-		virtual ~Entity() override = default;
+		virtual ~Entity() override;
 
 		/// <summary>
 		/// Copy constructor.
@@ -133,6 +204,13 @@ namespace Library
 		/// <param name="name">String to use as the name of the Entity.</param>
 		void SetName(const std::string& name);
 
+		/// <summary>
+		/// Gets the generational handle of the Entity, which resolves to null once the Entity is destroyed.
+		/// Prefer storing handles over raw pointers or names when referring to an Entity across frames.
+		/// </summary>
+		/// <returns>Handle of the Entity.</returns>
+		EntityHandle Handle() const;
+
 		/// <summary>
 		/// Gets the Entity that owns this Entity.
 		/// </summary>
@@ -156,6 +234,27 @@ namespace Library
 		/// </summary>
 		/// <param name="enabled">Boolean determining whether to enable or disable the Entity.</param>
 		void SetEnabled(const bool enabled);
+
+		/// <summary>
+		/// Gets whether the Entity is sleeping.
+		/// </summary>
+		/// <returns>True when sleeping. Otherwise, false.</returns>
+		bool IsSleeping() const;
+
+		/// <summary>
+		/// Gets whether the Entity is updated by its parent, i.e. whether it is both enabled and awake.
+		/// </summary>
+		/// <returns>True when active. Otherwise, false.</returns>
+		bool IsActive() const;
+		
+		/// <summary>
+		/// Gets the number of child Entity objects scheduled for update.
+		/// </summary>
+		/// <remarks>
+		/// Children that are put to sleep or disabled are only dropped from the schedule the next time the Entity updates.
+		/// </remarks>
+		/// <returns>Number of child Entity objects scheduled for update.</returns>
+		std::size_t ActiveChildCount() const;
 		
 		/// <summary>
 		/// Gets the number of child Entity objects.
@@ -163,6 +262,29 @@ namespace Library
 		/// <returns>Number of child Entity objects.</returns>
 		std::size_t ChildCount() const;
 
+		/// <summary>
+		/// Gets a counter incremented whenever a child Entity is added or removed, for validating lookups cached against the children.
+		/// </summary>
+		/// <returns>Version of the child set.</returns>
+		std::uint64_t ChildSetVersion() const;
+
+		/// <summary>
+		/// Gets the child Entity at the given index. Children keep the order they were added in.
+		/// </summary>
+		/// <param name="index">Index of the child Entity.</param>
+		/// <returns>Reference to the child Entity.</returns>
+		/// <exception cref="std::out_of_range">Index is out of bounds.</exception>
+		Entity& ChildAt(const std::size_t index);
+
+		/// <summary>
+		/// Gets the child Entity at the given index. Children keep the order they were added in.
+		/// </summary>
+		/// <param name="index">Index of the child Entity.</param>
+		/// <returns>Reference to the child Entity.</returns>
+		/// <exception cref="std::out_of_range">Index is out of bounds.</exception>
+		/// <remarks>Walks the child list while removed children are awaiting compaction.</remarks>
+		const Entity& ChildAt(const std::size_t index) const;
+
 		/// <summary>
 		/// Gets the child Entity with the given name.
 		/// </summary>
@@ -179,6 +301,30 @@ namespace Library
 		template<typename T=Entity>
 		const T* FindChild(const std::string& name) const;
 
+		/// <summary>
+		/// Gets the child Entity referred to by the given handle, in constant time.
+		/// </summary>
+		/// <param name="handle">Handle of the child Entity to be found.</param>
+		/// <returns>Pointer to the child Entity, or null if the handle is no longer valid.</returns>
+		template<typename T=Entity>
+		T* FindChild(const ChildHandle& handle);
+
+		/// <summary>
+		/// Gets the child Entity referred to by the given handle, in constant time.
+		/// </summary>
+		/// <param name="handle">Handle of the child Entity to be found.</param>
+		/// <returns>Pointer to the child Entity, or null if the handle is no longer valid.</returns>
+		template<typename T=Entity>
+		const T* FindChild(const ChildHandle& handle) const;
+
+		/// <summary>
+		/// Gets a generational handle for a child Entity.
+		/// </summary>
+		/// <param name="child">Child Entity.</param>
+		/// <returns>Handle of the child Entity.</returns>
+		/// <exception cref="std::runtime_error">Entity is not a child.</exception>
+		ChildHandle GetChildHandle(const Entity& child) const;
+
 		/// <summary>
 		/// Gets the child Entity array with the given name.
 		/// </summary>
@@ -225,11 +371,42 @@ namespace Library
 		/// <returns>Reference to the newly heap allocated Entity.</returns>
 		Entity& CreateChild(const std::string& className, const std::string& name);
 
+		/// <summary>
+		/// Reserves storage for a number of additional children, so that adding them in a batch does not grow the child lists one at a time.
+		/// </summary>
+		/// <param name="count">Number of children about to be added.</param>
+		void ReserveChildren(const std::size_t count);
+
 		/// <summary>
 		/// Orphans a child Entity.
 		/// </summary>
 		/// <param name="child">Child to be removed.</param>
 		void DestroyChild(Entity& child);
+
+		/// <summary>
+		/// Orphans the child Entity referred to by the given handle, if the handle is still valid.
+		/// </summary>
+		/// <param name="handle">Handle of the child to be removed.</param>
+		void DestroyChild(const ChildHandle& handle);
+
+		/// <summary>
+		/// Puts the Entity to sleep until Wake is called, cancelling any scheduled wake.
+		/// A sleeping Entity and its descendants are skipped by Update at no per frame cost.
+		/// </summary>
+		void Sleep();
+
+		/// <summary>
+		/// Puts the Entity to sleep until the given amount of game time has passed, or Wake is called.
+		/// </summary>
+		/// <param name="worldState">WorldState whose World schedules the wake.</param>
+		/// <param name="duration">Game time to sleep for.</param>
+		/// <exception cref="std::runtime_error">WorldState has no World.</exception>
+		void SleepFor(WorldState& worldState, const std::chrono::milliseconds& duration);
+
+		/// <summary>
+		/// Wakes the Entity, rescheduling it for update by its parent.
+		/// </summary>
+		void Wake();
 #pragma endregion Modifiers
 
 #pragma region Game Loop
@@ -249,6 +426,19 @@ namespace Library
 		/// Virtual shutdown method meant for use by derived classes.
 		/// </summary>
 		virtual void Shutdown(WorldState& worldState);
+
+	protected:
+		/// <summary>
+		/// Virtual method called after a child Entity is woken. Allows an Entity sleeping on one of its children to wake with it.
+		/// </summary>
+		/// <param name="child">Child Entity that was woken.</param>
+		virtual void ChildWoken(Entity& child);
+
+		/// <summary>
+		/// Virtual method called when the Entity, or one of its ancestors, is queued for destruction.
+		/// Derived classes release anything that could still reach the Entity before it is deleted, e.g. Event subscriptions.
+		/// </summary>
+		virtual void Retired();
 #pragma endregion Game Loop
 
 #pragma region RTTI Overrides
@@ -263,9 +453,97 @@ namespace Library
 #pragma region Helper Methods
 	protected:
 		/// <summary>
-		/// Performs pending actions of the child Scopes.
+		/// Performs pending actions of the child Scopes as a batch.
+		/// Children pending removal are destroyed once every pending action has been applied.
 		/// </summary>
 		void UpdatePendingChildren();
+
+		/// <summary>
+		/// Performs the given function on each active child Entity, dropping inactive children from the schedule.
+		/// </summary>
+		/// <param name="functor">Function to be performed on each active child Entity.</param>
+		template<typename TFunctor>
+		void ForEachActiveChild(TFunctor functor);
+
+		/// <summary>
+		/// Performs the given function on each active child Entity, starting at the given index into the update schedule,
+		/// until the function asks to stop. Allows a caller to suspend an update part way through and resume it later.
+		/// </summary>
+		/// <param name="index">Index into the update schedule of the first child Entity to be visited.</param>
+		/// <param name="functor">Function to be performed on each active child Entity. Returns false to stop after the current child.</param>
+		/// <returns>Index of the next child Entity to be visited, or zero once every child has been visited.</returns>
+		template<typename TFunctor>
+		std::size_t ForEachActiveChildFrom(std::size_t index, TFunctor functor);
+
+	private:
+		/// <summary>
+		/// Schedules a child Entity for update, if it is active and not already scheduled.
+		/// </summary>
+		/// <param name="child">Child Entity to be scheduled.</param>
+		void ActivateChild(Entity& child);
+
+		/// <summary>
+		/// Removes a child Entity from the update schedule.
+		/// </summary>
+		/// <param name="child">Child Entity to be unscheduled.</param>
+		void DeactivateChild(Entity& child);
+
+		/// <summary>
+		/// Drops removed entries from the active child list, and moves children woken out of order back to their place in the child order.
+		/// The update order of the remaining children is unchanged.
+		/// </summary>
+		void CompactActiveChildren();
+
+		/// <summary>
+		/// Registers the copies of the children of another Entity, after its attributes have been copied.
+		/// Matches each copy to its original by position rather than by name, preserving the child order of the original.
+		/// </summary>
+		/// <param name="rhs">Entity that was copied.</param>
+		void CopyChildEntries(const Entity& rhs);
+
+		/// <summary>
+		/// Appends a child Entity to the child list, assigning it a slot and scheduling it for update.
+		/// </summary>
+		/// <param name="child">Child Entity to be inserted.</param>
+		void InsertChildEntry(Entity& child);
+
+		/// <summary>
+		/// Removes a child Entity from both the child list and the update schedule in constant time, freeing its slot.
+		/// The child leaves a null entry behind, unless it is the last child, so the remaining children keep their order.
+		/// </summary>
+		/// <param name="child">Child Entity to be removed.</param>
+		void RemoveChildEntry(Entity& child);
+
+		/// <summary>
+		/// Drops the null entries left by removed children from the child list, preserving the order of the remaining children.
+		/// </summary>
+		void CompactChildren();
+
+		/// <summary>
+		/// Orphans a child Entity that has already been removed from the child list, then destroys it.
+		/// Destruction is deferred to the ReclamationQueue when one is given.
+		/// </summary>
+		/// <param name="child">Child Entity to be destroyed.</param>
+		/// <param name="reclamationQueue">ReclamationQueue taking ownership of the child, or null to delete it immediately.</param>
+		void ReclaimChild(Entity& child, ReclamationQueue* reclamationQueue);
+
+		/// <summary>
+		/// Gets the ReclamationQueue of the World at the root of the hierarchy, if any.
+		/// </summary>
+		/// <returns>Pointer to the ReclamationQueue, or null when the root is not a World.</returns>
+		ReclamationQueue* FindReclamationQueue();
+
+		/// <summary>
+		/// Readies the Entity and all of its descendants for deferred destruction.
+		/// Cancels their scheduled wakes, disables them and calls Retired on each.
+		/// </summary>
+		void Retire();
+
+		/// <summary>
+		/// Takes over the child list entries of the given Entity within the parent, after a move.
+		/// </summary>
+		/// <param name="rhs">Moved from Entity.</param>
+		void ReplaceInParent(Entity& rhs);
 #pragma endregion Helper Methods
 		
 #pragma region Data Members
@@ -279,13 +557,100 @@ namespace Library
 		/// Represents whether the Entity should be updated.
 		/// </summary>
 		bool mEnabled{ true };
+
+		/// <summary>
+		/// Represents whether the Entity is sleeping until woken.
+		/// </summary>
+		bool mSleeping{ false };
 		
 		/// <summary>
-		/// Collection of Entity objects within the Children prescribed Attribute.
+		/// Contiguous collection of child Entity objects, in the order they were added.
+		/// Removed children leave null entries until the list is compacted. The last entry is never null.
 		/// </summary>
 		Vector<Entity*> mChildren;
 
 	private:
+		/// <summary>
+		/// Number of null entries within the child list.
+		/// </summary>
+		std::size_t mChildHoleCount{ 0 };
+
+		/// <summary>
+		/// Child Entity objects scheduled for update, in the order the children were added.
+		/// Entries may be null or inactive, and woken children may be out of order, until the next update.
+		/// </summary>
+		Vector<Entity*> mActiveChildren;
+
+		/// <summary>
+		/// Number of null entries within the active child list.
+		/// </summary>
+		std::size_t mActiveHoleCount{ 0 };
+
+		/// <summary>
+		/// Represents whether every entry of the active child list is in child order.
+		/// </summary>
+		bool mActiveChildrenOrdered{ true };
+
+		/// <summary>
+		/// Represents whether an update of the active children was suspended part way through, so entries must keep their indices.
+		/// </summary>
+		bool mActivePassSuspended{ false };
+
+		/// <summary>
+		/// Child order of the last entry of the active child list, while it is ordered.
+		/// </summary>
+		std::uint64_t mLastActiveOrder{ 0 };
+
+		/// <summary>
+		/// Child order given to the next child added.
+		/// </summary>
+		std::uint64_t mNextChildOrder{ 0 };
+
+		/// <summary>
+		/// Number of times a child Entity has been added or removed.
+		/// </summary>
+		std::uint64_t mChildSetVersion{ 0 };
+
+		/// <summary>
+		/// Index of the Entity within the active child list of its parent.
+		/// </summary>
+		std::size_t mActiveIndex{ InactiveIndex };
+
+		/// <summary>
+		/// Position of the Entity among the children of its parent, increasing in the order they were added.
+		/// </summary>
+		std::uint64_t mChildOrder{ 0 };
+
+		/// <summary>
+		/// Slot table mapping child handles to indices within the child list.
+		/// </summary>
+		Vector<ChildSlot> mChildSlots{ Vector<ChildSlot>::EqualityFunctor() };
+
+		/// <summary>
+		/// Head of the intrusive list of free slots within the slot table.
+		/// </summary>
+		std::uint32_t mFreeChildSlot{ InvalidSlot };
+
+		/// <summary>
+		/// Generational handle of the Entity within the global slot table.
+		/// </summary>
+		EntityHandle mHandle;
+
+		/// <summary>
+		/// Slot of the Entity within the slot table of its parent.
+		/// </summary>
+		std::uint32_t mSlot{ InvalidSlot };
+
+		/// <summary>
+		/// World holding a scheduled wake for the Entity, if any.
+		/// </summary>
+		World* mWakeScheduler{ nullptr };
+
+		/// <summary>
+		/// Index of the scheduled wake within the wake heap of the scheduling World.
+		/// </summary>
+		std::size_t mWakeIndex{ 0 };
+
 		/// <summary>
 		/// Pending children to have an action performed during the end of an Update call.
 		/// </summary>
@@ -16,19 +16,39 @@ namespace Library
 		mName = name;
 	}
 
+	inline EntityHandle Entity::Handle() const
+	{
+		return mHandle;
+	}
+
 	inline bool Entity::Enabled() const
 	{
 		return mEnabled;
 	}
 
-	inline void Entity::SetEnabled(const bool enabled)
+	inline bool Entity::IsSleeping() const
+	{
+		return mSleeping;
+	}
+
+	inline bool Entity::IsActive() const
 	{
-		mEnabled = enabled;
+		return mEnabled && !mSleeping;
 	}
 
 	inline std::size_t Entity::ChildCount() const
 	{
-		return mChildren.Size();
+		return mChildren.Size() - mChildHoleCount;
+	}
+
+	inline std::uint64_t Entity::ChildSetVersion() const
+	{
+		return mChildSetVersion;
+	}
+
+	inline std::size_t Entity::ActiveChildCount() const
+	{
+		return mActiveChildren.Size() - mActiveHoleCount;
 	}
 
 	template<typename T>
@@ -52,6 +72,23 @@ namespace Library
 		return const_cast<Entity*>(this)->FindChild<T>(name);
 	}
 
+	template<typename T>
+	inline T* Entity::FindChild(const ChildHandle& handle)
+	{
+		if (handle.Slot >= mChildSlots.Size() || mChildSlots[handle.Slot].Generation != handle.Generation)
+		{
+			return nullptr;
+		}
+
+		return mChildren[mChildSlots[handle.Slot].Index]->As<T>();
+	}
+
+	template<typename T>
+	inline const T* Entity::FindChild(const ChildHandle& handle) const
+	{
+		return const_cast<Entity*>(this)->FindChild<T>(handle);
+	}
+
 	template<typename T>
 	inline gsl::span<T*> Entity::FindChildArray(const std::string& name)
 	{
@@ -78,4 +115,59 @@ namespace Library
 		return gsl::span<const T* const>(nullptr, nullptr);
 	}
 #pragma endregion Accessors
+
+#pragma region Helper Methods
+	template<typename TFunctor>
+	inline void Entity::ForEachActiveChild(TFunctor functor)
+	{
+		mUpdatingChildren = true;
+
+		for (std::size_t i = 0; i < mActiveChildren.Size(); ++i)
+		{
+			Entity* child = mActiveChildren[i];
+			if (child == nullptr) continue;
+
+			if (!child->IsActive())
+			{
+				DeactivateChild(*child);
+				continue;
+			}
+
+			functor(*child);
+		}
+
+		mUpdatingChildren = false;
+		mActivePassSuspended = false;
+
+		CompactActiveChildren();
+	}
+
+	template<typename TFunctor>
+	inline std::size_t Entity::ForEachActiveChildFrom(std::size_t index, TFunctor functor)
+	{
+		mUpdatingChildren = true;
+
+		while (index < mActiveChildren.Size())
+		{
+			Entity* child = mActiveChildren[index++];
+			if (child == nullptr) continue;
+
+			if (!child->IsActive())
+			{
+				DeactivateChild(*child);
+				continue;
+			}
+
+			if (!functor(*child)) break;
+		}
+
+		mUpdatingChildren = false;
+		mActivePassSuspended = index < mActiveChildren.Size();
+
+		if (mActivePassSuspended) return index;
+
+		CompactActiveChildren();
+		return 0;
+	}
+#pragma endregion Helper Methods
 }
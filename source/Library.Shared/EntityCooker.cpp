@@ -0,0 +1,374 @@
+#pragma region Includes
+// Pre-compiled Header
+#include "pch.h"
+
+// Header
+#include "EntityCooker.h"
+
+// Standard
+#include <cstring>
+#include <fstream>
+
+// First Party
+#include "Entity.h"
+#include "Factory.h"
+#include "MemoryMappedFile.h"
+#include "Profiler.h"
+#pragma endregion Includes
+
+using namespace std::string_literals;
+
+namespace Library
+{
+#pragma region Cook Methods
+	void EntityCooker::Cook(const Entity& root, std::ostream& outputStream)
+	{
+		PROFILE_SCOPE("EntityCooker::Cook");
+
+		CookContext context;
+		CookEntity(context, root, NoParent);
+
+		Header header
+		{
+			Magic,
+			Version,
+			static_cast<std::uint32_t>(context.Entities.Size()),
+			static_cast<std::uint32_t>(context.Attributes.Size()),
+			static_cast<std::uint32_t>(context.Strings.Size()),
+			0,
+		};
+
+		header.EntitiesOffset = AlignedEnd(0, sizeof(Header));
+		header.AttributesOffset = AlignedEnd(header.EntitiesOffset, context.Entities.Size() * sizeof(EntityRecord));
+		header.StringsOffset = AlignedEnd(header.AttributesOffset, context.Attributes.Size() * sizeof(AttributeRecord));
+		header.DataOffset = AlignedEnd(header.StringsOffset, context.Strings.Size() * sizeof(StringRecord));
+		header.Size = header.DataOffset + context.Data.size();
+
+		const char padding[Alignment]{};
+		std::uint64_t written = 0;
+
+		const auto writeSection = [&outputStream, &padding, &written](const std::uint64_t offset, const void* bytes, const std::size_t size)
+		{
+			outputStream.write(padding, static_cast<std::streamsize>(offset - written));
+			if (size > 0) outputStream.write(static_cast<const char*>(bytes), static_cast<std::streamsize>(size));
+			written = offset + size;
+		};
+
+		writeSection(0, &header, sizeof(Header));
+		writeSection(header.EntitiesOffset, &context.Entities[0], context.Entities.Size() * sizeof(EntityRecord));
+		writeSection(header.AttributesOffset, context.Attributes.IsEmpty() ? nullptr : &context.Attributes[0], context.Attributes.Size() * sizeof(AttributeRecord));
+		writeSection(header.StringsOffset, context.Strings.IsEmpty() ? nullptr : &context.Strings[0], context.Strings.Size() * sizeof(StringRecord));
+		writeSection(header.DataOffset, context.Data.data(), context.Data.size());
+	}
+
+	void EntityCooker::CookToFile(const Entity& root, const std::string& filename)
+	{
+		std::ofstream filestream(filename, std::ios::binary);
+
+		if (!filestream.is_open())
+		{
+			throw std::runtime_error("Could not open \""s + filename + "\"."s);
+		}
+
+		Cook(root, filestream);
+	}
+#pragma endregion Cook Methods
+
+#pragma region Load Methods
+	void EntityCooker::Load(Entity& root, gsl::span<const std::byte> data)
+	{
+		PROFILE_SCOPE("EntityCooker::Load");
+
+		const auto corrupt = []() { return std::runtime_error("Corrupt cooked data."); };
+
+		if (data.size() < sizeof(Header)) throw corrupt();
+		assert(reinterpret_cast<std::uintptr_t>(data.data()) % alignof(std::uint64_t) == 0);
+
+		const Header& header = *reinterpret_cast<const Header*>(data.data());
+
+		if (header.Magic != Magic || header.Version != Version)
+		{
+			throw std::runtime_error("Data is not a cooked file of version "s + std::to_string(Version) + "."s);
+		}
+
+		const auto isInBounds = [&header](const std::uint64_t offset, const std::uint64_t size)
+		{
+			return offset <= header.Size && size <= header.Size - offset;
+		};
+
+		if (header.Size > static_cast<std::uint64_t>(data.size()) || header.EntityCount == 0
+			|| !isInBounds(header.EntitiesOffset, std::uint64_t(header.EntityCount) * sizeof(EntityRecord))
+			|| !isInBounds(header.AttributesOffset, std::uint64_t(header.AttributeCount) * sizeof(AttributeRecord))
+			|| !isInBounds(header.StringsOffset, std::uint64_t(header.StringCount) * sizeof(StringRecord))
+			|| header.DataOffset > header.Size)
+		{
+			throw corrupt();
+		}
+
+		// The tables are used in place, only the values they describe are copied.
+		const auto* entityRecords = reinterpret_cast<const EntityRecord*>(data.data() + header.EntitiesOffset);
+		const auto* attributeRecords = reinterpret_cast<const AttributeRecord*>(data.data() + header.AttributesOffset);
+		const auto* stringRecords = reinterpret_cast<const StringRecord*>(data.data() + header.StringsOffset);
+		const std::byte* values = data.data() + header.DataOffset;
+		const std::uint64_t valuesSize = header.Size - header.DataOffset;
+
+		// Keys repeat across entities, so each string is constructed once.
+		Vector<std::string> strings(header.StringCount);
+
+		for (std::uint32_t i = 0; i < header.StringCount; ++i)
+		{
+			const StringRecord& record = stringRecords[i];
+			if (record.DataOffset > valuesSize || record.Length > valuesSize - record.DataOffset) throw corrupt();
+
+			strings.EmplaceBack(reinterpret_cast<const char*>(values + record.DataOffset), record.Length);
+		}
+
+		const auto string = [&strings, &corrupt](const std::uint32_t index) -> const std::string&
+		{
+			if (index >= strings.Size()) throw corrupt();
+			return strings[index];
+		};
+
+		Vector<Entity*> entities(header.EntityCount);
+
+		for (std::uint32_t i = 0; i < header.EntityCount; ++i)
+		{
+			const EntityRecord& record = entityRecords[i];
+
+			if (std::uint64_t(record.FirstAttribute) + record.AttributeCount > header.AttributeCount) throw corrupt();
+
+			Entity* entity = &root;
+			gsl::owner<Entity*> created = nullptr;
+
+			if (i > 0)
+			{
+				// Parents precede their children, so the parent index always refers to an Entity already created.
+				if (record.Parent >= i) throw corrupt();
+
+				const std::string& className = string(record.ClassName);
+				created = Factory<Entity>::Create(className);
+				if (created == nullptr) throw std::runtime_error("\""s + className + "\" is not a registered Entity class."s);
+
+				entity = created;
+				entity->SetName(string(record.Name));
+			}
+			else if (record.Parent != NoParent)
+			{
+				throw corrupt();
+			}
+
+			try
+			{
+				entity->SetEnabled(record.Enabled != 0);
+				entity->ReserveChildren(record.ChildCount);
+
+				for (std::uint32_t j = record.FirstAttribute; j < record.FirstAttribute + record.AttributeCount; ++j)
+				{
+					const AttributeRecord& attributeRecord = attributeRecords[j];
+					const auto type = static_cast<Entity::Types>(attributeRecord.Type);
+
+					if (type <= Entity::Types::Unknown || type > Entity::Types::Scope) throw corrupt();
+
+					Entity::Data& target = entity->Append(string(attributeRecord.Key));
+
+					if (target.Type() == Entity::Types::Unknown)
+					{
+						target.SetType(type);
+					}
+					else if (target.Type() != type)
+					{
+						throw std::runtime_error("\""s + string(attributeRecord.Key) + "\" has a different type than its cooked value."s);
+					}
+
+					// Children are entity records of their own, the attribute only keeps their key in order.
+					if (type == Entity::Types::Scope) continue;
+
+					// Validated before resizing, and in division form so that the byte count cannot wrap on 32 bit targets.
+					const std::size_t elementSize = ElementSize(type);
+					if (attributeRecord.DataOffset > valuesSize || attributeRecord.Size > (valuesSize - attributeRecord.DataOffset) / elementSize) throw corrupt();
+
+					const std::size_t size = attributeRecord.Size;
+
+					if (target.HasInternalStorage())
+					{
+						target.Resize(size);
+					}
+					else if (target.Size() < size)
+					{
+						throw std::runtime_error("\""s + string(attributeRecord.Key) + "\" array has too many elements."s);
+					}
+
+					if (size == 0) continue;
+
+					const std::byte* source = values + attributeRecord.DataOffset;
+
+					switch (type)
+					{
+					case Entity::Types::Integer:	std::memcpy(target.Data<int>(), source, size * elementSize);		break;
+					case Entity::Types::Float:		std::memcpy(target.Data<float>(), source, size * elementSize);		break;
+					case Entity::Types::Vector:		std::memcpy(target.Data<glm::vec4>(), source, size * elementSize);	break;
+					case Entity::Types::Matrix:		std::memcpy(target.Data<glm::mat4>(), source, size * elementSize);	break;
+
+					case Entity::Types::String:
+					{
+						const auto* indices = reinterpret_cast<const std::uint32_t*>(source);
+
+						for (std::size_t k = 0; k < size; ++k)
+						{
+							target.Set(string(indices[k]), k);
+						}
+
+						break;
+					}
+
+					default:
+						break;
+					}
+				}
+
+				if (created != nullptr) entities[record.Parent]->AddChild(*created);
+			}
+			catch (...)
+			{
+				delete created;
+				throw;
+			}
+
+			entities.EmplaceBack(entity);
+		}
+	}
+
+	void EntityCooker::LoadFromFile(Entity& root, const std::string& filename)
+	{
+		const MemoryMappedFile file(filename);
+		Load(root, file.Data());
+	}
+#pragma endregion Load Methods
+
+#pragma region Helper Methods
+	void EntityCooker::CookEntity(CookContext& context, const Entity& entity, const std::uint32_t parent)
+	{
+		const std::size_t index = context.Entities.Size();
+
+		context.Entities.PushBack(EntityRecord
+		{
+			Intern(context, entity.TypeNameInstance()),
+			Intern(context, entity.Name()),
+			parent,
+			static_cast<std::uint32_t>(context.Attributes.Size()),
+			0,
+			0,
+			entity.Enabled() ? 1u : 0u,
+			0
+		});
+
+		Vector<const Entity*> children;
+
+		for (std::size_t i = 0; i < entity.Size(); ++i)
+		{
+			const Entity::Data& data = entity[i];
+			const Entity::Types type = data.Type();
+
+			if (type == Entity::Types::Unknown || type == Entity::Types::Pointer || type == Entity::Types::Reference) continue;
+
+			AttributeRecord record
+			{
+				Intern(context, *entity.FindName(i)),
+				static_cast<std::int32_t>(type),
+				static_cast<std::uint32_t>(data.Size()),
+				0,
+				0
+			};
+
+			switch (type)
+			{
+			case Entity::Types::Integer:	record.DataOffset = AppendData(context, data.Data<int>(), data.Size() * ElementSize(type));			break;
+			case Entity::Types::Float:		record.DataOffset = AppendData(context, data.Data<float>(), data.Size() * ElementSize(type));		break;
+			case Entity::Types::Vector:		record.DataOffset = AppendData(context, data.Data<glm::vec4>(), data.Size() * ElementSize(type));	break;
+			case Entity::Types::Matrix:		record.DataOffset = AppendData(context, data.Data<glm::mat4>(), data.Size() * ElementSize(type));	break;
+
+			case Entity::Types::String:
+			{
+				Vector<std::uint32_t> indices(data.Size());
+
+				for (std::size_t j = 0; j < data.Size(); ++j)
+				{
+					indices.EmplaceBack(Intern(context, data.Get<std::string>(j)));
+				}
+
+				record.DataOffset = AppendData(context, indices.IsEmpty() ? nullptr : &indices[0], indices.Size() * ElementSize(type));
+				break;
+			}
+
+			case Entity::Types::Scope:
+				for (std::size_t j = 0; j < data.Size(); ++j)
+				{
+					const Scope& child = data[j];
+
+					if (!child.Is(Entity::TypeIdClass()))
+					{
+						throw std::runtime_error("\""s + *entity.FindName(i) + "\" holds a Scope that is not an Entity."s);
+					}
+
+					children.EmplaceBack(static_cast<const Entity*>(&child));
+				}
+				break;
+
+			default:
+				break;
+			}
+
+			context.Attributes.PushBack(record);
+		}
+
+		// Records are re-indexed rather than referenced, as cooking the children grows the table.
+		context.Entities[index].AttributeCount = static_cast<std::uint32_t>(context.Attributes.Size()) - context.Entities[index].FirstAttribute;
+		context.Entities[index].ChildCount = static_cast<std::uint32_t>(children.Size());
+
+		for (const auto* child : children)
+		{
+			CookEntity(context, *child, static_cast<std::uint32_t>(index));
+		}
+	}
+
+	std::uint32_t EntityCooker::Intern(CookContext& context, const std::string& string)
+	{
+		const auto [it, isNew] = context.StringIndices.Insert({ string, static_cast<std::uint32_t>(context.Strings.Size()) });
+
+		if (isNew)
+		{
+			context.Strings.PushBack(StringRecord{ AppendData(context, string.data(), string.size(), 1), static_cast<std::uint32_t>(string.size()), 0 });
+		}
+
+		return it->second;
+	}
+
+	std::uint64_t EntityCooker::AppendData(CookContext& context, const void* bytes, const std::size_t size, const std::size_t alignment)
+	{
+		const std::uint64_t offset = (context.Data.size() + alignment - 1) / alignment * alignment;
+
+		context.Data.resize(static_cast<std::size_t>(offset));
+		if (size > 0) context.Data.append(static_cast<const char*>(bytes), size);
+
+		return offset;
+	}
+
+	std::size_t EntityCooker::ElementSize(const Entity::Types type)
+	{
+		switch (type)
+		{
+		case Entity::Types::Integer:	return sizeof(int);
+		case Entity::Types::Float:		return sizeof(float);
+		case Entity::Types::Vector:		return sizeof(glm::vec4);
+		case Entity::Types::Matrix:		return sizeof(glm::mat4);
+		case Entity::Types::String:		return sizeof(std::uint32_t);
+		default:						return 0;
+		}
+	}
+
+	std::uint64_t EntityCooker::AlignedEnd(const std::uint64_t offset, const std::size_t size)
+	{
+		return (offset + size + Alignment - 1) & ~std::uint64_t(Alignment - 1);
+	}
+#pragma endregion Helper Methods
+}
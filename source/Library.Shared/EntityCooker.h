@@ -0,0 +1,221 @@
+#pragma once
+
+#pragma region Includes
+// Standard
+#include <cstdint>
+#include <ostream>
+#include <string>
+
+// Third Party
+#include <gsl/gsl>
+
+// First Party
+#include "Datum.h"
+#include "HashMap.h"
+#include "Vector.h"
+#pragma endregion Includes
+
+namespace Library
+{
+	// Forward Declarations
+	class Entity;
+
+	/// <summary>
+	/// Serializes Entity trees to a versioned binary format, and loads them back without parsing.
+	/// </summary>
+	/// <remarks>
+	/// A cooked file holds flat tables of entity and attribute records, a string table and a data section, each 16 byte aligned.
+	/// Entities are stored parent first, so loading is a single pass that creates each Entity through Factory and copies its values in bulk.
+	/// Pointer and Reference attributes are runtime addresses and are not cooked. Children must be Entity instances.
+	/// Files are written in the byte order of the machine cooking them.
+	/// </remarks>
+	class EntityCooker final
+	{
+#pragma region Type Definitions, Constants
+	public:
+		/// <summary>
+		/// Identifies a cooked file, "FWLD" in little endian order.
+		/// </summary>
+		inline static constexpr std::uint32_t Magic = 0x444C5746;
+
+		/// <summary>
+		/// Current version of the cooked format. Files of any other version are rejected.
+		/// </summary>
+		inline static constexpr std::uint32_t Version = 1;
+
+		/// <summary>
+		/// Index representing no parent, used by the root record.
+		/// </summary>
+		inline static constexpr std::uint32_t NoParent = 0xFFFFFFFF;
+
+	private:
+		/// <summary>
+		/// Alignment in bytes of every section and every attribute value array.
+		/// </summary>
+		inline static constexpr std::size_t Alignment = 16;
+
+		/// <summary>
+		/// Leading record of a cooked file.
+		/// </summary>
+		struct Header final
+		{
+			std::uint32_t Magic;
+			std::uint32_t Version;
+			std::uint32_t EntityCount;
+			std::uint32_t AttributeCount;
+			std::uint32_t StringCount;
+			std::uint32_t Reserved;
+			std::uint64_t EntitiesOffset;
+			std::uint64_t AttributesOffset;
+			std::uint64_t StringsOffset;
+			std::uint64_t DataOffset;
+			std::uint64_t Size;
+		};
+
+		/// <summary>
+		/// Entity record, indexing the string table and its contiguous run of attribute records.
+		/// </summary>
+		struct EntityRecord final
+		{
+			std::uint32_t ClassName;
+			std::uint32_t Name;
+			std::uint32_t Parent;
+			std::uint32_t FirstAttribute;
+			std::uint32_t AttributeCount;
+			std::uint32_t ChildCount;
+			std::uint32_t Enabled;
+			std::uint32_t Reserved;
+		};
+
+		/// <summary>
+		/// Attribute record. Scope attributes only record their child count, as the children are entity records of their own.
+		/// </summary>
+		struct AttributeRecord final
+		{
+			std::uint32_t Key;
+			std::int32_t Type;
+			std::uint32_t Size;
+			std::uint32_t Reserved;
+			std::uint64_t DataOffset;
+		};
+
+		/// <summary>
+		/// String record, locating string characters within the data section.
+		/// </summary>
+		struct StringRecord final
+		{
+			std::uint64_t DataOffset;
+			std::uint32_t Length;
+			std::uint32_t Reserved;
+		};
+
+		/// <summary>
+		/// Tables filled while cooking an Entity tree.
+		/// </summary>
+		struct CookContext final
+		{
+			Vector<EntityRecord> Entities{ Vector<EntityRecord>::EqualityFunctor() };
+			Vector<AttributeRecord> Attributes{ Vector<AttributeRecord>::EqualityFunctor() };
+			Vector<StringRecord> Strings{ Vector<StringRecord>::EqualityFunctor() };
+			HashMap<std::string, std::uint32_t> StringIndices;
+			std::string Data;
+		};
+#pragma endregion Type Definitions, Constants
+
+#pragma region Special Members
+	public:
+		EntityCooker() = delete;
+		~EntityCooker() = delete;
+		EntityCooker(const EntityCooker&) = delete;
+		EntityCooker& operator=(const EntityCooker&) = delete;
+		EntityCooker(EntityCooker&&) = delete;
+		EntityCooker& operator=(EntityCooker&&) = delete;
+#pragma endregion Special Members
+
+#pragma region Cook Methods
+	public:
+		/// <summary>
+		/// Writes an Entity, its attributes and its descendants to a stream in the cooked format.
+		/// </summary>
+		/// <param name="root">Entity to be cooked.</param>
+		/// <param name="outputStream">Binary stream the cooked data is written to.</param>
+		/// <exception cref="std::runtime_error">A child is not an Entity.</exception>
+		static void Cook(const Entity& root, std::ostream& outputStream);
+
+		/// <summary>
+		/// Writes an Entity, its attributes and its descendants to a file in the cooked format.
+		/// </summary>
+		/// <param name="root">Entity to be cooked.</param>
+		/// <param name="filename">Filename of the file to be written.</param>
+		/// <exception cref="std::runtime_error">File could not be opened.</exception>
+		/// <exception cref="std::runtime_error">A child is not an Entity.</exception>
+		static void CookToFile(const Entity& root, const std::string& filename);
+#pragma endregion Cook Methods
+
+#pragma region Load Methods
+	public:
+		/// <summary>
+		/// Loads cooked data into an Entity. The root record's attributes and children are added to the given Entity.
+		/// </summary>
+		/// <param name="root">Entity the cooked data is loaded into.</param>
+		/// <param name="data">Cooked data, aligned to at least 8 bytes.</param>
+		/// <exception cref="std::runtime_error">Data is not a cooked file of the current version, or is corrupt.</exception>
+		/// <exception cref="std::runtime_error">A cooked class is not registered with Factory.</exception>
+		static void Load(Entity& root, gsl::span<const std::byte> data);
+
+		/// <summary>
+		/// Maps a cooked file into memory and loads it into an Entity.
+		/// </summary>
+		/// <param name="root">Entity the cooked data is loaded into.</param>
+		/// <param name="filename">Filename of the cooked file.</param>
+		/// <exception cref="std::runtime_error">File could not be mapped.</exception>
+		/// <exception cref="std::runtime_error">File is not a cooked file of the current version, or is corrupt.</exception>
+		/// <exception cref="std::runtime_error">A cooked class is not registered with Factory.</exception>
+		static void LoadFromFile(Entity& root, const std::string& filename);
+#pragma endregion Load Methods
+
+#pragma region Helper Methods
+	private:
+		/// <summary>
+		/// Appends the records of an Entity, then those of its children.
+		/// </summary>
+		/// <param name="context">Tables being filled.</param>
+		/// <param name="entity">Entity to be cooked.</param>
+		/// <param name="parent">Index of the parent record, or NoParent.</param>
+		static void CookEntity(CookContext& context, const Entity& entity, const std::uint32_t parent);
+
+		/// <summary>
+		/// Gets the string table index of a string, adding it if needed.
+		/// </summary>
+		/// <param name="context">Tables being filled.</param>
+		/// <param name="string">String to be found or added.</param>
+		/// <returns>Index of the string record.</returns>
+		static std::uint32_t Intern(CookContext& context, const std::string& string);
+
+		/// <summary>
+		/// Pads the data section to an alignment, then appends bytes to it.
+		/// </summary>
+		/// <param name="context">Tables being filled.</param>
+		/// <param name="bytes">Bytes to be appended.</param>
+		/// <param name="size">Number of bytes.</param>
+		/// <param name="alignment">Alignment of the bytes within the data section.</param>
+		/// <returns>Offset of the bytes within the data section.</returns>
+		static std::uint64_t AppendData(CookContext& context, const void* bytes, const std::size_t size, const std::size_t alignment=Alignment);
+
+		/// <summary>
+		/// Gets the size in bytes of a cooked element of a given type. Strings are cooked as string table indices.
+		/// </summary>
+		/// <param name="type">Type of the attribute.</param>
+		/// <returns>Size of an element in bytes, or zero for types whose values are not cooked.</returns>
+		static std::size_t ElementSize(const Datum::Types type);
+
+		/// <summary>
+		/// Gets the offset following a section, rounded up to the alignment.
+		/// </summary>
+		/// <param name="offset">Offset of the section.</param>
+		/// <param name="size">Size of the section in bytes.</param>
+		/// <returns>Aligned offset.</returns>
+		static std::uint64_t AlignedEnd(const std::uint64_t offset, const std::size_t size);
+#pragma endregion Helper Methods
+	};
+}
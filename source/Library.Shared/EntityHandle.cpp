@@ -0,0 +1,209 @@
+#pragma region Includes
+// Pre-compiled Header
+#include "pch.h"
+
+// Header
+#include "EntityHandle.h"
+
+// Standard
+#include <array>
+#include <atomic>
+#include <limits>
+#pragma endregion Includes
+
+namespace Library
+{
+#pragma region Slot Table
+	namespace
+	{
+		/// <summary>
+		/// Number of slots per page, as a power of two.
+		/// </summary>
+		constexpr std::uint32_t PageShift = 12;
+
+		/// <summary>
+		/// Number of slots per page.
+		/// </summary>
+		constexpr std::uint32_t PageSize = 1 << PageShift;
+
+		/// <summary>
+		/// Maximum number of pages.
+		/// </summary>
+		constexpr std::uint32_t MaxPages = EntityHandle::MaxSlots / PageSize;
+
+		/// <summary>
+		/// Slot index representing the end of the free list.
+		/// </summary>
+		constexpr std::uint32_t InvalidIndex = std::numeric_limits<std::uint32_t>::max();
+
+		/// <summary>
+		/// Entry within the slot table.
+		/// </summary>
+		struct Slot final
+		{
+			/// <summary>
+			/// Entity occupying the slot, or null while free.
+			/// </summary>
+			std::atomic<Entity*> Target{ nullptr };
+
+			/// <summary>
+			/// Generation of the slot, incremented each time it is released.
+			/// </summary>
+			std::atomic<std::uint32_t> Generation{ 1 };
+
+			/// <summary>
+			/// Next free slot while free.
+			/// </summary>
+			std::uint32_t NextFree{ InvalidIndex };
+		};
+
+		/// <summary>
+		/// Global table of slots, allocated in fixed size pages so that slots never move while being resolved.
+		/// The first page is statically allocated. Further pages are allocated on demand and kept until the table is destroyed,
+		/// as a lock-free Resolve may be reading any of them at any time.
+		/// </summary>
+		struct SlotTable final
+		{
+			/// <summary>
+			/// Statically allocated first page.
+			/// </summary>
+			std::array<Slot, PageSize> FirstPage;
+
+			/// <summary>
+			/// Pages of slots. Null until first needed.
+			/// </summary>
+			std::array<std::atomic<Slot*>, MaxPages> Pages{};
+
+			/// <summary>
+			/// Number of slots handed out so far, free or occupied.
+			/// </summary>
+			std::uint32_t SlotCount{ 0 };
+
+			/// <summary>
+			/// Head of the free list.
+			/// </summary>
+			std::uint32_t FreeHead{ InvalidIndex };
+
+			/// <summary>
+			/// Guards slot assignment and release.
+			/// </summary>
+			std::mutex Mutex;
+
+			SlotTable()
+			{
+				Pages[0].store(FirstPage.data(), std::memory_order_release);
+			}
+
+			~SlotTable()
+			{
+				for (std::uint32_t page = 1; page < MaxPages; ++page)
+				{
+					delete[] Pages[page].load(std::memory_order_acquire);
+				}
+			}
+
+			SlotTable(const SlotTable&) = delete;
+			SlotTable& operator=(const SlotTable&) = delete;
+			SlotTable(SlotTable&&) = delete;
+			SlotTable& operator=(SlotTable&&) = delete;
+
+			/// <summary>
+			/// Gets the slot at the given index. The page holding it must exist.
+			/// </summary>
+			Slot& At(const std::uint32_t index)
+			{
+				return Pages[index >> PageShift].load(std::memory_order_acquire)[index & (PageSize - 1)];
+			}
+		};
+
+		/// <summary>
+		/// Gets the global slot table.
+		/// </summary>
+		SlotTable& Table()
+		{
+			static SlotTable table;
+			return table;
+		}
+	}
+#pragma endregion Slot Table
+
+#pragma region Accessors
+	Entity* EntityHandle::Resolve() const
+	{
+		const std::uint32_t index = Index();
+		if (IsNull() || index >= MaxSlots) return nullptr;
+
+		const Slot* page = Table().Pages[index >> PageShift].load(std::memory_order_acquire);
+		if (page == nullptr) return nullptr;
+
+		const Slot& slot = page[index & (PageSize - 1)];
+		Entity* target = slot.Target.load(std::memory_order_acquire);
+
+		return slot.Generation.load(std::memory_order_acquire) == Generation() ? target : nullptr;
+	}
+#pragma endregion Accessors
+
+#pragma region Slot Management
+	EntityHandle EntityHandle::Register(Entity& entity)
+	{
+		SlotTable& table = Table();
+		std::scoped_lock<std::mutex> lock(table.Mutex);
+
+		std::uint32_t index = table.FreeHead;
+
+		if (index != InvalidIndex)
+		{
+			table.FreeHead = table.At(index).NextFree;
+		}
+		else
+		{
+			if (table.SlotCount == MaxSlots)
+			{
+				throw std::runtime_error("Entity slot table is full.");
+			}
+
+			index = table.SlotCount++;
+
+			if ((index & (PageSize - 1)) == 0 && index >= PageSize)
+			{
+				table.Pages[index >> PageShift].store(new Slot[PageSize], std::memory_order_release);
+			}
+		}
+
+		Slot& slot = table.At(index);
+		slot.Target.store(&entity, std::memory_order_release);
+
+		return EntityHandle(index, slot.Generation.load(std::memory_order_relaxed));
+	}
+
+	void EntityHandle::Unregister(const EntityHandle& handle)
+	{
+		if (handle.IsNull()) return;
+
+		SlotTable& table = Table();
+		std::scoped_lock<std::mutex> lock(table.Mutex);
+
+		Slot& slot = table.At(handle.Index());
+		assert(slot.Generation.load(std::memory_order_relaxed) == handle.Generation());
+
+		std::uint32_t generation = handle.Generation() + 1;
+		if (generation == 0) generation = 1;
+
+		slot.Target.store(nullptr, std::memory_order_release);
+		slot.Generation.store(generation, std::memory_order_release);
+
+		slot.NextFree = table.FreeHead;
+		table.FreeHead = handle.Index();
+	}
+
+	void EntityHandle::Retarget(const EntityHandle& handle, Entity& entity)
+	{
+		if (handle.IsNull()) return;
+
+		Slot& slot = Table().At(handle.Index());
+		assert(slot.Generation.load(std::memory_order_relaxed) == handle.Generation());
+
+		slot.Target.store(&entity, std::memory_order_release);
+	}
+#pragma endregion Slot Management
+}
@@ -0,0 +1,178 @@
+#pragma once
+
+#pragma region Includes
+// Standard
+#include <cstdint>
+#pragma endregion Includes
+
+namespace Library
+{
+	// Forward Declarations
+	class Entity;
+
+	/// <summary>
+	/// Compact generational handle to an Entity, resolved through a global slot table in constant time.
+	/// </summary>
+	/// <remarks>
+	/// Every Entity is assigned a slot on construction. Destroying the Entity bumps the generation of its slot,
+	/// so outstanding handles resolve to null instead of dangling, even once the slot is reused.
+	/// Moving an Entity transfers its handle to the moved into Entity.
+	/// Resolution is lock-free. Slot assignment and release are serialized internally, so Entity objects may be constructed on any thread.
+	/// </remarks>
+	class EntityHandle final
+	{
+		friend class Entity;
+
+#pragma region Type Definitions, Constants
+	public:
+		/// <summary>
+		/// Maximum number of Entity objects that may be alive at once.
+		/// </summary>
+		inline static constexpr std::uint32_t MaxSlots = 1 << 24;
+#pragma endregion Type Definitions, Constants
+
+#pragma region Special Members
+	public:
+		/// <summary>
+		/// Default constructor. Creates a null handle.
+		/// </summary>
+		constexpr EntityHandle() noexcept = default;
+
+		/// <summary>
+		/// Default destructor.
+		/// </summary>
+		~EntityHandle() = default;
+
+		/// <summary>
+		/// Copy constructor.
+		/// </summary>
+		/// <param name="rhs">EntityHandle to be copied.</param>
+		EntityHandle(const EntityHandle& rhs) = default;
+
+		/// <summary>
+		/// Copy assignment operator.
+		/// </summary>
+		/// <param name="rhs">EntityHandle to be copied.</param>
+		/// <returns>Newly copied into left hand side EntityHandle.</returns>
+		EntityHandle& operator=(const EntityHandle& rhs) = default;
+
+		/// <summary>
+		/// Move constructor.
+		/// </summary>
+		/// <param name="rhs">EntityHandle to be moved.</param>
+		EntityHandle(EntityHandle&& rhs) noexcept = default;
+
+		/// <summary>
+		/// Move assignment operator.
+		/// </summary>
+		/// <param name="rhs">EntityHandle to be moved.</param>
+		/// <returns>Newly moved into left hand side EntityHandle.</returns>
+		EntityHandle& operator=(EntityHandle&& rhs) noexcept = default;
+
+		/// <summary>
+		/// Reconstructs a handle from its packed value, e.g. one stored in an integer Attribute or sent in an Event.
+		/// </summary>
+		/// <param name="value">Packed value returned by Value.</param>
+		/// <returns>EntityHandle with the given packed value.</returns>
+		static constexpr EntityHandle FromValue(const std::uint64_t value) noexcept;
+#pragma endregion Special Members
+
+#pragma region Boolean Operators
+	public:
+		/// <summary>
+		/// Equality operator.
+		/// </summary>
+		/// <param name="rhs">EntityHandle to be compared against.</param>
+		/// <returns>True when both handles refer to the same slot and generation. Otherwise, false.</returns>
+		constexpr bool operator==(const EntityHandle& rhs) const noexcept;
+
+		/// <summary>
+		/// Inequality operator.
+		/// </summary>
+		/// <param name="rhs">EntityHandle to be compared against.</param>
+		/// <returns>True when the handles refer to different slots or generations. Otherwise, false.</returns>
+		constexpr bool operator!=(const EntityHandle& rhs) const noexcept;
+#pragma endregion Boolean Operators
+
+#pragma region Accessors
+	public:
+		/// <summary>
+		/// Gets the packed 64 bit value of the handle, with the generation in the upper half and the slot index in the lower half.
+		/// </summary>
+		/// <returns>Packed value of the handle. Zero for a null handle.</returns>
+		constexpr std::uint64_t Value() const noexcept;
+
+		/// <summary>
+		/// Gets the index of the slot the handle refers to.
+		/// </summary>
+		/// <returns>Slot index.</returns>
+		constexpr std::uint32_t Index() const noexcept;
+
+		/// <summary>
+		/// Gets the generation of the slot at the time the handle was created.
+		/// </summary>
+		/// <returns>Slot generation. Zero for a null handle.</returns>
+		constexpr std::uint32_t Generation() const noexcept;
+
+		/// <summary>
+		/// Gets whether the handle is null, i.e. was never assigned to an Entity.
+		/// </summary>
+		/// <returns>True when null. Otherwise, false.</returns>
+		constexpr bool IsNull() const noexcept;
+
+		/// <summary>
+		/// Gets whether the Entity the handle refers to is still alive.
+		/// </summary>
+		/// <returns>True when the handle resolves to an Entity. Otherwise, false.</returns>
+		bool IsValid() const;
+
+		/// <summary>
+		/// Gets the Entity the handle refers to.
+		/// </summary>
+		/// <returns>Pointer to the Entity, or null when the handle is null or the Entity has been destroyed.</returns>
+		Entity* Resolve() const;
+#pragma endregion Accessors
+
+#pragma region Slot Management
+	private:
+		/// <summary>
+		/// Specialized constructor for packing a slot index and generation.
+		/// </summary>
+		/// <param name="index">Slot index.</param>
+		/// <param name="generation">Slot generation.</param>
+		constexpr EntityHandle(const std::uint32_t index, const std::uint32_t generation) noexcept;
+
+		/// <summary>
+		/// Assigns a free slot to an Entity.
+		/// </summary>
+		/// <param name="entity">Entity to be assigned a slot.</param>
+		/// <returns>Handle to the Entity.</returns>
+		/// <exception cref="std::runtime_error">Slot table is full.</exception>
+		static EntityHandle Register(Entity& entity);
+
+		/// <summary>
+		/// Releases the slot of a handle, invalidating every copy of it. Does nothing for a null handle.
+		/// </summary>
+		/// <param name="handle">Handle whose slot is released.</param>
+		static void Unregister(const EntityHandle& handle);
+
+		/// <summary>
+		/// Points the slot of a handle at a different Entity, after a move.
+		/// </summary>
+		/// <param name="handle">Handle whose slot is retargeted.</param>
+		/// <param name="entity">Entity the slot now refers to.</param>
+		static void Retarget(const EntityHandle& handle, Entity& entity);
+#pragma endregion Slot Management
+
+#pragma region Data Members
+	private:
+		/// <summary>
+		/// Packed generation and slot index.
+		/// </summary>
+		std::uint64_t mValue{ 0 };
+#pragma endregion Data Members
+	};
+}
+
+// Inline File
+#include "EntityHandle.inl"
@@ -0,0 +1,60 @@
+#pragma once
+
+// Header
+#include "EntityHandle.h"
+
+namespace Library
+{
+#pragma region Special Members
+	inline constexpr EntityHandle EntityHandle::FromValue(const std::uint64_t value) noexcept
+	{
+		EntityHandle handle;
+		handle.mValue = value;
+		return handle;
+	}
+
+	inline constexpr EntityHandle::EntityHandle(const std::uint32_t index, const std::uint32_t generation) noexcept :
+		mValue((static_cast<std::uint64_t>(generation) << 32) | index)
+	{
+	}
+#pragma endregion Special Members
+
+#pragma region Boolean Operators
+	inline constexpr bool EntityHandle::operator==(const EntityHandle& rhs) const noexcept
+	{
+		return mValue == rhs.mValue;
+	}
+
+	inline constexpr bool EntityHandle::operator!=(const EntityHandle& rhs) const noexcept
+	{
+		return !operator==(rhs);
+	}
+#pragma endregion Boolean Operators
+
+#pragma region Accessors
+	inline constexpr std::uint64_t EntityHandle::Value() const noexcept
+	{
+		return mValue;
+	}
+
+	inline constexpr std::uint32_t EntityHandle::Index() const noexcept
+	{
+		return static_cast<std::uint32_t>(mValue);
+	}
+
+	inline constexpr std::uint32_t EntityHandle::Generation() const noexcept
+	{
+		return static_cast<std::uint32_t>(mValue >> 32);
+	}
+
+	inline constexpr bool EntityHandle::IsNull() const noexcept
+	{
+		return mValue == 0;
+	}
+
+	inline bool EntityHandle::IsValid() const
+	{
+		return Resolve() != nullptr;
+	}
+#pragma endregion Accessors
+}
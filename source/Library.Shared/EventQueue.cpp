@@ -11,6 +11,7 @@
 
 // First Party
 #include "EventPublisher.h"
+#include "Profiler.h"
 #pragma endregion Includes
 
 using namespace std::string_literals;
@@ -24,6 +25,8 @@ namespace Library
 
 	void EventQueue::Update(const GameTime& gameTime)
 	{
+		PROFILE_SCOPE("EventQueue::Update");
+
 		for (EventEntry& entry : mQueue)
 		{
 			if (gameTime.CurrentTime() >= entry.ExpireTime)
@@ -0,0 +1,300 @@
+#pragma region Includes
+// Pre-compiled Header
+#include "pch.h"
+
+// Header
+#include "ExpressionBatch.h"
+
+// Standard
+#include <algorithm>
+
+// First Party
+#include "ActionExpression.h"
+#include "Profiler.h"
+#pragma endregion Includes
+
+namespace Library
+{
+#pragma region Lane Operations
+	namespace
+	{
+		using OpCode = CompiledExpression::OpCode;
+		using Value = CompiledExpression::Value;
+
+		/// <summary>
+		/// Applies an operation to every value of a lane.
+		/// Kept free of branches and aliasing so that the loop vectorizes.
+		/// </summary>
+		template <typename TOperation>
+		inline void Unary(Value* const lane, const std::size_t count, TOperation operation)
+		{
+			for (std::size_t i = 0; i < count; ++i)
+			{
+				operation(lane[i]);
+			}
+		}
+
+		/// <summary>
+		/// Combines every value of a lane with the corresponding value of the lane above it, storing the result in the lower lane.
+		/// Kept free of branches and aliasing so that the loop vectorizes.
+		/// </summary>
+		template <typename TOperation>
+		inline void Binary(Value* const lhs, const Value* const rhs, const std::size_t count, TOperation operation)
+		{
+			for (std::size_t i = 0; i < count; ++i)
+			{
+				operation(lhs[i], rhs[i]);
+			}
+		}
+
+		/// <summary>
+		/// Throws when any value of an integer divisor lane is zero.
+		/// </summary>
+		inline void CheckDivisor(const Value* const lane, const std::size_t count)
+		{
+			int allNonZero = 1;
+
+			for (std::size_t i = 0; i < count; ++i)
+			{
+				allNonZero &= lane[i].Integer != 0;
+			}
+
+			if (!allNonZero) throw std::runtime_error("Integer division by zero.");
+		}
+	}
+#pragma endregion Lane Operations
+
+#pragma region Modifiers
+	void ExpressionBatch::Add(ActionExpression& expression)
+	{
+		if (!expression.IsCompiled()) expression.Compile();
+		if (expression.mIsBatchQueued) return;
+
+		expression.mBatched = 1;
+		expression.mIsBatchQueued = true;
+
+		const CompiledExpression& program = expression.mProgram;
+		if (program.IsEmpty()) return;
+
+		Shape& shape = mShapes[program.ShapeKey()];
+		if (shape.Program.IsEmpty()) shape.Program = program;
+
+		shape.Handles.PushBack(expression.Handle());
+		shape.Versions.PushBack(expression.mProgramVersion);
+
+		for (auto* operand : program.Operands())
+		{
+			shape.Operands.PushBack(operand);
+		}
+
+		++mSize;
+	}
+
+	void ExpressionBatch::Clear()
+	{
+		for (auto& pair : mShapes)
+		{
+			for (const auto& handle : pair.second.Handles)
+			{
+				Entity* entity = handle.Resolve();
+				ActionExpression* expression = entity ? entity->As<ActionExpression>() : nullptr;
+
+				if (expression) expression->mIsBatchQueued = false;
+			}
+		}
+
+		mShapes.Clear();
+		mSize = 0;
+	}
+
+	void ExpressionBatch::Evaluate()
+	{
+		PROFILE_SCOPE("ExpressionBatch::Evaluate");
+
+		for (auto& pair : mShapes)
+		{
+			Refresh(pair.second);
+		}
+
+		try
+		{
+			for (auto& pair : mShapes)
+			{
+				Evaluate(pair.second);
+			}
+		}
+		catch (...)
+		{
+			ClearInstances();
+			throw;
+		}
+
+		ClearInstances();
+	}
+#pragma endregion Modifiers
+
+#pragma region Helper Methods
+	void ExpressionBatch::Refresh(Shape& shape)
+	{
+		shape.Results.Clear();
+
+		std::size_t i = 0;
+
+		while (i < shape.Handles.Size())
+		{
+			Entity* entity = shape.Handles[i].Resolve();
+			ActionExpression* expression = entity ? entity->As<ActionExpression>() : nullptr;
+
+			if (expression == nullptr || expression->mProgramVersion != shape.Versions[i])
+			{
+				RemoveAt(shape, i);
+				continue;
+			}
+
+			expression->mIsBatchQueued = false;
+
+			if (expression->GetParent() == nullptr || !expression->IsCompiled() || !expression->mBatched)
+			{
+				RemoveAt(shape, i);
+			}
+			else
+			{
+				shape.Results.PushBack(expression->mResultPtr);
+				++i;
+			}
+		}
+	}
+
+	void ExpressionBatch::ClearInstances()
+	{
+		for (auto& pair : mShapes)
+		{
+			Shape& shape = pair.second;
+			shape.Handles.Clear();
+			shape.Versions.Clear();
+			shape.Operands.Clear();
+			shape.Results.Clear();
+		}
+
+		mSize = 0;
+	}
+
+	void ExpressionBatch::RemoveAt(Shape& shape, const std::size_t index)
+	{
+		const std::size_t last = shape.Handles.Size() - 1;
+		const std::size_t operandCount = shape.Program.Operands().Size();
+
+		if (index != last)
+		{
+			shape.Handles[index] = shape.Handles[last];
+			shape.Versions[index] = shape.Versions[last];
+
+			for (std::size_t operand = 0; operand < operandCount; ++operand)
+			{
+				shape.Operands[index * operandCount + operand] = shape.Operands[last * operandCount + operand];
+			}
+		}
+
+		shape.Handles.PopBack();
+		shape.Versions.PopBack();
+		shape.Operands.Resize(last * operandCount);
+
+		--mSize;
+	}
+
+	void ExpressionBatch::Evaluate(Shape& shape)
+	{
+		const std::size_t count = shape.Handles.Size();
+		if (count == 0) return;
+
+		const CompiledExpression& program = shape.Program;
+		const std::size_t operandCount = program.Operands().Size();
+		const Vector<Value>& constants = program.Constants();
+
+		// Lane zero is left unused, so that top always points at the topmost lane.
+		shape.Lanes.Resize((program.StackDepth() + 1) * count);
+		Value* const lanes = &shape.Lanes[0];
+		Value* top = lanes;
+
+		for (const auto& instruction : program.Code())
+		{
+			Value* const below = top != lanes ? top - count : lanes;
+
+			switch (instruction.Op)
+			{
+			case OpCode::LoadInteger:
+				top += count;
+				for (std::size_t i = 0; i < count; ++i) top[i].Integer = shape.Operands[i * operandCount + instruction.Argument]->Get<int>();
+				break;
+
+			case OpCode::LoadFloat:
+				top += count;
+				for (std::size_t i = 0; i < count; ++i) top[i].Float = shape.Operands[i * operandCount + instruction.Argument]->Get<float>();
+				break;
+
+			case OpCode::Constant:
+				top += count;
+				std::fill(top, top + count, constants[instruction.Argument]);
+				break;
+
+			case OpCode::IntegerToFloat:		Unary(top, count, [](Value& v) { v.Float = static_cast<float>(v.Integer); });					break;
+			case OpCode::IntegerToFloatBelow:	Unary(below, count, [](Value& v) { v.Float = static_cast<float>(v.Integer); });					break;
+			case OpCode::FloatToBoolean:		Unary(top, count, [](Value& v) { v.Integer = v.Float != 0.0f; });								break;
+			case OpCode::FloatToBooleanBelow:	Unary(below, count, [](Value& v) { v.Integer = v.Float != 0.0f; });								break;
+
+			case OpCode::NegateInteger:			Unary(top, count, [](Value& v) { v.Integer = -v.Integer; });									break;
+			case OpCode::NegateFloat:			Unary(top, count, [](Value& v) { v.Float = -v.Float; });										break;
+			case OpCode::Not:					Unary(top, count, [](Value& v) { v.Integer = !v.Integer; });									break;
+
+			case OpCode::AddInteger:			Binary(below, top, count, [](Value& l, const Value& r) { l.Integer += r.Integer; });				top = below; break;
+			case OpCode::AddFloat:				Binary(below, top, count, [](Value& l, const Value& r) { l.Float += r.Float; });					top = below; break;
+			case OpCode::SubtractInteger:		Binary(below, top, count, [](Value& l, const Value& r) { l.Integer -= r.Integer; });				top = below; break;
+			case OpCode::SubtractFloat:			Binary(below, top, count, [](Value& l, const Value& r) { l.Float -= r.Float; });					top = below; break;
+			case OpCode::MultiplyInteger:		Binary(below, top, count, [](Value& l, const Value& r) { l.Integer *= r.Integer; });				top = below; break;
+			case OpCode::MultiplyFloat:			Binary(below, top, count, [](Value& l, const Value& r) { l.Float *= r.Float; });					top = below; break;
+			case OpCode::DivideFloat:			Binary(below, top, count, [](Value& l, const Value& r) { l.Float /= r.Float; });					top = below; break;
+
+			case OpCode::DivideInteger:
+				CheckDivisor(top, count);
+				Binary(below, top, count, [](Value& l, const Value& r) { l.Integer /= r.Integer; });
+				top = below;
+				break;
+
+			case OpCode::Modulo:
+				CheckDivisor(top, count);
+				Binary(below, top, count, [](Value& l, const Value& r) { l.Integer %= r.Integer; });
+				top = below;
+				break;
+
+			case OpCode::LessInteger:			Binary(below, top, count, [](Value& l, const Value& r) { l.Integer = l.Integer < r.Integer; });		top = below; break;
+			case OpCode::LessFloat:				Binary(below, top, count, [](Value& l, const Value& r) { l.Integer = l.Float < r.Float; });			top = below; break;
+			case OpCode::LessEqualInteger:		Binary(below, top, count, [](Value& l, const Value& r) { l.Integer = l.Integer <= r.Integer; });	top = below; break;
+			case OpCode::LessEqualFloat:		Binary(below, top, count, [](Value& l, const Value& r) { l.Integer = l.Float <= r.Float; });		top = below; break;
+			case OpCode::GreaterInteger:		Binary(below, top, count, [](Value& l, const Value& r) { l.Integer = l.Integer > r.Integer; });		top = below; break;
+			case OpCode::GreaterFloat:			Binary(below, top, count, [](Value& l, const Value& r) { l.Integer = l.Float > r.Float; });			top = below; break;
+			case OpCode::GreaterEqualInteger:	Binary(below, top, count, [](Value& l, const Value& r) { l.Integer = l.Integer >= r.Integer; });	top = below; break;
+			case OpCode::GreaterEqualFloat:		Binary(below, top, count, [](Value& l, const Value& r) { l.Integer = l.Float >= r.Float; });		top = below; break;
+			case OpCode::EqualInteger:			Binary(below, top, count, [](Value& l, const Value& r) { l.Integer = l.Integer == r.Integer; });	top = below; break;
+			case OpCode::EqualFloat:			Binary(below, top, count, [](Value& l, const Value& r) { l.Integer = l.Float == r.Float; });		top = below; break;
+			case OpCode::NotEqualInteger:		Binary(below, top, count, [](Value& l, const Value& r) { l.Integer = l.Integer != r.Integer; });	top = below; break;
+			case OpCode::NotEqualFloat:			Binary(below, top, count, [](Value& l, const Value& r) { l.Integer = l.Float != r.Float; });		top = below; break;
+
+			case OpCode::And:					Binary(below, top, count, [](Value& l, const Value& r) { l.Integer = l.Integer != 0 && r.Integer != 0; });	top = below; break;
+			case OpCode::Or:					Binary(below, top, count, [](Value& l, const Value& r) { l.Integer = l.Integer != 0 || r.Integer != 0; });	top = below; break;
+
+			default:							throw std::runtime_error("Invalid expression instruction.");
+			}
+		}
+
+		assert(top == lanes + count);
+
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			if (shape.Results[i] != nullptr)
+			{
+				CompiledExpression::Store(top[i], program.ResultType(), *shape.Results[i]);
+			}
+		}
+	}
+#pragma endregion Helper Methods
+}
@@ -0,0 +1,196 @@
+#pragma once
+
+#pragma region Includes
+// Standard
+#include <cstdint>
+#include <string>
+
+// First Party
+#include "CompiledExpression.h"
+#include "EntityHandle.h"
+#include "HashMap.h"
+#include "Vector.h"
+#pragma endregion Includes
+
+namespace Library
+{
+	// Forward Declarations
+	class ActionExpression;
+
+	/// <summary>
+	/// Evaluates many ActionExpression instances together, grouped by the shape of their compiled expression.
+	/// </summary>
+	/// <remarks>
+	/// Expressions that differ only in the Datum their operands are bound to share a shape.
+	/// Batched instances queue themselves during Update, and are evaluated once the Entity traversal is complete.
+	/// The operand values of every instance of a shape are gathered into contiguous lanes,
+	/// each instruction is applied across all lanes in a single tight loop, and the results are scattered back to the Result Datum of each instance.
+	/// Instances are queued for a single evaluation, and are skipped if destroyed, orphaned or moved to another parent, recompiled, or no longer batched since.
+	/// </remarks>
+	class ExpressionBatch final
+	{
+#pragma region Special Members
+	public:
+		/// <summary>
+		/// Default constructor.
+		/// </summary>
+		ExpressionBatch() = default;
+
+		/// <summary>
+		/// Default destructor.
+		/// </summary>
+		~ExpressionBatch() = default;
+
+		/// <summary>
+		/// Deleted copy constructor. Instances must not be evaluated by more than one batch.
+		/// </summary>
+		ExpressionBatch(const ExpressionBatch&) = delete;
+
+		/// <summary>
+		/// Deleted copy assignment operator. Instances must not be evaluated by more than one batch.
+		/// </summary>
+		ExpressionBatch& operator=(const ExpressionBatch&) = delete;
+
+		/// <summary>
+		/// Move constructor.
+		/// </summary>
+		/// <param name="rhs">ExpressionBatch to be moved.</param>
+		ExpressionBatch(ExpressionBatch&& rhs) noexcept = default;
+
+		/// <summary>
+		/// Move assignment operator.
+		/// </summary>
+		/// <param name="rhs">ExpressionBatch to be moved.</param>
+		/// <returns>Newly moved into left hand side ExpressionBatch.</returns>
+		ExpressionBatch& operator=(ExpressionBatch&& rhs) noexcept = default;
+#pragma endregion Special Members
+
+#pragma region Accessors
+	public:
+		/// <summary>
+		/// Gets the number of distinct expression shapes seen by the batch since it was last cleared.
+		/// </summary>
+		/// <returns>Number of shapes.</returns>
+		std::size_t ShapeCount() const;
+
+		/// <summary>
+		/// Gets the number of instances awaiting evaluation, including any not yet found to be stale.
+		/// </summary>
+		/// <returns>Number of instances.</returns>
+		std::size_t Size() const;
+
+		/// <summary>
+		/// Gets whether no instances await evaluation.
+		/// </summary>
+		/// <returns>True when empty. Otherwise, false.</returns>
+		bool IsEmpty() const;
+#pragma endregion Accessors
+
+#pragma region Modifiers
+	public:
+		/// <summary>
+		/// Queues an ActionExpression for the next evaluation, marking it as batched and compiling it first if needed.
+		/// Queuing it again before then has no effect, unless it was recompiled in between.
+		/// </summary>
+		/// <param name="expression">ActionExpression to be evaluated.</param>
+		/// <exception cref="std::runtime_error">Expression fails to compile.</exception>
+		void Add(ActionExpression& expression);
+
+		/// <summary>
+		/// Removes every queued instance and shape, without evaluating them.
+		/// </summary>
+		void Clear();
+
+		/// <summary>
+		/// Evaluates every queued instance, skipping any that are stale, and clears the queued instances.
+		/// Shapes are kept, so their storage is reused by the next evaluation.
+		/// </summary>
+		/// <exception cref="std::runtime_error">Integer division or modulo by zero, or a Result Datum that is neither an integer nor a float.</exception>
+		void Evaluate();
+#pragma endregion Modifiers
+
+#pragma region Helper Types
+	private:
+		using Value = CompiledExpression::Value;
+
+		/// <summary>
+		/// Instances sharing a shape, stored as parallel arrays.
+		/// </summary>
+		struct Shape final
+		{
+			/// <summary>
+			/// Compiled expression of the first instance, providing the shared bytecode and constants.
+			/// </summary>
+			CompiledExpression Program;
+
+			/// <summary>
+			/// Handle of each instance.
+			/// </summary>
+			Vector<EntityHandle> Handles{ Vector<EntityHandle>::EqualityFunctor() };
+
+			/// <summary>
+			/// Program version of each instance when queued.
+			/// </summary>
+			Vector<std::uint32_t> Versions;
+
+			/// <summary>
+			/// Operand Datum of each instance, with the operands of an instance stored contiguously.
+			/// </summary>
+			Vector<Datum*> Operands;
+
+			/// <summary>
+			/// Result Datum of each instance, refreshed every evaluation.
+			/// </summary>
+			Vector<Datum*> Results;
+
+			/// <summary>
+			/// Evaluation stack, one contiguous lane per stack level.
+			/// </summary>
+			Vector<Value> Lanes{ Vector<Value>::EqualityFunctor() };
+		};
+#pragma endregion Helper Types
+
+#pragma region Helper Methods
+	private:
+		/// <summary>
+		/// Drops stale instances from a Shape, gathers the Result Datum of the rest and marks them as no longer queued.
+		/// </summary>
+		/// <param name="shape">Shape to be refreshed.</param>
+		void Refresh(Shape& shape);
+
+		/// <summary>
+		/// Removes every instance of every Shape, keeping the Shapes and their storage.
+		/// </summary>
+		void ClearInstances();
+
+		/// <summary>
+		/// Removes an instance from a Shape, moving the last instance into its place.
+		/// </summary>
+		/// <param name="shape">Shape holding the instance.</param>
+		/// <param name="index">Index of the instance.</param>
+		void RemoveAt(Shape& shape, const std::size_t index);
+
+		/// <summary>
+		/// Evaluates every instance of a Shape.
+		/// </summary>
+		/// <param name="shape">Shape to be evaluated.</param>
+		static void Evaluate(Shape& shape);
+#pragma endregion Helper Methods
+
+#pragma region Data Members
+	private:
+		/// <summary>
+		/// Shapes, keyed by CompiledExpression::ShapeKey.
+		/// </summary>
+		HashMap<std::string, Shape> mShapes;
+
+		/// <summary>
+		/// Number of queued instances.
+		/// </summary>
+		std::size_t mSize{ 0 };
+#pragma endregion Data Members
+	};
+}
+
+// Inline File
+#include "ExpressionBatch.inl"
@@ -0,0 +1,24 @@
+#pragma once
+
+// Header
+#include "ExpressionBatch.h"
+
+namespace Library
+{
+#pragma region Accessors
+	inline std::size_t ExpressionBatch::ShapeCount() const
+	{
+		return mShapes.Size();
+	}
+
+	inline std::size_t ExpressionBatch::Size() const
+	{
+		return mSize;
+	}
+
+	inline bool ExpressionBatch::IsEmpty() const
+	{
+		return mSize == 0;
+	}
+#pragma endregion Accessors
+}
@@ -0,0 +1,105 @@
+#pragma once
+
+#pragma region Includes
+// Platform. Defining LIBRARY_FLOAT4_SCALAR builds the scalar lanes on any platform, so both paths can be tested.
+#if !defined(LIBRARY_FLOAT4_SCALAR) && (defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__))
+#define LIBRARY_FLOAT4_SSE
+#include <xmmintrin.h>
+#endif
+#pragma endregion Includes
+
+namespace Library
+{
+	/// <summary>
+	/// Four float lanes operated on together, using SSE where available and scalar lanes otherwise.
+	/// Comparisons produce lane masks for Select, rather than booleans.
+	/// </summary>
+	class Float4 final
+	{
+#pragma region Special Members
+	public:
+		Float4() = default;
+		~Float4() = default;
+		Float4(const Float4& rhs) = default;
+		Float4& operator=(const Float4& rhs) = default;
+		Float4(Float4&& rhs) = default;
+		Float4& operator=(Float4&& rhs) = default;
+
+		/// <summary>
+		/// Broadcasts a value to every lane.
+		/// </summary>
+		/// <param name="value">Value of every lane.</param>
+		explicit Float4(const float value);
+
+		/// <summary>
+		/// Loads four consecutive values.
+		/// </summary>
+		/// <param name="values">Pointer to four floats. Need not be aligned.</param>
+		/// <returns>Float4 holding the values.</returns>
+		static Float4 Load(const float* values);
+
+		/// <summary>
+		/// Stores the lanes to four consecutive values.
+		/// </summary>
+		/// <param name="values">Pointer to four floats. Need not be aligned.</param>
+		void Store(float* values) const;
+#pragma endregion Special Members
+
+#pragma region Arithmetic Operators
+	public:
+		Float4 operator+(const Float4& rhs) const;
+		Float4 operator-(const Float4& rhs) const;
+		Float4 operator*(const Float4& rhs) const;
+		Float4 operator/(const Float4& rhs) const;
+		Float4 operator-() const;
+#pragma endregion Arithmetic Operators
+
+#pragma region Comparison Operators
+	public:
+		/// <summary>
+		/// Compares each lane, producing a lane mask.
+		/// </summary>
+		/// <returns>Mask with all bits set in lanes where lhs is less than rhs.</returns>
+		Float4 operator<(const Float4& rhs) const;
+
+		/// <summary>
+		/// Compares each lane, producing a lane mask.
+		/// </summary>
+		/// <returns>Mask with all bits set in lanes where lhs is greater than rhs.</returns>
+		Float4 operator>(const Float4& rhs) const;
+#pragma endregion Comparison Operators
+
+#pragma region Lane Functions
+	public:
+		/// <summary>
+		/// Chooses each lane from one of two values by a lane mask.
+		/// </summary>
+		/// <param name="mask">Lane mask, as produced by a comparison.</param>
+		/// <param name="whenTrue">Lanes chosen where the mask is set.</param>
+		/// <param name="whenFalse">Lanes chosen where the mask is clear.</param>
+		/// <returns>Chosen lanes.</returns>
+		static Float4 Select(const Float4& mask, const Float4& whenTrue, const Float4& whenFalse);
+
+		static Float4 Min(const Float4& lhs, const Float4& rhs);
+		static Float4 Max(const Float4& lhs, const Float4& rhs);
+
+		/// <summary>
+		/// Linearly interpolates each lane.
+		/// </summary>
+		/// <returns>lhs + (rhs - lhs) * t.</returns>
+		static Float4 Lerp(const Float4& lhs, const Float4& rhs, const Float4& t);
+#pragma endregion Lane Functions
+
+	private:
+#if defined(LIBRARY_FLOAT4_SSE)
+		explicit Float4(const __m128 value);
+
+		__m128 mValue;
+#else
+		float mValues[4];
+#endif
+	};
+}
+
+// Inline File
+#include "Float4.inl"
@@ -0,0 +1,205 @@
+#pragma once
+
+// Header
+#include "Float4.h"
+
+// Standard
+#include <cstdint>
+#include <cstring>
+
+namespace Library
+{
+#if defined(LIBRARY_FLOAT4_SSE)
+#pragma region Special Members
+	inline Float4::Float4(const float value) :
+		mValue(_mm_set1_ps(value))
+	{
+	}
+
+	inline Float4::Float4(const __m128 value) :
+		mValue(value)
+	{
+	}
+
+	inline Float4 Float4::Load(const float* values)
+	{
+		return Float4(_mm_loadu_ps(values));
+	}
+
+	inline void Float4::Store(float* values) const
+	{
+		_mm_storeu_ps(values, mValue);
+	}
+#pragma endregion Special Members
+
+#pragma region Arithmetic Operators
+	inline Float4 Float4::operator+(const Float4& rhs) const
+	{
+		return Float4(_mm_add_ps(mValue, rhs.mValue));
+	}
+
+	inline Float4 Float4::operator-(const Float4& rhs) const
+	{
+		return Float4(_mm_sub_ps(mValue, rhs.mValue));
+	}
+
+	inline Float4 Float4::operator*(const Float4& rhs) const
+	{
+		return Float4(_mm_mul_ps(mValue, rhs.mValue));
+	}
+
+	inline Float4 Float4::operator/(const Float4& rhs) const
+	{
+		return Float4(_mm_div_ps(mValue, rhs.mValue));
+	}
+
+	inline Float4 Float4::operator-() const
+	{
+		return Float4(_mm_xor_ps(mValue, _mm_set1_ps(-0.0f)));
+	}
+#pragma endregion Arithmetic Operators
+
+#pragma region Comparison Operators
+	inline Float4 Float4::operator<(const Float4& rhs) const
+	{
+		return Float4(_mm_cmplt_ps(mValue, rhs.mValue));
+	}
+
+	inline Float4 Float4::operator>(const Float4& rhs) const
+	{
+		return Float4(_mm_cmpgt_ps(mValue, rhs.mValue));
+	}
+#pragma endregion Comparison Operators
+
+#pragma region Lane Functions
+	inline Float4 Float4::Select(const Float4& mask, const Float4& whenTrue, const Float4& whenFalse)
+	{
+		return Float4(_mm_or_ps(_mm_and_ps(mask.mValue, whenTrue.mValue), _mm_andnot_ps(mask.mValue, whenFalse.mValue)));
+	}
+
+	inline Float4 Float4::Min(const Float4& lhs, const Float4& rhs)
+	{
+		return Float4(_mm_min_ps(lhs.mValue, rhs.mValue));
+	}
+
+	inline Float4 Float4::Max(const Float4& lhs, const Float4& rhs)
+	{
+		return Float4(_mm_max_ps(lhs.mValue, rhs.mValue));
+	}
+#pragma endregion Lane Functions
+#else
+#pragma region Special Members
+	inline Float4::Float4(const float value) :
+		mValues{ value, value, value, value }
+	{
+	}
+
+	inline Float4 Float4::Load(const float* values)
+	{
+		Float4 result;
+		std::memcpy(result.mValues, values, sizeof(result.mValues));
+		return result;
+	}
+
+	inline void Float4::Store(float* values) const
+	{
+		std::memcpy(values, mValues, sizeof(mValues));
+	}
+#pragma endregion Special Members
+
+#pragma region Arithmetic Operators
+	inline Float4 Float4::operator+(const Float4& rhs) const
+	{
+		Float4 result;
+		for (int i = 0; i < 4; ++i) result.mValues[i] = mValues[i] + rhs.mValues[i];
+		return result;
+	}
+
+	inline Float4 Float4::operator-(const Float4& rhs) const
+	{
+		Float4 result;
+		for (int i = 0; i < 4; ++i) result.mValues[i] = mValues[i] - rhs.mValues[i];
+		return result;
+	}
+
+	inline Float4 Float4::operator*(const Float4& rhs) const
+	{
+		Float4 result;
+		for (int i = 0; i < 4; ++i) result.mValues[i] = mValues[i] * rhs.mValues[i];
+		return result;
+	}
+
+	inline Float4 Float4::operator/(const Float4& rhs) const
+	{
+		Float4 result;
+		for (int i = 0; i < 4; ++i) result.mValues[i] = mValues[i] / rhs.mValues[i];
+		return result;
+	}
+
+	inline Float4 Float4::operator-() const
+	{
+		Float4 result;
+		for (int i = 0; i < 4; ++i) result.mValues[i] = -mValues[i];
+		return result;
+	}
+#pragma endregion Arithmetic Operators
+
+#pragma region Comparison Operators
+	// Masks are all bits set or clear, matching SSE, so Select behaves identically.
+	inline Float4 Float4::operator<(const Float4& rhs) const
+	{
+		Float4 result;
+		for (int i = 0; i < 4; ++i)
+		{
+			const std::uint32_t mask = mValues[i] < rhs.mValues[i] ? 0xFFFFFFFF : 0;
+			std::memcpy(&result.mValues[i], &mask, sizeof(mask));
+		}
+		return result;
+	}
+
+	inline Float4 Float4::operator>(const Float4& rhs) const
+	{
+		return rhs < *this;
+	}
+#pragma endregion Comparison Operators
+
+#pragma region Lane Functions
+	inline Float4 Float4::Select(const Float4& mask, const Float4& whenTrue, const Float4& whenFalse)
+	{
+		Float4 result;
+		for (int i = 0; i < 4; ++i)
+		{
+			std::uint32_t laneMask, trueBits, falseBits;
+			std::memcpy(&laneMask, &mask.mValues[i], sizeof(laneMask));
+			std::memcpy(&trueBits, &whenTrue.mValues[i], sizeof(trueBits));
+			std::memcpy(&falseBits, &whenFalse.mValues[i], sizeof(falseBits));
+
+			const std::uint32_t bits = (laneMask & trueBits) | (~laneMask & falseBits);
+			std::memcpy(&result.mValues[i], &bits, sizeof(bits));
+		}
+		return result;
+	}
+
+	inline Float4 Float4::Min(const Float4& lhs, const Float4& rhs)
+	{
+		Float4 result;
+		for (int i = 0; i < 4; ++i) result.mValues[i] = lhs.mValues[i] < rhs.mValues[i] ? lhs.mValues[i] : rhs.mValues[i];
+		return result;
+	}
+
+	inline Float4 Float4::Max(const Float4& lhs, const Float4& rhs)
+	{
+		Float4 result;
+		for (int i = 0; i < 4; ++i) result.mValues[i] = lhs.mValues[i] > rhs.mValues[i] ? lhs.mValues[i] : rhs.mValues[i];
+		return result;
+	}
+#pragma endregion Lane Functions
+#endif
+
+#pragma region Lane Functions
+	inline Float4 Float4::Lerp(const Float4& lhs, const Float4& rhs, const Float4& t)
+	{
+		return lhs + (rhs - lhs) * t;
+	}
+#pragma endregion Lane Functions
+}
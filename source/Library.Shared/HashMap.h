@@ -425,6 +425,7 @@ namespace Library
 
 		/// <summary>
 		/// Resizes the HashMap to a given bucket count, re-indexing the elements.
+		/// Elements are relinked into their new buckets rather than copied, so references to them remain valid.
 		/// </summary>
 		/// <param name="bucketCount">New bucket count for the HashMap.</param>
 		void Rehash(const std::size_t bucketCount);
@@ -580,14 +581,14 @@ namespace Library
 		std::pair<Iterator, bool> Insert(Pair&& entry);
 
 		/// <summary>
-		/// Removes a single Pair value from the HashMap given the corresponding TKey value.
+		/// Removes a single Pair value from the HashMap given the corresponding TKey value. Other Pair values remain in place.
 		/// </summary>
 		/// <param name="key">TKey value to be searched for in the HashMap to be removed.</param>
 		/// <returns>True on successful remove, false otherwise.</returns>
 		bool Remove(const TKey& key);
 
 		/// <summary>
-		/// Removes a single Pair value from the HashMap given the corresponding TKey value.
+		/// Removes a single Pair value from the HashMap given the corresponding Iterator. Other Pair values remain in place.
 		/// </summary>
 		/// <param name="it">Iterator pointing to the Pair value to be removed.</param>
 		/// <returns>True on successful remove, false otherwise.</returns>
@@ -259,14 +259,20 @@ namespace Library
 	{
 		if (bucketCount == mBuckets.Size()) return;
 
-		HashMap newHash = HashMap(bucketCount, *mKeyEqualityFunctor, *mHashFunctor);
+		assert(bucketCount > 0);
+
+		Bucket buckets(0, Bucket::EqualityFunctor());
+		buckets.Resize(bucketCount, Chain(Chain::EqualityFunctor()));
 
-		for (auto it = begin(); it != end(); ++it)
+		for (Chain& chain : mBuckets)
 		{
-			newHash.Insert(*it);
+			while (!chain.IsEmpty())
+			{
+				buckets[mHashFunctor->operator()(chain.Front().first) % buckets.Capacity()].SpliceFront(chain);
+			}
 		}
 
-		*this = std::move(newHash);
+		mBuckets = std::move(buckets);
 	}
 #pragma endregion Size and Capacity
 
@@ -480,8 +486,7 @@ namespace Library
 	inline bool HashMap<TKey, TData>::Remove(const TKey& key)
 	{
 		std::size_t index;
-		auto it = Find(key, index);
-		return it.mBucketIterator->Remove(it.mChainIterator);
+		return Remove(Find(key, index));
 	}
 
 	template<typename TKey, typename TData>
@@ -489,7 +494,27 @@ namespace Library
 	{
 		if (it.mOwner != this || it == end()) return false;
 
-		return it.mBucketIterator->Remove(it.mChainIterator);
+		Chain& chain = *it.mBucketIterator;
+
+		if (chain.begin() == it.mChainIterator)
+		{
+			chain.PopFront();
+		}
+		else
+		{
+			ChainIterator previous = chain.begin();
+
+			for (ChainIterator current = previous; ++current != it.mChainIterator;)
+			{
+				previous = current;
+			}
+
+			chain.RemoveAfter(previous);
+		}
+
+		--mSize;
+
+		return true;
 	}
 
 	template<typename TKey, typename TData>
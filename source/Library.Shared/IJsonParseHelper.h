@@ -1,14 +1,21 @@
 #pragma once
 
 #pragma region Includes
+// Standard
+#include <cstdint>
+#include <string_view>
+
 // Third Party
 #pragma warning(disable : 26812)
 #include <json/json.h>
 #pragma warning(default : 26812)
 
+#include <gsl/gsl>
+
 // First Party
 #include "RTTI.h"
 #include "JsonParseMaster.h"
+#include "JsonStreamReader.h"
 #pragma endregion Includes
 
 namespace Library
@@ -20,6 +27,30 @@ namespace Library
 	{
 		RTTI_DECLARATIONS_ABSTRACT(IJsonParseHelper, RTTI)
 
+#pragma region Type Definitions
+	public:
+		/// <summary>
+		/// Shapes of JSON value a helper may handle, combined as flags.
+		/// </summary>
+		enum Shapes : std::uint8_t
+		{
+			None = 0,
+			Object = 1 << 0,
+			Array = 1 << 1,
+			Scalar = 1 << 2,
+			All = Object | Array | Scalar
+		};
+
+		/// <summary>
+		/// Declares the shapes of value a helper may handle under a specific key.
+		/// </summary>
+		struct Route final
+		{
+			std::string_view Key;
+			std::uint8_t Shapes;
+		};
+#pragma endregion Type Definitions
+
 #pragma region Special Member Functions
 	protected:
 		/// <summary>
@@ -78,6 +109,46 @@ namespace Library
 		/// </summary>
 		virtual void Initialize() {};
 #pragma endregion Virtual Methods
+
+#pragma region Routes
+	public:
+		/// <summary>
+		/// Gets the shapes of value the helper may handle under any key.
+		/// JsonParseMaster only offers a value to helpers whose routes match its key and shape.
+		/// The default implementation routes every value to the helper.
+		/// </summary>
+		/// <returns>Shapes flags.</returns>
+		virtual std::uint8_t AnyKeyShapes() const { return Shapes::All; };
+
+		/// <summary>
+		/// Gets the routes for specific keys, handled in addition to AnyKeyShapes. Keys are matched without regard to case.
+		/// Routes are read when a parse begins, so the returned storage must outlive the helper's registration.
+		/// </summary>
+		/// <returns>Span of routes, empty by default.</returns>
+		virtual gsl::span<const Route> KeyRoutes() const { return {}; };
+#pragma endregion Routes
+
+#pragma region Stream Handlers
+	public:
+		/// <summary>
+		/// Virtual handler method for determining how the helper will respond to a value read by JsonParseMaster::ParseStream.
+		/// Scalar values are complete, while objects and arrays are at their start token and their content follows.
+		/// The default implementation handles nothing, so helpers that only support a Json::Value are skipped when streaming.
+		/// </summary>
+		/// <param name="data">Reference to the SharedData instance to be filled with parsed data.</param>
+		/// <param name="key">A const reference to the key string associated with the value.</param>
+		/// <param name="reader">JsonStreamReader positioned at the first token of the value.</param>
+		/// <returns>True if the value is handled by the helper. Otherwise, false.</returns>
+		virtual bool StreamStartHandler(JsonParseMaster::SharedData&, const std::string&, const JsonStreamReader&) { return false; };
+
+		/// <summary>
+		/// Virtual handler method for a scalar element of an array whose start was handled by the helper.
+		/// </summary>
+		/// <param name="data">Reference to the SharedData instance to be filled with parsed data.</param>
+		/// <param name="key">A const reference to the key string associated with the array.</param>
+		/// <param name="reader">JsonStreamReader positioned at the element.</param>
+		virtual void StreamElementHandler(JsonParseMaster::SharedData&, const std::string&, const JsonStreamReader&) {};
+#pragma endregion Stream Handlers
 	};
 }
 
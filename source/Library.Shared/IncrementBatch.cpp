@@ -0,0 +1,116 @@
+#pragma region Includes
+// Pre-compiled Header
+#include "pch.h"
+
+// Header
+#include "IncrementBatch.h"
+
+// First Party
+#include "ActionIncrement.h"
+#include "Profiler.h"
+#pragma endregion Includes
+
+namespace Library
+{
+#pragma region Modifiers
+	void IncrementBatch::Add(ActionIncrement& increment)
+	{
+		if (!increment.IsBound()) increment.Bind();
+
+		increment.mBatched = 1;
+
+		if (increment.mTarget == nullptr) return;
+
+		Target& target = mTargets[increment.mTarget];
+
+		// Queued by this batch for the current binding, as opposed to by another batch before a move between Worlds.
+		const std::size_t index = increment.mBatchIndex;
+
+		if (increment.mIsBatchQueued && index < target.Handles.Size() && target.Handles[index] == increment.Handle() && target.Versions[index] == increment.mBindingVersion)
+		{
+			++target.Counts[index];
+			return;
+		}
+
+		increment.mIsBatchQueued = true;
+		increment.mBatchIndex = target.Handles.Size();
+
+		target.Handles.PushBack(increment.Handle());
+		target.Versions.PushBack(increment.mBindingVersion);
+		target.Counts.PushBack(1);
+
+		++mSize;
+	}
+
+	void IncrementBatch::Clear()
+	{
+		for (auto& pair : mTargets)
+		{
+			for (const auto& handle : pair.second.Handles)
+			{
+				Entity* entity = handle.Resolve();
+				ActionIncrement* increment = entity ? entity->As<ActionIncrement>() : nullptr;
+
+				if (increment) increment->mIsBatchQueued = false;
+			}
+		}
+
+		mTargets.Clear();
+		mSize = 0;
+	}
+
+	void IncrementBatch::Apply()
+	{
+		PROFILE_SCOPE("IncrementBatch::Apply");
+
+		for (auto& pair : mTargets)
+		{
+			Target& target = pair.second;
+
+			// The Datum of an idle target may since have been destroyed, and its address reused by another Datum.
+			if (target.Handles.IsEmpty())
+			{
+				mIdleTargets.PushBack(pair.first);
+				continue;
+			}
+
+			int sum = 0;
+			bool isApplied = false;
+
+			for (std::size_t i = 0; i < target.Handles.Size(); ++i)
+			{
+				Entity* entity = target.Handles[i].Resolve();
+				ActionIncrement* increment = entity ? entity->As<ActionIncrement>() : nullptr;
+
+				if (increment == nullptr || increment->mBindingVersion != target.Versions[i]) continue;
+
+				increment->mIsBatchQueued = false;
+
+				if (increment->GetParent() != nullptr && increment->IsBound() && increment->mBatched)
+				{
+					sum += increment->mIncrementStep * static_cast<int>(target.Counts[i]);
+					isApplied = true;
+				}
+			}
+
+			// Only written while bound instances remain, as those keep the hierarchy holding the Datum alive.
+			if (isApplied)
+			{
+				pair.first->Get<int>() += sum;
+			}
+
+			target.Handles.Clear();
+			target.Versions.Clear();
+			target.Counts.Clear();
+		}
+
+		for (auto* datum : mIdleTargets)
+		{
+			mTargets.Remove(datum);
+		}
+
+		mIdleTargets.Clear();
+		mSize = 0;
+	}
+#pragma endregion Modifiers
+}
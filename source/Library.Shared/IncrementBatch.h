@@ -0,0 +1,154 @@
+#pragma once
+
+#pragma region Includes
+// Standard
+#include <cstdint>
+
+// First Party
+#include "Datum.h"
+#include "EntityHandle.h"
+#include "HashMap.h"
+#include "Vector.h"
+#pragma endregion Includes
+
+namespace Library
+{
+	// Forward Declarations
+	class ActionIncrement;
+
+	/// <summary>
+	/// Applies many ActionIncrement instances together, grouped by the integer Datum they are bound to.
+	/// </summary>
+	/// <remarks>
+	/// Batched instances queue themselves during Update, and are applied once the Entity traversal is complete.
+	/// The steps of every instance bound to a Datum are summed, and the Datum is written once.
+	/// Instances queued more than once before an application are counted, and their step applied once per time queued.
+	/// Queued instances are skipped if destroyed, orphaned, rebound, or no longer batched since.
+	/// Targets are kept while instances keep queuing for them, so their storage is reused, and erased after a frame without any.
+	/// </remarks>
+	class IncrementBatch final
+	{
+#pragma region Special Members
+	public:
+		/// <summary>
+		/// Default constructor.
+		/// </summary>
+		IncrementBatch() = default;
+
+		/// <summary>
+		/// Default destructor.
+		/// </summary>
+		~IncrementBatch() = default;
+
+		/// <summary>
+		/// Deleted copy constructor. Instances must not be applied by more than one batch.
+		/// </summary>
+		IncrementBatch(const IncrementBatch&) = delete;
+
+		/// <summary>
+		/// Deleted copy assignment operator. Instances must not be applied by more than one batch.
+		/// </summary>
+		IncrementBatch& operator=(const IncrementBatch&) = delete;
+
+		/// <summary>
+		/// Move constructor.
+		/// </summary>
+		/// <param name="rhs">IncrementBatch to be moved.</param>
+		IncrementBatch(IncrementBatch&& rhs) noexcept = default;
+
+		/// <summary>
+		/// Move assignment operator.
+		/// </summary>
+		/// <param name="rhs">IncrementBatch to be moved.</param>
+		/// <returns>Newly moved into left hand side IncrementBatch.</returns>
+		IncrementBatch& operator=(IncrementBatch&& rhs) noexcept = default;
+#pragma endregion Special Members
+
+#pragma region Accessors
+	public:
+		/// <summary>
+		/// Gets the number of distinct Datum targeted by the batch, this frame or the last.
+		/// </summary>
+		/// <returns>Number of targets.</returns>
+		std::size_t TargetCount() const;
+
+		/// <summary>
+		/// Gets the number of instances awaiting application, including any not yet found to be stale.
+		/// </summary>
+		/// <returns>Number of instances.</returns>
+		std::size_t Size() const;
+
+		/// <summary>
+		/// Gets whether no instances await application.
+		/// </summary>
+		/// <returns>True when empty. Otherwise, false.</returns>
+		bool IsEmpty() const;
+#pragma endregion Accessors
+
+#pragma region Modifiers
+	public:
+		/// <summary>
+		/// Queues an ActionIncrement for the next application, marking it as batched and binding it first if needed.
+		/// Queuing it again before then counts its step once more, unless it was rebound in between, in which case only the new binding is applied.
+		/// An ActionIncrement whose operand does not resolve is marked as batched, but neither queued nor tracked.
+		/// </summary>
+		/// <param name="increment">ActionIncrement to be applied.</param>
+		void Add(ActionIncrement& increment);
+
+		/// <summary>
+		/// Removes every queued instance and target, without applying them.
+		/// </summary>
+		void Clear();
+
+		/// <summary>
+		/// Applies every queued instance, skipping any that are stale, clears the queued instances and erases the targets without any.
+		/// </summary>
+		void Apply();
+#pragma endregion Modifiers
+
+#pragma region Helper Types
+	private:
+		/// <summary>
+		/// Instances bound to the same Datum, stored as parallel arrays.
+		/// </summary>
+		struct Target final
+		{
+			/// <summary>
+			/// Handle of each instance.
+			/// </summary>
+			Vector<EntityHandle> Handles{ Vector<EntityHandle>::EqualityFunctor() };
+
+			/// <summary>
+			/// Binding version of each instance when queued.
+			/// </summary>
+			Vector<std::uint32_t> Versions;
+
+			/// <summary>
+			/// Number of times each instance was queued.
+			/// </summary>
+			Vector<std::uint32_t> Counts;
+		};
+#pragma endregion Helper Types
+
+#pragma region Data Members
+	private:
+		/// <summary>
+		/// Targets, keyed by the Datum their instances are bound to.
+		/// </summary>
+		HashMap<Datum*, Target> mTargets;
+
+		/// <summary>
+		/// Targets found without instances during an application, reused across applications.
+		/// </summary>
+		Vector<Datum*> mIdleTargets;
+
+		/// <summary>
+		/// Number of queued instances.
+		/// </summary>
+		std::size_t mSize{ 0 };
+#pragma endregion Data Members
+	};
+}
+
+// Inline File
+#include "IncrementBatch.inl"
@@ -0,0 +1,24 @@
+#pragma once
+
+// Header
+#include "IncrementBatch.h"
+
+namespace Library
+{
+#pragma region Accessors
+	inline std::size_t IncrementBatch::TargetCount() const
+	{
+		return mTargets.Size();
+	}
+
+	inline std::size_t IncrementBatch::Size() const
+	{
+		return mSize;
+	}
+
+	inline bool IncrementBatch::IsEmpty() const
+	{
+		return mSize == 0;
+	}
+#pragma endregion Accessors
+}
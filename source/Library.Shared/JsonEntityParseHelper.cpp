@@ -132,9 +132,8 @@ namespace Library
 		
 		bool handled = false;
 		StackFrame& stackFrame = helperData->mStack.Top();
-		const std::string formattedKey = String::ToLower(key);
 		
-		if (formattedKey == "type"s && value.isString())
+		if (String::EqualsIgnoreCase(key, "type") && value.isString())
 		{
 			const std::string& valueStr = value.asString();
 			const auto it = TypeStringMap.Find(valueStr);
@@ -155,7 +154,7 @@ namespace Library
 				throw std::runtime_error("\""s + valueStr + "\" is not a valid type."s);
 			}
 		}
-		else if (formattedKey == "value"s)
+		else if (String::EqualsIgnoreCase(key, "value"))
 		{
 			if (value.isString() || value.isObject() || value.isInt() || value.isDouble())
 			{
@@ -173,7 +172,7 @@ namespace Library
 
 				handled = true;
 			}
-			else if (value.isArray() && !value.empty())
+			else if (value.isArray())
 			{
 				for (const auto& v1 : value)
 				{
@@ -222,16 +221,18 @@ namespace Library
 		SharedData* testHelperData = data.As<SharedData>();
 		assert(!testHelperData->mStack.IsEmpty());
 
-		const std::string formattedKey = String::ToLower(key);
-		if (formattedKey == "type"s || formattedKey == "value"s) return true;
+		if (String::EqualsIgnoreCase(key, "type") || String::EqualsIgnoreCase(key, "value")) return true;
 
 		const StackFrame& stackFrame = testHelperData->mStack.Top();
+
+		// A streamed value that preceded its type is applied here, the same way as a parsed one.
+		const Json::Value* value = stackFrame.PendingValue.isNull() ? stackFrame.Value : &stackFrame.PendingValue;
 		
 		bool handled = false;
 
 		if (stackFrame.Type != Entity::Types::Unknown)
 		{
-			if (stackFrame.Value == nullptr)
+			if (value == nullptr)
 			{
 				auto& scopeData = stackFrame.Context[stackFrame.Key];
 
@@ -242,11 +243,11 @@ namespace Library
 
 				handled = true;
 			}
-			else if (stackFrame.Value->isObject())
+			else if (value->isObject())
 			{
 				handled = true;
 			}
-			else if (stackFrame.Value->isArray())
+			else if (value->isArray())
 			{
 				auto& scopeData = stackFrame.Context[stackFrame.Key];
 
@@ -257,16 +258,16 @@ namespace Library
 
 				if (scopeData.HasInternalStorage())
 				{
-					scopeData.Resize(stackFrame.Value->size());
+					scopeData.Resize(value->size());
 				}
-				else if (scopeData.Size() < stackFrame.Value->size())
+				else if (scopeData.Size() < value->size())
 				{
 					throw std::runtime_error("\""s + stackFrame.Key + "\" array has too many elements."s);
 				}
 				
-				for (Json::Value::ArrayIndex i = 0; i < stackFrame.Value->size(); ++i)
+				for (Json::Value::ArrayIndex i = 0; i < value->size(); ++i)
 				{
-					const auto& v = stackFrame.Value->get(i, 0);
+					const auto& v = value->get(i, 0);
 
 					if (stackFrame.Type == Entity::Types::Integer)
 					{
@@ -301,16 +302,16 @@ namespace Library
 
 				if (stackFrame.Type == Entity::Types::Integer)
 				{
-					scopeData.Set(stackFrame.Value->asInt(), scopeData.Size() - 1);
+					scopeData.Set(value->asInt(), scopeData.Size() - 1);
 				}
 				else if (stackFrame.Type == Entity::Types::Float)
 				{
-					scopeData.Set(static_cast<float>(stackFrame.Value->asDouble()), scopeData.Size() - 1);
+					scopeData.Set(static_cast<float>(value->asDouble()), scopeData.Size() - 1);
 				}
 				else
 				{
-					assert(stackFrame.Value->isString());
-					scopeData.SetFromString(stackFrame.Value->asString(), scopeData.Size() - 1);
+					assert(value->isString());
+					scopeData.SetFromString(value->asString(), scopeData.Size() - 1);
 				}
 
 				handled = true;
@@ -320,5 +321,223 @@ namespace Library
  		testHelperData->mStack.Pop();
 		return handled;
 	}
+
+	bool JsonEntityParseHelper::StreamStartHandler(JsonParseMaster::SharedData& data, const std::string& key, const JsonStreamReader& reader)
+	{
+		using Token = JsonStreamReader::Token;
+
+		SharedData* helperData = data.As<SharedData>();
+		if (helperData == nullptr) return false;
+
+		const Token token = reader.Current();
+
+		if (helperData->mStack.IsEmpty())
+		{
+			if (token != Token::ObjectStart) return false;
+
+			helperData->mStack.Push({ key, Entity::Types::Unknown, "Entity"s, nullptr, *helperData->mRootEntity });
+			return true;
+		}
+
+		bool handled = false;
+		StackFrame& stackFrame = helperData->mStack.Top();
+
+		if (String::EqualsIgnoreCase(key, "type") && token == Token::String)
+		{
+			const std::string& valueStr = reader.Text();
+			const auto it = TypeStringMap.Find(valueStr);
+
+			if (it != TypeStringMap.end())
+			{
+				stackFrame.Type = it->second;
+				handled = true;
+			}
+			else if (Factory<Entity>::IsRegistered(valueStr))
+			{
+				// An object value streamed before its type was already created with the default class.
+				if (stackFrame.HasChildValue && valueStr != stackFrame.ClassName)
+				{
+					throw std::runtime_error("\""s + stackFrame.Key + "\" value precedes its class."s);
+				}
+
+				stackFrame.ClassName = valueStr;
+				stackFrame.Type = Entity::Types::Scope;
+				handled = true;
+			}
+			else
+			{
+				throw std::runtime_error("\""s + valueStr + "\" is not a valid type."s);
+			}
+		}
+		else if (String::EqualsIgnoreCase(key, "value"))
+		{
+			if (token == Token::ObjectStart)
+			{
+				Entity* newEntity = Factory<Entity>::Create(stackFrame.ClassName);
+				assert(newEntity != nullptr);
+				if (newEntity == nullptr) throw std::bad_alloc();
+
+				newEntity->SetName(stackFrame.Key);
+				stackFrame.Context.AddChild(*newEntity);
+				stackFrame.HasChildValue = true;
+			}
+			else if (stackFrame.Type == Entity::Types::Unknown)
+			{
+				// Buffered until the end of the attribute, as elements cannot be converted before the type is known.
+				stackFrame.PendingValue = token == Token::ArrayStart ? Json::Value(Json::arrayValue) : PendingFromStream(reader);
+				stackFrame.ElementCount = 0;
+			}
+			else if (token == Token::ArrayStart)
+			{
+				// Replaces any previous contents, as the DOM path does, including with an empty array.
+				auto& scopeData = GetAttribute(stackFrame);
+				if (scopeData.HasInternalStorage()) scopeData.Resize(0);
+
+				stackFrame.ElementCount = 0;
+			}
+			else
+			{
+				auto& scopeData = GetAttribute(stackFrame);
+
+				if (scopeData.HasInternalStorage())
+				{
+					scopeData.Resize(1);
+				}
+
+				if (!SetFromStream(scopeData, stackFrame.Type, reader, scopeData.Size() - 1))
+				{
+					throw std::runtime_error("Invalid value type."s);
+				}
+			}
+
+			handled = true;
+		}
+		else if (token == Token::ObjectStart)
+		{
+			Entity::Data& entityData = *stackFrame.Context.Find(stackFrame.Key);
+
+			assert(entityData.Type() == Entity::Types::Scope);
+			assert(entityData[entityData.Size() - 1].Is(Entity::TypeIdClass()));
+
+			Entity* entity = static_cast<Entity*>(entityData.Get<Scope*>(entityData.Size() - 1));
+
+			helperData->mStack.Push({ key, Entity::Types::Unknown, "Entity"s, nullptr, *entity });
+			handled = true;
+		}
+
+		return handled;
+	}
+
+	void JsonEntityParseHelper::StreamElementHandler(JsonParseMaster::SharedData& data, const std::string&, const JsonStreamReader& reader)
+	{
+		assert(data.Is(SharedData::TypeIdClass()));
+
+		SharedData* helperData = data.As<SharedData>();
+		assert(!helperData->mStack.IsEmpty());
+
+		StackFrame& stackFrame = helperData->mStack.Top();
+		const std::size_t index = stackFrame.ElementCount++;
+
+		if (stackFrame.Type == Entity::Types::Unknown)
+		{
+			using Token = JsonStreamReader::Token;
+
+			const Token token = reader.Current();
+			if (token != Token::Integer && token != Token::Float && token != Token::String) throw std::runtime_error("Invalid array value type."s);
+
+			Json::Value element = PendingFromStream(reader);
+
+			if (index > 0 && element.type() != stackFrame.PendingValue[0].type())
+			{
+				throw std::runtime_error("Mismatched array value types."s);
+			}
+
+			stackFrame.PendingValue.append(std::move(element));
+			return;
+		}
+
+		auto& scopeData = GetAttribute(stackFrame);
+
+		if (scopeData.HasInternalStorage())
+		{
+			// Array length is unknown until its end, so capacity is grown geometrically.
+			if (index == scopeData.Capacity()) scopeData.Reserve(std::max(index * 2, std::size_t(4)));
+			scopeData.Resize(index + 1);
+		}
+		else if (index >= scopeData.Size())
+		{
+			throw std::runtime_error("\""s + stackFrame.Key + "\" array has too many elements."s);
+		}
+
+		if (!SetFromStream(scopeData, stackFrame.Type, reader, index))
+		{
+			throw std::runtime_error("Invalid array value type."s);
+		}
+	}
 #pragma endregion Handlers
+
+#pragma region Routes
+	std::uint8_t JsonEntityParseHelper::AnyKeyShapes() const
+	{
+		return Shapes::Object;
+	}
+
+	gsl::span<const IJsonParseHelper::Route> JsonEntityParseHelper::KeyRoutes() const
+	{
+		return AttributeRoutes;
+	}
+#pragma endregion Routes
+
+#pragma region Helper Methods
+	Entity::Data& JsonEntityParseHelper::GetAttribute(const StackFrame& stackFrame)
+	{
+		auto& scopeData = stackFrame.Context[stackFrame.Key];
+
+		if (scopeData.Type() == Entity::Types::Unknown)
+		{
+			scopeData.SetType(stackFrame.Type);
+		}
+
+		return scopeData;
+	}
+
+	bool JsonEntityParseHelper::SetFromStream(Entity::Data& scopeData, const Entity::Types type, const JsonStreamReader& reader, const std::size_t index)
+	{
+		using Token = JsonStreamReader::Token;
+
+		const Token token = reader.Current();
+
+		if (type == Entity::Types::Integer)
+		{
+			if (token == Token::Integer)		scopeData.Set(reader.Integer(), index);
+			else if (token == Token::Float)		scopeData.Set(static_cast<int>(reader.Float()), index);
+			else								return false;
+		}
+		else if (type == Entity::Types::Float)
+		{
+			if (token != Token::Integer && token != Token::Float) return false;
+			scopeData.Set(static_cast<float>(reader.Float()), index);
+		}
+		else
+		{
+			if (token != Token::String) return false;
+			scopeData.SetFromString(reader.Text(), index);
+		}
+
+		return true;
+	}
+
+	Json::Value JsonEntityParseHelper::PendingFromStream(const JsonStreamReader& reader)
+	{
+		using Token = JsonStreamReader::Token;
+
+		switch (reader.Current())
+		{
+		case Token::Integer:	return Json::Value(reader.Integer());
+		case Token::Float:		return Json::Value(reader.Float());
+		case Token::String:		return Json::Value(reader.Text());
+		default:				throw std::runtime_error("Invalid value type."s);
+		}
+	}
+#pragma endregion Helper Methods
 }
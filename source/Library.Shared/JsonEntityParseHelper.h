@@ -38,6 +38,18 @@ namespace Library
 			std::string ClassName;
 			const Json::Value* Value;
 			Entity& Context;
+			std::size_t ElementCount{ 0 };
+			Json::Value PendingValue;		// Streamed scalar or array value that preceded its type, applied by EndHandler.
+			bool HasChildValue{ false };	// Whether an Entity was created for a streamed object value.
+		};
+
+		/// <summary>
+		/// Keys of attribute members, routed in addition to objects under any key.
+		/// </summary>
+		inline static constexpr Route AttributeRoutes[] =
+		{
+			{ "type", Shapes::Scalar },
+			{ "value", Shapes::All }
 		};
 #pragma endregion Type Definitions and Constants
 
@@ -167,7 +179,69 @@ namespace Library
 		/// </summary>
 		/// <exception cref="std::runtime_error">"" array has too many elements.</exception>
 		virtual bool EndHandler(JsonParseMaster::SharedData& data, const std::string& key) override;
+
+		/// <summary>
+		/// Called by the associated JsonParseMaster when streaming a value.
+		/// Values are assigned as they are read once the "type" of their attribute is known, and buffered until the end of the attribute otherwise.
+		/// An object value read before its type is created with the default Entity class, so its type may then only name that class.
+		/// </summary>
+		/// <returns>True if handled. Otherwise, false.</returns>
+		/// <exception cref="std::runtime_error"><string> is not a valid type.</exception>
+		/// <exception cref="std::runtime_error">"" value precedes its class.</exception>
+		/// <exception cref="std::runtime_error">Invalid value type.</exception>
+		virtual bool StreamStartHandler(JsonParseMaster::SharedData& data, const std::string& key, const JsonStreamReader& reader) override;
+
+		/// <summary>
+		/// Called by the associated JsonParseMaster for each scalar element of a streamed array value.
+		/// </summary>
+		/// <exception cref="std::runtime_error">Invalid array value type.</exception>
+		/// <exception cref="std::runtime_error">Mismatched array value types.</exception>
+		/// <exception cref="std::runtime_error">"" array has too many elements.</exception>
+		virtual void StreamElementHandler(JsonParseMaster::SharedData& data, const std::string& key, const JsonStreamReader& reader) override;
 #pragma endregion Parse Handlers
+
+#pragma region Routes
+	public:
+		/// <summary>
+		/// Entities and nested attributes are objects, which may appear under any key.
+		/// </summary>
+		/// <returns>Object shape flag.</returns>
+		virtual std::uint8_t AnyKeyShapes() const override;
+
+		/// <summary>
+		/// Attribute "type" and "value" members, matched without regard to case.
+		/// </summary>
+		/// <returns>Span of AttributeRoutes.</returns>
+		virtual gsl::span<const Route> KeyRoutes() const override;
+#pragma endregion Routes
+
+#pragma region Helper Methods
+	private:
+		/// <summary>
+		/// Sets the type of the attribute of a stack frame, if it is not yet known.
+		/// </summary>
+		/// <param name="stackFrame">StackFrame of the attribute.</param>
+		/// <returns>Reference to the attribute.</returns>
+		static Entity::Data& GetAttribute(const StackFrame& stackFrame);
+
+		/// <summary>
+		/// Sets an element of an attribute from the current scalar token of a JsonStreamReader.
+		/// </summary>
+		/// <param name="scopeData">Attribute to be set.</param>
+		/// <param name="type">Type of the attribute.</param>
+		/// <param name="reader">JsonStreamReader positioned at a scalar value.</param>
+		/// <param name="index">Index of the element to be set.</param>
+		/// <returns>True if the token matches the attribute type. Otherwise, false.</returns>
+		static bool SetFromStream(Entity::Data& scopeData, const Entity::Types type, const JsonStreamReader& reader, const std::size_t index);
+
+		/// <summary>
+		/// Converts the current scalar token of a JsonStreamReader into a value to be buffered until its type is known.
+		/// </summary>
+		/// <param name="reader">JsonStreamReader positioned at a scalar value.</param>
+		/// <returns>Integer, float or string value.</returns>
+		/// <exception cref="std::runtime_error">Invalid value type.</exception>
+		static Json::Value PendingFromStream(const JsonStreamReader& reader);
+#pragma endregion Helper Methods
 	};
 }
 
@@ -11,6 +11,8 @@
 
 // First Party
 #include "IJsonParseHelper.h"
+#include "JsonStreamReader.h"
+#include "Profiler.h"
 #pragma endregion Includes
 
 namespace Library
@@ -68,6 +70,7 @@ namespace Library
 		rhs.mSharedData = nullptr;
 		rhs.mFilename.clear();
 		rhs.mOwnsSharedData = false;
+		rhs.mRoutesDirty = true;
 	}
 
 	JsonParseMaster& JsonParseMaster::operator=(JsonParseMaster&& rhs) noexcept
@@ -77,12 +80,14 @@ namespace Library
 		mFilename = rhs.mFilename;
 		mOwnsSharedData = rhs.mOwnsSharedData;
 		mOwnedHelperIndices = std::move(rhs.mOwnedHelperIndices);
+		mRoutesDirty = true;
 	
 		mSharedData->SetJsonParseMaster(this);
 
 		rhs.mSharedData = nullptr;
 		rhs.mFilename.clear();
 		rhs.mOwnsSharedData = false;
+		rhs.mRoutesDirty = true;
 
 		return *this;
 	}
@@ -125,17 +130,72 @@ namespace Library
 		}
 
 		mHelpers.EmplaceBack(&helper);
+		mRoutesDirty = true;
 	}
 
 	bool JsonParseMaster::RemoveHelper(IJsonParseHelper& helper)
 	{
-		return mHelpers.Remove(&helper);
+		const bool removed = mHelpers.Remove(&helper);
+		if (removed) mRoutesDirty = true;
+
+		return removed;
+	}
+
+	void JsonParseMaster::BuildRoutes()
+	{
+		if (!mRoutesDirty) return;
+
+		mKeyRoutes.Clear();
+
+		for (auto& candidates : mAnyKeyRoutes)
+		{
+			candidates.Clear();
+		}
+
+		for (auto* helper : mHelpers)
+		{
+			for (const auto& route : helper->KeyRoutes())
+			{
+				mKeyRoutes.TryEmplace(std::string(route.Key));
+			}
+		}
+
+		// Candidates are appended helper by helper, so every list keeps registration order.
+		for (auto* helper : mHelpers)
+		{
+			const std::uint8_t anyKeyShapes = helper->AnyKeyShapes();
+			const auto keyRoutes = helper->KeyRoutes();
+
+			for (std::size_t i = 0; i < mAnyKeyRoutes.size(); ++i)
+			{
+				if (anyKeyShapes & (1 << i)) mAnyKeyRoutes[i].EmplaceBack(helper);
+			}
+
+			for (auto& [key, candidates] : mKeyRoutes)
+			{
+				std::uint8_t shapes = anyKeyShapes;
+
+				for (const auto& route : keyRoutes)
+				{
+					if (String::EqualsIgnoreCase(route.Key, key)) shapes |= route.Shapes;
+				}
+
+				for (std::size_t i = 0; i < candidates.size(); ++i)
+				{
+					if (shapes & (1 << i)) candidates[i].EmplaceBack(helper);
+				}
+			}
+		}
+
+		mRoutesDirty = false;
 	}
 #pragma endregion Modifiers
 
 #pragma region Parse Methods
 	void JsonParseMaster::Parse(std::istream& inputStream)
 	{
+		PROFILE_SCOPE("JsonParseMaster::Parse");
+
 		mSharedData->PreParse();
 
 		for (auto* helper : mHelpers)
@@ -145,6 +205,8 @@ namespace Library
 
 		if (!mSharedData || mHelpers.Size() == 0) return;
 
+		BuildRoutes();
+
 		Json::Value root;
 		inputStream >> root;
 
@@ -173,20 +235,65 @@ namespace Library
 			filestream.close();
 		}
 	}
+
+	void JsonParseMaster::ParseStream(std::istream& inputStream)
+	{
+		PROFILE_SCOPE("JsonParseMaster::ParseStream");
+
+		if (!mSharedData || mHelpers.Size() == 0) return;
+
+		mSharedData->PreParse();
+
+		for (auto* helper : mHelpers)
+		{
+			helper->Initialize();
+		}
+
+		BuildRoutes();
+
+		JsonStreamReader reader(inputStream);
+
+		if (reader.Next() != JsonStreamReader::Token::ObjectStart)
+		{
+			throw std::runtime_error("Root JSON value must be an object.");
+		}
+
+		mSharedData->IncrementDepth();
+		StreamMembers(reader);
+		mSharedData->DecrementDepth();
+
+		reader.Next();
+
+		mSharedData->PostParse();
+	}
+
+	void JsonParseMaster::ParseStreamFromFile(std::string filename)
+	{
+		std::ifstream filestream;
+		filestream.open(filename, std::ios::binary);
+
+		if (filestream.is_open())
+		{
+			mFilename = std::move(filename);
+			ParseStream(filestream);
+			filestream.close();
+		}
+	}
 #pragma endregion Parse Methods
 
 #pragma region Parse Helper Methods
 	void Library::JsonParseMaster::ParseMembers(const Json::Value& value)
 	{
-		for (const auto& member : value.getMemberNames())
+		for (auto it = value.begin(); it != value.end(); ++it)
 		{
-			Parse(member, value[member]);
+			const std::string member = it.name();
+			Parse(member, *it);
 		}
 	}
 
 	void JsonParseMaster::Parse(const std::string& key, const Json::Value& value)
 	{		
-		for (auto helper : mHelpers)
+		for (auto helper : Routes(key, ShapeIndex(value)))
 		{
 			if (value.isObject())
 			{
@@ -235,5 +342,104 @@ namespace Library
 			}
 		}
 	}
+
+	void JsonParseMaster::StreamMembers(JsonStreamReader& reader)
+	{
+		using Token = JsonStreamReader::Token;
+
+		while (reader.Next() == Token::Key)
+		{
+			const std::string key = reader.Text();
+			reader.Next();
+			StreamValue(key, reader);
+		}
+
+		assert(reader.Current() == Token::ObjectEnd);
+	}
+
+	void JsonParseMaster::StreamValue(const std::string& key, JsonStreamReader& reader)
+	{
+		using Token = JsonStreamReader::Token;
+
+		IJsonParseHelper* handler = nullptr;
+
+		for (auto* helper : Routes(key, ShapeIndex(reader)))
+		{
+			if (helper->StreamStartHandler(*mSharedData, key, reader))
+			{
+				handler = helper;
+				break;
+			}
+		}
+
+		if (handler == nullptr)
+		{
+			reader.Skip();
+			return;
+		}
+
+		if (reader.Current() == Token::ObjectStart)
+		{
+			mSharedData->IncrementDepth();
+			StreamMembers(reader);
+			handler->EndHandler(*mSharedData, key);
+			mSharedData->DecrementDepth();
+		}
+		else if (reader.Current() == Token::ArrayStart)
+		{
+			for (Token token = reader.Next(); token != Token::ArrayEnd; token = reader.Next())
+			{
+				if (token == Token::ObjectStart)
+				{
+					mSharedData->IncrementDepth();
+					StreamMembers(reader);
+					mSharedData->DecrementDepth();
+				}
+				else if (token == Token::ArrayStart)
+				{
+					StreamValue(key, reader);
+				}
+				else
+				{
+					handler->StreamElementHandler(*mSharedData, key, reader);
+				}
+			}
+
+			handler->EndHandler(*mSharedData, key);
+		}
+		else
+		{
+			handler->EndHandler(*mSharedData, key);
+		}
+	}
+
+	const Vector<IJsonParseHelper*>& JsonParseMaster::Routes(const std::string& key, const std::size_t shapeIndex) const
+	{
+		assert(!mRoutesDirty);
+
+		if (!mKeyRoutes.IsEmpty())
+		{
+			const auto it = mKeyRoutes.Find(key);
+			if (it != mKeyRoutes.end()) return it->second[shapeIndex];
+		}
+
+		return mAnyKeyRoutes[shapeIndex];
+	}
+
+	std::size_t JsonParseMaster::ShapeIndex(const Json::Value& value)
+	{
+		if (value.isObject())	return 0;
+		if (value.isArray())	return 1;
+		return 2;
+	}
+
+	std::size_t JsonParseMaster::ShapeIndex(const JsonStreamReader& reader)
+	{
+		using Token = JsonStreamReader::Token;
+
+		if (reader.Current() == Token::ObjectStart)	return 0;
+		if (reader.Current() == Token::ArrayStart)	return 1;
+		return 2;
+	}
 #pragma endregion Parse Helper Methods
 }
@@ -3,6 +3,7 @@
 #pragma region Includes
 // Standard
 #include <stdint.h>
+#include <array>
 
 // Third Party
 #pragma warning(disable : 26812)
@@ -14,17 +15,33 @@
 // First Party
 #include "RTTI.h"
 #include "Vector.h"
+#include "HashMap.h"
+#include "Utility.h"
 #pragma endregion Includes
 
 namespace Library
 {
 	class IJsonParseHelper;
+	class JsonStreamReader;
 	
 	/// <summary>
 	/// JSON parser master class for managing IJsonParserHelper handles and parsing JSON data.
 	/// </summary>
 	class JsonParseMaster final
 	{
+#pragma region Type Definitions, Constants
+	private:
+		/// <summary>
+		/// Helpers offered a value of each shape, in registration order. Indexed by ShapeIndex.
+		/// </summary>
+		using RouteCandidates = std::array<Vector<IJsonParseHelper*>, 3>;
+
+		/// <summary>
+		/// Bucket count of the key routing table. Helpers declare few specific keys.
+		/// </summary>
+		inline static constexpr std::size_t RouteBucketCount = 31;
+#pragma endregion Type Definitions, Constants
+
 #pragma region Shared Data
 	public:
 		/// <summary>
@@ -213,6 +230,12 @@ namespace Library
 		/// </summary>
 		/// <param name="helper">Reference to the IJsonParseHelper subclass.</param>
 		bool RemoveHelper(IJsonParseHelper& helper);
+
+	private:
+		/// <summary>
+		/// Rebuilds the routing tables from the routes declared by each helper, if helpers changed since the last build.
+		/// </summary>
+		void BuildRoutes();
 #pragma endregion Modifiers
 		
 #pragma region Parse Methods
@@ -234,6 +257,21 @@ namespace Library
 		/// </summary>
 		/// <param name="filename">Filename of the JSON file to be parsed.</param>
 		void ParseFromFile(std::string filename);
+
+		/// <summary>
+		/// Parses an input stream containing JSON data as it is read, without building a Json::Value document.
+		/// Values are dispatched to the stream handlers of the helpers in document order.
+		/// </summary>
+		/// <param name="inputStream">A std::istream instance containing JSON data.</param>
+		/// <exception cref="std::runtime_error">Malformed JSON, or a root value that is not an object.</exception>
+		void ParseStream(std::istream& inputStream);
+
+		/// <summary>
+		/// Parses a JSON file as it is read, without building a Json::Value document.
+		/// </summary>
+		/// <param name="filename">Filename of the JSON file to be parsed.</param>
+		/// <exception cref="std::runtime_error">Malformed JSON, or a root value that is not an object.</exception>
+		void ParseStreamFromFile(std::string filename);
 #pragma endregion Parse Methods
 
 #pragma region Parse Helper Methods
@@ -251,6 +289,41 @@ namespace Library
 		/// <param name="value">Reference to the JSON value.</param>
 		/// <param name="isArray">Boolean representing if the JSON value is an array.</param>
 		void Parse(const std::string& key, const Json::Value& value);
+
+		/// <summary>
+		/// Reads the members of an object from a stream and parses them, after its start token has been read.
+		/// </summary>
+		/// <param name="reader">JsonStreamReader positioned at the start of the object.</param>
+		void StreamMembers(JsonStreamReader& reader);
+
+		/// <summary>
+		/// Parses a value from a stream, skipping it when no helper handles it.
+		/// </summary>
+		/// <param name="key">Key associated with the value.</param>
+		/// <param name="reader">JsonStreamReader positioned at the first token of the value.</param>
+		void StreamValue(const std::string& key, JsonStreamReader& reader);
+
+		/// <summary>
+		/// Gets the helpers routed a value, in registration order.
+		/// </summary>
+		/// <param name="key">Key associated with the value.</param>
+		/// <param name="shapeIndex">Index of the shape of the value.</param>
+		/// <returns>Helpers to be offered the value.</returns>
+		const Vector<IJsonParseHelper*>& Routes(const std::string& key, const std::size_t shapeIndex) const;
+
+		/// <summary>
+		/// Gets the routing index of the shape of a JSON value.
+		/// </summary>
+		/// <param name="value">Reference to the JSON value.</param>
+		/// <returns>0 for objects, 1 for arrays and 2 for scalars.</returns>
+		static std::size_t ShapeIndex(const Json::Value& value);
+
+		/// <summary>
+		/// Gets the routing index of the shape of the value a stream is positioned at.
+		/// </summary>
+		/// <param name="reader">JsonStreamReader positioned at the first token of the value.</param>
+		/// <returns>0 for objects, 1 for arrays and 2 for scalars.</returns>
+		static std::size_t ShapeIndex(const JsonStreamReader& reader);
 #pragma endregion Parse Helper Methods
 
 #pragma region Data Members
@@ -279,6 +352,22 @@ namespace Library
 		/// List of indices in the list of helpers that contain owned Helper instances.
 		/// </summary>
 		Vector<std::size_t> mOwnedHelperIndices;
+
+		/// <summary>
+		/// Helpers routed values of keys declared by any helper's KeyRoutes, merged with the helpers routed any key.
+		/// Keys are hashed and compared without regard to case.
+		/// </summary>
+		HashMap<std::string, RouteCandidates> mKeyRoutes{ RouteBucketCount, String::EqualsIgnoreCase, String::HashIgnoreCase };
+
+		/// <summary>
+		/// Helpers routed values of keys no helper declares.
+		/// </summary>
+		RouteCandidates mAnyKeyRoutes;
+
+		/// <summary>
+		/// Describes if helpers were added or removed since the routing tables were built.
+		/// </summary>
+		bool mRoutesDirty{ true };
 #pragma endregion Data Members
 	};
 }
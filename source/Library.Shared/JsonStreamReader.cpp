@@ -0,0 +1,312 @@
+#pragma region Includes
+// Pre-compiled Header
+#include "pch.h"
+
+// Header
+#include "JsonStreamReader.h"
+
+// Standard
+#include <climits>
+#include <cstdlib>
+#pragma endregion Includes
+
+using namespace std::string_literals;
+
+namespace Library
+{
+#pragma region Special Members
+	JsonStreamReader::JsonStreamReader(std::istream& inputStream, const std::size_t bufferSize) :
+		mInput(inputStream), mBuffer(std::max(bufferSize, std::size_t(1)))
+	{
+		mBuffer.Resize(mBuffer.Capacity());
+	}
+#pragma endregion Special Members
+
+#pragma region Modifiers
+	JsonStreamReader::Token JsonStreamReader::Next()
+	{
+		SkipWhitespace();
+
+		if (mCurrent == Token::Key)
+		{
+			Expect(':');
+			SkipWhitespace();
+			return mCurrent = ReadValue();
+		}
+
+		if (mContainers.IsEmpty())
+		{
+			if (mIsRootRead)
+			{
+				if (Peek() >= 0) Error("Unexpected content after the root value."s);
+				return mCurrent = Token::End;
+			}
+
+			mCurrent = ReadValue();
+			mIsRootRead = IsScalar();
+			return mCurrent;
+		}
+
+		Container& container = mContainers.Back();
+		const bool isObject = container.Type == Token::ObjectStart;
+
+		if (Peek() == (isObject ? '}' : ']'))
+		{
+			Get();
+			mContainers.PopBack();
+			mIsRootRead = mContainers.IsEmpty();
+			return mCurrent = isObject ? Token::ObjectEnd : Token::ArrayEnd;
+		}
+
+		if (container.HasElement)
+		{
+			Expect(',');
+			SkipWhitespace();
+		}
+
+		// Set before reading, as a nested object or array invalidates the reference.
+		container.HasElement = true;
+
+		if (isObject)
+		{
+			Expect('"');
+			ReadString();
+			return mCurrent = Token::Key;
+		}
+
+		return mCurrent = ReadValue();
+	}
+
+	void JsonStreamReader::Skip()
+	{
+		if (mCurrent == Token::Key) Next();
+
+		if (mCurrent == Token::ObjectStart || mCurrent == Token::ArrayStart)
+		{
+			const std::size_t depth = mContainers.Size();
+
+			while (mContainers.Size() >= depth)
+			{
+				Next();
+			}
+		}
+	}
+#pragma endregion Modifiers
+
+#pragma region Helper Methods
+	void JsonStreamReader::SkipWhitespace()
+	{
+		for (int c = Peek(); c == ' ' || c == '\n' || c == '\t' || c == '\r'; c = Peek())
+		{
+			if (c == '\n') ++mLine;
+			++mPosition;
+		}
+	}
+
+	void JsonStreamReader::Expect(const char expected)
+	{
+		const int c = Get();
+
+		if (c != expected)
+		{
+			Error(c < 0 ? "Unexpected end of input."s : "Expected '"s + expected + "' but found '"s + static_cast<char>(c) + "'."s);
+		}
+	}
+
+	JsonStreamReader::Token JsonStreamReader::ReadValue()
+	{
+		const int c = Peek();
+
+		switch (c)
+		{
+		case '{':
+			Get();
+			mContainers.PushBack({ Token::ObjectStart, false });
+			return Token::ObjectStart;
+
+		case '[':
+			Get();
+			mContainers.PushBack({ Token::ArrayStart, false });
+			return Token::ArrayStart;
+
+		case '"':
+			Get();
+			ReadString();
+			return Token::String;
+
+		case 't':
+			Get();
+			mBoolean = true;
+			return ReadLiteral("rue", Token::Boolean);
+
+		case 'f':
+			Get();
+			mBoolean = false;
+			return ReadLiteral("alse", Token::Boolean);
+
+		case 'n':
+			Get();
+			return ReadLiteral("ull", Token::Null);
+
+		default:
+			if (c == '-' || (c >= '0' && c <= '9')) return ReadNumber();
+			Error(c < 0 ? "Unexpected end of input."s : "Unexpected character '"s + static_cast<char>(c) + "'."s);
+		}
+	}
+
+	void JsonStreamReader::ReadString()
+	{
+		mText.clear();
+
+		for (;;)
+		{
+			if (Peek() < 0) Error("Unterminated string."s);
+
+			// Copies runs of plain characters straight from the buffer.
+			const std::size_t start = mPosition;
+
+			while (mPosition < mLength)
+			{
+				const char c = mBuffer[mPosition];
+				if (c == '"' || c == '\\' || static_cast<unsigned char>(c) < 0x20) break;
+				++mPosition;
+			}
+
+			mText.append(&mBuffer[start], mPosition - start);
+			if (mPosition == mLength) continue;
+
+			const int c = Get();
+
+			if (c == '"') return;
+			if (c != '\\') Error("Control character in string."s);
+
+			const int escape = Get();
+
+			switch (escape)
+			{
+			case '"':	mText.push_back('"');	break;
+			case '\\':	mText.push_back('\\');	break;
+			case '/':	mText.push_back('/');	break;
+			case 'b':	mText.push_back('\b');	break;
+			case 'f':	mText.push_back('\f');	break;
+			case 'n':	mText.push_back('\n');	break;
+			case 'r':	mText.push_back('\r');	break;
+			case 't':	mText.push_back('\t');	break;
+
+			case 'u':
+			{
+				std::uint32_t codePoint = ReadHexQuad();
+
+				if (codePoint >= 0xD800 && codePoint <= 0xDBFF)
+				{
+					Expect('\\');
+					Expect('u');
+
+					const std::uint32_t low = ReadHexQuad();
+					if (low < 0xDC00 || low > 0xDFFF) Error("Invalid surrogate pair."s);
+
+					codePoint = 0x10000 + ((codePoint - 0xD800) << 10) + (low - 0xDC00);
+				}
+
+				AppendUtf8(codePoint);
+				break;
+			}
+
+			default:
+				Error("Invalid escape sequence."s);
+			}
+		}
+	}
+
+	JsonStreamReader::Token JsonStreamReader::ReadNumber()
+	{
+		mText.clear();
+		bool isFloat = false;
+
+		for (int c = Peek(); (c >= '0' && c <= '9') || c == '-' || c == '+' || c == '.' || c == 'e' || c == 'E'; c = Peek())
+		{
+			isFloat |= c == '.' || c == 'e' || c == 'E';
+			mText.push_back(static_cast<char>(Get()));
+		}
+
+		const char* begin = mText.c_str();
+		char* end = nullptr;
+
+		if (!isFloat)
+		{
+			const long long value = std::strtoll(begin, &end, 10);
+
+			if (end == begin + mText.size() && value >= INT_MIN && value <= INT_MAX)
+			{
+				mInteger = static_cast<int>(value);
+				mFloat = static_cast<double>(value);
+				return Token::Integer;
+			}
+		}
+
+		mFloat = std::strtod(begin, &end);
+		if (end != begin + mText.size()) Error("Invalid number \""s + mText + "\"."s);
+
+		return Token::Float;
+	}
+
+	JsonStreamReader::Token JsonStreamReader::ReadLiteral(const char* rest, const Token token)
+	{
+		for (; *rest != '\0'; ++rest)
+		{
+			if (Get() != *rest) Error("Invalid literal."s);
+		}
+
+		return token;
+	}
+
+	void JsonStreamReader::AppendUtf8(const std::uint32_t codePoint)
+	{
+		if (codePoint < 0x80)
+		{
+			mText.push_back(static_cast<char>(codePoint));
+		}
+		else if (codePoint < 0x800)
+		{
+			mText.push_back(static_cast<char>(0xC0 | (codePoint >> 6)));
+			mText.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+		}
+		else if (codePoint < 0x10000)
+		{
+			mText.push_back(static_cast<char>(0xE0 | (codePoint >> 12)));
+			mText.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+			mText.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+		}
+		else
+		{
+			mText.push_back(static_cast<char>(0xF0 | (codePoint >> 18)));
+			mText.push_back(static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F)));
+			mText.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+			mText.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+		}
+	}
+
+	std::uint32_t JsonStreamReader::ReadHexQuad()
+	{
+		std::uint32_t value = 0;
+
+		for (std::size_t i = 0; i < 4; ++i)
+		{
+			const int c = Get();
+			value <<= 4;
+
+			if (c >= '0' && c <= '9')		value |= static_cast<std::uint32_t>(c - '0');
+			else if (c >= 'a' && c <= 'f')	value |= static_cast<std::uint32_t>(c - 'a' + 10);
+			else if (c >= 'A' && c <= 'F')	value |= static_cast<std::uint32_t>(c - 'A' + 10);
+			else							Error("Invalid unicode escape sequence."s);
+		}
+
+		return value;
+	}
+
+	void JsonStreamReader::Error(const std::string& message) const
+	{
+		throw std::runtime_error("JSON parse error on line "s + std::to_string(mLine) + ": "s + message);
+	}
+#pragma endregion Helper Methods
+}
@@ -0,0 +1,301 @@
+#pragma once
+
+#pragma region Includes
+// Standard
+#include <cstdint>
+#include <istream>
+#include <string>
+
+// First Party
+#include "Vector.h"
+#pragma endregion Includes
+
+namespace Library
+{
+	/// <summary>
+	/// Pull tokenizer for reading JSON from an input stream one token at a time, without building a document.
+	/// </summary>
+	/// <remarks>
+	/// The stream is read through a fixed size buffer, so memory use depends on the nesting depth and the longest string, not the document size.
+	/// Malformed input is reported with a std::runtime_error naming the line it was found on.
+	/// </remarks>
+	class JsonStreamReader final
+	{
+#pragma region Type Definitions, Constants
+	public:
+		/// <summary>
+		/// Kinds of token read from the stream.
+		/// </summary>
+		enum class Token
+		{
+			None,
+			ObjectStart,
+			ObjectEnd,
+			ArrayStart,
+			ArrayEnd,
+			Key,
+			String,
+			Integer,
+			Float,
+			Boolean,
+			Null,
+			End
+		};
+
+		/// <summary>
+		/// Default size in bytes of the read buffer.
+		/// </summary>
+		static constexpr std::size_t DefaultBufferSize = 64 * 1024;
+#pragma endregion Type Definitions, Constants
+
+#pragma region Special Members
+	public:
+		/// <summary>
+		/// Specialized constructor for reading from an input stream.
+		/// </summary>
+		/// <param name="inputStream">Stream to read JSON from. Must outlive the JsonStreamReader.</param>
+		/// <param name="bufferSize">Size in bytes of the read buffer.</param>
+		explicit JsonStreamReader(std::istream& inputStream, const std::size_t bufferSize=DefaultBufferSize);
+
+		/// <summary>
+		/// Default destructor.
+		/// </summary>
+		~JsonStreamReader() = default;
+
+		/// <summary>
+		/// Deleted copy constructor.
+		/// </summary>
+		JsonStreamReader(const JsonStreamReader&) = delete;
+
+		/// <summary>
+		/// Deleted copy assignment operator.
+		/// </summary>
+		JsonStreamReader& operator=(const JsonStreamReader&) = delete;
+
+		/// <summary>
+		/// Deleted move constructor.
+		/// </summary>
+		JsonStreamReader(JsonStreamReader&&) = delete;
+
+		/// <summary>
+		/// Deleted move assignment operator.
+		/// </summary>
+		JsonStreamReader& operator=(JsonStreamReader&&) = delete;
+#pragma endregion Special Members
+
+#pragma region Accessors
+	public:
+		/// <summary>
+		/// Gets the last token read.
+		/// </summary>
+		/// <returns>Current token. None before the first read.</returns>
+		Token Current() const;
+
+		/// <summary>
+		/// Gets the text of the current Key or String token.
+		/// </summary>
+		/// <returns>Reference to the unescaped text.</returns>
+		const std::string& Text() const;
+
+		/// <summary>
+		/// Gets the value of the current Integer token.
+		/// </summary>
+		/// <returns>Integer value.</returns>
+		int Integer() const;
+
+		/// <summary>
+		/// Gets the value of the current Integer or Float token as a floating point value.
+		/// </summary>
+		/// <returns>Floating point value.</returns>
+		double Float() const;
+
+		/// <summary>
+		/// Gets the value of the current Boolean token.
+		/// </summary>
+		/// <returns>Boolean value.</returns>
+		bool Boolean() const;
+
+		/// <summary>
+		/// Gets whether the current token is a String, Integer, Float, Boolean or Null value.
+		/// </summary>
+		/// <returns>True when the current token is a scalar value. Otherwise, false.</returns>
+		bool IsScalar() const;
+
+		/// <summary>
+		/// Gets the line of the stream the reader is on, starting at one.
+		/// </summary>
+		/// <returns>Current line number.</returns>
+		std::size_t Line() const;
+#pragma endregion Accessors
+
+#pragma region Modifiers
+	public:
+		/// <summary>
+		/// Reads the next token from the stream.
+		/// </summary>
+		/// <returns>Token read. End once the root value has been read completely.</returns>
+		/// <exception cref="std::runtime_error">Malformed JSON.</exception>
+		Token Next();
+
+		/// <summary>
+		/// Skips the value starting at the current token, including everything nested within it.
+		/// </summary>
+		/// <exception cref="std::runtime_error">Malformed JSON.</exception>
+		void Skip();
+#pragma endregion Modifiers
+
+#pragma region Helper Types
+	private:
+		/// <summary>
+		/// Open object or array, and whether it has read an element yet.
+		/// </summary>
+		struct Container final
+		{
+			/// <summary>
+			/// ObjectStart or ArrayStart.
+			/// </summary>
+			Token Type;
+
+			/// <summary>
+			/// Whether an element, or a key for objects, has been read.
+			/// </summary>
+			bool HasElement;
+		};
+#pragma endregion Helper Types
+
+#pragma region Helper Methods
+	private:
+		/// <summary>
+		/// Gets the next character without consuming it, refilling the buffer as needed.
+		/// </summary>
+		/// <returns>Next character, or a negative value at the end of the stream.</returns>
+		int Peek();
+
+		/// <summary>
+		/// Consumes the next character.
+		/// </summary>
+		/// <returns>Consumed character, or a negative value at the end of the stream.</returns>
+		int Get();
+
+		/// <summary>
+		/// Consumes whitespace, counting lines.
+		/// </summary>
+		void SkipWhitespace();
+
+		/// <summary>
+		/// Consumes a character, throwing if it is not the one expected.
+		/// </summary>
+		/// <param name="expected">Character expected next.</param>
+		void Expect(const char expected);
+
+		/// <summary>
+		/// Reads a value starting at the next character.
+		/// </summary>
+		/// <returns>Token read.</returns>
+		Token ReadValue();
+
+		/// <summary>
+		/// Reads a quoted string into the text buffer, after its opening quote has been consumed.
+		/// </summary>
+		void ReadString();
+
+		/// <summary>
+		/// Reads a number starting at the next character.
+		/// </summary>
+		/// <returns>Integer or Float token.</returns>
+		Token ReadNumber();
+
+		/// <summary>
+		/// Reads a literal, after its first character has been consumed.
+		/// </summary>
+		/// <param name="rest">Remaining characters of the literal.</param>
+		/// <param name="token">Token to be returned.</param>
+		/// <returns>Token for the literal.</returns>
+		Token ReadLiteral(const char* rest, const Token token);
+
+		/// <summary>
+		/// Appends a code point to the text buffer, encoded as UTF-8.
+		/// </summary>
+		/// <param name="codePoint">Unicode code point.</param>
+		void AppendUtf8(const std::uint32_t codePoint);
+
+		/// <summary>
+		/// Reads the four hexadecimal digits of a \u escape sequence.
+		/// </summary>
+		/// <returns>Code unit.</returns>
+		std::uint32_t ReadHexQuad();
+
+		/// <summary>
+		/// Throws a std::runtime_error describing malformed input at the current line.
+		/// </summary>
+		/// <param name="message">Description of the error.</param>
+		[[noreturn]] void Error(const std::string& message) const;
+#pragma endregion Helper Methods
+
+#pragma region Data Members
+	private:
+		/// <summary>
+		/// Stream read from.
+		/// </summary>
+		std::istream& mInput;
+
+		/// <summary>
+		/// Read buffer.
+		/// </summary>
+		Vector<char> mBuffer;
+
+		/// <summary>
+		/// Index of the next unread character in the buffer.
+		/// </summary>
+		std::size_t mPosition{ 0 };
+
+		/// <summary>
+		/// Number of valid characters in the buffer.
+		/// </summary>
+		std::size_t mLength{ 0 };
+
+		/// <summary>
+		/// Objects and arrays currently open, innermost last.
+		/// </summary>
+		Vector<Container> mContainers{ Vector<Container>::EqualityFunctor() };
+
+		/// <summary>
+		/// Last token read.
+		/// </summary>
+		Token mCurrent{ Token::None };
+
+		/// <summary>
+		/// Whether the root value has been read completely.
+		/// </summary>
+		bool mIsRootRead{ false };
+
+		/// <summary>
+		/// Unescaped text of the current Key or String token, or the characters of the current number.
+		/// </summary>
+		std::string mText;
+
+		/// <summary>
+		/// Value of the current Integer token.
+		/// </summary>
+		int mInteger{ 0 };
+
+		/// <summary>
+		/// Value of the current Integer or Float token.
+		/// </summary>
+		double mFloat{ 0.0 };
+
+		/// <summary>
+		/// Value of the current Boolean token.
+		/// </summary>
+		bool mBoolean{ false };
+
+		/// <summary>
+		/// Current line number.
+		/// </summary>
+		std::size_t mLine{ 1 };
+#pragma endregion Data Members
+	};
+}
+
+// Inline File
+#include "JsonStreamReader.inl"
@@ -0,0 +1,68 @@
+#pragma once
+
+// Header
+#include "JsonStreamReader.h"
+
+namespace Library
+{
+#pragma region Accessors
+	inline JsonStreamReader::Token JsonStreamReader::Current() const
+	{
+		return mCurrent;
+	}
+
+	inline const std::string& JsonStreamReader::Text() const
+	{
+		return mText;
+	}
+
+	inline int JsonStreamReader::Integer() const
+	{
+		return mInteger;
+	}
+
+	inline double JsonStreamReader::Float() const
+	{
+		return mFloat;
+	}
+
+	inline bool JsonStreamReader::Boolean() const
+	{
+		return mBoolean;
+	}
+
+	inline bool JsonStreamReader::IsScalar() const
+	{
+		return mCurrent == Token::String || mCurrent == Token::Integer || mCurrent == Token::Float 
+			|| mCurrent == Token::Boolean || mCurrent == Token::Null;
+	}
+
+	inline std::size_t JsonStreamReader::Line() const
+	{
+		return mLine;
+	}
+#pragma endregion Accessors
+
+#pragma region Helper Methods
+	inline int JsonStreamReader::Peek()
+	{
+		if (mPosition == mLength)
+		{
+			mInput.read(&mBuffer[0], static_cast<std::streamsize>(mBuffer.Size()));
+			mLength = static_cast<std::size_t>(mInput.gcount());
+			mPosition = 0;
+
+			if (mLength == 0) return -1;
+		}
+
+		return static_cast<unsigned char>(mBuffer[mPosition]);
+	}
+
+	inline int JsonStreamReader::Get()
+	{
+		const int c = Peek();
+		if (c >= 0) ++mPosition;
+		return c;
+	}
+#pragma endregion Helper Methods
+}
@@ -0,0 +1,285 @@
+#pragma region Includes
+// Pre-compiled Header
+#include "pch.h"
+
+// Header
+#include "JsonWorldLoader.h"
+
+// Standard
+#include <atomic>
+#include <fstream>
+#include <future>
+#include <thread>
+
+// First Party
+#include "JsonEntityParseHelper.h"
+#include "Entity.h"
+#include "Profiler.h"
+#pragma endregion Includes
+
+using namespace std::string_literals;
+
+namespace Library
+{
+#pragma region Special Members
+	JsonWorldLoader::JsonWorldLoader(const JsonParseMaster& master, const std::size_t threadCount) :
+		mMaster(master), mThreadCount(threadCount > 0 ? threadCount : std::max(std::size_t(std::thread::hardware_concurrency()), std::size_t(1)))
+	{
+	}
+#pragma endregion Special Members
+
+#pragma region Accessors
+	std::size_t JsonWorldLoader::ThreadCount() const
+	{
+		return mThreadCount;
+	}
+#pragma endregion Accessors
+
+#pragma region Load Methods
+	void JsonWorldLoader::Load(Entity& root, std::istream& inputStream)
+	{
+		const std::string document{ std::istreambuf_iterator<char>(inputStream), std::istreambuf_iterator<char>() };
+		LoadDocuments(root, SplitMembers(document));
+	}
+
+	void JsonWorldLoader::LoadFromFile(Entity& root, const std::string& filename)
+	{
+		LoadDocuments(root, SplitMembers(ReadFile(filename)));
+	}
+
+	void JsonWorldLoader::LoadFromFiles(Entity& root, const Vector<std::string>& filenames)
+	{
+		Vector<std::string> documents(filenames.Size());
+
+		for (const auto& filename : filenames)
+		{
+			documents.EmplaceBack(ReadFile(filename));
+		}
+
+		LoadDocuments(root, documents);
+	}
+#pragma endregion Load Methods
+
+#pragma region Helper Methods
+	Vector<std::string> JsonWorldLoader::SplitMembers(const std::string& document)
+	{
+		Vector<std::string> members;
+
+		std::size_t depth = 0;
+		std::size_t memberStart = 0;
+		bool isInString = false;
+		bool isEscaped = false;
+
+		for (std::size_t i = 0; i < document.size(); ++i)
+		{
+			const char c = document[i];
+
+			if (isInString)
+			{
+				if (isEscaped)			isEscaped = false;
+				else if (c == '\\')		isEscaped = true;
+				else if (c == '"')		isInString = false;
+				continue;
+			}
+
+			if (depth == 0 && c != '{' && c != ' ' && c != '\t' && c != '\n' && c != '\r')
+			{
+				throw std::runtime_error("Root JSON value must be an object.");
+			}
+
+			switch (c)
+			{
+			case '"':
+				isInString = true;
+				break;
+
+			case '{':
+			case '[':
+				if (++depth == 1) memberStart = i + 1;
+				break;
+
+			case ',':
+			case '}':
+			case ']':
+				if (depth == 1)
+				{
+					const auto first = document.find_first_not_of(" \t\n\r", memberStart);
+
+					if (first < i)
+					{
+						members.EmplaceBack("{"s + document.substr(memberStart, i - memberStart) + "}"s);
+					}
+
+					memberStart = i + 1;
+				}
+
+				if (c != ',')
+				{
+					// The root object closing ends the document, anything after it is left to the parser to report.
+					if (--depth == 0) return members;
+				}
+				break;
+
+			default:
+				break;
+			}
+		}
+
+		throw std::runtime_error("Root JSON value must be an object.");
+	}
+
+	std::string JsonWorldLoader::ReadFile(const std::string& filename)
+	{
+		std::ifstream filestream(filename, std::ios::binary);
+
+		if (!filestream.is_open())
+		{
+			throw std::runtime_error("Could not open \""s + filename + "\"."s);
+		}
+
+		return std::string{ std::istreambuf_iterator<char>(filestream), std::istreambuf_iterator<char>() };
+	}
+
+	void JsonWorldLoader::LoadDocuments(Entity& root, const Vector<std::string>& documents)
+	{
+		PROFILE_SCOPE("JsonWorldLoader::LoadDocuments");
+
+		assert(mMaster.GetSharedData() != nullptr && mMaster.GetSharedData()->Is(JsonEntityParseHelper::SharedData::TypeIdClass()));
+
+		Vector<gsl::owner<Entity*>> stagings(documents.Size());
+		stagings.Resize(documents.Size(), nullptr);
+
+		std::atomic<std::size_t> nextDocument{ 0 };
+
+		// Each worker owns a cloned master and claims documents until none remain, so uneven sectors balance out.
+		auto worker = [this, &documents, &stagings, &nextDocument]
+		{
+			const std::unique_ptr<JsonParseMaster> master(mMaster.Clone());
+			auto* sharedData = const_cast<JsonParseMaster::SharedData*>(master->GetSharedData())->As<JsonEntityParseHelper::SharedData>();
+
+			for (std::size_t i = nextDocument++; i < documents.Size(); i = nextDocument++)
+			{
+				master->Parse(documents[i]);
+				stagings[i] = sharedData->TransferEntity();
+			}
+		};
+
+		const std::size_t workerCount = std::min(mThreadCount, documents.Size());
+
+		Vector<std::future<void>> workers(workerCount, Vector<std::future<void>>::EqualityFunctor());
+
+		for (std::size_t i = 1; i < workerCount; ++i)
+		{
+			workers.EmplaceBack(std::async(std::launch::async, worker));
+		}
+
+		std::exception_ptr exception;
+
+		try
+		{
+			if (workerCount > 0) worker();
+		}
+		catch (...)
+		{
+			exception = std::current_exception();
+			nextDocument = documents.Size();
+		}
+
+		for (auto& future : workers)
+		{
+			try
+			{
+				future.get();
+			}
+			catch (...)
+			{
+				if (!exception) exception = std::current_exception();
+			}
+		}
+
+		// Splicing touches the root, so it happens on this thread once every worker has finished.
+		for (auto* staging : stagings)
+		{
+			if (staging == nullptr) continue;
+
+			try
+			{
+				if (!exception) Splice(root, *staging);
+			}
+			catch (...)
+			{
+				exception = std::current_exception();
+			}
+
+			delete staging;
+		}
+
+		if (exception) std::rethrow_exception(exception);
+	}
+
+	void JsonWorldLoader::Splice(Entity& root, Entity& staging)
+	{
+		Vector<Entity*> children;
+		Vector<const Scope::Attribute*> attributes;
+
+		static_cast<const Entity&>(staging).ForEachAuxiliary([&children, &attributes](const Scope::Attribute& attribute)
+		{
+			const Entity::Data& data = attribute.second;
+
+			if (data.Type() == Entity::Types::Scope)
+			{
+				for (std::size_t i = 0; i < data.Size(); ++i)
+				{
+					assert(data.Get<Scope*>(i)->Is(Entity::TypeIdClass()));
+					children.EmplaceBack(static_cast<Entity*>(data.Get<Scope*>(i)));
+				}
+			}
+			else
+			{
+				attributes.EmplaceBack(&attribute);
+			}
+		});
+
+		for (const auto* attribute : attributes)
+		{
+			const Entity::Data& data = attribute->second;
+			Entity::Data& target = root[attribute->first];
+
+			if (target.Type() == Entity::Types::Unknown)
+			{
+				target.SetType(data.Type());
+			}
+
+			if (target.HasInternalStorage())
+			{
+				target.Resize(data.Size());
+			}
+			else if (target.Size() < data.Size())
+			{
+				throw std::runtime_error("\""s + attribute->first + "\" array has too many elements."s);
+			}
+
+			// Element wise, so that prescribed attributes keep their external storage.
+			for (std::size_t i = 0; i < data.Size(); ++i)
+			{
+				switch (data.Type())
+				{
+				case Entity::Types::Integer:	target.Set(data.Get<int>(i), i);			break;
+				case Entity::Types::Float:		target.Set(data.Get<float>(i), i);			break;
+				case Entity::Types::Vector:		target.Set(data.Get<glm::vec4>(i), i);		break;
+				case Entity::Types::Matrix:		target.Set(data.Get<glm::mat4>(i), i);		break;
+				case Entity::Types::String:		target.Set(data.Get<std::string>(i), i);	break;
+				default:						throw std::runtime_error("Invalid value type."s);
+				}
+			}
+		}
+
+		root.ReserveChildren(children.Size());
+
+		for (auto* child : children)
+		{
+			root.AddChild(*child);
+		}
+	}
+#pragma endregion Helper Methods
+}
@@ -0,0 +1,130 @@
+#pragma once
+
+#pragma region Includes
+// Standard
+#include <istream>
+#include <string>
+
+// First Party
+#include "JsonParseMaster.h"
+#include "Vector.h"
+#pragma endregion Includes
+
+namespace Library
+{
+	// Forward Declarations
+	class Entity;
+
+	/// <summary>
+	/// Loads JSON worlds on multiple threads, parsing each sector with its own clone of a JsonParseMaster.
+	/// </summary>
+	/// <remarks>
+	/// A world document is split at its top level members, and a multi-file world at its files.
+	/// Each piece is parsed on a worker thread into a staging Entity, which is spliced into the root Entity in document order once every worker has finished.
+	/// The master must have a JsonEntityParseHelper::SharedData, and Factory and TypeManager registrations must not change during a load.
+	/// </remarks>
+	class JsonWorldLoader final
+	{
+#pragma region Special Members
+	public:
+		/// <summary>
+		/// Specialized constructor for loading with a configured JsonParseMaster.
+		/// </summary>
+		/// <param name="master">JsonParseMaster cloned by each worker. Must outlive the JsonWorldLoader.</param>
+		/// <param name="threadCount">Maximum number of worker threads. Zero uses one per hardware thread.</param>
+		explicit JsonWorldLoader(const JsonParseMaster& master, const std::size_t threadCount=0);
+
+		/// <summary>
+		/// Default destructor.
+		/// </summary>
+		~JsonWorldLoader() = default;
+
+		JsonWorldLoader(const JsonWorldLoader&) = delete;
+		JsonWorldLoader& operator=(const JsonWorldLoader&) = delete;
+		JsonWorldLoader(JsonWorldLoader&&) = delete;
+		JsonWorldLoader& operator=(JsonWorldLoader&&) = delete;
+#pragma endregion Special Members
+
+#pragma region Accessors
+	public:
+		/// <summary>
+		/// Gets the maximum number of worker threads used by a load.
+		/// </summary>
+		/// <returns>Maximum number of worker threads.</returns>
+		std::size_t ThreadCount() const;
+#pragma endregion Accessors
+
+#pragma region Load Methods
+	public:
+		/// <summary>
+		/// Loads a JSON document into an Entity, parsing its top level members in parallel.
+		/// </summary>
+		/// <param name="root">Entity the parsed attributes and children are added to.</param>
+		/// <param name="inputStream">A std::istream instance containing JSON data.</param>
+		/// <exception cref="std::runtime_error">Root JSON value is not an object.</exception>
+		void Load(Entity& root, std::istream& inputStream);
+
+		/// <summary>
+		/// Loads a JSON file into an Entity, parsing its top level members in parallel.
+		/// </summary>
+		/// <param name="root">Entity the parsed attributes and children are added to.</param>
+		/// <param name="filename">Filename of the JSON file to be loaded.</param>
+		/// <exception cref="std::runtime_error">File could not be opened.</exception>
+		void LoadFromFile(Entity& root, const std::string& filename);
+
+		/// <summary>
+		/// Loads the JSON files of a multi-file world into an Entity, parsing each file in parallel.
+		/// </summary>
+		/// <param name="root">Entity the parsed attributes and children are added to.</param>
+		/// <param name="filenames">Filenames of the JSON files to be loaded, in the order they are spliced.</param>
+		/// <exception cref="std::runtime_error">File could not be opened.</exception>
+		void LoadFromFiles(Entity& root, const Vector<std::string>& filenames);
+#pragma endregion Load Methods
+
+#pragma region Helper Methods
+	private:
+		/// <summary>
+		/// Splits the members of a JSON object into single member JSON documents.
+		/// </summary>
+		/// <param name="document">JSON text of an object.</param>
+		/// <returns>One JSON document per member, in document order.</returns>
+		/// <exception cref="std::runtime_error">Root JSON value is not an object.</exception>
+		static Vector<std::string> SplitMembers(const std::string& document);
+
+		/// <summary>
+		/// Reads an entire file into a string.
+		/// </summary>
+		/// <param name="filename">Filename of the file to be read.</param>
+		/// <returns>Contents of the file.</returns>
+		/// <exception cref="std::runtime_error">File could not be opened.</exception>
+		static std::string ReadFile(const std::string& filename);
+
+		/// <summary>
+		/// Parses JSON documents on worker threads and splices the results into an Entity.
+		/// </summary>
+		/// <param name="root">Entity the parsed attributes and children are added to.</param>
+		/// <param name="documents">JSON documents to be parsed.</param>
+		void LoadDocuments(Entity& root, const Vector<std::string>& documents);
+
+		/// <summary>
+		/// Moves the children and attributes of a staging Entity into the root Entity.
+		/// </summary>
+		/// <param name="root">Entity receiving the parsed data.</param>
+		/// <param name="staging">Entity a worker parsed into.</param>
+		static void Splice(Entity& root, Entity& staging);
+#pragma endregion Helper Methods
+
+#pragma region Data Members
+	private:
+		/// <summary>
+		/// JsonParseMaster cloned by each worker.
+		/// </summary>
+		const JsonParseMaster& mMaster;
+
+		/// <summary>
+		/// Maximum number of worker threads.
+		/// </summary>
+		std::size_t mThreadCount;
+#pragma endregion Data Members
+	};
+}
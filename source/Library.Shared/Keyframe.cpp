@@ -64,17 +64,25 @@ namespace Library
 
 	void Keyframe::Save(OutputStreamHelper& streamHelper) const
 	{
-		streamHelper << mTime;
-		streamHelper << mTranslation.x << mTranslation.y << mTranslation.z;
-		streamHelper << mRotationQuaternion.x << mRotationQuaternion.y << mRotationQuaternion.z << mRotationQuaternion.w;
-		streamHelper << mScale.x << mScale.y << mScale.z;
+		const float values[SerializedFloatCount] =
+		{
+			mTime,
+			mTranslation.x, mTranslation.y, mTranslation.z,
+			mRotationQuaternion.x, mRotationQuaternion.y, mRotationQuaternion.z, mRotationQuaternion.w,
+			mScale.x, mScale.y, mScale.z
+		};
+
+		streamHelper.WriteArray(gsl::span<const float>(values));
 	}
 
 	void Keyframe::Load(InputStreamHelper& streamHelper)
 	{
-		streamHelper >> mTime;
-		streamHelper >> mTranslation.x >> mTranslation.y >> mTranslation.z;
-		streamHelper >> mRotationQuaternion.x >> mRotationQuaternion.y >> mRotationQuaternion.z >> mRotationQuaternion.w;
-		streamHelper >> mScale.x >> mScale.y >> mScale.z;
+		float values[SerializedFloatCount];
+		streamHelper.ReadArray(gsl::span<float>(values));
+
+		mTime = values[0];
+		mTranslation = glm::vec3(values[1], values[2], values[3]);
+		mRotationQuaternion = glm::quat(values[7], values[4], values[5], values[6]);
+		mScale = glm::vec3(values[8], values[9], values[10]);
 	}
 }
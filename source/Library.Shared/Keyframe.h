@@ -9,6 +9,11 @@ namespace Library
     class Keyframe final
     {
     public:
+		/// <summary>
+		/// Number of floats a keyframe is saved as: its time, translation, rotation quaternion (x, y, z, w) and scale.
+		/// </summary>
+		inline static constexpr std::uint32_t SerializedFloatCount = 11;
+
 		Keyframe() = delete;
     	~Keyframe() = default;
 		Keyframe(const Keyframe&) = default;
@@ -4,8 +4,19 @@
 
 // Header
 #include "MathUtility.h"
+
+// Standard
+#include <cmath>
 #pragma endregion Includes
 
+namespace
+{
+	// Range of the three smallest components of a unit quaternion is [-1/sqrt(2), 1/sqrt(2)].
+	constexpr float SmallestComponentRange = 0.707106781f;
+	constexpr float QuantizedMaximum = 32767.0f;
+	constexpr std::uint16_t ComponentMask = 0x7FFF;
+}
+
 namespace Library::Math
 {
 	bool IsPrime(const std::size_t value)
@@ -32,4 +43,61 @@ namespace Library::Math
 		while (!IsPrime(++prime));
 		return prime;
 	}
+
+	PackedQuaternion PackQuaternion(const glm::quat& quaternion)
+	{
+		const float components[] = { quaternion.x, quaternion.y, quaternion.z, quaternion.w };
+
+		std::uint32_t largestIndex = 0;
+		for (std::uint32_t i = 1; i < 4; ++i)
+		{
+			if (std::abs(components[i]) > std::abs(components[largestIndex]))
+			{
+				largestIndex = i;
+			}
+		}
+
+		// q and -q are the same rotation, so the largest component is made positive and left implicit.
+		const float sign = (components[largestIndex] < 0.0f ? -1.0f : 1.0f);
+
+		PackedQuaternion packedQuaternion;
+		std::uint32_t bitIndex = 0;
+
+		for (std::uint32_t i = 0; i < 4; ++i)
+		{
+			if (i != largestIndex)
+			{
+				const float normalized = (std::clamp(components[i] * sign / SmallestComponentRange, -1.0f, 1.0f) + 1.0f) * 0.5f;
+				packedQuaternion.Bits[bitIndex++] = static_cast<std::uint16_t>(std::lround(normalized * QuantizedMaximum));
+			}
+		}
+
+		packedQuaternion.Bits[0] |= static_cast<std::uint16_t>((largestIndex & 1U) << 15);
+		packedQuaternion.Bits[1] |= static_cast<std::uint16_t>((largestIndex >> 1) << 15);
+
+		return packedQuaternion;
+	}
+
+	glm::quat UnpackQuaternion(const PackedQuaternion& packedQuaternion)
+	{
+		const std::uint32_t largestIndex = (packedQuaternion.Bits[0] >> 15) | ((packedQuaternion.Bits[1] >> 15) << 1);
+
+		float components[4];
+		float sumOfSquares = 0.0f;
+		std::uint32_t bitIndex = 0;
+
+		for (std::uint32_t i = 0; i < 4; ++i)
+		{
+			if (i != largestIndex)
+			{
+				const float normalized = (packedQuaternion.Bits[bitIndex++] & ComponentMask) / QuantizedMaximum;
+				components[i] = (normalized * 2.0f - 1.0f) * SmallestComponentRange;
+				sumOfSquares += components[i] * components[i];
+			}
+		}
+
+		components[largestIndex] = std::sqrt(std::max(0.0f, 1.0f - sumOfSquares));
+
+		return glm::quat(components[3], components[0], components[1], components[2]);
+	}
 }
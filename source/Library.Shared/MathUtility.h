@@ -2,6 +2,13 @@
 
 // Standard
 #include <cstddef>
+#include <cstdint>
+
+// Third Party
+#pragma warning(disable : 4201)
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+#pragma warning(default : 4201)
 
 namespace Library::Math
 {
@@ -17,4 +24,27 @@ namespace Library::Math
 	/// <param name="value">Number to start from when finding the next prime number.</param>
 	/// <returns>Prime number greater than the given value.</returns>
 	std::size_t FindNextPrime(const std::size_t value);
+
+	/// <summary>
+	/// Unit quaternion packed into 48 bits with the smallest three encoding.
+	/// The three smallest components are quantized to 15 bits each, and the index of the largest component is split across the spare high bits.
+	/// </summary>
+	struct PackedQuaternion final
+	{
+		std::uint16_t Bits[3];
+	};
+
+	/// <summary>
+	/// Packs a unit quaternion. Each reconstructed component is within 1e-4 of the original.
+	/// </summary>
+	/// <param name="quaternion">Unit quaternion to pack.</param>
+	/// <returns>Packed quaternion, representing the same rotation.</returns>
+	PackedQuaternion PackQuaternion(const glm::quat& quaternion);
+
+	/// <summary>
+	/// Unpacks a quaternion, rebuilding the largest component from the other three.
+	/// </summary>
+	/// <param name="packedQuaternion">Packed quaternion.</param>
+	/// <returns>Unit quaternion, with a positive largest component.</returns>
+	glm::quat UnpackQuaternion(const PackedQuaternion& packedQuaternion);
 }
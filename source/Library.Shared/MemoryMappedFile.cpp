@@ -0,0 +1,146 @@
+#pragma region Includes
+// Pre-compiled Header
+#include "pch.h"
+
+// Header
+#include "MemoryMappedFile.h"
+
+// Platform
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+#pragma endregion Includes
+
+using namespace std::string_literals;
+
+namespace Library
+{
+#pragma region Special Members
+	MemoryMappedFile::MemoryMappedFile(const std::string& filename)
+	{
+		Open(filename);
+	}
+
+	MemoryMappedFile::~MemoryMappedFile()
+	{
+		Close();
+	}
+
+	MemoryMappedFile::MemoryMappedFile(MemoryMappedFile&& rhs) noexcept :
+		mData(rhs.mData), mSize(rhs.mSize), mIsOpen(rhs.mIsOpen)
+	{
+		rhs.mData = nullptr;
+		rhs.mSize = 0;
+		rhs.mIsOpen = false;
+	}
+
+	MemoryMappedFile& MemoryMappedFile::operator=(MemoryMappedFile&& rhs) noexcept
+	{
+		if (this != &rhs)
+		{
+			Close();
+
+			mData = rhs.mData;
+			mSize = rhs.mSize;
+			mIsOpen = rhs.mIsOpen;
+
+			rhs.mData = nullptr;
+			rhs.mSize = 0;
+			rhs.mIsOpen = false;
+		}
+
+		return *this;
+	}
+#pragma endregion Special Members
+
+#pragma region Modifiers
+	void MemoryMappedFile::Open(const std::string& filename)
+	{
+		Close();
+
+		const auto error = [&filename]() { return std::runtime_error("Could not map \""s + filename + "\"."s); };
+
+		// The view keeps the mapping alive, so the file and mapping handles are closed as soon as it exists.
+#if defined(_WIN32)
+		const HANDLE file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+		if (file == INVALID_HANDLE_VALUE) throw error();
+
+		LARGE_INTEGER size;
+
+		if (!GetFileSizeEx(file, &size))
+		{
+			CloseHandle(file);
+			throw error();
+		}
+
+		if (size.QuadPart > 0)
+		{
+			const HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+			CloseHandle(file);
+			if (mapping == nullptr) throw error();
+
+			const void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+			CloseHandle(mapping);
+			if (view == nullptr) throw error();
+
+			mData = static_cast<const std::byte*>(view);
+			mSize = static_cast<std::size_t>(size.QuadPart);
+		}
+		else
+		{
+			CloseHandle(file);
+		}
+#else
+		const int descriptor = open(filename.c_str(), O_RDONLY);
+		if (descriptor < 0) throw error();
+
+		struct stat status;
+
+		if (fstat(descriptor, &status) != 0)
+		{
+			close(descriptor);
+			throw error();
+		}
+
+		if (status.st_size > 0)
+		{
+			void* view = mmap(nullptr, static_cast<std::size_t>(status.st_size), PROT_READ, MAP_PRIVATE, descriptor, 0);
+			close(descriptor);
+			if (view == MAP_FAILED) throw error();
+
+			mData = static_cast<const std::byte*>(view);
+			mSize = static_cast<std::size_t>(status.st_size);
+		}
+		else
+		{
+			close(descriptor);
+		}
+#endif
+
+		mIsOpen = true;
+	}
+
+	void MemoryMappedFile::Close()
+	{
+		if (mData != nullptr)
+		{
+#if defined(_WIN32)
+			UnmapViewOfFile(mData);
+#else
+			munmap(const_cast<std::byte*>(mData), mSize);
+#endif
+		}
+
+		mData = nullptr;
+		mSize = 0;
+		mIsOpen = false;
+	}
+#pragma endregion Modifiers
+}
@@ -0,0 +1,116 @@
+#pragma once
+
+#pragma region Includes
+// Standard
+#include <cstddef>
+#include <string>
+
+// Third Party
+#include <gsl/gsl>
+#pragma endregion Includes
+
+namespace Library
+{
+	/// <summary>
+	/// Read only view of an entire file mapped into memory.
+	/// </summary>
+	/// <remarks>
+	/// Pages are loaded by the operating system as they are first touched, so opening a file does not read it.
+	/// The view begins on a page boundary.
+	/// </remarks>
+	class MemoryMappedFile final
+	{
+#pragma region Special Members
+	public:
+		/// <summary>
+		/// Default constructor.
+		/// </summary>
+		MemoryMappedFile() = default;
+
+		/// <summary>
+		/// Specialized constructor for mapping a file.
+		/// </summary>
+		/// <param name="filename">Filename of the file to be mapped.</param>
+		/// <exception cref="std::runtime_error">File could not be opened or mapped.</exception>
+		explicit MemoryMappedFile(const std::string& filename);
+
+		/// <summary>
+		/// Destructor. Unmaps the file, if open.
+		/// </summary>
+		~MemoryMappedFile();
+
+		MemoryMappedFile(const MemoryMappedFile&) = delete;
+		MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+
+		/// <summary>
+		/// Move constructor.
+		/// </summary>
+		/// <param name="rhs">MemoryMappedFile to be moved.</param>
+		MemoryMappedFile(MemoryMappedFile&& rhs) noexcept;
+
+		/// <summary>
+		/// Move assignment operator.
+		/// </summary>
+		/// <param name="rhs">MemoryMappedFile to be moved.</param>
+		/// <returns>Reference to the moved MemoryMappedFile.</returns>
+		MemoryMappedFile& operator=(MemoryMappedFile&& rhs) noexcept;
+#pragma endregion Special Members
+
+#pragma region Accessors
+	public:
+		/// <summary>
+		/// Gets whether a file is mapped.
+		/// </summary>
+		/// <returns>True if a file is mapped. Otherwise, false.</returns>
+		bool IsOpen() const;
+
+		/// <summary>
+		/// Gets the mapped contents of the file.
+		/// </summary>
+		/// <returns>Span over the file contents. Empty if no file is mapped.</returns>
+		gsl::span<const std::byte> Data() const;
+
+		/// <summary>
+		/// Gets the size of the mapped file.
+		/// </summary>
+		/// <returns>Size of the file in bytes.</returns>
+		std::size_t Size() const;
+#pragma endregion Accessors
+
+#pragma region Modifiers
+	public:
+		/// <summary>
+		/// Maps a file, unmapping any file already mapped.
+		/// </summary>
+		/// <param name="filename">Filename of the file to be mapped.</param>
+		/// <exception cref="std::runtime_error">File could not be opened or mapped.</exception>
+		void Open(const std::string& filename);
+
+		/// <summary>
+		/// Unmaps the file, if open.
+		/// </summary>
+		void Close();
+#pragma endregion Modifiers
+
+#pragma region Data Members
+	private:
+		/// <summary>
+		/// Start of the mapped view.
+		/// </summary>
+		const std::byte* mData{ nullptr };
+
+		/// <summary>
+		/// Size of the mapped view in bytes.
+		/// </summary>
+		std::size_t mSize{ 0 };
+
+		/// <summary>
+		/// Whether a file is mapped. An empty file is open without a view.
+		/// </summary>
+		bool mIsOpen{ false };
+#pragma endregion Data Members
+	};
+}
+
+// Inline File
+#include "MemoryMappedFile.inl"
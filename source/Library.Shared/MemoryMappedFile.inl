@@ -0,0 +1,24 @@
+#pragma once
+
+// Header
+#include "MemoryMappedFile.h"
+
+namespace Library
+{
+#pragma region Accessors
+	inline bool MemoryMappedFile::IsOpen() const
+	{
+		return mIsOpen;
+	}
+
+	inline gsl::span<const std::byte> MemoryMappedFile::Data() const
+	{
+		return gsl::span<const std::byte>(mData, mSize);
+	}
+
+	inline std::size_t MemoryMappedFile::Size() const
+	{
+		return mSize;
+	}
+#pragma endregion Accessors
+}
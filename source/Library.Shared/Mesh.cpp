@@ -5,13 +5,92 @@
 // Header
 #include "Mesh.h"
 
+// Standard
+#include <cstring>
+
+// Third Party
+#include <glm/gtc/packing.hpp>
+
 // First Party
 #include "StreamHelper.h"
+#include "VertexFormat.h"
 #include "ModelMaterial.h"
 #include "Model.h"
 #include "Bone.h"
 #pragma endregion Includes
 
+namespace
+{
+	template <typename T>
+	gsl::span<const T> MakeSpan(const Library::Vector<T>& vector)
+	{
+		return vector.IsEmpty() ? gsl::span<const T>() : gsl::span<const T>(&vector[0], vector.Size());
+	}
+
+	// Vertices converted per block, so the block's interleaved output stays in cache while each of its elements is written.
+	constexpr std::size_t InterleaveBlockSize = 1024;
+
+	glm::u8vec4 PackWeights8(const glm::vec4& weights)
+	{
+		// Rounding may leave the quantized weights off by one from the maximum, so the largest weight takes up the difference.
+		glm::ivec4 quantized = glm::ivec4(glm::round(glm::clamp(weights, 0.0f, 1.0f) * 255.0f));
+		const int sum = quantized.x + quantized.y + quantized.z + quantized.w;
+
+		if (sum > 0)
+		{
+			int largest = 0;
+			for (int i = 1; i < 4; ++i)
+			{
+				if (quantized[i] > quantized[largest]) largest = i;
+			}
+
+			quantized[largest] += 255 - sum;
+		}
+
+		return glm::u8vec4(quantized);
+	}
+
+	template <typename TFetch>
+	void WriteElement(const Library::VertexElement& element, std::byte* vertices, const std::size_t stride, const std::size_t first, const std::size_t count, TFetch fetch)
+	{
+		using namespace Library;
+
+		std::byte* destination = vertices + first * stride + element.Offset;
+
+		const auto writeRun = [&destination, stride, first, count, &fetch](auto pack)
+		{
+			for (std::size_t i = first; i < first + count; ++i, destination += stride)
+			{
+				const auto value = pack(fetch(i));
+				std::memcpy(destination, &value, sizeof(value));
+			}
+		};
+
+		if (element.Semantic == VertexSemantic::BoneWeights && element.Format == VertexElementFormat::UNorm8x4)
+		{
+			writeRun(PackWeights8);
+			return;
+		}
+
+		switch (element.Format)
+		{
+		case VertexElementFormat::Float2:		writeRun([](const glm::vec4& value) { return glm::vec2(value); }); break;
+		case VertexElementFormat::Float3:		writeRun([](const glm::vec4& value) { return glm::vec3(value); }); break;
+		case VertexElementFormat::Float4:		writeRun([](const glm::vec4& value) { return value; }); break;
+		case VertexElementFormat::Half2:		writeRun([](const glm::vec4& value) { return glm::packHalf2x16(glm::vec2(value)); }); break;
+		case VertexElementFormat::Half4:		writeRun([](const glm::vec4& value) { return glm::packHalf4x16(value); }); break;
+		case VertexElementFormat::SNorm8x4:		writeRun([](const glm::vec4& value) { return glm::packSnorm4x8(value); }); break;
+		case VertexElementFormat::SNorm16x4:	writeRun([](const glm::vec4& value) { return glm::packSnorm4x16(value); }); break;
+		case VertexElementFormat::UNorm8x4:		writeRun([](const glm::vec4& value) { return glm::packUnorm4x8(value); }); break;
+		case VertexElementFormat::UNorm16x2:	writeRun([](const glm::vec4& value) { return glm::packUnorm2x16(glm::vec2(value)); }); break;
+		case VertexElementFormat::UNorm16x4:	writeRun([](const glm::vec4& value) { return glm::packUnorm4x16(value); }); break;
+		case VertexElementFormat::UInt8x4:		writeRun([](const glm::vec4& value) { return glm::u8vec4(value); }); break;
+		case VertexElementFormat::UInt16x4:		writeRun([](const glm::vec4& value) { return glm::u16vec4(value); }); break;
+		default:								break;
+		}
+	}
+}
+
 namespace Library
 {
 	Mesh::Mesh(Model& model, InputStreamHelper& streamHelper) :
@@ -23,6 +102,42 @@ namespace Library
 	Mesh::Mesh(Model& model, MeshData&& meshData) :
 		mModel(&model), mData(std::move(meshData))
 	{
+		FlattenBoneWeights();
+		BindStreams();
+	}
+
+	Mesh::Mesh(Model& model, MeshData&& meshData, MeshStreams&& streams, std::shared_ptr<const MemoryMappedFile> mappedFile) :
+		mModel(&model), mData(std::move(meshData)), mStreams(std::move(streams)), mMappedFile(std::move(mappedFile))
+	{
+	}
+
+	Mesh::Mesh(const Mesh& rhs) :
+		mModel(rhs.mModel), mData(rhs.mData), mBoneWeightOffsets(rhs.mBoneWeightOffsets), mBoneWeights(rhs.mBoneWeights), mStreams(rhs.mStreams), mMappedFile(rhs.mMappedFile)
+	{
+		if (mMappedFile == nullptr)
+		{
+			BindStreams();
+		}
+	}
+
+	Mesh& Mesh::operator=(const Mesh& rhs)
+	{
+		if (this != &rhs)
+		{
+			mModel = rhs.mModel;
+			mData = rhs.mData;
+			mBoneWeightOffsets = rhs.mBoneWeightOffsets;
+			mBoneWeights = rhs.mBoneWeights;
+			mStreams = rhs.mStreams;
+			mMappedFile = rhs.mMappedFile;
+
+			if (mMappedFile == nullptr)
+			{
+				BindStreams();
+			}
+		}
+
+		return *this;
 	}
 
 	Model& Mesh::GetModel()
@@ -50,34 +165,34 @@ namespace Library
 		return mData.Name;
 	}
 
-	const Vector<glm::vec3>& Mesh::Vertices() const
+	gsl::span<const glm::vec3> Mesh::Vertices() const
 	{
-		return mData.Vertices;
+		return mStreams.Vertices;
 	}
 
-	const Vector<glm::vec3>& Mesh::Normals() const
+	gsl::span<const glm::vec3> Mesh::Normals() const
 	{
-		return mData.Normals;
+		return mStreams.Normals;
 	}
 
-	const Vector<glm::vec3>& Mesh::Tangents() const
+	gsl::span<const glm::vec3> Mesh::Tangents() const
 	{
-		return mData.Tangents;
+		return mStreams.Tangents;
 	}
 
-	const Vector<glm::vec3>& Mesh::BiNormals() const
+	gsl::span<const glm::vec3> Mesh::BiNormals() const
 	{
-		return mData.BiNormals;
+		return mStreams.BiNormals;
 	}
 
-	const Vector<Vector<glm::vec3>>& Mesh::TextureCoordinates() const
+	const Vector<gsl::span<const glm::vec3>>& Mesh::TextureCoordinates() const
 	{
-		return mData.TextureCoordinates;
+		return mStreams.TextureCoordinates;
 	}
 
-	const Vector<Vector<glm::vec4>>& Mesh::VertexColors() const
+	const Vector<gsl::span<const glm::vec4>>& Mesh::VertexColors() const
 	{
-		return mData.VertexColors;
+		return mStreams.VertexColors;
 	}
 
 	uint32_t Mesh::FaceCount() const
@@ -85,88 +200,212 @@ namespace Library
 		return mData.FaceCount;
 	}
 
-	const Vector<uint32_t>& Mesh::Indices() const
+	gsl::span<const uint32_t> Mesh::Indices() const
 	{
-		return mData.Indices;
+		return mStreams.Indices;
 	}
 
-	const Vector<BoneVertexWeights>& Mesh::BoneWeights() const
+	bool Mesh::HasBoneWeights() const
 	{
-		return mData.BoneWeights;
+		return !mStreams.BoneWeightOffsets.empty();
 	}
 
-	void Mesh::Save(OutputStreamHelper& streamHelper) const
+	gsl::span<const BoneVertexWeights::VertexWeight> Mesh::BoneWeights(const std::size_t vertexIndex) const
 	{
-		const std::string materialName = (mData.Material != nullptr ? mData.Material->Name() : "");
-		streamHelper << materialName;
+		const std::uint32_t first = mStreams.BoneWeightOffsets[vertexIndex];
+		return mStreams.BoneWeights.subspan(first, mStreams.BoneWeightOffsets[vertexIndex + 1] - first);
+	}
 
-		// Serialize name
-		streamHelper << mData.Name;
+	const MeshStreams& Mesh::Streams() const
+	{
+		return mStreams;
+	}
+
+	bool Mesh::IsMapped() const
+	{
+		return mMappedFile != nullptr;
+	}
+
+	void Mesh::Interleave(const VertexFormat& format, gsl::span<std::byte> vertices) const
+	{
+		const std::size_t vertexCount = mStreams.Vertices.size();
+		const std::size_t stride = format.Stride();
 
-		// Serialize vertices
-		streamHelper << gsl::narrow_cast<uint32_t>(mData.Vertices.Size());
-		for (const glm::vec3& vertex : mData.Vertices)
+		if (vertices.size() < vertexCount * stride)
 		{
-			streamHelper << vertex.x << vertex.y << vertex.z;
+			throw std::runtime_error("Vertex buffer is too small.");
 		}
 
-		// Serialize normals
-		streamHelper << gsl::narrow_cast<uint32_t>(mData.Normals.Size());
-		for (const glm::vec3& normal : mData.Normals)
+		if (vertexCount == 0) return;
+
+		const bool hasBoneWeights = mStreams.BoneWeightOffsets.size() > vertexCount;
+
+		// Bone indices are range checked once up front, rather than per vertex.
+		for (const VertexElement& element : format.Elements())
 		{
-			streamHelper << normal.x << normal.y << normal.z;
+			if (element.Semantic == VertexSemantic::BoneIndices && element.Format != VertexElementFormat::Float4 && hasBoneWeights)
+			{
+				const std::uint32_t maxBoneIndex = (element.Format == VertexElementFormat::UInt8x4 ? 0xFFU : 0xFFFFU);
+				for (const BoneVertexWeights::VertexWeight& weight : mStreams.BoneWeights)
+				{
+					if (weight.BoneIndex > maxBoneIndex) throw std::runtime_error("Bone index does not fit the vertex format.");
+				}
+			}
 		}
 
-		// Serialize tangents
-		streamHelper << gsl::narrow_cast<uint32_t>(mData.Tangents.Size());
-		for (const glm::vec3& tangents : mData.Tangents)
+		const std::uint32_t* weightOffsets = mStreams.BoneWeightOffsets.data();
+		const BoneVertexWeights::VertexWeight* weights = mStreams.BoneWeights.data();
+
+		const auto boneIndices = [weightOffsets, weights](const std::size_t i)
+		{
+			glm::vec4 indices(0.0f);
+			for (std::uint32_t weight = weightOffsets[i], j = 0; weight < weightOffsets[i + 1] && j < BoneVertexWeights::MaxBoneWeightsPerVertex; ++weight, ++j)
+			{
+				indices[j] = static_cast<float>(weights[weight].BoneIndex);
+			}
+
+			return indices;
+		};
+
+		const auto boneWeights = [weightOffsets, weights](const std::size_t i)
 		{
-			streamHelper << tangents.x << tangents.y << tangents.z;
+			glm::vec4 values(0.0f);
+			for (std::uint32_t weight = weightOffsets[i], j = 0; weight < weightOffsets[i + 1] && j < BoneVertexWeights::MaxBoneWeightsPerVertex; ++weight, ++j)
+			{
+				values[j] = weights[weight].Weight;
+			}
+
+			const float sum = values.x + values.y + values.z + values.w;
+			return (sum > 0.0f ? values / sum : values);
+		};
+
+		const auto zero = [](const std::size_t) { return glm::vec4(0.0f); };
+
+		for (std::size_t first = 0; first < vertexCount; first += InterleaveBlockSize)
+		{
+			const std::size_t count = std::min(InterleaveBlockSize, vertexCount - first);
+
+			for (const VertexElement& element : format.Elements())
+			{
+				const auto write = [&element, &vertices, stride, first, count](auto fetch)
+				{
+					WriteElement(element, vertices.data(), stride, first, count, fetch);
+				};
+
+				const auto writeVectors = [&write, &zero, vertexCount](gsl::span<const glm::vec3> stream, const float w)
+				{
+					const glm::vec3* source = stream.data();
+					if (stream.size() < vertexCount) write(zero);
+					else write([source, w](const std::size_t i) { return glm::vec4(source[i], w); });
+				};
+
+				switch (element.Semantic)
+				{
+				case VertexSemantic::Position:
+					writeVectors(mStreams.Vertices, 1.0f);
+					break;
+
+				case VertexSemantic::Normal:
+					writeVectors(mStreams.Normals, 0.0f);
+					break;
+
+				case VertexSemantic::Tangent:
+					writeVectors(mStreams.Tangents, 0.0f);
+					break;
+
+				case VertexSemantic::BiNormal:
+					writeVectors(mStreams.BiNormals, 0.0f);
+					break;
+
+				case VertexSemantic::TextureCoordinate:
+					writeVectors(element.Channel < mStreams.TextureCoordinates.Size() ? mStreams.TextureCoordinates[element.Channel] : gsl::span<const glm::vec3>(), 0.0f);
+					break;
+
+				case VertexSemantic::Color:
+				{
+					const auto stream = (element.Channel < mStreams.VertexColors.Size() ? mStreams.VertexColors[element.Channel] : gsl::span<const glm::vec4>());
+					const glm::vec4* source = stream.data();
+					if (stream.size() < vertexCount) write(zero);
+					else write([source](const std::size_t i) { return source[i]; });
+					break;
+				}
+
+				case VertexSemantic::BoneIndices:
+					if (hasBoneWeights) write(boneIndices);
+					else write(zero);
+					break;
+
+				case VertexSemantic::BoneWeights:
+					if (hasBoneWeights) write(boneWeights);
+					else write(zero);
+					break;
+
+				default:
+					break;
+				}
+			}
 		}
+	}
 
-		// Serialize bi-normals
-		streamHelper << gsl::narrow_cast<uint32_t>(mData.BiNormals.Size());
-		for (const glm::vec3& biNormal : mData.BiNormals)
+	Vector<std::byte> Mesh::Interleave(const VertexFormat& format) const
+	{
+		Vector<std::byte> vertices;
+		vertices.Resize(mStreams.Vertices.size() * format.Stride());
+
+		if (!vertices.IsEmpty())
 		{
-			streamHelper << biNormal.x << biNormal.y << biNormal.z;
+			Interleave(format, gsl::span<std::byte>(&vertices[0], vertices.Size()));
 		}
 
+		return vertices;
+	}
+
+	void Mesh::Save(OutputStreamHelper& streamHelper) const
+	{
+		const std::string materialName = (mData.Material != nullptr ? mData.Material->Name() : "");
+		streamHelper << materialName;
+
+		// Serialize name
+		streamHelper << mData.Name;
+
+		// Serialize vertex attributes
+		const auto writeStream = [&streamHelper](const auto& stream)
+		{
+			streamHelper << gsl::narrow_cast<uint32_t>(stream.size());
+			streamHelper.WriteArray(stream);
+		};
+
+		writeStream(mStreams.Vertices);
+		writeStream(mStreams.Normals);
+		writeStream(mStreams.Tangents);
+		writeStream(mStreams.BiNormals);
+
 		// Serialize texture coordinates
-		streamHelper << gsl::narrow_cast<uint32_t>(mData.TextureCoordinates.Size());
-		for (const auto& uvList : mData.TextureCoordinates)
+		streamHelper << gsl::narrow_cast<uint32_t>(mStreams.TextureCoordinates.Size());
+		for (const auto& uvList : mStreams.TextureCoordinates)
 		{
-			streamHelper << gsl::narrow_cast<uint32_t>(uvList.Size());
-			for (const glm::vec3& uv : uvList)
-			{
-				streamHelper << uv.x << uv.y << uv.z;
-			}
+			writeStream(uvList);
 		}
 
 		// Serialize vertex colors
-		streamHelper << gsl::narrow_cast<uint32_t>(mData.VertexColors.Size());
-		for (const auto& vertexColorList : mData.VertexColors)
+		streamHelper << gsl::narrow_cast<uint32_t>(mStreams.VertexColors.Size());
+		for (const auto& vertexColorList : mStreams.VertexColors)
 		{
-			streamHelper << vertexColorList.Size();
-			for (const glm::vec4& vertexColor : vertexColorList)
-			{
-				streamHelper << vertexColor.x << vertexColor.y << vertexColor.z << vertexColor.w;
-			}
+			writeStream(vertexColorList);
 		}
 
 		// Serialize indices
 		streamHelper << mData.FaceCount;
-		streamHelper << gsl::narrow_cast<uint32_t>(mData.Indices.Size());
-		for (const uint32_t& index : mData.Indices)
-		{
-			streamHelper << index;
-		}
+		writeStream(mStreams.Indices);
 
 		// Serialize bone weights
-		streamHelper << gsl::narrow_cast<uint32_t>(mData.BoneWeights.Size());
-		for (const BoneVertexWeights& boneVertexWeight : mData.BoneWeights)
+		const std::size_t boneWeightVertexCount = (HasBoneWeights() ? mStreams.BoneWeightOffsets.size() - 1 : 0);
+		streamHelper << gsl::narrow_cast<uint32_t>(boneWeightVertexCount);
+		for (std::size_t i = 0; i < boneWeightVertexCount; ++i)
 		{
-			streamHelper << gsl::narrow_cast<uint32_t>(boneVertexWeight.Weights().Size());
-			for (const BoneVertexWeights::VertexWeight& weight : boneVertexWeight.Weights())
+			const auto weights = BoneWeights(i);
+			streamHelper << gsl::narrow_cast<uint32_t>(weights.size());
+			for (const BoneVertexWeights::VertexWeight& weight : weights)
 			{
 				streamHelper << weight.Weight << weight.BoneIndex;
 			}
@@ -193,57 +432,11 @@ namespace Library
 		// Deserialize name
 		streamHelper >> mData.Name;
 
-		// Deserialize vertices
-		{
-			uint32_t vertexCount;
-			streamHelper >> vertexCount;
-			mData.Vertices.Reserve(vertexCount);
-			for (uint32_t i = 0; i < vertexCount; i++)
-			{
-				glm::vec3 vertex;
-				streamHelper >> vertex.x >> vertex.y >> vertex.z;
-				mData.Vertices.EmplaceBack(vertex);
-			}
-		}
-
-		// Deserialize normals
-		{
-			uint32_t normalCount;
-			streamHelper >> normalCount;
-			mData.Normals.Reserve(normalCount);
-			for (uint32_t i = 0; i < normalCount; i++)
-			{
-				glm::vec3 normal;
-				streamHelper >> normal.x >> normal.y >> normal.z;
-				mData.Normals.EmplaceBack(normal);
-			}
-		}
-
-		// Deserialize tangents
-		{
-			uint32_t tangentCount;
-			streamHelper >> tangentCount;
-			mData.Tangents.Reserve(tangentCount);
-			for (uint32_t i = 0; i < tangentCount; i++)
-			{
-				glm::vec3 tangent;
-				streamHelper >> tangent.x >> tangent.y >> tangent.z;
-				mData.Tangents.EmplaceBack(tangent);
-			}
-		}
-
-		// Deserialize bi-normals
-		{
-			uint32_t biNormalCount;
-			streamHelper >> biNormalCount;
-			mData.BiNormals.Reserve(biNormalCount);
-			for (uint32_t i = 0; i < biNormalCount; i++)
-			{
-				glm::vec3 biNormal;
-				streamHelper >> biNormal.x >> biNormal.y >> biNormal.z;
-				mData.BiNormals.EmplaceBack(biNormal);
-			}
-		}
+		// Deserialize vertex attributes
+		streamHelper.ReadArray(mData.Vertices);
+		streamHelper.ReadArray(mData.Normals);
+		streamHelper.ReadArray(mData.Tangents);
+		streamHelper.ReadArray(mData.BiNormals);
 
 		// Deserialize texture coordinates
 		{
@@ -252,19 +445,10 @@ namespace Library
 			mData.TextureCoordinates.Reserve(textureCoordinateCount);
 			for (uint32_t i = 0; i < textureCoordinateCount; i++)
 			{
-				uint32_t uvListCount;
-				streamHelper >> uvListCount;
-				if (uvListCount > 0)
+				Vector<glm::vec3> uvs;
+				streamHelper.ReadArray(uvs);
+				if (!uvs.IsEmpty())
 				{
-					Vector<glm::vec3> uvs;
-					uvs.Reserve(uvListCount);
-					for (uint32_t j = 0; j < uvListCount; j++)
-					{
-						glm::vec3 uv;
-						streamHelper >> uv.x >> uv.y >> uv.z;
-						uvs.EmplaceBack(uv);
-					}
-
 					mData.TextureCoordinates.EmplaceBack(std::move(uvs));
 				}
 			}
@@ -277,19 +461,10 @@ namespace Library
 			mData.VertexColors.Reserve(vertexColorCount);
 			for (uint32_t i = 0; i < vertexColorCount; i++)
 			{
-				uint32_t vertexColorListCount;
-				streamHelper >> vertexColorListCount;
-				if (vertexColorListCount > 0)
+				Vector<glm::vec4> vertexColors;
+				streamHelper.ReadArray(vertexColors);
+				if (!vertexColors.IsEmpty())
 				{
-					Vector<glm::vec4> vertexColors;
-					vertexColors.Reserve(vertexColorListCount);
-					for (uint32_t j = 0; j < vertexColorListCount; j++)
-					{
-						glm::vec4 vertexColor;
-						streamHelper >> vertexColor.x >> vertexColor.y >> vertexColor.z >> vertexColor.w;
-						vertexColors.EmplaceBack(vertexColor);
-					}
-
 					mData.VertexColors.EmplaceBack(std::move(vertexColors));
 				}
 			}
@@ -298,36 +473,89 @@ namespace Library
 		// Deserialize indexes	
 		{
 			streamHelper >> mData.FaceCount;
-			uint32_t indexCount;
-			streamHelper >> indexCount;
-			mData.Indices.Reserve(indexCount);
-			for (uint32_t i = 0; i < indexCount; i++)
-			{
-				uint32_t index;
-				streamHelper >> index;
-				mData.Indices.EmplaceBack(index);
-			}
+			streamHelper.ReadArray(mData.Indices);
 		}
 
 		// Deserialize bone weights
 		{
 			uint32_t boneVertexWeightCount;
 			streamHelper >> boneVertexWeightCount;
-			mData.BoneWeights.Resize(boneVertexWeightCount);
-			for (uint32_t i = 0; i < boneVertexWeightCount; i++)
+			if (boneVertexWeightCount > 0)
 			{
-				uint32_t weightCount;
-				streamHelper >> weightCount;
-				mData.BoneWeights.Reserve(weightCount);
-				for (uint32_t j = 0; j < weightCount; j++)
+				mBoneWeightOffsets.Reserve(std::size_t(boneVertexWeightCount) + 1);
+				mBoneWeights.Reserve(boneVertexWeightCount);
+
+				for (uint32_t i = 0; i < boneVertexWeightCount; i++)
 				{
-					float weight;
-					uint32_t boneIndex;
-					streamHelper >> weight >> boneIndex;
+					mBoneWeightOffsets.EmplaceBack(gsl::narrow_cast<uint32_t>(mBoneWeights.Size()));
+
+					uint32_t weightCount;
+					streamHelper >> weightCount;
+					if (weightCount > BoneVertexWeights::MaxBoneWeightsPerVertex)
+					{
+						throw std::runtime_error("Maximum number of bone weights per vertex exceeded.");
+					}
+
+					for (uint32_t j = 0; j < weightCount; j++)
+					{
+						float weight;
+						uint32_t boneIndex;
+						streamHelper >> weight >> boneIndex;
 
-					mData.BoneWeights[i].AddWeight(weight, boneIndex);
+						mBoneWeights.EmplaceBack(weight, boneIndex);
+					}
 				}
+
+				mBoneWeightOffsets.EmplaceBack(gsl::narrow_cast<uint32_t>(mBoneWeights.Size()));
 			}
 		}
+
+		BindStreams();
+	}
+
+	void Mesh::FlattenBoneWeights()
+	{
+		if (mData.BoneWeights.IsEmpty()) return;
+
+		mBoneWeightOffsets.Reserve(mData.BoneWeights.Size() + 1);
+		mBoneWeights.Reserve(mData.BoneWeights.Size());
+
+		for (const BoneVertexWeights& boneVertexWeights : mData.BoneWeights)
+		{
+			mBoneWeightOffsets.EmplaceBack(gsl::narrow_cast<uint32_t>(mBoneWeights.Size()));
+			for (const BoneVertexWeights::VertexWeight& weight : boneVertexWeights.Weights())
+			{
+				mBoneWeights.EmplaceBack(weight);
+			}
+		}
+
+		mBoneWeightOffsets.EmplaceBack(gsl::narrow_cast<uint32_t>(mBoneWeights.Size()));
+
+		mData.BoneWeights.Clear();
+		mData.BoneWeights.ShrinkToFit();
+	}
+
+	void Mesh::BindStreams()
+	{
+		mStreams.Vertices = MakeSpan(mData.Vertices);
+		mStreams.Normals = MakeSpan(mData.Normals);
+		mStreams.Tangents = MakeSpan(mData.Tangents);
+		mStreams.BiNormals = MakeSpan(mData.BiNormals);
+
+		mStreams.TextureCoordinates.Clear();
+		for (const auto& uvList : mData.TextureCoordinates)
+		{
+			mStreams.TextureCoordinates.EmplaceBack(MakeSpan(uvList));
+		}
+
+		mStreams.VertexColors.Clear();
+		for (const auto& vertexColorList : mData.VertexColors)
+		{
+			mStreams.VertexColors.EmplaceBack(MakeSpan(vertexColorList));
+		}
+
+		mStreams.Indices = MakeSpan(mData.Indices);
+		mStreams.BoneWeightOffsets = MakeSpan(mBoneWeightOffsets);
+		mStreams.BoneWeights = MakeSpan(mBoneWeights);
 	}
 }
\ No newline at end of file
@@ -12,6 +12,8 @@ namespace Library
     class ModelMaterial;
 	class OutputStreamHelper;
 	class InputStreamHelper;
+	class MemoryMappedFile;
+	class VertexFormat;
 
 	struct MeshData final
 	{
@@ -28,14 +30,34 @@ namespace Library
 		Vector<BoneVertexWeights> BoneWeights;
 	};
 
+	/// <summary>
+	/// Views of a Mesh's vertex streams, indices and bone weights, into either the Mesh's own arrays or a mapped model file.
+	/// </summary>
+	struct MeshStreams final
+	{
+		using VertexWeight = BoneVertexWeights::VertexWeight;
+
+		gsl::span<const glm::vec3> Vertices;
+		gsl::span<const glm::vec3> Normals;
+		gsl::span<const glm::vec3> Tangents;
+		gsl::span<const glm::vec3> BiNormals;
+		Vector<gsl::span<const glm::vec3>> TextureCoordinates{ Vector<gsl::span<const glm::vec3>>::EqualityFunctor() };
+		Vector<gsl::span<const glm::vec4>> VertexColors{ Vector<gsl::span<const glm::vec4>>::EqualityFunctor() };
+		gsl::span<const std::uint32_t> Indices;
+		gsl::span<const std::uint32_t> BoneWeightOffsets;		// Index of each vertex's first weight, followed by the weight count
+		gsl::span<const VertexWeight> BoneWeights;				// Weights of every vertex, contiguous
+	};
+
     class Mesh final
     {
+		friend class ModelCooker;
+
     public:
 		Mesh(Model& model, InputStreamHelper& streamHelper);
 		Mesh(Model& model, MeshData&& meshData);
-		Mesh(const Mesh&) = default;
+		Mesh(const Mesh& rhs);
 		Mesh(Mesh&&) = default;
-		Mesh& operator=(const Mesh&) = default;
+		Mesh& operator=(const Mesh& rhs);
 		Mesh& operator=(Mesh&&) = default;
 		~Mesh() = default;
 
@@ -45,22 +67,84 @@ namespace Library
         std::shared_ptr<const ModelMaterial> GetMaterial() const;
         const std::string& Name() const;
 
-		const Vector<glm::vec3>& Vertices() const;
-		const Vector<glm::vec3>& Normals() const;
-		const Vector<glm::vec3>& Tangents() const;
-		const Vector<glm::vec3>& BiNormals() const;
-		const Vector<Vector<glm::vec3>>& TextureCoordinates() const;
-		const Vector<Vector<glm::vec4>>& VertexColors() const;
+		gsl::span<const glm::vec3> Vertices() const;
+		gsl::span<const glm::vec3> Normals() const;
+		gsl::span<const glm::vec3> Tangents() const;
+		gsl::span<const glm::vec3> BiNormals() const;
+		const Vector<gsl::span<const glm::vec3>>& TextureCoordinates() const;
+		const Vector<gsl::span<const glm::vec4>>& VertexColors() const;
 		std::uint32_t FaceCount() const;
-		const Vector<std::uint32_t>& Indices() const;
-		const Vector<BoneVertexWeights>& BoneWeights() const;
+		gsl::span<const std::uint32_t> Indices() const;
+
+		/// <summary>
+		/// Gets whether the vertices of the Mesh are weighted to bones.
+		/// </summary>
+		bool HasBoneWeights() const;
+
+		/// <summary>
+		/// Gets the bone weights of a vertex.
+		/// </summary>
+		/// <param name="vertexIndex">Index of the vertex.</param>
+		/// <returns>Up to BoneVertexWeights::MaxBoneWeightsPerVertex weights.</returns>
+		gsl::span<const BoneVertexWeights::VertexWeight> BoneWeights(const std::size_t vertexIndex) const;
+
+		/// <summary>
+		/// Gets the views of every stream of the Mesh.
+		/// </summary>
+		const MeshStreams& Streams() const;
+
+		/// <summary>
+		/// Gets whether the streams of the Mesh are views into a mapped model file rather than arrays of its own.
+		/// </summary>
+		bool IsMapped() const;
+
+		/// <summary>
+		/// Writes the vertices of the Mesh interleaved in a vertex format, converting and quantizing each element.
+		/// Elements whose stream the Mesh lacks are written as zero.
+		/// </summary>
+		/// <param name="format">Layout of a vertex.</param>
+		/// <param name="vertices">Buffer of at least Vertices().size() * format.Stride() bytes, such as a mapped upload buffer.</param>
+		/// <exception cref="std::runtime_error">Buffer is too small.</exception>
+		/// <exception cref="std::runtime_error">A bone index does not fit the bone index format.</exception>
+		void Interleave(const VertexFormat& format, gsl::span<std::byte> vertices) const;
+
+		/// <summary>
+		/// Interleaves the vertices of the Mesh into a new buffer.
+		/// </summary>
+		/// <param name="format">Layout of a vertex.</param>
+		/// <returns>Vertices().size() * format.Stride() bytes of interleaved vertices.</returns>
+		/// <exception cref="std::runtime_error">A bone index does not fit the bone index format.</exception>
+		Vector<std::byte> Interleave(const VertexFormat& format) const;
 
 		void Save(OutputStreamHelper& streamHelper) const;
 
     private:
+		/// <summary>
+		/// Constructor for a Mesh whose streams are views into a mapped model file.
+		/// </summary>
+		/// <param name="model">Model owning the Mesh.</param>
+		/// <param name="meshData">Name, material and face count of the Mesh. Its arrays are unused.</param>
+		/// <param name="streams">Views into the mapped file.</param>
+		/// <param name="mappedFile">Mapped file, kept open for as long as the Mesh exists.</param>
+		Mesh(Model& model, MeshData&& meshData, MeshStreams&& streams, std::shared_ptr<const MemoryMappedFile> mappedFile);
+
 		void Load(InputStreamHelper& streamHelper);
 
+		/// <summary>
+		/// Moves per vertex bone weights of the MeshData into the flat weight arrays.
+		/// </summary>
+		void FlattenBoneWeights();
+
+		/// <summary>
+		/// Points the streams at the arrays owned by the Mesh.
+		/// </summary>
+		void BindStreams();
+
         gsl::not_null<Model*> mModel;
 		MeshData mData;
+		Vector<std::uint32_t> mBoneWeightOffsets;
+		Vector<BoneVertexWeights::VertexWeight> mBoneWeights;
+		MeshStreams mStreams;
+		std::shared_ptr<const MemoryMappedFile> mMappedFile;
     };
-}
\ No newline at end of file
+}
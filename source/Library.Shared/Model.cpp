@@ -9,8 +9,10 @@
 #include "StreamHelper.h"
 #include "Mesh.h"
 #include "SceneNode.h"
+#include "Bone.h"
 #include "ModelMaterial.h"
 #include "AnimationClip.h"
+#include "ModelCooker.h"
 #pragma endregion Includes
 
 namespace Library
@@ -32,6 +34,7 @@ namespace Library
 	Model::Model(ModelData&& modelData, std::string name) : Entity(Model::TypeIdClass(), std::move(name)),
 		mData(std::move(modelData))
 	{
+		FlattenSkeleton();
 	}
 
 	bool Model::HasMeshes() const
@@ -84,6 +87,11 @@ namespace Library
 		return mData.RootNode;
 	}
 
+	const SkeletonData& Model::Skeleton() const
+	{
+		return mSkeleton;
+	}
+
 	ModelData& Model::Data()
 	{
 		return mData;
@@ -108,7 +116,11 @@ namespace Library
 	void Model::Save(std::ofstream& file) const
 	{
 		OutputStreamHelper streamHelper(file);
+		Save(streamHelper, true);
+	}
 
+	void Model::Save(OutputStreamHelper& streamHelper, const bool saveMeshes) const
+	{
 		// Serialize materials
 		streamHelper << gsl::narrow_cast<std::uint32_t>(mData.Materials.Size());
 		for (const auto& material : mData.Materials)
@@ -117,10 +129,13 @@ namespace Library
 		}
 
 		// Serialize meshes
-		streamHelper << gsl::narrow_cast<std::uint32_t>(mData.Meshes.Size());
-		for (const auto& mesh : mData.Meshes)
+		streamHelper << (saveMeshes ? gsl::narrow_cast<std::uint32_t>(mData.Meshes.Size()) : 0U);
+		if (saveMeshes)
 		{
-			mesh->Save(streamHelper);
+			for (const auto& mesh : mData.Meshes)
+			{
+				mesh->Save(streamHelper);
+			}
 		}
 
 		// Serialize bones
@@ -148,6 +163,12 @@ namespace Library
 
 	void Model::Load(const std::string& filename)
 	{
+		if (ModelCooker::IsCookedFile(filename))
+		{
+			ModelCooker::LoadFromFile(*this, filename);
+			return;
+		}
+
 		std::ifstream file(filename.c_str(), std::ios::binary);
 		if (!file.is_open())
 		{
@@ -160,7 +181,11 @@ namespace Library
 	void Model::Load(std::ifstream& file)
 	{
 		InputStreamHelper streamHelper(file);
+		Load(streamHelper);
+	}
 
+	void Model::Load(InputStreamHelper& streamHelper)
+	{
 		// Deserialize materials
 		std::uint32_t materialCount;
 		streamHelper >> materialCount;
@@ -206,6 +231,61 @@ namespace Library
 			const auto& animation = mData.Animations.EmplaceBack(std::make_shared<AnimationClip>(*this, streamHelper));
 			mData.AnimationsByName[animation->Name()] = animation;
 		}
+
+		FlattenSkeleton();
+	}
+
+	void Model::FlattenSkeleton()
+	{
+		mSkeleton = SkeletonData();
+
+		mSkeleton.OffsetTransforms.Reserve(mData.Bones.Size());
+		for (const auto& bone : mData.Bones)
+		{
+			mSkeleton.OffsetTransforms.EmplaceBack(bone->OffsetTransform());
+		}
+
+		mSkeleton.BoneDepths.Resize(mData.Bones.Size(), SkeletonData::NoDepth);
+
+		if (mData.RootNode == nullptr) return;
+
+		Vector<std::uint32_t> nodeDepths;
+
+		// Depth first, with children pushed in reverse so siblings keep their hierarchy order.
+		Vector<std::pair<const SceneNode*, std::uint32_t>> pendingNodes;
+		pendingNodes.EmplaceBack(mData.RootNode.get(), SkeletonData::NoParent);
+
+		while (!pendingNodes.IsEmpty())
+		{
+			const auto [sceneNode, parentIndex] = pendingNodes.Back();
+			pendingNodes.PopBack();
+
+			const std::uint32_t nodeIndex = gsl::narrow_cast<std::uint32_t>(mSkeleton.Parents.Size());
+			const Bone* bone = sceneNode->As<Bone>();
+
+			mSkeleton.Parents.EmplaceBack(parentIndex);
+			mSkeleton.BoneIndices.EmplaceBack(bone != nullptr ? bone->Index() : SkeletonData::NoBone);
+			mSkeleton.Transforms.EmplaceBack(sceneNode->GetTransform());
+
+			const std::uint32_t depth = (parentIndex != SkeletonData::NoParent ? nodeDepths[parentIndex] + 1 : 0);
+			nodeDepths.EmplaceBack(depth);
+			if (bone != nullptr) mSkeleton.BoneDepths[bone->Index()] = depth;
+
+			const auto& children = sceneNode->Children();
+			for (std::size_t i = children.Size(); i > 0; --i)
+			{
+				pendingNodes.EmplaceBack(children[i - 1].get(), nodeIndex);
+			}
+		}
+
+		// Animations sample their shallowest bones first, so reduced levels of detail sample a prefix of their tracks.
+		if (mSkeleton.BoneDepths.IsEmpty()) return;
+
+		const auto boneDepths = gsl::span<const std::uint32_t>(&mSkeleton.BoneDepths[0], mSkeleton.BoneDepths.Size());
+		for (const auto& animation : mData.Animations)
+		{
+			animation->OrderTracksByDepth(boneDepths);
+		}
 	}
 
 	void Model::SaveSkeleton(OutputStreamHelper& streamHelper, const std::shared_ptr<const SceneNode>& sceneNode) const
@@ -1,6 +1,9 @@
 #pragma once
 
 #pragma region Includes
+// Standard
+#include <limits>
+
 // First Party
 #include "Entity.h"
 #pragma endregion Includes
@@ -30,12 +33,30 @@ namespace Library
 		std::shared_ptr<SceneNode> RootNode;
 	};
 
+	/// <summary>
+	/// Represents a Model's skeleton hierarchy flattened into contiguous arrays, for index based pose evaluation.
+	/// Nodes are stored parent first, so a single forward pass visits every parent before its children.
+	/// </summary>
+	struct SkeletonData final
+	{
+		inline static constexpr std::uint32_t NoParent = std::numeric_limits<std::uint32_t>::max();
+		inline static constexpr std::uint32_t NoBone = std::numeric_limits<std::uint32_t>::max();
+		inline static constexpr std::uint32_t NoDepth = std::numeric_limits<std::uint32_t>::max();
+
+		Vector<std::uint32_t> Parents;				// Node index of each node's parent, or NoParent
+		Vector<std::uint32_t> BoneIndices;			// Bone index of each node, or NoBone
+		Vector<glm::mat4x4> Transforms;				// To parent transform of each node
+		Vector<glm::mat4x4> OffsetTransforms;		// Offset transform of each bone, by bone index
+		Vector<std::uint32_t> BoneDepths;			// Depth of each bone below the root node, or NoDepth, by bone index
+	};
+
 	/// <summary>
 	/// Component for providing a physical representation of an Entity as a 3D model.
 	/// </summary>
 	class Model final : public Entity
 	{
 		RTTI_DECLARATIONS(Model, Entity)
+		friend class ModelCooker;
 
 #pragma region Special Members
 	public:
@@ -64,6 +85,7 @@ namespace Library
 		const Vector<std::shared_ptr<Bone>>& Bones() const;
 		const HashMap<std::string, std::uint32_t>& BoneIndexMapping() const;
 		std::shared_ptr<const SceneNode> RootNode() const;
+		const SkeletonData& Skeleton() const;
 
 		ModelData& Data();
 		const ModelData& Data() const;
@@ -71,18 +93,31 @@ namespace Library
 
 #pragma region Asset Management
 	public:
+		/// <summary>
+		/// Flattens the skeleton hierarchy under RootNode into Skeleton.
+		/// Also orders the tracks of each animation by the depth of their bones.
+		/// Called when a Model is loaded; must be called again if the bones or hierarchy are changed through Data.
+		/// </summary>
+		void FlattenSkeleton();
+
 		void Save(const std::string& filename) const;
 		void Save(std::ofstream& file) const;
 
 	private:
+		/// <summary>
+		/// Loads a Model file, mapping it through ModelCooker if it is cooked.
+		/// </summary>
 		void Load(const std::string& filename);
 		void Load(std::ifstream& file);
+		void Load(InputStreamHelper& streamHelper);
+		void Save(OutputStreamHelper& streamHelper, const bool saveMeshes) const;
 
 		void SaveSkeleton(OutputStreamHelper & streamHelper, const std::shared_ptr<const SceneNode> & sceneNode) const;
 		std::shared_ptr<SceneNode> LoadSkeleton(InputStreamHelper & streamHelper, std::shared_ptr<SceneNode> parentSceneNode);
 #pragma endregion Asset Management
 
 		ModelData mData;
+		SkeletonData mSkeleton;
 	};
 
 #pragma region ModelFactory Declaration
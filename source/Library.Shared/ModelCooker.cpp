@@ -0,0 +1,393 @@
+#pragma region Includes
+// Pre-compiled Header
+#include "pch.h"
+
+// Header
+#include "ModelCooker.h"
+
+// Standard
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <sstream>
+#include <streambuf>
+
+// First Party
+#include "HashMap.h"
+#include "Model.h"
+#include "Mesh.h"
+#include "MemoryMappedFile.h"
+#include "StreamHelper.h"
+#include "Profiler.h"
+#pragma endregion Includes
+
+using namespace std::string_literals;
+
+namespace
+{
+	/// <summary>
+	/// Read only stream buffer over bytes already in memory, so they can be deserialized without being copied.
+	/// </summary>
+	class SpanStreamBuffer final : public std::streambuf
+	{
+	public:
+		explicit SpanStreamBuffer(gsl::span<const std::byte> bytes)
+		{
+			char* begin = const_cast<char*>(reinterpret_cast<const char*>(bytes.data()));
+			setg(begin, begin, begin + bytes.size());
+		}
+	};
+
+	template <typename T>
+	gsl::span<const T> ViewStream(gsl::span<const std::byte> values, const std::uint64_t offset, const std::uint64_t count)
+	{
+		if (offset % alignof(T) != 0 || offset > values.size() || count > (values.size() - offset) / sizeof(T))
+		{
+			throw std::runtime_error("Corrupt cooked model.");
+		}
+
+		return gsl::span<const T>(reinterpret_cast<const T*>(values.data() + offset), static_cast<std::size_t>(count));
+	}
+
+	/// <summary>
+	/// Mapping of a cooked file, shared while any Model loaded from it exists.
+	/// </summary>
+	struct SharedMapping final
+	{
+		std::weak_ptr<const Library::MemoryMappedFile> File;
+		std::filesystem::file_time_type WriteTime;
+	};
+
+	/// <summary>
+	/// Shared mappings by canonical path, guarded by a mutex as Models may be loaded from several threads.
+	/// </summary>
+	struct MappingCache final
+	{
+		std::mutex Mutex;
+		Library::HashMap<std::string, SharedMapping> Mappings;
+	};
+
+	MappingCache& GetMappingCache()
+	{
+		static MappingCache cache;
+		return cache;
+	}
+
+	/// <summary>
+	/// Removes the mappings no Model uses any longer. Expects the cache's mutex to be held.
+	/// </summary>
+	void RemoveExpiredMappings(MappingCache& cache)
+	{
+		Library::Vector<std::string> expiredPaths;
+
+		for (const auto& [path, mapping] : cache.Mappings)
+		{
+			if (mapping.File.expired()) expiredPaths.PushBack(path);
+		}
+
+		for (const auto& path : expiredPaths)
+		{
+			cache.Mappings.Remove(path);
+		}
+	}
+}
+
+namespace Library
+{
+#pragma region Cook Methods
+	void ModelCooker::Cook(const Model& model, std::ostream& outputStream)
+	{
+		PROFILE_SCOPE("ModelCooker::Cook");
+
+		CookContext context;
+
+		// Everything but the meshes keeps the regular serialization.
+		std::ostringstream assets(std::ios::binary);
+		{
+			OutputStreamHelper streamHelper(assets);
+			model.Save(streamHelper, false);
+		}
+
+		const std::string assetBytes = assets.str();
+		const std::uint64_t assetsOffset = AppendData(context, assetBytes.data(), assetBytes.size());
+
+		for (const auto& mesh : model.Meshes())
+		{
+			const MeshStreams& streams = mesh->Streams();
+
+			MeshRecord record{};
+			record.NameOffset = AppendData(context, mesh->Name().data(), mesh->Name().size(), 1);
+			record.NameLength = static_cast<std::uint32_t>(mesh->Name().size());
+			record.MaterialIndex = NoMaterial;
+			record.FaceCount = mesh->FaceCount();
+			record.FirstChannel = static_cast<std::uint32_t>(context.Channels.Size());
+			record.TextureCoordinateChannelCount = static_cast<std::uint32_t>(streams.TextureCoordinates.Size());
+			record.VertexColorChannelCount = static_cast<std::uint32_t>(streams.VertexColors.Size());
+
+			const auto& materials = model.Materials();
+			for (std::size_t i = 0; i < materials.Size(); ++i)
+			{
+				if (materials[i] == mesh->GetMaterial())
+				{
+					record.MaterialIndex = static_cast<std::uint32_t>(i);
+					break;
+				}
+			}
+
+			record.Vertices = AppendStream(context, streams.Vertices);
+			record.Normals = AppendStream(context, streams.Normals);
+			record.Tangents = AppendStream(context, streams.Tangents);
+			record.BiNormals = AppendStream(context, streams.BiNormals);
+			record.Indices = AppendStream(context, streams.Indices);
+			record.BoneWeightOffsets = AppendStream(context, streams.BoneWeightOffsets);
+			record.BoneWeights = AppendStream(context, streams.BoneWeights);
+
+			for (const auto& channel : streams.TextureCoordinates)
+			{
+				context.Channels.PushBack(AppendStream(context, channel));
+			}
+
+			for (const auto& channel : streams.VertexColors)
+			{
+				context.Channels.PushBack(AppendStream(context, channel));
+			}
+
+			context.Meshes.PushBack(record);
+		}
+
+		Header header
+		{
+			Magic,
+			Version,
+			static_cast<std::uint32_t>(context.Meshes.Size()),
+			static_cast<std::uint32_t>(context.Channels.Size()),
+		};
+
+		header.MeshesOffset = AlignedEnd(0, sizeof(Header));
+		header.ChannelsOffset = AlignedEnd(header.MeshesOffset, context.Meshes.Size() * sizeof(MeshRecord));
+		header.DataOffset = AlignedEnd(header.ChannelsOffset, context.Channels.Size() * sizeof(StreamRecord));
+		header.AssetsOffset = assetsOffset;
+		header.AssetsSize = assetBytes.size();
+		header.Size = header.DataOffset + context.Data.size();
+
+		const char padding[Alignment]{};
+		std::uint64_t written = 0;
+
+		const auto writeSection = [&outputStream, &padding, &written](const std::uint64_t offset, const void* bytes, const std::size_t size)
+		{
+			outputStream.write(padding, static_cast<std::streamsize>(offset - written));
+			if (size > 0) outputStream.write(static_cast<const char*>(bytes), static_cast<std::streamsize>(size));
+			written = offset + size;
+		};
+
+		writeSection(0, &header, sizeof(Header));
+		writeSection(header.MeshesOffset, context.Meshes.IsEmpty() ? nullptr : &context.Meshes[0], context.Meshes.Size() * sizeof(MeshRecord));
+		writeSection(header.ChannelsOffset, context.Channels.IsEmpty() ? nullptr : &context.Channels[0], context.Channels.Size() * sizeof(StreamRecord));
+		writeSection(header.DataOffset, context.Data.data(), context.Data.size());
+	}
+
+	void ModelCooker::CookToFile(const Model& model, const std::string& filename)
+	{
+		// Held while writing, so the file is not mapped part way through.
+		MappingCache& cache = GetMappingCache();
+		const std::lock_guard<std::mutex> lock(cache.Mutex);
+
+		// Rewriting a mapped file would change, or on some platforms truncate, the streams of the Models viewing it.
+		std::error_code errorCode;
+		const std::filesystem::path path = std::filesystem::canonical(filename, errorCode);
+
+		if (!errorCode)
+		{
+			const auto it = cache.Mappings.Find(path.string());
+
+			if (it != cache.Mappings.end() && !it->second.File.expired())
+			{
+				throw std::runtime_error("Could not cook \""s + filename + "\", as it is mapped by a loaded Model."s);
+			}
+		}
+
+		std::ofstream filestream(filename, std::ios::binary);
+
+		if (!filestream.is_open())
+		{
+			throw std::runtime_error("Could not open \""s + filename + "\"."s);
+		}
+
+		Cook(model, filestream);
+	}
+#pragma endregion Cook Methods
+
+#pragma region Load Methods
+	void ModelCooker::Load(Model& model, std::shared_ptr<const MemoryMappedFile> file)
+	{
+		PROFILE_SCOPE("ModelCooker::Load");
+
+		assert(file != nullptr);
+		const gsl::span<const std::byte> data = file->Data();
+
+		const auto corrupt = []() { return std::runtime_error("Corrupt cooked model."); };
+
+		if (data.size() < sizeof(Header)) throw corrupt();
+		assert(reinterpret_cast<std::uintptr_t>(data.data()) % Alignment == 0);
+
+		const Header& header = *reinterpret_cast<const Header*>(data.data());
+
+		if (header.Magic != Magic || header.Version != Version)
+		{
+			throw std::runtime_error("Data is not a cooked model of version "s + std::to_string(Version) + "."s);
+		}
+
+		const auto isInBounds = [](const std::uint64_t offset, const std::uint64_t size, const std::uint64_t sectionSize)
+		{
+			return offset <= sectionSize && size <= sectionSize - offset;
+		};
+
+		if (header.Size > static_cast<std::uint64_t>(data.size()) || header.DataOffset > header.Size || header.DataOffset % Alignment != 0
+			|| !isInBounds(header.MeshesOffset, std::uint64_t(header.MeshCount) * sizeof(MeshRecord), header.Size)
+			|| !isInBounds(header.ChannelsOffset, std::uint64_t(header.ChannelCount) * sizeof(StreamRecord), header.Size)
+			|| !isInBounds(header.AssetsOffset, header.AssetsSize, header.Size - header.DataOffset))
+		{
+			throw corrupt();
+		}
+
+		const auto* meshRecords = reinterpret_cast<const MeshRecord*>(data.data() + header.MeshesOffset);
+		const auto* channelRecords = reinterpret_cast<const StreamRecord*>(data.data() + header.ChannelsOffset);
+		const auto values = data.subspan(static_cast<std::size_t>(header.DataOffset), static_cast<std::size_t>(header.Size - header.DataOffset));
+
+		// Materials, bones, the skeleton and animations are deserialized straight from the mapping.
+		{
+			SpanStreamBuffer buffer(values.subspan(static_cast<std::size_t>(header.AssetsOffset), static_cast<std::size_t>(header.AssetsSize)));
+			std::istream assets(&buffer);
+			InputStreamHelper streamHelper(assets);
+
+			model.Load(streamHelper);
+			if (!assets) throw corrupt();
+		}
+
+		const auto& materials = model.Materials();
+		model.Data().Meshes.Reserve(header.MeshCount);
+
+		for (std::uint32_t i = 0; i < header.MeshCount; ++i)
+		{
+			const MeshRecord& record = meshRecords[i];
+
+			if (!isInBounds(record.NameOffset, record.NameLength, values.size())
+				|| (record.MaterialIndex != NoMaterial && record.MaterialIndex >= materials.Size())
+				|| std::uint64_t(record.FirstChannel) + record.TextureCoordinateChannelCount + record.VertexColorChannelCount > header.ChannelCount)
+			{
+				throw corrupt();
+			}
+
+			MeshData meshData;
+			meshData.Name.assign(reinterpret_cast<const char*>(values.data() + record.NameOffset), record.NameLength);
+			meshData.Material = (record.MaterialIndex != NoMaterial ? materials[record.MaterialIndex] : nullptr);
+			meshData.FaceCount = record.FaceCount;
+
+			// Streams are viewed in place, so only their bounds and alignment are checked.
+			MeshStreams streams;
+			streams.Vertices = ViewStream<glm::vec3>(values, record.Vertices.DataOffset, record.Vertices.Count);
+			streams.Normals = ViewStream<glm::vec3>(values, record.Normals.DataOffset, record.Normals.Count);
+			streams.Tangents = ViewStream<glm::vec3>(values, record.Tangents.DataOffset, record.Tangents.Count);
+			streams.BiNormals = ViewStream<glm::vec3>(values, record.BiNormals.DataOffset, record.BiNormals.Count);
+			streams.Indices = ViewStream<std::uint32_t>(values, record.Indices.DataOffset, record.Indices.Count);
+			streams.BoneWeightOffsets = ViewStream<std::uint32_t>(values, record.BoneWeightOffsets.DataOffset, record.BoneWeightOffsets.Count);
+			streams.BoneWeights = ViewStream<MeshStreams::VertexWeight>(values, record.BoneWeights.DataOffset, record.BoneWeights.Count);
+
+			// Each vertex's weights run from its offset to the next, so the offsets must rise to the end of the weights.
+			if (!streams.BoneWeightOffsets.empty())
+			{
+				if (streams.BoneWeightOffsets.size() != streams.Vertices.size() + 1
+					|| streams.BoneWeightOffsets[streams.BoneWeightOffsets.size() - 1] != streams.BoneWeights.size()
+					|| std::is_sorted_until(streams.BoneWeightOffsets.begin(), streams.BoneWeightOffsets.end()) != streams.BoneWeightOffsets.end())
+				{
+					throw corrupt();
+				}
+			}
+
+			const StreamRecord* channels = channelRecords + record.FirstChannel;
+
+			for (std::uint32_t channel = 0; channel < record.TextureCoordinateChannelCount; ++channel, ++channels)
+			{
+				streams.TextureCoordinates.EmplaceBack(ViewStream<glm::vec3>(values, channels->DataOffset, channels->Count));
+			}
+
+			for (std::uint32_t channel = 0; channel < record.VertexColorChannelCount; ++channel, ++channels)
+			{
+				streams.VertexColors.EmplaceBack(ViewStream<glm::vec4>(values, channels->DataOffset, channels->Count));
+			}
+
+			model.Data().Meshes.EmplaceBack(std::shared_ptr<Mesh>(new Mesh(model, std::move(meshData), std::move(streams), file)));
+		}
+	}
+
+	void ModelCooker::LoadFromFile(Model& model, const std::string& filename)
+	{
+		Load(model, MapShared(filename));
+	}
+
+	bool ModelCooker::IsCookedFile(const std::string& filename)
+	{
+		std::ifstream filestream(filename, std::ios::binary);
+
+		std::uint32_t magic = 0;
+		filestream.read(reinterpret_cast<char*>(&magic), sizeof(magic));
+
+		return filestream.good() && magic == Magic;
+	}
+#pragma endregion Load Methods
+
+#pragma region Helper Methods
+	std::shared_ptr<const MemoryMappedFile> ModelCooker::MapShared(const std::string& filename)
+	{
+		// Keyed by the file rather than the filename, so every path to a file shares its mapping.
+		std::error_code errorCode;
+		const std::filesystem::path path = std::filesystem::canonical(filename, errorCode);
+		const std::filesystem::file_time_type writeTime = (errorCode ? std::filesystem::file_time_type() : std::filesystem::last_write_time(path, errorCode));
+
+		if (errorCode)
+		{
+			throw std::runtime_error("Could not map \""s + filename + "\"."s);
+		}
+
+		MappingCache& cache = GetMappingCache();
+		const std::lock_guard<std::mutex> lock(cache.Mutex);
+
+		RemoveExpiredMappings(cache);
+
+		SharedMapping& mapping = cache.Mappings[path.string()];
+		std::shared_ptr<const MemoryMappedFile> file = mapping.File.lock();
+
+		// A file replaced since it was mapped is mapped again. Models loaded earlier keep viewing the mapping they loaded from.
+		if (file == nullptr || mapping.WriteTime != writeTime)
+		{
+			file = std::make_shared<MemoryMappedFile>(path.string());
+			mapping.File = file;
+			mapping.WriteTime = writeTime;
+		}
+
+		return file;
+	}
+
+	std::uint64_t ModelCooker::AppendData(CookContext& context, const void* bytes, const std::size_t size, const std::size_t alignment)
+	{
+		const std::uint64_t offset = (context.Data.size() + alignment - 1) / alignment * alignment;
+
+		context.Data.resize(static_cast<std::size_t>(offset));
+		if (size > 0) context.Data.append(static_cast<const char*>(bytes), size);
+
+		return offset;
+	}
+
+	template <typename T>
+	ModelCooker::StreamRecord ModelCooker::AppendStream(CookContext& context, gsl::span<const T> stream)
+	{
+		return StreamRecord{ AppendData(context, stream.data(), stream.size_bytes()), stream.size() };
+	}
+
+	std::uint64_t ModelCooker::AlignedEnd(const std::uint64_t offset, const std::size_t size)
+	{
+		return (offset + size + Alignment - 1) & ~std::uint64_t(Alignment - 1);
+	}
+#pragma endregion Helper Methods
+}
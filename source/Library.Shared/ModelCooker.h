@@ -0,0 +1,211 @@
+#pragma once
+
+#pragma region Includes
+// Standard
+#include <cstdint>
+#include <memory>
+#include <ostream>
+#include <string>
+
+// Third Party
+#include <gsl/gsl>
+
+// First Party
+#include "Vector.h"
+#pragma endregion Includes
+
+namespace Library
+{
+	// Forward Declarations
+	class Model;
+	class MemoryMappedFile;
+
+	/// <summary>
+	/// Writes Models to a versioned binary format whose vertex streams are used in place once the file is mapped into memory.
+	/// </summary>
+	/// <remarks>
+	/// A cooked model holds a mesh table, a texture coordinate and vertex color channel table and a data section, each 16 byte aligned.
+	/// Every vertex stream, index buffer and bone weight array is a 16 byte aligned run of the data section, and loaded Meshes view it directly,
+	/// so loading does not read or copy vertex data and the operating system pages it in as it is used.
+	/// Materials, bones, the skeleton hierarchy and animations are stored in the regular Model serialization within the data section, and are deserialized.
+	/// Files mapped by LoadFromFile are shared by every Model loaded from the same file while any of them exists, until the file is replaced.
+	/// Files are written in the byte order of the machine cooking them.
+	/// </remarks>
+	class ModelCooker final
+	{
+#pragma region Type Definitions, Constants
+	public:
+		/// <summary>
+		/// Identifies a cooked model file, "FMDL" in little endian order.
+		/// </summary>
+		inline static constexpr std::uint32_t Magic = 0x4C444D46;
+
+		/// <summary>
+		/// Current version of the cooked format. Files of any other version are rejected.
+		/// </summary>
+		inline static constexpr std::uint32_t Version = 1;
+
+		/// <summary>
+		/// Material index of a mesh without a material.
+		/// </summary>
+		inline static constexpr std::uint32_t NoMaterial = 0xFFFFFFFF;
+
+	private:
+		/// <summary>
+		/// Alignment in bytes of every section and every stream.
+		/// </summary>
+		inline static constexpr std::size_t Alignment = 16;
+
+		/// <summary>
+		/// Leading record of a cooked file.
+		/// </summary>
+		struct Header final
+		{
+			std::uint32_t Magic;
+			std::uint32_t Version;
+			std::uint32_t MeshCount;
+			std::uint32_t ChannelCount;
+			std::uint64_t MeshesOffset;
+			std::uint64_t ChannelsOffset;
+			std::uint64_t DataOffset;
+			std::uint64_t AssetsOffset;
+			std::uint64_t AssetsSize;
+			std::uint64_t Size;
+		};
+
+		/// <summary>
+		/// Run of elements within the data section.
+		/// </summary>
+		struct StreamRecord final
+		{
+			std::uint64_t DataOffset;
+			std::uint64_t Count;
+		};
+
+		/// <summary>
+		/// Mesh record. Texture coordinate channels are followed by vertex color channels in the channel table.
+		/// </summary>
+		struct MeshRecord final
+		{
+			std::uint64_t NameOffset;
+			std::uint32_t NameLength;
+			std::uint32_t MaterialIndex;
+			std::uint32_t FaceCount;
+			std::uint32_t FirstChannel;
+			std::uint32_t TextureCoordinateChannelCount;
+			std::uint32_t VertexColorChannelCount;
+			StreamRecord Vertices;
+			StreamRecord Normals;
+			StreamRecord Tangents;
+			StreamRecord BiNormals;
+			StreamRecord Indices;
+			StreamRecord BoneWeightOffsets;
+			StreamRecord BoneWeights;
+		};
+
+		/// <summary>
+		/// Tables filled while cooking a Model.
+		/// </summary>
+		struct CookContext final
+		{
+			Vector<MeshRecord> Meshes{ Vector<MeshRecord>::EqualityFunctor() };
+			Vector<StreamRecord> Channels{ Vector<StreamRecord>::EqualityFunctor() };
+			std::string Data;
+		};
+#pragma endregion Type Definitions, Constants
+
+#pragma region Special Members
+	public:
+		ModelCooker() = delete;
+		~ModelCooker() = delete;
+		ModelCooker(const ModelCooker&) = delete;
+		ModelCooker& operator=(const ModelCooker&) = delete;
+		ModelCooker(ModelCooker&&) = delete;
+		ModelCooker& operator=(ModelCooker&&) = delete;
+#pragma endregion Special Members
+
+#pragma region Cook Methods
+	public:
+		/// <summary>
+		/// Writes a Model to a stream in the cooked format.
+		/// </summary>
+		/// <param name="model">Model to be cooked.</param>
+		/// <param name="outputStream">Binary stream the cooked data is written to.</param>
+		static void Cook(const Model& model, std::ostream& outputStream);
+
+		/// <summary>
+		/// Writes a Model to a file in the cooked format.
+		/// </summary>
+		/// <param name="model">Model to be cooked.</param>
+		/// <param name="filename">Filename of the file to be written.</param>
+		/// <exception cref="std::runtime_error">File could not be opened.</exception>
+		/// <exception cref="std::runtime_error">File is mapped by a Model loaded from it.</exception>
+		static void CookToFile(const Model& model, const std::string& filename);
+#pragma endregion Cook Methods
+
+#pragma region Load Methods
+	public:
+		/// <summary>
+		/// Loads a mapped cooked file into an empty Model. Its Meshes keep the file mapped.
+		/// </summary>
+		/// <param name="model">Model the cooked data is loaded into.</param>
+		/// <param name="file">Mapped cooked file.</param>
+		/// <exception cref="std::runtime_error">File is not a cooked model of the current version, or is corrupt.</exception>
+		static void Load(Model& model, std::shared_ptr<const MemoryMappedFile> file);
+
+		/// <summary>
+		/// Maps a cooked file, or reuses its mapping if it is already mapped, and loads it into an empty Model.
+		/// </summary>
+		/// <param name="model">Model the cooked data is loaded into.</param>
+		/// <param name="filename">Filename of the cooked file.</param>
+		/// <exception cref="std::runtime_error">File could not be mapped.</exception>
+		/// <exception cref="std::runtime_error">File is not a cooked model of the current version, or is corrupt.</exception>
+		static void LoadFromFile(Model& model, const std::string& filename);
+
+		/// <summary>
+		/// Gets whether a file begins with the cooked model identifier.
+		/// </summary>
+		/// <param name="filename">Filename of the file.</param>
+		/// <returns>True if the file is a cooked model. Otherwise, false.</returns>
+		static bool IsCookedFile(const std::string& filename);
+#pragma endregion Load Methods
+
+#pragma region Helper Methods
+	private:
+		/// <summary>
+		/// Maps a file, sharing the mapping with every caller that maps the same file while it is in use and unchanged.
+		/// </summary>
+		/// <param name="filename">Filename of the file.</param>
+		/// <returns>Mapped file.</returns>
+		/// <exception cref="std::runtime_error">File could not be mapped.</exception>
+		static std::shared_ptr<const MemoryMappedFile> MapShared(const std::string& filename);
+
+		/// <summary>
+		/// Pads the data section to an alignment, then appends bytes to it.
+		/// </summary>
+		/// <param name="context">Tables being filled.</param>
+		/// <param name="bytes">Bytes to be appended.</param>
+		/// <param name="size">Number of bytes.</param>
+		/// <param name="alignment">Alignment of the bytes within the data section.</param>
+		/// <returns>Offset of the bytes within the data section.</returns>
+		static std::uint64_t AppendData(CookContext& context, const void* bytes, const std::size_t size, const std::size_t alignment=Alignment);
+
+		/// <summary>
+		/// Appends the elements of a stream to the data section.
+		/// </summary>
+		/// <param name="context">Tables being filled.</param>
+		/// <param name="stream">Elements to be appended.</param>
+		/// <returns>Record of the stream.</returns>
+		template <typename T>
+		static StreamRecord AppendStream(CookContext& context, gsl::span<const T> stream);
+
+		/// <summary>
+		/// Gets the offset following a section, rounded up to the alignment.
+		/// </summary>
+		/// <param name="offset">Offset of the section.</param>
+		/// <param name="size">Size of the section in bytes.</param>
+		/// <returns>Aligned offset.</returns>
+		static std::uint64_t AlignedEnd(const std::uint64_t offset, const std::size_t size);
+#pragma endregion Helper Methods
+	};
+}
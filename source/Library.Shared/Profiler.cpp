@@ -0,0 +1,247 @@
+#pragma region Includes
+// Pre-compiled Header
+#include "pch.h"
+
+// Header
+#include "Profiler.h"
+
+// Standard
+#include <algorithm>
+#pragma endregion Includes
+
+namespace Library
+{
+#pragma region Helper Functions
+	namespace
+	{
+		/// <summary>
+		/// Writes a string as an escaped JSON string literal.
+		/// </summary>
+		void WriteJsonString(std::ostream& outputStream, const char* string)
+		{
+			outputStream << '"';
+
+			for (const char* it = string; *it != '\0'; ++it)
+			{
+				if (*it == '"' || *it == '\\') outputStream << '\\';
+				outputStream << *it;
+			}
+
+			outputStream << '"';
+		}
+	}
+#pragma endregion Helper Functions
+
+#pragma region Thread Buffer
+	Profiler::ThreadBuffer::ThreadBuffer(const std::size_t capacity, const std::uint32_t threadIndex) :
+		ThreadIndex(threadIndex), mSamples(std::make_unique<Sample[]>(capacity)), mMask(capacity - 1)
+	{
+		assert((capacity & mMask) == 0);
+	}
+
+	void Profiler::ThreadBuffer::CopyTo(Vector<Sample>& samples) const
+	{
+		const std::uint64_t capacity = mMask + 1;
+		const std::uint64_t head = mHead.load(std::memory_order_acquire);
+		const std::uint64_t begin = std::max(mFloor, head - std::min(head, capacity));
+		const std::size_t offset = samples.Size();
+
+		samples.Reserve(offset + gsl::narrow<std::size_t>(head - begin));
+
+		for (std::uint64_t i = begin; i < head; ++i)
+		{
+			samples.PushBack(mSamples[i & mMask]);
+		}
+
+		// The owning thread keeps recording during the copy. Samples in slots it has claimed since, including one it may be writing now,
+		// could have been copied torn, so those are dropped.
+		std::atomic_thread_fence(std::memory_order_acquire);
+		const std::uint64_t claimed = mClaimed.load(std::memory_order_relaxed);
+		const std::uint64_t validBegin = claimed > capacity ? claimed - capacity : 0;
+
+		if (validBegin > begin)
+		{
+			const std::size_t dropped = gsl::narrow<std::size_t>(std::min(validBegin, head) - begin);
+			std::move(samples.begin() + offset + dropped, samples.end(), samples.begin() + offset);
+			samples.Resize(samples.Size() - dropped);
+		}
+	}
+
+	void Profiler::ThreadBuffer::Clear()
+	{
+		mFloor = mHead.load(std::memory_order_acquire);
+	}
+#pragma endregion Thread Buffer
+
+#pragma region Special Members
+	Profiler::Profiler(const std::size_t bufferCapacity) :
+		mSession(++sSession), mBufferCapacity(bufferCapacity)
+	{
+		mStopWatch.Start();
+	}
+
+	Profiler::~Profiler()
+	{
+		for (auto* threadBuffer : mThreadBuffers)
+		{
+			delete threadBuffer;
+		}
+	}
+#pragma endregion Special Members
+
+#pragma region Instance Management
+	void Profiler::Create(const std::size_t bufferCapacity)
+	{
+		if (sInstance) return;
+
+		std::size_t capacity = 1;
+		while (capacity < bufferCapacity) capacity <<= 1;
+
+		sInstance = new Profiler(capacity);
+	}
+
+	void Profiler::Destroy()
+	{
+		delete sInstance;
+		sInstance = nullptr;
+	}
+#pragma endregion Instance Management
+
+#pragma region Modifiers
+	void Profiler::Clear()
+	{
+		std::scoped_lock<std::mutex> lock(mMutex);
+
+		for (auto* threadBuffer : mThreadBuffers)
+		{
+			threadBuffer->Clear();
+		}
+	}
+#pragma endregion Modifiers
+
+#pragma region Reporting
+	Vector<Profiler::Sample> Profiler::Collect() const
+	{
+		Vector<Sample> samples(Vector<Sample>::EqualityFunctor{});
+
+		{
+			std::scoped_lock<std::mutex> lock(mMutex);
+
+			for (const auto* threadBuffer : mThreadBuffers)
+			{
+				threadBuffer->CopyTo(samples);
+			}
+		}
+
+		std::sort(samples.begin(), samples.end(), [](const Sample& lhs, const Sample& rhs)
+		{
+			if (lhs.ThreadIndex != rhs.ThreadIndex) return lhs.ThreadIndex < rhs.ThreadIndex;
+			if (lhs.Start != rhs.Start) return lhs.Start < rhs.Start;
+			return lhs.Depth < rhs.Depth;
+		});
+
+		return samples;
+	}
+
+	Profiler::StatsMap Profiler::Aggregate() const
+	{
+		StatsMap stats;
+
+		for (const auto& sample : Collect())
+		{
+			SampleStats& entry = stats[sample.Name];
+			++entry.Count;
+			entry.Total += sample.Duration;
+			entry.Max = std::max(entry.Max, sample.Duration);
+		}
+
+		return stats;
+	}
+
+	void Profiler::WriteChromeTrace(std::ostream& outputStream) const
+	{
+		using Microseconds = std::chrono::duration<double, std::micro>;
+
+		outputStream << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+
+		bool first = true;
+
+		for (const auto& sample : Collect())
+		{
+			if (!first) outputStream << ',';
+			first = false;
+
+			outputStream << "\n{\"name\":";
+			WriteJsonString(outputStream, sample.Name);
+			outputStream << ",\"cat\":\"frame\",\"ph\":\"X\""
+				<< ",\"ts\":" << Microseconds(sample.Start).count()
+				<< ",\"dur\":" << Microseconds(sample.Duration).count()
+				<< ",\"pid\":0,\"tid\":" << sample.ThreadIndex
+				<< ",\"args\":{\"frame\":" << sample.Frame << "}}";
+		}
+
+		outputStream << "\n]}\n";
+	}
+
+	void Profiler::WriteFoldedStacks(std::ostream& outputStream) const
+	{
+		using StackEntry = std::pair<std::string, std::chrono::nanoseconds>;
+
+		HashMap<std::string, std::chrono::nanoseconds> selfTimes;
+		Vector<StackEntry> stack(Vector<StackEntry>::EqualityFunctor{});
+		std::uint32_t threadIndex = 0;
+
+		const auto popStack = [&selfTimes, &stack]
+		{
+			selfTimes[stack.Back().first] += stack.Back().second;
+			stack.PopBack();
+		};
+
+		for (const auto& sample : Collect())
+		{
+			if (sample.ThreadIndex != threadIndex)
+			{
+				while (!stack.IsEmpty()) popStack();
+				threadIndex = sample.ThreadIndex;
+			}
+
+			while (stack.Size() > sample.Depth) popStack();
+
+			if (stack.IsEmpty())
+			{
+				stack.EmplaceBack(sample.Name, sample.Duration);
+			}
+			else
+			{
+				stack.Back().second -= sample.Duration;
+				stack.EmplaceBack(stack.Back().first + ';' + sample.Name, sample.Duration);
+			}
+		}
+
+		while (!stack.IsEmpty()) popStack();
+
+		for (const auto& [path, selfTime] : selfTimes)
+		{
+			const auto microseconds = std::chrono::duration_cast<std::chrono::microseconds>(selfTime).count();
+			if (microseconds > 0) outputStream << path << ' ' << microseconds << '\n';
+		}
+	}
+#pragma endregion Reporting
+
+#pragma region Helper Methods
+	Profiler::ThreadBuffer& Profiler::GetThreadBuffer()
+	{
+		if (sThreadSession != mSession)
+		{
+			std::scoped_lock<std::mutex> lock(mMutex);
+
+			sThreadBuffer = new ThreadBuffer(mBufferCapacity, static_cast<std::uint32_t>(mThreadBuffers.Size()));
+			sThreadSession = mSession;
+
+			mThreadBuffers.EmplaceBack(sThreadBuffer);
+		}
+
+		return *sThreadBuffer;
+	}
+#pragma endregion Helper Methods
+}
@@ -0,0 +1,338 @@
+#pragma once
+
+#pragma region Includes
+// Standard
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <ostream>
+
+// Third Party
+#include <gsl/gsl>
+
+// First Party
+#include "StopWatch.h"
+#include "Vector.h"
+#include "HashMap.h"
+#pragma endregion Includes
+
+namespace Library
+{
+	/// <summary>
+	/// Hierarchical frame profiler that records named, timed scopes into per-thread ring buffers.
+	/// </summary>
+	/// <remarks>
+	/// Recording is lock-free. Each thread writes only to its own ring buffer, and never waits on Collect or Clear.
+	/// Collect and Clear may run while other threads record. Samples a thread overwrites while they are being collected are dropped rather than
+	/// reported torn, and Clear only moves the start of each buffer forward, leaving the write position to the owning thread.
+	/// </remarks>
+	class Profiler final
+	{
+#pragma region Type Definitions, Constants
+	public:
+		/// <summary>
+		/// Default number of samples retained by each thread before the oldest samples are overwritten.
+		/// </summary>
+		static constexpr std::size_t DefaultBufferCapacity = 1 << 16;
+
+		/// <summary>
+		/// Single timed scope recorded by the Profiler.
+		/// </summary>
+		struct Sample final
+		{
+			/// <summary>
+			/// Name of the scope. Must have static storage duration, e.g. a literal or an RTTI type name.
+			/// </summary>
+			const char* Name{ nullptr };
+
+			/// <summary>
+			/// Time the scope began, relative to the start of the profiling session.
+			/// </summary>
+			std::chrono::nanoseconds Start{ 0 };
+
+			/// <summary>
+			/// Time spent within the scope, including nested scopes.
+			/// </summary>
+			std::chrono::nanoseconds Duration{ 0 };
+
+			/// <summary>
+			/// Frame during which the scope began.
+			/// </summary>
+			std::uint64_t Frame{ 0 };
+
+			/// <summary>
+			/// Nesting depth of the scope on its thread. Root scopes have a depth of zero.
+			/// </summary>
+			std::uint32_t Depth{ 0 };
+
+			/// <summary>
+			/// Index of the thread that recorded the scope, in order of first use.
+			/// </summary>
+			std::uint32_t ThreadIndex{ 0 };
+		};
+
+		/// <summary>
+		/// Aggregated timing data for all samples sharing a name.
+		/// </summary>
+		struct SampleStats final
+		{
+			/// <summary>
+			/// Number of samples recorded.
+			/// </summary>
+			std::size_t Count{ 0 };
+
+			/// <summary>
+			/// Sum of the sample durations.
+			/// </summary>
+			std::chrono::nanoseconds Total{ 0 };
+
+			/// <summary>
+			/// Longest sample duration.
+			/// </summary>
+			std::chrono::nanoseconds Max{ 0 };
+		};
+
+		/// <summary>
+		/// Type definition for the aggregated sample statistics, keyed by sample name.
+		/// </summary>
+		using StatsMap = HashMap<std::string, SampleStats>;
+
+	private:
+		/// <summary>
+		/// Single producer ring buffer owned by one recording thread.
+		/// Only the owning thread writes mHead. CopyTo and Clear are called under the mutex of the Profiler.
+		/// </summary>
+		class ThreadBuffer final
+		{
+		public:
+			ThreadBuffer(const std::size_t capacity, const std::uint32_t threadIndex);
+			~ThreadBuffer() = default;
+			ThreadBuffer(const ThreadBuffer&) = delete;
+			ThreadBuffer& operator=(const ThreadBuffer&) = delete;
+			ThreadBuffer(ThreadBuffer&&) = delete;
+			ThreadBuffer& operator=(ThreadBuffer&&) = delete;
+
+			void Push(const Sample& sample);
+			void CopyTo(Vector<Sample>& samples) const;
+			void Clear();
+
+			std::uint32_t ThreadIndex;
+			std::uint32_t Depth{ 0 };
+
+		private:
+			std::unique_ptr<Sample[]> mSamples;
+			std::size_t mMask;
+			std::atomic<std::uint64_t> mHead{ 0 };
+			std::atomic<std::uint64_t> mClaimed{ 0 };	// Head once the slot being written is published. Ahead of mHead only during a Push.
+			std::uint64_t mFloor{ 0 };					// Head at the last Clear. Samples before it are not copied.
+		};
+#pragma endregion Type Definitions, Constants
+
+#pragma region Scoped Sample
+	public:
+		/// <summary>
+		/// RAII helper that records a Sample spanning its own lifetime.
+		/// Does nothing when no Profiler instance exists.
+		/// </summary>
+		class ScopedSample final
+		{
+		public:
+			/// <summary>
+			/// Begins a timed scope.
+			/// </summary>
+			/// <param name="name">Name of the scope. Must have static storage duration.</param>
+			explicit ScopedSample(const char* name);
+
+			/// <summary>
+			/// Ends the timed scope and records it.
+			/// </summary>
+			~ScopedSample();
+
+			ScopedSample(const ScopedSample&) = delete;
+			ScopedSample& operator=(const ScopedSample&) = delete;
+			ScopedSample(ScopedSample&&) = delete;
+			ScopedSample& operator=(ScopedSample&&) = delete;
+
+		private:
+			/// <summary>
+			/// Ring buffer of the current thread, or null when profiling is inactive.
+			/// </summary>
+			ThreadBuffer* mBuffer{ nullptr };
+
+			/// <summary>
+			/// Sample being recorded.
+			/// </summary>
+			Sample mSample;
+		};
+#pragma endregion Scoped Sample
+
+#pragma region Special Members
+	private:
+		explicit Profiler(const std::size_t bufferCapacity);
+		~Profiler();
+
+	public:
+		Profiler(const Profiler&) = delete;
+		Profiler(Profiler&&) = delete;
+		Profiler& operator=(const Profiler&) = delete;
+		Profiler& operator=(Profiler&&) = delete;
+#pragma endregion Special Members
+
+#pragma region Instance Management
+	public:
+		/// <summary>
+		/// Creates the Profiler instance and starts a new profiling session, if one does not exist.
+		/// </summary>
+		/// <param name="bufferCapacity">Samples retained per thread, rounded up to a power of two.</param>
+		static void Create(const std::size_t bufferCapacity=DefaultBufferCapacity);
+
+		/// <summary>
+		/// Destroys the Profiler instance, releasing all recorded samples.
+		/// </summary>
+		static void Destroy();
+
+		/// <summary>
+		/// Gets the Profiler instance.
+		/// </summary>
+		/// <returns>Pointer to the Profiler instance, or null when profiling is inactive.</returns>
+		static Profiler* Instance();
+#pragma endregion Instance Management
+
+#pragma region Accessors
+	public:
+		/// <summary>
+		/// Gets the index of the current frame.
+		/// </summary>
+		/// <returns>Number of frames begun during the session.</returns>
+		std::uint64_t Frame() const;
+
+		/// <summary>
+		/// Gets the time elapsed since the profiling session started.
+		/// </summary>
+		/// <returns>Session time as nanoseconds.</returns>
+		std::chrono::nanoseconds Now() const;
+#pragma endregion Accessors
+
+#pragma region Modifiers
+	public:
+		/// <summary>
+		/// Marks the beginning of a new frame. Samples begun afterwards are tagged with the new frame index.
+		/// </summary>
+		void BeginFrame();
+
+		/// <summary>
+		/// Discards all recorded samples. Threads recording concurrently keep their samples recorded after the call.
+		/// </summary>
+		void Clear();
+#pragma endregion Modifiers
+
+#pragma region Reporting
+	public:
+		/// <summary>
+		/// Gathers the samples retained by every thread, ordered by thread and then by start time.
+		/// </summary>
+		/// <returns>Vector of recorded samples.</returns>
+		Vector<Sample> Collect() const;
+
+		/// <summary>
+		/// Aggregates the retained samples by name, e.g. by RTTI type name.
+		/// </summary>
+		/// <returns>Map of sample names to their aggregated statistics.</returns>
+		StatsMap Aggregate() const;
+
+		/// <summary>
+		/// Writes the retained samples as a Chrome trace event file, viewable in chrome://tracing or Perfetto.
+		/// </summary>
+		/// <param name="outputStream">Stream to write the JSON trace to.</param>
+		void WriteChromeTrace(std::ostream& outputStream) const;
+
+		/// <summary>
+		/// Writes the retained samples as folded stacks weighted by self time in microseconds, for flamegraph tools.
+		/// </summary>
+		/// <param name="outputStream">Stream to write the folded stacks to.</param>
+		void WriteFoldedStacks(std::ostream& outputStream) const;
+#pragma endregion Reporting
+
+#pragma region Helper Methods
+	private:
+		/// <summary>
+		/// Gets the ring buffer of the calling thread, registering a new one on first use.
+		/// </summary>
+		/// <returns>Reference to the ring buffer of the calling thread.</returns>
+		ThreadBuffer& GetThreadBuffer();
+#pragma endregion Helper Methods
+
+#pragma region Data Members
+	private:
+		/// <summary>
+		/// Singleton instance.
+		/// </summary>
+		inline static Profiler* sInstance{ nullptr };
+
+		/// <summary>
+		/// Incremented for each new instance, invalidating cached thread local buffers of previous sessions.
+		/// </summary>
+		inline static std::atomic<std::uint64_t> sSession{ 0 };
+
+		/// <summary>
+		/// Ring buffer of the calling thread, registered during the session identified by sThreadSession.
+		/// </summary>
+		inline static thread_local ThreadBuffer* sThreadBuffer{ nullptr };
+
+		/// <summary>
+		/// Session for which the ring buffer of the calling thread was registered.
+		/// </summary>
+		inline static thread_local std::uint64_t sThreadSession{ 0 };
+
+		/// <summary>
+		/// Session this instance belongs to.
+		/// </summary>
+		std::uint64_t mSession;
+
+		/// <summary>
+		/// Samples retained by each thread buffer.
+		/// </summary>
+		std::size_t mBufferCapacity;
+
+		/// <summary>
+		/// Measures time since the start of the session.
+		/// </summary>
+		StopWatch mStopWatch;
+
+		/// <summary>
+		/// Current frame index.
+		/// </summary>
+		std::atomic<std::uint64_t> mFrame{ 0 };
+
+		/// <summary>
+		/// Ring buffers of every thread that has recorded a sample during the session.
+		/// </summary>
+		Vector<gsl::owner<ThreadBuffer*>> mThreadBuffers;
+
+		/// <summary>
+		/// Guards registration of new thread buffers.
+		/// </summary>
+		mutable std::mutex mMutex;
+#pragma endregion Data Members
+	};
+}
+
+#pragma region Profiling Macros
+/// <summary>
+/// Profiling macros. Compiled out entirely unless PROFILING_ENABLED is defined.
+/// </summary>
+#ifdef PROFILING_ENABLED
+#define PROFILE_CONCATENATE_IMPL(lhs, rhs) lhs##rhs
+#define PROFILE_CONCATENATE(lhs, rhs) PROFILE_CONCATENATE_IMPL(lhs, rhs)
+#define PROFILE_SCOPE(name) const Library::Profiler::ScopedSample PROFILE_CONCATENATE(profileScope, __LINE__)(name)
+#define PROFILE_FRAME() if (Library::Profiler* profiler = Library::Profiler::Instance()) profiler->BeginFrame()
+#else
+#define PROFILE_SCOPE(name)
+#define PROFILE_FRAME()
+#endif
+#pragma endregion Profiling Macros
+
+// Inline File
+#include "Profiler.inl"
@@ -0,0 +1,74 @@
+#pragma once
+
+// Header
+#include "Profiler.h"
+
+namespace Library
+{
+#pragma region Thread Buffer
+	inline void Profiler::ThreadBuffer::Push(const Sample& sample)
+	{
+		const std::uint64_t head = mHead.load(std::memory_order_relaxed);
+
+		// Claims the slot before overwriting it, so that a concurrent CopyTo that sees the write also sees the claim.
+		mClaimed.store(head + 1, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_release);
+
+		mSamples[head & mMask] = sample;
+		mHead.store(head + 1, std::memory_order_release);
+	}
+#pragma endregion Thread Buffer
+
+#pragma region Scoped Sample
+	inline Profiler::ScopedSample::ScopedSample(const char* name)
+	{
+		Profiler* profiler = sInstance;
+		if (profiler == nullptr) return;
+
+		mBuffer = &profiler->GetThreadBuffer();
+
+		mSample.Name = name;
+		mSample.Frame = profiler->mFrame.load(std::memory_order_relaxed);
+		mSample.Depth = mBuffer->Depth++;
+		mSample.ThreadIndex = mBuffer->ThreadIndex;
+		mSample.Start = profiler->Now();
+	}
+
+	inline Profiler::ScopedSample::~ScopedSample()
+	{
+		if (mBuffer == nullptr) return;
+
+		assert(sInstance != nullptr);
+		mSample.Duration = sInstance->Now() - mSample.Start;
+
+		--mBuffer->Depth;
+		mBuffer->Push(mSample);
+	}
+#pragma endregion Scoped Sample
+
+#pragma region Instance Management
+	inline Profiler* Profiler::Instance()
+	{
+		return sInstance;
+	}
+#pragma endregion Instance Management
+
+#pragma region Accessors
+	inline std::uint64_t Profiler::Frame() const
+	{
+		return mFrame.load(std::memory_order_relaxed);
+	}
+
+	inline std::chrono::nanoseconds Profiler::Now() const
+	{
+		return mStopWatch.Split();
+	}
+#pragma endregion Accessors
+
+#pragma region Modifiers
+	inline void Profiler::BeginFrame()
+	{
+		mFrame.fetch_add(1, std::memory_order_relaxed);
+	}
+#pragma endregion Modifiers
+}
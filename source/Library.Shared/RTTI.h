@@ -60,6 +60,18 @@ namespace Library
 		/// <returns>Type ID associated with the true class type of an instance.</returns>
 		virtual RTTI::IdType TypeIdInstance() const = 0;
 
+		/// <summary>
+		/// Gets the type name associated with this class type.
+		/// </summary>
+		/// <returns>Type name associated with RTTI.</returns>
+		static const char* TypeNameClass() { return "RTTI"; }
+
+		/// <summary>
+		/// Gets the type name associated with the true class type of an instance.
+		/// </summary>
+		/// <returns>Type name associated with the true class type of an instance, with static storage duration.</returns>
+		virtual const char* TypeNameInstance() const { return TypeNameClass(); }
+
 		/// <summary>
 		/// Gets the current instance cast as an RTTI pointer.
 		/// </summary>
@@ -142,6 +154,10 @@ namespace Library
 																																		\
 		virtual Library::RTTI::IdType TypeIdInstance() const override { return TypeIdClass(); }											\
 																																		\
+		static const char* TypeNameClass() { return #Type; }																			\
+																																		\
+		virtual const char* TypeNameInstance() const override { return TypeNameClass(); }												\
+																																		\
 		virtual Library::RTTI* QueryInterface(const Library::RTTI::IdType id) override													\
         {																																\
 			return (id == sRunTimeTypeId ? reinterpret_cast<Library::RTTI*>(this) : ParentType::QueryInterface(id));					\
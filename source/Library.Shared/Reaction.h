@@ -56,6 +56,7 @@ namespace Library
 	protected:
 		/// <summary>
 		/// Specialized constructor for use by derived classes to ensure correct Attribute population.
+		/// Reactions start asleep, since they only act when notified.
 		/// </summary>
 		/// <param name="typeId">Type ID of the derived class.</param>
 		/// <param name="name">Name for the Reaction.</param>
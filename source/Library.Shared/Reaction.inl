@@ -8,6 +8,7 @@ namespace Library
 #pragma region Special Members
 	inline Reaction::Reaction(const IdType typeId, std::string name) : Entity(typeId, std::move(name))
 	{
+		Sleep();
 	}
 #pragma endregion Special Members
 
@@ -100,8 +100,16 @@ namespace Library
 			Entity::Update(message.GetWorld()->GetWorldState());
 			
 			mParameters.Clear();
+
+			Entity* parent = GetParent();
+			if (parent) parent->Wake();
 		}
 	}
+
+	void ReactionAttributed::Retired()
+	{
+		Event<EventMessageAttributed>::Unsubscribe(*this);
+	}
 #pragma endregion Event Subscriber Overrides
 
 #pragma region Scope Overrides
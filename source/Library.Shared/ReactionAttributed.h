@@ -87,10 +87,18 @@ namespace Library
 	public:
 		/// <summary>
 		/// Interface method called by an EventPublisher during Publish to receive the Event.
+		/// After reacting to a matching Event, wakes the parent Entity.
 		/// </summary>
 		/// <param name="eventPublisher">Reference to an Event as an EventPublisher.</param>
 		/// <remarks>Overrides must be thread safe.</remarks>
 		virtual void Notify(EventPublisher& eventPublisher) override;
+
+	protected:
+		/// <summary>
+		/// Unsubscribes from Event&lt;EventMessageAttributed&gt; once the ReactionAttributed is queued for destruction,
+		/// so Events published before it is deleted, possibly on another thread, no longer reach it.
+		/// </summary>
+		virtual void Retired() override;
 #pragma endregion Event Subscriber Overrides
 
 #pragma region Scope Overrides
@@ -0,0 +1,64 @@
+#pragma region Includes
+// Pre-compiled Header
+#include "pch.h"
+
+// Header
+#include "ReclamationQueue.h"
+
+// First Party
+#include "Scope.h"
+#include "Profiler.h"
+#pragma endregion Includes
+
+namespace Library
+{
+#pragma region Special Members
+	ReclamationQueue::~ReclamationQueue()
+	{
+		Wait();
+		Drain();
+	}
+#pragma endregion Special Members
+
+#pragma region Modifiers
+	std::size_t ReclamationQueue::Drain(const std::size_t maxCount)
+	{
+		PROFILE_SCOPE("ReclamationQueue::Drain");
+
+		const std::size_t count = std::min(maxCount, mQueue.Size());
+
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			delete mQueue.Back();
+			mQueue.PopBack();
+		}
+
+		return count;
+	}
+
+	void ReclamationQueue::DrainAsync()
+	{
+		Wait();
+
+		if (mQueue.IsEmpty()) return;
+
+		mBackgroundDrain = std::async(std::launch::async, [queue = std::move(mQueue)]
+		{
+			PROFILE_SCOPE("ReclamationQueue::DrainAsync");
+
+			for (auto* scope : queue)
+			{
+				delete scope;
+			}
+		});
+	}
+
+	void ReclamationQueue::Wait()
+	{
+		if (mBackgroundDrain.valid())
+		{
+			mBackgroundDrain.get();
+		}
+	}
+#pragma endregion Modifiers
+}
@@ -0,0 +1,121 @@
+#pragma once
+
+#pragma region Includes
+// Standard
+#include <future>
+#include <limits>
+
+// Third Party
+#include <gsl/gsl>
+
+// First Party
+#include "Vector.h"
+#pragma endregion Includes
+
+namespace Library
+{
+	// Forward Declarations
+	class Scope;
+
+	/// <summary>
+	/// Queue of orphaned Scope objects awaiting destruction, used to move destructor cost out of the frame that removed them.
+	/// </summary>
+	/// <remarks>
+	/// Queued Scope objects must have no parent and must not be referenced by anything that outlives them, e.g. scheduled wakes.
+	/// Entity objects are retired by their parent before being queued: their wakes are cancelled, they are disabled and they unsubscribe from Events.
+	/// </remarks>
+	class ReclamationQueue final
+	{
+#pragma region Type Definitions, Constants
+	public:
+		/// <summary>
+		/// Drain count representing every queued Scope.
+		/// </summary>
+		inline static constexpr std::size_t All = std::numeric_limits<std::size_t>::max();
+#pragma endregion Type Definitions, Constants
+
+#pragma region Special Members
+	public:
+		/// <summary>
+		/// Default constructor.
+		/// </summary>
+		ReclamationQueue() = default;
+
+		/// <summary>
+		/// Destructor. Waits for any background drain, then destroys every queued Scope.
+		/// </summary>
+		~ReclamationQueue();
+
+		ReclamationQueue(const ReclamationQueue&) = delete;
+		ReclamationQueue& operator=(const ReclamationQueue&) = delete;
+		ReclamationQueue(ReclamationQueue&&) = delete;
+		ReclamationQueue& operator=(ReclamationQueue&&) = delete;
+#pragma endregion Special Members
+
+#pragma region Accessors
+	public:
+		/// <summary>
+		/// Gets the number of Scope objects awaiting destruction, excluding those handed to a background drain.
+		/// </summary>
+		/// <returns>Number of queued Scope objects.</returns>
+		std::size_t Size() const;
+
+		/// <summary>
+		/// Gets whether any Scope objects are awaiting destruction, excluding those handed to a background drain.
+		/// </summary>
+		/// <returns>True when no Scope objects are queued. Otherwise, false.</returns>
+		bool IsEmpty() const;
+
+		/// <summary>
+		/// Gets whether a background drain is still running.
+		/// </summary>
+		/// <returns>True when a background drain has not yet finished. Otherwise, false.</returns>
+		bool IsDraining() const;
+#pragma endregion Accessors
+
+#pragma region Modifiers
+	public:
+		/// <summary>
+		/// Takes ownership of an orphaned Scope, deferring its destruction.
+		/// </summary>
+		/// <param name="scope">Scope to be destroyed later.</param>
+		void Enqueue(gsl::owner<Scope*> scope);
+
+		/// <summary>
+		/// Destroys up to the given number of queued Scope objects on the calling thread, most recently queued first.
+		/// </summary>
+		/// <param name="maxCount">Maximum number of Scope objects to be destroyed.</param>
+		/// <returns>Number of Scope objects destroyed.</returns>
+		std::size_t Drain(const std::size_t maxCount=All);
+
+		/// <summary>
+		/// Hands every queued Scope to a worker thread for destruction, after waiting for any previous background drain.
+		/// </summary>
+		/// <remarks>
+		/// Destructors run concurrently with the caller. Retired Entity objects are no longer subscribed, so Events may still be published meanwhile.
+		/// </remarks>
+		void DrainAsync();
+
+		/// <summary>
+		/// Blocks until any background drain has finished.
+		/// </summary>
+		void Wait();
+#pragma endregion Modifiers
+
+#pragma region Data Members
+	private:
+		/// <summary>
+		/// Scope objects awaiting destruction.
+		/// </summary>
+		Vector<gsl::owner<Scope*>> mQueue;
+
+		/// <summary>
+		/// Result of the most recent background drain.
+		/// </summary>
+		std::future<void> mBackgroundDrain;
+#pragma endregion Data Members
+	};
+}
+
+// Inline File
+#include "ReclamationQueue.inl"
@@ -0,0 +1,32 @@
+#pragma once
+
+// Header
+#include "ReclamationQueue.h"
+
+namespace Library
+{
+#pragma region Accessors
+	inline std::size_t ReclamationQueue::Size() const
+	{
+		return mQueue.Size();
+	}
+
+	inline bool ReclamationQueue::IsEmpty() const
+	{
+		return mQueue.IsEmpty();
+	}
+
+	inline bool ReclamationQueue::IsDraining() const
+	{
+		return mBackgroundDrain.valid() && mBackgroundDrain.wait_for(std::chrono::seconds(0)) != std::future_status::ready;
+	}
+#pragma endregion Accessors
+
+#pragma region Modifiers
+	inline void ReclamationQueue::Enqueue(gsl::owner<Scope*> scope)
+	{
+		assert(scope != nullptr);
+		mQueue.EmplaceBack(scope);
+	}
+#pragma endregion Modifiers
+}
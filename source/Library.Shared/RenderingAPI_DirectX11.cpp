@@ -33,12 +33,12 @@ namespace Library
 		ID3D11Buffer* indexBuffer = nullptr;
 		
 		D3D11_BUFFER_DESC indexBufferDesc{ 0 };
-		indexBufferDesc.ByteWidth = gsl::narrow_cast<uint32_t>(sizeof(uint32_t) * mesh.Indices().Size());
+		indexBufferDesc.ByteWidth = gsl::narrow_cast<uint32_t>(sizeof(uint32_t) * mesh.Indices().size());
 		indexBufferDesc.Usage = D3D11_USAGE_IMMUTABLE;
 		indexBufferDesc.BindFlags = D3D11_BIND_INDEX_BUFFER;
 
 		D3D11_SUBRESOURCE_DATA indexSubResourceData{ 0 };
-		indexSubResourceData.pSysMem = &mesh.Indices()[0];
+		indexSubResourceData.pSysMem = mesh.Indices().data();
 
 		if (FAILED(mDevice.DevicePtr->CreateBuffer(&indexBufferDesc, &indexSubResourceData, &indexBuffer)))
 		{
@@ -574,6 +574,22 @@ namespace Library
 		/// <exception cref="runtime_error">Invalid Iterator.</exception>
 		bool Remove(const Iterator& it);
 
+		/// <summary>
+		/// Removes the element following the given Iterator, leaving every other element in place.
+		/// </summary>
+		/// <param name="position">Iterator referencing the element before the one to be removed.</param>
+		/// <returns>True on successful remove, false if no element follows the Iterator.</returns>
+		/// <exception cref="runtime_error">Invalid Iterator.</exception>
+		bool RemoveAfter(const Iterator& position);
+
+		/// <summary>
+		/// Moves the first node of another SList to the back of the SList.
+		/// The element is neither copied nor moved, so references to it remain valid.
+		/// </summary>
+		/// <param name="source">SList whose first node is moved.</param>
+		/// <exception cref="runtime_error">Source SList is empty.</exception>
+		void SpliceFront(SList& source);
+
 		/// <summary>
 		/// Removes all elements from the SList and resets the size to zero.
 		/// </summary>
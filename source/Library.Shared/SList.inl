@@ -595,6 +595,54 @@ namespace Library
 		return isRemoved;
 	}
 
+	template<typename T>
+	inline bool SList<T>::RemoveAfter(const Iterator& position)
+	{
+		if (position.mOwner != this)
+		{
+			throw std::runtime_error("Invalid iterator.");
+		}
+
+		if (position == end() || position.mNode->Next == nullptr) return false;
+
+		std::shared_ptr<Node> removed = position.mNode->Next;
+		position.mNode->Next = removed->Next;
+
+		if (removed == mBack)
+		{
+			mBack = position.mNode;
+		}
+
+		--mSize;
+
+		return true;
+	}
+
+	template<typename T>
+	inline void SList<T>::SpliceFront(SList& source)
+	{
+		if (source.mSize == 0)
+		{
+			throw std::runtime_error("Source list is empty.");
+		}
+
+		std::shared_ptr<Node> node = source.mFront;
+		source.PopFront();
+		node->Next = nullptr;
+
+		if (mSize == 0)
+		{
+			mFront = node;
+		}
+		else
+		{
+			mBack->Next = node;
+		}
+
+		mBack = node;
+		++mSize;
+	}
+
 	template<typename T>
 	inline void SList<T>::Clear()
 	{
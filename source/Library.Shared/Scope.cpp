@@ -3,6 +3,7 @@
 #include "pch.h"
 
 // Standard
+#include <atomic>
 #include <sstream>
 
 // Header
@@ -26,7 +27,7 @@ namespace Library
 	}
 
 	Scope::Scope(const Scope& rhs) :
-		mPairPtrs(rhs.mPairPtrs.Size()), mTable(rhs.mTable.BucketCount())
+		mPairPtrs(rhs.mPairPtrs.Size()), mTable(rhs.mTable.BucketCount()), mEmptyChildEntryCount(rhs.mEmptyChildEntryCount)
 	{
 		for (const auto& tableEntryPtr : rhs.mPairPtrs)
 		{
@@ -37,9 +38,7 @@ namespace Library
 				
 				for (std::size_t i = 0; i < tableEntryPtr->second.Size(); ++i)
 				{
-					mChildren.EmplaceBack(tableEntryPtr->second[i].Clone());
-					mChildren.Back()->mParent = this;
-					data.EmplaceBack<Scope*>(mChildren.Back());
+					data.EmplaceBack<Scope*>(&AttachChild(*tableEntryPtr->second[i].Clone()));
 				}
 
 				mPairPtrs.EmplaceBack(&(*mTable.TryEmplace(tableEntryPtr->first, data).first));
@@ -54,6 +53,7 @@ namespace Library
 	Scope& Scope::operator=(const Scope& rhs)
 	{
 		Clear();
+		TouchStructure();
 
 		mTable = Table(rhs.mTable.BucketCount());
 		
@@ -69,9 +69,7 @@ namespace Library
 				
 				for (std::size_t i = 0; i < tableEntryPtr->second.Size(); ++i)
 				{
-					mChildren.EmplaceBack(tableEntryPtr->second[i].Clone());
-					mChildren.Back()->mParent = this;
-					data.EmplaceBack<Scope*>(mChildren.Back());
+					data.EmplaceBack<Scope*>(&AttachChild(*tableEntryPtr->second[i].Clone()));
 				}
 
 				mPairPtrs.EmplaceBack(&(*mTable.TryEmplace(tableEntryPtr->first, data).first));
@@ -82,12 +80,18 @@ namespace Library
 			}
 		}
 
+		mEmptyChildEntryCount = rhs.mEmptyChildEntryCount;
+
 		return *this;
 	}
 
 	Scope::Scope(Scope&& rhs) noexcept :
-		mParent(rhs.mParent), mPairPtrs(std::move(rhs.mPairPtrs)), mTable(std::move(rhs.mTable)), mChildren(std::move(rhs.mChildren))
+		mParent(rhs.mParent), mPairPtrs(std::move(rhs.mPairPtrs)), mTable(std::move(rhs.mTable)), mChildren(std::move(rhs.mChildren)),
+		mEmptyChildEntryCount(rhs.mEmptyChildEntryCount)
 	{
+		rhs.mEmptyChildEntryCount = 0;
+		rhs.TouchStructure();
+
 		for (auto& child : mChildren)
 		{
 			child->mParent = this;
@@ -95,7 +99,8 @@ namespace Library
 
 		if (rhs.mParent)
 		{
-			*rhs.mParent->mChildren.Find(&rhs) = this;
+			rhs.mParent->mChildren[rhs.mChildIndex] = this;
+			mChildIndex = rhs.mChildIndex;
 
 			auto [data, index] = rhs.mParent->FindScope(rhs);
 			assert(data != nullptr);
@@ -118,6 +123,10 @@ namespace Library
 		mTable = std::move(rhs.mTable);
 		mPairPtrs = std::move(rhs.mPairPtrs);
 		mChildren = std::move(rhs.mChildren);
+		mEmptyChildEntryCount = rhs.mEmptyChildEntryCount;
+		rhs.mEmptyChildEntryCount = 0;
+		rhs.TouchStructure();
+		TouchStructure();
 
 		for (auto& child : mChildren)
 		{
@@ -126,7 +135,8 @@ namespace Library
 
 		if (rhs.mParent)
 		{
-			*rhs.mParent->mChildren.Find(&rhs) = this;
+			rhs.mParent->mChildren[rhs.mChildIndex] = this;
+			mChildIndex = rhs.mChildIndex;
 
 			auto [data, index] = rhs.mParent->FindScope(rhs);
 			assert(data != nullptr);
@@ -155,9 +165,7 @@ namespace Library
 
 				for (std::size_t i = 0; i < tableEntry.second.Size(); ++i)
 				{
-					mChildren.EmplaceBack(tableEntry.second[i].Clone());
-					mChildren.Back()->mParent = this;
-					data.EmplaceBack<Scope*>(mChildren.Back());
+					data.EmplaceBack<Scope*>(&AttachChild(*tableEntry.second[i].Clone()));
 
 					auto [it, isNew] = mTable.TryEmplace(tableEntry.first, Data(mChildren.Back()));
 					if (isNew) mPairPtrs.EmplaceBack(&(*it));
@@ -174,6 +182,7 @@ namespace Library
 	Scope& Scope::operator=(std::initializer_list<Attribute> rhs)
 	{
 		Clear();
+		TouchStructure();
 		
 		mTable = Table(Math::FindNextPrime(rhs.size()));
 
@@ -194,9 +203,7 @@ namespace Library
 
 				for (std::size_t i = 0; i < tableEntry.second.Size(); ++i)
 				{
-					mChildren.EmplaceBack(tableEntry.second[i].Clone());
-					mChildren.Back()->mParent = this;
-					data.EmplaceBack<Scope*>(mChildren.Back());
+					data.EmplaceBack<Scope*>(&AttachChild(*tableEntry.second[i].Clone()));
 
 					auto [it, isNew] = mTable.TryEmplace(tableEntry.first, Data(mChildren.Back()));
 					if (isNew) mPairPtrs.EmplaceBack(&(*it));
@@ -277,6 +284,21 @@ namespace Library
 			mPairPtrs.ShrinkToFit();
 		}
 	}
+
+	void Scope::Compact()
+	{
+		Table table(Math::FindNextPrime(mPairPtrs.Size()));
+
+		for (auto& pairPtr : mPairPtrs)
+		{
+			pairPtr = &(*table.TryEmplace(pairPtr->first, std::move(pairPtr->second)).first);
+		}
+
+		mTable = std::move(table);
+
+		mPairPtrs.ShrinkToFit();
+		TouchStructure();
+	}
 #pragma endregion Size and Capacity
 
 #pragma region Accessors
@@ -398,9 +420,16 @@ namespace Library
 		if (key.empty()) throw std::runtime_error("Name cannot be empty.");
 
 		auto [it, isNew] = mTable.TryEmplace(key, Data());
-		if (isNew) mPairPtrs.EmplaceBack(&(*it));
+		Data& data = it->second;
+
+		if (isNew)
+		{
+			mPairPtrs.EmplaceBack(&(*it));
+			GrowTable();
+			TouchStructure();
+		}
 
-		return it->second;
+		return data;
 	}
 
 	Scope& Scope::AppendScope(const Key& key, const std::size_t capacity)
@@ -414,17 +443,18 @@ namespace Library
 			throw std::runtime_error("Table entry already exists with a non-Scope type.");
 		}
 
-		Scope* child = new Scope(std::max(Table::DefaultBucketCount, Math::FindNextPrime(capacity)));
-		child->mParent = this;
-		mChildren.EmplaceBack(child);
+		Scope* child = &AttachChild(*new Scope(std::max(Table::DefaultBucketCount, Math::FindNextPrime(capacity))));
 
 		if (data)
 		{
+			if (data->Type() == Types::Scope && data->IsEmpty() && mEmptyChildEntryCount > 0) --mEmptyChildEntryCount;
 			data->EmplaceBack<Scope*>(child);
 		}
 		else
 		{
 			mPairPtrs.EmplaceBack(&(*mTable.TryEmplace(key, Data(mChildren.Back())).first));
+			GrowTable();
+			TouchStructure();
 		}
 
 		return *child;
@@ -437,12 +467,37 @@ namespace Library
 		if (data == nullptr) throw std::runtime_error("Child Scope not found.");
 
 		data->RemoveAt(index);
-		mChildren.Remove(&child);
-		child.mParent = nullptr;
+		DetachChild(child);
 
 		return &child;
 	}
 
+	gsl::owner<Scope*> Scope::Orphan(Scope& child, const Key& key)
+	{
+		Data* data = Find(key);
+
+		if (data && data->Type() == Types::Scope)
+		{
+			for (std::size_t i = data->Size(); i > 0; --i)
+			{
+				if (data->Get<Data::ScopePointer>(i - 1) == &child)
+				{
+					data->RemoveAt(i - 1);
+					DetachChild(child);
+
+					if (data->IsEmpty() && ++mEmptyChildEntryCount * 2 > mPairPtrs.Size())
+					{
+						EraseEmptyChildEntries();
+					}
+
+					return &child;
+				}
+			}
+		}
+
+		return Orphan(child);
+	}
+
 	Scope& Scope::Adopt(Scope& child, const Key& key)
 	{
 		if (this == &child)			throw std::runtime_error("Cannot adopt self.");
@@ -456,26 +511,29 @@ namespace Library
 			throw std::runtime_error("Table entry already exists with a non-Scope type.");
 		}
 	
-		Scope* orphan = child.mParent ? child.mParent->Orphan(child) : &child;
-		orphan->mParent = this;
-		mChildren.EmplaceBack(orphan);
+		Scope* orphan = &AttachChild(child.mParent ? *child.mParent->Orphan(child) : child);
 
 		if (data)
 		{
+			if (data->Type() == Types::Scope && data->IsEmpty() && mEmptyChildEntryCount > 0) --mEmptyChildEntryCount;
 			data->EmplaceBack<Scope*>(orphan);
 		}
 		else
 		{
 			mPairPtrs.EmplaceBack(&(*mTable.TryEmplace(key, Data(mChildren.Back())).first));
+			GrowTable();
+			TouchStructure();
 		}
 
-		return *mChildren.Back();
+		return *orphan;
 	}
 
 	void Scope::Clear()
 	{
 		mTable.Clear();
 		mPairPtrs.Clear();
+		mEmptyChildEntryCount = 0;
+		TouchStructure();
 
 		for (auto& child : mChildren)
 		{
@@ -492,6 +550,76 @@ namespace Library
 #pragma endregion Modifiers
 
 #pragma region Helper Methods
+	std::size_t Scope::PinnedAttributeCount() const
+	{
+		return 0;
+	}
+
+	Scope& Scope::AttachChild(Scope& child)
+	{
+		child.mParent = this;
+		child.mChildIndex = mChildren.Size();
+		mChildren.EmplaceBack(&child);
+
+		return child;
+	}
+
+	void Scope::DetachChild(Scope& child)
+	{
+		assert(child.mParent == this && mChildren[child.mChildIndex] == &child);
+
+		if (child.mChildIndex != mChildren.Size() - 1)
+		{
+			mChildren[child.mChildIndex] = mChildren.Back();
+			mChildren[child.mChildIndex]->mChildIndex = child.mChildIndex;
+		}
+
+		mChildren.PopBack();
+		child.mParent = nullptr;
+	}
+
+	void Scope::GrowTable()
+	{
+		if (mTable.Size() > mTable.BucketCount() * MaxLoadFactor)
+		{
+			mTable.Rehash(Math::FindNextPrime(mTable.Size() * MaxLoadFactor));
+		}
+	}
+
+	void Scope::EraseEmptyChildEntries()
+	{
+		std::size_t count = PinnedAttributeCount();
+
+		for (std::size_t i = count; i < mPairPtrs.Size(); ++i)
+		{
+			Attribute* pairPtr = mPairPtrs[i];
+
+			if (pairPtr->second.Type() == Types::Scope && pairPtr->second.IsEmpty())
+			{
+				mTable.Remove(pairPtr->first);
+			}
+			else
+			{
+				mPairPtrs[count++] = pairPtr;
+			}
+		}
+
+		mPairPtrs.Resize(count);
+		mEmptyChildEntryCount = 0;
+		TouchStructure();
+	}
+
+	void Scope::TouchStructure()
+	{
+		mStructureVersion = NextStructureVersion();
+	}
+
+	std::uint64_t Scope::NextStructureVersion()
+	{
+		static std::atomic<std::uint64_t> sNextVersion{ 1 };
+		return sNextVersion.fetch_add(1, std::memory_order_relaxed);
+	}
+
 	Scope::Data* Scope::SearchChildrenHelper(const Vector<Scope*>& queue, const Key& key, Scope** scopePtrOut)
 	{
 		Vector<Scope*> newQueue;
@@ -520,6 +648,16 @@ namespace Library
 		return nullptr;
 	}
 #pragma endregion Helper Methods
+
+#pragma region Lineage
+	Scope::Lineage::Lineage(const Scope& scope)
+	{
+		for (const Scope* current = &scope; current != nullptr; current = current->mParent)
+		{
+			mLinks.EmplaceBack(Link{ current, current->mStructureVersion });
+		}
+	}
+#pragma endregion Lineage
 	
 #pragma region RTTI Overrides
 	std::string Scope::ToString() const
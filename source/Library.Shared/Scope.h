@@ -2,6 +2,7 @@
 
 #pragma region Includes
 // Standard
+#include <cstdint>
 #include <string>
 
 // Third Party
@@ -50,6 +51,17 @@ namespace Library
 		/// Attribute type defining a key and data value pair.
 		/// </summary>
 		using Attribute = Table::Pair;
+
+		/// <summary>
+		/// Snapshot of a Scope and its ancestors, used to tell when a cached Search result may be stale.
+		/// </summary>
+		class Lineage;
+
+	private:
+		/// <summary>
+		/// Average number of Attributes per bucket above which the table grows.
+		/// </summary>
+		inline static constexpr std::size_t MaxLoadFactor = 2;
 #pragma endregion Type Definitions and Constants
 
 #pragma region Constructors, Destructor, Assignment
@@ -176,6 +188,15 @@ namespace Library
 		/// Otherwise, a Reserve call should be made to specify the new desired capacity.
 		/// </remarks>
 		void ShrinkToFit();
+
+		/// <summary>
+		/// Rebuilds the table with the smallest prime bucket count that holds the content size, and trims the order list to fit.
+		/// </summary>
+		/// <remarks>
+		/// Unlike ShrinkToFit, this may go below the default bucket count, and keeps every attribute in place, including external storage.
+		/// Copies of a Scope inherit its bucket count, so compacting a Scope that is cloned many times keeps every copy small.
+		/// </remarks>
+		void Compact();
 #pragma endregion Size and Capacity
 
 #pragma region Accessors
@@ -312,6 +333,13 @@ namespace Library
 		/// </summary>
 		/// <param name="functor">Function object to be called on each Attribute.</param>
 		void ForEachAttribute(const std::function<void(const Attribute&)>& functor) const;
+
+		/// <summary>
+		/// Gets the structure version of the Scope, which changes whenever Attributes are added to or removed from it, or moved to new storage.
+		/// Versions are drawn from a single counter, so a Scope never shares a version with another Scope, including one it took the address of.
+		/// </summary>
+		/// <returns>Structure version of the Scope.</returns>
+		std::uint64_t StructureVersion() const;
 #pragma endregion Accessors
 
 #pragma region Modifiers
@@ -341,6 +369,16 @@ namespace Library
 		/// <returns>True, if the child was successfully orphaned. Otherwise, false.</returns>
 		gsl::owner<Scope*> Orphan(Scope& child);
 
+		/// <summary>
+		/// Removes a child Scope, given its address and the Key value it is expected to be found under.
+		/// Runs in constant time when the child is found under the given Key, otherwise falls back to a full search.
+		/// Attributes left without children by this overload are erased in a batch once they make up half of the Scope.
+		/// </summary>
+		/// <param name="child">Scope to remove from the Table.</param>
+		/// <param name="key">Key value of the Attribute expected to hold the child.</param>
+		/// <returns>Owning pointer to the orphaned child.</returns>
+		gsl::owner<Scope*> Orphan(Scope& child, const Key& key);
+
 		/// <summary>
 		/// Appends an existing Scope, calling Orphan as needed on the previous parent.
 		/// </summary>
@@ -356,6 +394,13 @@ namespace Library
 #pragma endregion Modifiers
 
 #pragma region Helper Methods
+	protected:
+		/// <summary>
+		/// Gets the number of leading Attributes that are never erased, even when left without children.
+		/// </summary>
+		/// <returns>Number of leading Attributes kept in place.</returns>
+		virtual std::size_t PinnedAttributeCount() const;
+
 	private:
 		/// <summary>
 		/// SearchChildren helper method. 
@@ -366,6 +411,40 @@ namespace Library
 		/// <param name="scopePtrOut">Output parameter that points to the Scope which owns the found Attribute.</param>
 		/// <returns>If found, a pointer to the Data value of the Attribute. Otherwise, nullptr.</returns>
 		static Data* SearchChildrenHelper(const Vector<Scope*>& queue, const Key& key, Scope** scopePtrOut=nullptr);
+
+		/// <summary>
+		/// Sets the Scope as the parent of a child and appends the child to the child list.
+		/// </summary>
+		/// <param name="child">Scope without a parent.</param>
+		/// <returns>Reference to the child.</returns>
+		Scope& AttachChild(Scope& child);
+
+		/// <summary>
+		/// Removes a child from the child list by swapping in the last child, and clears its parent.
+		/// </summary>
+		/// <param name="child">Child of the Scope.</param>
+		void DetachChild(Scope& child);
+
+		/// <summary>
+		/// Grows the table once the number of Attributes exceeds MaxLoadFactor per bucket. Attributes keep their addresses.
+		/// </summary>
+		void GrowTable();
+
+		/// <summary>
+		/// Erases every Attribute past the pinned Attributes that holds the Scope type without any children, preserving the order of the rest.
+		/// </summary>
+		void EraseEmptyChildEntries();
+
+		/// <summary>
+		/// Assigns the Scope a new structure version, invalidating every Lineage taken through it.
+		/// </summary>
+		void TouchStructure();
+
+		/// <summary>
+		/// Draws the next unused structure version.
+		/// </summary>
+		/// <returns>Structure version.</returns>
+		static std::uint64_t NextStructureVersion();
 #pragma endregion Helper Methods
 
 #pragma region RTTI Overrides
@@ -403,11 +482,83 @@ namespace Library
 		Table mTable;
 
 		/// <summary>
-		/// SList containing child Scopes.
+		/// Vector containing child Scopes.
 		/// </summary>
 		Vector<Scope*> mChildren;
+
+		/// <summary>
+		/// Index of the Scope within the child list of its parent, if a child.
+		/// </summary>
+		std::size_t mChildIndex{ 0 };
+
+		/// <summary>
+		/// Number of Attributes left without children by Orphan, awaiting erasure.
+		/// </summary>
+		std::size_t mEmptyChildEntryCount{ 0 };
+
+		/// <summary>
+		/// Structure version of the Scope.
+		/// </summary>
+		std::uint64_t mStructureVersion{ NextStructureVersion() };
 #pragma endregion Data Members
 	};
+
+	/// <summary>
+	/// Records a Scope and each of its ancestors along with their structure versions.
+	/// </summary>
+	/// <remarks>
+	/// A Search from a Scope sees the same Attributes, at the same addresses, for as long as a Lineage taken from it still matches.
+	/// A Lineage stops matching once a Scope along the chain gains or loses Attributes, or any Scope along the chain is given a new parent.
+	/// Changes to the values of Attributes, including their type and size, are not tracked.
+	/// </remarks>
+	class Scope::Lineage final
+	{
+	public:
+		/// <summary>
+		/// Default constructor, for an empty Lineage that matches no Scope.
+		/// </summary>
+		Lineage() = default;
+
+		/// <summary>
+		/// Takes the Lineage of a Scope.
+		/// </summary>
+		/// <param name="scope">Scope to record along with its ancestors.</param>
+		explicit Lineage(const Scope& scope);
+
+		/// <summary>
+		/// Gets whether the Lineage is empty.
+		/// </summary>
+		/// <returns>True when empty. Otherwise, false.</returns>
+		bool IsEmpty() const;
+
+		/// <summary>
+		/// Gets whether the Lineage was taken from the given Scope, and neither it nor its ancestors have changed structure since.
+		/// Runs in time linear to the depth of the Scope.
+		/// </summary>
+		/// <param name="scope">Scope to compare against.</param>
+		/// <returns>True when matching. Otherwise, false.</returns>
+		bool Matches(const Scope& scope) const;
+
+		/// <summary>
+		/// Empties the Lineage.
+		/// </summary>
+		void Clear();
+
+	private:
+		/// <summary>
+		/// Scope of the chain, along with its structure version when recorded.
+		/// </summary>
+		struct Link final
+		{
+			const Scope* Owner{ nullptr };
+			std::uint64_t Version{ 0 };
+		};
+
+		/// <summary>
+		/// Recorded Scope and ancestors, starting at the Scope itself.
+		/// </summary>
+		Vector<Link> mLinks{ Vector<Link>::EqualityFunctor() };
+	};
 }
 
 // Inline File
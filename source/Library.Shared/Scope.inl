@@ -61,5 +61,38 @@ namespace Library
 	{
 		return index < mPairPtrs.Size() ? &mPairPtrs[index]->first : nullptr;
 	}
+
+	inline std::uint64_t Scope::StructureVersion() const
+	{
+		return mStructureVersion;
+	}
 #pragma endregion Accessors
+
+#pragma region Lineage
+	inline bool Scope::Lineage::IsEmpty() const
+	{
+		return mLinks.IsEmpty();
+	}
+
+	inline bool Scope::Lineage::Matches(const Scope& scope) const
+	{
+		if (mLinks.IsEmpty()) return false;
+
+		const Scope* current = &scope;
+
+		for (const auto& link : mLinks)
+		{
+			if (current != link.Owner || current->mStructureVersion != link.Version) return false;
+
+			current = current->mParent;
+		}
+
+		return current == nullptr;
+	}
+
+	inline void Scope::Lineage::Clear()
+	{
+		mLinks.Clear();
+	}
+#pragma endregion Lineage
 }
\ No newline at end of file
@@ -17,6 +17,7 @@ namespace Library
 		const std::chrono::microseconds& Elapsed() const;
 		std::chrono::milliseconds ElapsedMilliseconds() const;
 		std::chrono::seconds ElapsedSeconds() const;
+		std::chrono::nanoseconds Split() const;
 		bool IsRunning() const;
 
 		void Reset();
@@ -17,6 +17,13 @@ namespace Library
 		return std::chrono::duration_cast<std::chrono::seconds>(mElapsedTime);
 	}
 
+	inline std::chrono::nanoseconds StopWatch::Split() const
+	{
+		if (!mIsRunning) return mElapsedTime;
+
+		return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::high_resolution_clock::now() - mStartTime);
+	}
+
 	inline bool StopWatch::IsRunning() const
 	{
 		return mIsRunning;
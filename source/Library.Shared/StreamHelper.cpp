@@ -5,6 +5,9 @@
 // Header
 #include "StreamHelper.h"
 
+// Standard
+#include <cstring>
+
 // First Party
 #include "Transform.h"
 #pragma endregion Includes
@@ -55,9 +58,13 @@ namespace Library
 		return *this;
 	}
 
-	OutputStreamHelper& OutputStreamHelper::operator<<(float value)
+	OutputStreamHelper& OutputStreamHelper::operator<<(const float value)
 	{
-		mStream.write(reinterpret_cast<char*>(&value), sizeof(float));
+		// Written through its bit pattern, so it is little endian like every other scalar.
+		static_assert(sizeof(float) == sizeof(std::uint32_t));
+		std::uint32_t bits;
+		std::memcpy(&bits, &value, sizeof(bits));
+		WriteObject(mStream, bits);
 
 		return *this;
 	}
@@ -73,15 +80,7 @@ namespace Library
 
 	OutputStreamHelper& OutputStreamHelper::operator<<(const glm::mat4x4& value)
 	{
-		for (int i = 0; i < 4; i++)
-		{
-			for (int j = 0; j < 4; j++)
-			{
-				*this << value[i][j];
-			}
-		}
-
-		return *this;
+		return WriteArray(gsl::span<const float>(glm::value_ptr(value), 16));
 	}
 
 	OutputStreamHelper& OutputStreamHelper::operator<<(const Transform& value)
@@ -160,7 +159,9 @@ namespace Library
 
 	InputStreamHelper& InputStreamHelper::operator>>(float& value)
 	{
-		mStream.read(reinterpret_cast<char*>(&value), sizeof(float));
+		std::uint32_t bits;
+		ReadObject(mStream, bits);
+		std::memcpy(&value, &bits, sizeof(value));
 
 		return *this;
 	}
@@ -178,15 +179,7 @@ namespace Library
 
 	InputStreamHelper& InputStreamHelper::operator>>(glm::mat4x4& value)
 	{
-		for (int i = 0; i < 4; i++)
-		{
-			for (int j = 0; j < 4; j++)
-			{
-				*this >> value[i][j];
-			}
-		}
-
-		return *this;
+		return ReadArray(gsl::span<float>(glm::value_ptr(value), 16));
 	}
 
 	InputStreamHelper& InputStreamHelper::operator>>(bool& value)
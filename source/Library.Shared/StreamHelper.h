@@ -1,9 +1,48 @@
 #pragma once
 
+#pragma region Includes
+// Standard
+#include <cstdint>
+#include <type_traits>
+
+// Third Party
+#include <gsl/gsl>
+
+// First Party
+#include "Vector.h"
+#pragma endregion Includes
+
 namespace Library
 {
 	class Transform;
 
+	/// <summary>
+	/// Gets the scalar type an element is made of, e.g. float for glm::vec3, used to order the bytes of bulk arrays.
+	/// </summary>
+	template <typename T, typename = void>
+	struct StreamScalar final
+	{
+		using Type = T;
+	};
+
+	template <typename T>
+	struct StreamScalar<T, std::void_t<typename T::value_type>> final
+	{
+		using Type = typename T::value_type;
+	};
+
+	/// <summary>
+	/// Reverses the bytes of each scalar in a buffer, converting it between little and big endian order.
+	/// </summary>
+	/// <param name="bytes">Buffer of scalars.</param>
+	template <typename TScalar>
+	void SwapScalarBytes(gsl::span<std::byte> bytes);
+
+	/// <summary>
+	/// Gets whether the machine stores scalars in little endian order, the order of the stream helpers' bulk arrays.
+	/// </summary>
+	bool IsLittleEndianMachine();
+
 	class OutputStreamHelper final
 	{
 	public:
@@ -26,6 +65,20 @@ namespace Library
 		OutputStreamHelper& operator<<(const glm::mat4x4& value);
 		OutputStreamHelper& operator<<(const Transform& value);
 		OutputStreamHelper& operator<<(const bool value);
+
+		/// <summary>
+		/// Writes an array of trivially copyable elements with a single write, in little endian order.
+		/// </summary>
+		/// <param name="values">Elements to be written, each made of scalars of one type.</param>
+		template <typename T>
+		OutputStreamHelper& WriteArray(gsl::span<const T> values);
+
+		/// <summary>
+		/// Writes the size of a Vector as a 32 bit count, followed by its elements with a single write.
+		/// </summary>
+		/// <param name="values">Elements to be written, each made of scalars of one type.</param>
+		template <typename T>
+		OutputStreamHelper& WriteArray(const Vector<T>& values);
 		
 	private:
 		template <typename T>
@@ -55,6 +108,20 @@ namespace Library
 		InputStreamHelper& operator>>(std::string& value);
 		InputStreamHelper& operator>>(glm::mat4x4& value);
 		InputStreamHelper& operator>>(bool& value);
+
+		/// <summary>
+		/// Reads an array of trivially copyable elements with a single read, from little endian order.
+		/// </summary>
+		/// <param name="values">Elements to be read into, each made of scalars of one type.</param>
+		template <typename T>
+		InputStreamHelper& ReadArray(gsl::span<T> values);
+
+		/// <summary>
+		/// Reads a 32 bit count, resizes a Vector to it and reads its elements with a single read.
+		/// </summary>
+		/// <param name="values">Vector to be read into, each element made of scalars of one type.</param>
+		template <typename T>
+		InputStreamHelper& ReadArray(Vector<T>& values);
 		
 	private:
 		template <typename T>
@@ -62,4 +129,7 @@ namespace Library
 
 		std::istream& mStream;
 	};
-}
\ No newline at end of file
+}
+
+// Inline File
+#include "StreamHelper.inl"
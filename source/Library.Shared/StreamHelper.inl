@@ -0,0 +1,101 @@
+#pragma once
+
+// Header
+#include "StreamHelper.h"
+
+// Standard
+#include <algorithm>
+#include <cstring>
+
+namespace Library
+{
+#pragma region Byte Order
+	template <typename TScalar>
+	inline void SwapScalarBytes(gsl::span<std::byte> bytes)
+	{
+		for (auto scalar = bytes.begin(); scalar != bytes.end(); scalar += sizeof(TScalar))
+		{
+			std::reverse(scalar, scalar + sizeof(TScalar));
+		}
+	}
+
+	inline bool IsLittleEndianMachine()
+	{
+		const std::uint16_t value = 1;
+		return *reinterpret_cast<const std::uint8_t*>(&value) == 1;
+	}
+#pragma endregion Byte Order
+
+#pragma region OutputStreamHelper
+	template <typename T>
+	inline OutputStreamHelper& OutputStreamHelper::WriteArray(gsl::span<const T> values)
+	{
+		using TScalar = typename StreamScalar<T>::Type;
+		static_assert(std::is_trivially_copyable_v<T>, "Bulk arrays must be trivially copyable.");
+		static_assert(sizeof(T) % sizeof(TScalar) == 0, "Bulk array elements must be made of scalars of one type.");
+
+		if (values.empty())
+		{
+			return *this;
+		}
+
+		if (IsLittleEndianMachine())
+		{
+			mStream.write(reinterpret_cast<const char*>(values.data()), values.size_bytes());
+		}
+		else
+		{
+			Vector<std::byte> bytes(values.size_bytes());
+			bytes.Resize(values.size_bytes());
+			std::memcpy(&bytes[0], values.data(), values.size_bytes());
+			SwapScalarBytes<TScalar>(gsl::span<std::byte>(&bytes[0], bytes.Size()));
+			mStream.write(reinterpret_cast<const char*>(&bytes[0]), bytes.Size());
+		}
+
+		return *this;
+	}
+
+	template <typename T>
+	inline OutputStreamHelper& OutputStreamHelper::WriteArray(const Vector<T>& values)
+	{
+		*this << gsl::narrow_cast<std::uint32_t>(values.Size());
+
+		return (values.IsEmpty() ? *this : WriteArray(gsl::span<const T>(&values[0], values.Size())));
+	}
+#pragma endregion OutputStreamHelper
+
+#pragma region InputStreamHelper
+	template <typename T>
+	inline InputStreamHelper& InputStreamHelper::ReadArray(gsl::span<T> values)
+	{
+		using TScalar = typename StreamScalar<T>::Type;
+		static_assert(std::is_trivially_copyable_v<T>, "Bulk arrays must be trivially copyable.");
+		static_assert(sizeof(T) % sizeof(TScalar) == 0, "Bulk array elements must be made of scalars of one type.");
+
+		if (values.empty())
+		{
+			return *this;
+		}
+
+		mStream.read(reinterpret_cast<char*>(values.data()), values.size_bytes());
+
+		if (!IsLittleEndianMachine())
+		{
+			SwapScalarBytes<TScalar>(gsl::span<std::byte>(reinterpret_cast<std::byte*>(values.data()), values.size_bytes()));
+		}
+
+		return *this;
+	}
+
+	template <typename T>
+	inline InputStreamHelper& InputStreamHelper::ReadArray(Vector<T>& values)
+	{
+		std::uint32_t count;
+		*this >> count;
+
+		values.Resize(count);
+
+		return (values.IsEmpty() ? *this : ReadArray(gsl::span<T>(&values[0], values.Size())));
+	}
+#pragma endregion InputStreamHelper
+}
@@ -6,6 +6,7 @@
 #include "Utility.h"
 
 // Standard
+#include <cstdint>
 #include <string>
 #include <algorithm>
 #include <codecvt>
@@ -39,6 +40,26 @@ namespace Library
 			return uppercaseString;
 		}
 
+		bool EqualsIgnoreCase(std::string_view lhs, std::string_view rhs)
+		{
+			auto equals = [](const unsigned char l, const unsigned char r) { return std::tolower(l) == std::tolower(r); };
+			return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), equals);
+		}
+
+		std::size_t HashIgnoreCase(std::string_view str)
+		{
+			// FNV-1a over lowercased characters.
+			std::uint64_t hash = 14695981039346656037ULL;
+
+			for (const unsigned char c : str)
+			{
+				hash ^= static_cast<std::uint64_t>(std::tolower(c));
+				hash *= 1099511628211ULL;
+			}
+
+			return static_cast<std::size_t>(hash);
+		}
+
 #pragma warning(push)
 #pragma warning(disable: 4996)
 		void ToWideString(const std::string& source, std::wstring& dest)
@@ -1,5 +1,8 @@
 #pragma once
 
+// Standard
+#include <string_view>
+
 // First Party
 #include "Vector.h"
 
@@ -65,6 +68,21 @@ namespace Library
 		/// <returns>Uppercase copy of the given string.</returns>
 		std::string ToUpper(const std::string& str);
 
+		/// <summary>
+		/// Compares two strings without regard to case, without allocating lowercase copies.
+		/// </summary>
+		/// <param name="lhs">First string to be compared.</param>
+		/// <param name="rhs">Second string to be compared.</param>
+		/// <returns>True if the strings are equal when lowercased. Otherwise, false.</returns>
+		bool EqualsIgnoreCase(std::string_view lhs, std::string_view rhs);
+
+		/// <summary>
+		/// Hashes a string without regard to case, consistent with EqualsIgnoreCase.
+		/// </summary>
+		/// <param name="str">String to be hashed.</param>
+		/// <returns>Hash of the lowercased string.</returns>
+		std::size_t HashIgnoreCase(std::string_view str);
+
 		void ToWideString(const std::string& source, std::wstring& dest);
 		std::wstring ToWideString(const std::string& source);
 		void ToString(const std::wstring& source, std::string& dest);
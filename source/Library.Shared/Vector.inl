@@ -866,7 +866,7 @@ namespace Library
 			if (mEqualityFunctor->operator()(mData[i], value))
 			{
 				mData[i].~T();
-				std::memmove(&mData[i], &mData[i + 1], sizeof(T) * (mSize - i));
+				std::memmove(&mData[i], &mData[i + 1], sizeof(T) * (mSize - i - 1));
 
 				--mSize;
 				return true;
@@ -892,7 +892,7 @@ namespace Library
 			else
 			{
 				mData[it.mIndex].~T();
-				std::memmove(&mData[it.mIndex], &mData[it.mIndex + 1], sizeof(T) * (mSize - it.mIndex));
+				std::memmove(&mData[it.mIndex], &mData[it.mIndex + 1], sizeof(T) * (mSize - it.mIndex - 1));
 				--mSize;
 			}
 
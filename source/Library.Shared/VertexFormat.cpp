@@ -0,0 +1,84 @@
+#pragma region Includes
+// Pre-compiled Header
+#include "pch.h"
+
+// Header
+#include "VertexFormat.h"
+#pragma endregion Includes
+
+namespace Library
+{
+#pragma region VertexElement
+	bool VertexElement::operator==(const VertexElement& rhs) const noexcept
+	{
+		return Semantic == rhs.Semantic && Format == rhs.Format && Channel == rhs.Channel && Offset == rhs.Offset;
+	}
+
+	bool VertexElement::operator!=(const VertexElement& rhs) const noexcept
+	{
+		return !operator==(rhs);
+	}
+#pragma endregion VertexElement
+
+#pragma region VertexFormat
+	VertexFormat& VertexFormat::Add(const VertexSemantic semantic, const VertexElementFormat format, const std::uint32_t channel)
+	{
+		const bool isIntegerFormat = (format == VertexElementFormat::UInt8x4 || format == VertexElementFormat::UInt16x4);
+
+		if (semantic == VertexSemantic::BoneIndices ? !isIntegerFormat && format != VertexElementFormat::Float4 : isIntegerFormat)
+		{
+			throw std::runtime_error("Format is not supported for the semantic.");
+		}
+
+		if (channel > 0 && semantic != VertexSemantic::TextureCoordinate && semantic != VertexSemantic::Color)
+		{
+			throw std::runtime_error("Semantic does not have channels.");
+		}
+
+		mElements.PushBack(VertexElement{ semantic, format, channel, mStride });
+		mStride += FormatSize(format);
+
+		return *this;
+	}
+
+	const Vector<VertexElement>& VertexFormat::Elements() const
+	{
+		return mElements;
+	}
+
+	std::uint32_t VertexFormat::Stride() const
+	{
+		return mStride;
+	}
+
+	std::uint32_t VertexFormat::FormatSize(const VertexElementFormat format)
+	{
+		switch (format)
+		{
+		case VertexElementFormat::Float2:		return 8;
+		case VertexElementFormat::Float3:		return 12;
+		case VertexElementFormat::Float4:		return 16;
+		case VertexElementFormat::Half2:		return 4;
+		case VertexElementFormat::Half4:		return 8;
+		case VertexElementFormat::SNorm8x4:		return 4;
+		case VertexElementFormat::SNorm16x4:	return 8;
+		case VertexElementFormat::UNorm8x4:		return 4;
+		case VertexElementFormat::UNorm16x2:	return 4;
+		case VertexElementFormat::UNorm16x4:	return 8;
+		case VertexElementFormat::UInt8x4:		return 4;
+		case VertexElementFormat::UInt16x4:		return 8;
+		default:								return 0;
+		}
+	}
+
+	bool VertexFormat::operator==(const VertexFormat& rhs) const noexcept
+	{
+		return mStride == rhs.mStride && mElements == rhs.mElements;
+	}
+
+	bool VertexFormat::operator!=(const VertexFormat& rhs) const noexcept
+	{
+		return !operator==(rhs);
+	}
+#pragma endregion VertexFormat
+}
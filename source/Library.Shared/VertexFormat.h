@@ -0,0 +1,113 @@
+#pragma once
+
+#pragma region Includes
+// Standard
+#include <cstdint>
+
+// First Party
+#include "Vector.h"
+#pragma endregion Includes
+
+namespace Library
+{
+	/// <summary>
+	/// Mesh stream an element of an interleaved vertex is read from.
+	/// </summary>
+	enum class VertexSemantic
+	{
+		Position,
+		Normal,
+		Tangent,
+		BiNormal,
+		TextureCoordinate,
+		Color,
+		BoneIndices,
+		BoneWeights
+	};
+
+	/// <summary>
+	/// Layout an element of an interleaved vertex is written in. Normalized formats map [-1, 1] or [0, 1] to their integer range.
+	/// </summary>
+	enum class VertexElementFormat
+	{
+		Float2,
+		Float3,
+		Float4,
+		Half2,
+		Half4,
+		SNorm8x4,
+		SNorm16x4,
+		UNorm8x4,
+		UNorm16x2,
+		UNorm16x4,
+		UInt8x4,
+		UInt16x4
+	};
+
+	/// <summary>
+	/// Element of an interleaved vertex.
+	/// </summary>
+	struct VertexElement final
+	{
+		VertexSemantic Semantic;
+		VertexElementFormat Format;
+		std::uint32_t Channel;			// Texture coordinate or vertex color channel, otherwise zero
+		std::uint32_t Offset;			// Offset in bytes from the start of the vertex
+
+		bool operator==(const VertexElement& rhs) const noexcept;
+		bool operator!=(const VertexElement& rhs) const noexcept;
+	};
+
+	/// <summary>
+	/// Description of an interleaved vertex, built one element at a time, that Mesh::Interleave writes vertices in.
+	/// </summary>
+	/// <remarks>
+	/// Elements are packed in the order they are added, each at a 4 byte aligned offset, as every format is a multiple of 4 bytes.
+	/// Bone indices and weights hold the first BoneVertexWeights::MaxBoneWeightsPerVertex weights of a vertex, with weights normalized to sum to one.
+	/// </remarks>
+	class VertexFormat final
+	{
+	public:
+		VertexFormat() = default;
+		~VertexFormat() = default;
+		VertexFormat(const VertexFormat&) = default;
+		VertexFormat& operator=(const VertexFormat&) = default;
+		VertexFormat(VertexFormat&&) = default;
+		VertexFormat& operator=(VertexFormat&&) = default;
+
+		/// <summary>
+		/// Appends an element to the vertex.
+		/// </summary>
+		/// <param name="semantic">Mesh stream the element is read from.</param>
+		/// <param name="format">Layout the element is written in.</param>
+		/// <param name="channel">Texture coordinate or vertex color channel. Must be zero for other semantics.</param>
+		/// <returns>Reference to the VertexFormat, for chaining.</returns>
+		/// <exception cref="std::runtime_error">Bone indices use a format other than UInt8x4, UInt16x4 or Float4, or another semantic uses an integer format.</exception>
+		/// <exception cref="std::runtime_error">A channel is given for a semantic without channels.</exception>
+		VertexFormat& Add(const VertexSemantic semantic, const VertexElementFormat format, const std::uint32_t channel=0);
+
+		/// <summary>
+		/// Gets the elements of the vertex, in the order they are laid out.
+		/// </summary>
+		const Vector<VertexElement>& Elements() const;
+
+		/// <summary>
+		/// Gets the size of a vertex in bytes.
+		/// </summary>
+		std::uint32_t Stride() const;
+
+		/// <summary>
+		/// Gets the size of an element format in bytes.
+		/// </summary>
+		/// <param name="format">Element format.</param>
+		/// <returns>Size in bytes.</returns>
+		static std::uint32_t FormatSize(const VertexElementFormat format);
+
+		bool operator==(const VertexFormat& rhs) const noexcept;
+		bool operator!=(const VertexFormat& rhs) const noexcept;
+
+	private:
+		Vector<VertexElement> mElements;
+		std::uint32_t mStride{ 0 };
+	};
+}
@@ -11,6 +11,7 @@
 // First Party
 #include "Entity.h"
 #include "EventQueue.h"
+#include "Profiler.h"
 #pragma endregion Includes
 
 namespace Library
@@ -23,7 +24,7 @@ namespace Library
 	}
 
 	World::World(const World& rhs) : Entity(rhs),
-		mGameClock(rhs.mGameClock)
+		mGameClock(rhs.mGameClock), mReclaimBudget(rhs.mReclaimBudget)
 	{
 			mWorldState.World = this;
 			mWorldState.GameTime = rhs.mWorldState.GameTime;
@@ -37,6 +38,10 @@ namespace Library
 			Entity::operator=(rhs);
 
 			mGameClock = rhs.mGameClock;
+			mReclaimBudget = rhs.mReclaimBudget;
+			mExpressionBatch.Clear();
+			mIncrementBatch.Clear();
+			mAnimationBatch.Clear();
 			mWorldState.GameTime = rhs.mWorldState.GameTime;
 			mWorldState.EventQueue = rhs.mWorldState.EventQueue;
 		}
@@ -44,28 +49,62 @@ namespace Library
 		return *this;
 	}
 	
-	World::World(World&& rhs) noexcept : Entity(std::move(rhs))
+	World::World(World&& rhs) noexcept : Entity(std::move(rhs)),
+		mGameClock(rhs.mGameClock), mWakeTimers(std::move(rhs.mWakeTimers)), mReclaimBudget(rhs.mReclaimBudget),
+		mExpressionBatch(std::move(rhs.mExpressionBatch)), mIncrementBatch(std::move(rhs.mIncrementBatch)), mAnimationBatch(std::move(rhs.mAnimationBatch))
 	{
 		mWorldState.World = this;
 		mWorldState.GameTime = rhs.mWorldState.GameTime;
 		mWorldState.EventQueue = rhs.mWorldState.EventQueue;
 		rhs.mWorldState.GameTime = nullptr;
 		rhs.mWorldState.EventQueue = nullptr;
+
+		for (auto& wakeTimer : mWakeTimers)
+		{
+			wakeTimer.Sleeper->mWakeScheduler = this;
+		}
 	}
 
 	World& World::operator=(World&& rhs) noexcept
 	{
+		if (this == &rhs) return *this;
+
+		mGameClock = rhs.mGameClock;
+		mReclaimBudget = rhs.mReclaimBudget;
+		mExpressionBatch = std::move(rhs.mExpressionBatch);
+		mIncrementBatch = std::move(rhs.mIncrementBatch);
+		mAnimationBatch = std::move(rhs.mAnimationBatch);
 		mWorldState.GameTime = rhs.mWorldState.GameTime;
 		mWorldState.EventQueue = rhs.mWorldState.EventQueue;
 
 		rhs.mWorldState.GameTime = nullptr;
 		rhs.mWorldState.EventQueue = nullptr;
 
+		for (auto& wakeTimer : mWakeTimers)
+		{
+			wakeTimer.Sleeper->mWakeScheduler = nullptr;
+		}
+
+		mWakeTimers = std::move(rhs.mWakeTimers);
+
+		for (auto& wakeTimer : mWakeTimers)
+		{
+			wakeTimer.Sleeper->mWakeScheduler = this;
+		}
+
 		Entity::operator=(std::move(rhs));
 
 		return *this;
 	}
 
+	World::~World()
+	{
+		for (auto& wakeTimer : mWakeTimers)
+		{
+			wakeTimer.Sleeper->mWakeScheduler = nullptr;
+		}
+	}
+
 	gsl::owner<Scope*> World::Clone() const
 	{
 		return new World(*this);
@@ -90,6 +129,147 @@ namespace Library
 		};
 	}
 
+	std::size_t World::PendingWakeCount() const
+	{
+		return mWakeTimers.Size();
+	}
+
+	ReclamationQueue& World::GetReclamationQueue()
+	{
+		return mReclamationQueue;
+	}
+
+	std::size_t World::ReclaimBudget() const
+	{
+		return mReclaimBudget;
+	}
+
+	void World::SetReclaimBudget(const std::size_t reclaimBudget)
+	{
+		mReclaimBudget = reclaimBudget;
+	}
+
+	ExpressionBatch& World::GetExpressionBatch()
+	{
+		return mExpressionBatch;
+	}
+
+	IncrementBatch& World::GetIncrementBatch()
+	{
+		return mIncrementBatch;
+	}
+
+	AnimationBatch& World::GetAnimationBatch()
+	{
+		return mAnimationBatch;
+	}
+
+	void World::ScheduleWake(Entity& entity, const std::chrono::milliseconds& delay)
+	{
+		if (entity.mWakeScheduler)
+		{
+			entity.mWakeScheduler->CancelWake(entity);
+		}
+
+		entity.mWakeScheduler = this;
+
+		mWakeTimers.EmplaceBack(WakeTimer{ CurrentTime() + delay, &entity });
+		SiftWakeUp(mWakeTimers.Size() - 1);
+	}
+
+	void World::CancelWake(Entity& entity)
+	{
+		if (entity.mWakeScheduler != this) return;
+
+		assert(entity.mWakeIndex < mWakeTimers.Size() && mWakeTimers[entity.mWakeIndex].Sleeper == &entity);
+		RemoveWakeAt(entity.mWakeIndex);
+	}
+
+	void World::RetargetWake([[maybe_unused]] const Entity& from, Entity& to)
+	{
+		assert(to.mWakeIndex < mWakeTimers.Size() && mWakeTimers[to.mWakeIndex].Sleeper == &from);
+
+		mWakeTimers[to.mWakeIndex].Sleeper = &to;
+	}
+
+	void World::WakeDueEntities()
+	{
+		const std::chrono::milliseconds currentTime = CurrentTime();
+
+		while (!mWakeTimers.IsEmpty() && mWakeTimers.Front().Time <= currentTime)
+		{
+			Entity& sleeper = *mWakeTimers.Front().Sleeper;
+			RemoveWakeAt(0);
+
+			sleeper.Wake();
+		}
+	}
+
+	void World::RemoveWakeAt(const std::size_t index)
+	{
+		mWakeTimers[index].Sleeper->mWakeScheduler = nullptr;
+
+		const WakeTimer last = mWakeTimers.Back();
+		mWakeTimers.PopBack();
+
+		if (index == mWakeTimers.Size()) return;
+
+		PlaceWake(index, last);
+
+		if (index > 0 && last.Time < mWakeTimers[(index - 1) / 2].Time)
+		{
+			SiftWakeUp(index);
+		}
+		else
+		{
+			SiftWakeDown(index);
+		}
+	}
+
+	void World::SiftWakeUp(std::size_t index)
+	{
+		const WakeTimer wakeTimer = mWakeTimers[index];
+
+		while (index > 0)
+		{
+			const std::size_t parent = (index - 1) / 2;
+			if (!(wakeTimer.Time < mWakeTimers[parent].Time)) break;
+
+			PlaceWake(index, mWakeTimers[parent]);
+			index = parent;
+		}
+
+		PlaceWake(index, wakeTimer);
+	}
+
+	void World::SiftWakeDown(std::size_t index)
+	{
+		const WakeTimer wakeTimer = mWakeTimers[index];
+		const std::size_t size = mWakeTimers.Size();
+
+		for (std::size_t child = 2 * index + 1; child < size; child = 2 * index + 1)
+		{
+			if (child + 1 < size && mWakeTimers[child + 1].Time < mWakeTimers[child].Time) ++child;
+			if (!(mWakeTimers[child].Time < wakeTimer.Time)) break;
+
+			PlaceWake(index, mWakeTimers[child]);
+			index = child;
+		}
+
+		PlaceWake(index, wakeTimer);
+	}
+
+	void World::PlaceWake(const std::size_t index, const WakeTimer wakeTimer)
+	{
+		mWakeTimers[index] = wakeTimer;
+		wakeTimer.Sleeper->mWakeIndex = index;
+	}
+
+	std::chrono::milliseconds World::CurrentTime() const
+	{
+		return mWorldState.GameTime ? mWorldState.GameTime->TotalGameTime() : std::chrono::milliseconds(0);
+	}
+
 	void World::Run()
 	{
 		IsRunning = true;
@@ -122,6 +302,9 @@ namespace Library
 
 	void World::Update()
 	{
+		PROFILE_FRAME();
+		PROFILE_SCOPE("World::Update");
+
 		if (mWorldState.GameTime)
 		{
 			mGameClock.UpdateGameTime(*mWorldState.GameTime);
@@ -132,15 +315,25 @@ namespace Library
 			}
 		}
 
-		ForEachChild([this](Entity& sector)
+		WakeDueEntities();
+
+		ForEachActiveChild([this](Entity& sector)
 		{
+			PROFILE_SCOPE(sector.TypeNameInstance());
+
 			mWorldState.Sector = &sector;
 			mWorldState.Sector->Update(mWorldState);
 		});
 
 		mWorldState.Sector = nullptr;
 
+		mIncrementBatch.Apply();
+		mExpressionBatch.Evaluate();
+		mAnimationBatch.Evaluate();
+
 		UpdatePendingChildren();
+
+		mReclamationQueue.Drain(mReclaimBudget);
 	}
 
 	void World::Shutdown()
@@ -159,6 +352,8 @@ namespace Library
 		mWorldState.Sector = nullptr;
 
 		UpdatePendingChildren();
+
+		mReclamationQueue.Drain();
 	}
 
 	std::string World::ToString() const
@@ -3,7 +3,11 @@
 #pragma region Includes
 // First Party
 #include "Entity.h"
+#include "AnimationBatch.h"
+#include "ExpressionBatch.h"
+#include "IncrementBatch.h"
 #include "GameClock.h"
+#include "ReclamationQueue.h"
 #include "WorldState.h"
 #pragma endregion Includes
 
@@ -16,6 +20,27 @@ namespace Library
 	{
 		RTTI_DECLARATIONS(World, Entity)
 
+		friend class Entity;
+
+#pragma region Type Definitions
+	private:
+		/// <summary>
+		/// Scheduled wake of a sleeping Entity.
+		/// </summary>
+		struct WakeTimer final
+		{
+			/// <summary>
+			/// Total game time at which the Entity is woken.
+			/// </summary>
+			std::chrono::milliseconds Time;
+
+			/// <summary>
+			/// Sleeping Entity to be woken.
+			/// </summary>
+			Entity* Sleeper;
+		};
+#pragma endregion Type Definitions
+
 #pragma region Special Members
 	public:
 		/// <summary>
@@ -27,9 +52,9 @@ namespace Library
 		explicit World(std::string name=std::string(), GameTime* gameTime=nullptr, class EventQueue* eventQueue=nullptr);
 
 		/// <summary>
-		/// Default destructor.
+		/// Destructor. Detaches scheduled wakes from their sleeping Entity objects.
 		/// </summary>
-		~World() = default;
+		~World();
 
 		/// <summary>
 		/// Copy constructor.
@@ -80,8 +105,112 @@ namespace Library
 		/// </summary>
 		/// <returns>Reference to the WorldState associated with the World.</returns>
 		ConstWorldState GetWorldState() const;
+
+		/// <summary>
+		/// Gets the number of sleeping Entity objects with a scheduled wake.
+		/// </summary>
+		/// <returns>Number of scheduled wakes.</returns>
+		std::size_t PendingWakeCount() const;
+
+		/// <summary>
+		/// Gets the ReclamationQueue holding Entity objects destroyed within the World, awaiting deletion.
+		/// </summary>
+		/// <returns>Reference to the ReclamationQueue of the World.</returns>
+		ReclamationQueue& GetReclamationQueue();
+
+		/// <summary>
+		/// Gets the maximum number of destroyed Entity objects deleted at the end of each Update.
+		/// </summary>
+		/// <returns>Number of Entity objects deleted per Update.</returns>
+		std::size_t ReclaimBudget() const;
+
+		/// <summary>
+		/// Sets the maximum number of destroyed Entity objects deleted at the end of each Update, spreading mass despawns over several frames.
+		/// A budget of zero leaves the ReclamationQueue to be drained by the caller, e.g. with DrainAsync.
+		/// </summary>
+		/// <param name="reclaimBudget">Number of Entity objects deleted per Update.</param>
+		void SetReclaimBudget(const std::size_t reclaimBudget);
+
+		/// <summary>
+		/// Gets the ExpressionBatch evaluating the batched ActionExpression objects of the World at the end of each Update.
+		/// </summary>
+		/// <returns>Reference to the ExpressionBatch of the World.</returns>
+		ExpressionBatch& GetExpressionBatch();
+
+		/// <summary>
+		/// Gets the IncrementBatch applying the batched ActionIncrement objects of the World at the end of each Update.
+		/// </summary>
+		/// <returns>Reference to the IncrementBatch of the World.</returns>
+		IncrementBatch& GetIncrementBatch();
+
+		/// <summary>
+		/// Gets the AnimationBatch evaluating the poses of the playing AnimatorComponent objects of the World at the end of each Update.
+		/// </summary>
+		/// <returns>Reference to the AnimationBatch of the World.</returns>
+		AnimationBatch& GetAnimationBatch();
 #pragma endregion Accessors
 
+#pragma region Sleep Scheduling
+	public:
+		/// <summary>
+		/// Schedules an Entity to be woken once the given amount of game time has passed, replacing any previous schedule.
+		/// Scheduled wakes are processed at the start of Update, after the GameTime has advanced.
+		/// </summary>
+		/// <param name="entity">Entity to be woken.</param>
+		/// <param name="delay">Game time until the Entity is woken.</param>
+		void ScheduleWake(Entity& entity, const std::chrono::milliseconds& delay);
+
+		/// <summary>
+		/// Cancels the scheduled wake of an Entity, if any.
+		/// </summary>
+		/// <param name="entity">Entity whose wake is cancelled.</param>
+		void CancelWake(Entity& entity);
+
+	private:
+		/// <summary>
+		/// Points the scheduled wake of a moved from Entity at the Entity it was moved into.
+		/// </summary>
+		/// <param name="from">Moved from Entity.</param>
+		/// <param name="to">Moved into Entity.</param>
+		void RetargetWake(const Entity& from, Entity& to);
+
+		/// <summary>
+		/// Wakes every Entity whose scheduled wake time has been reached.
+		/// </summary>
+		void WakeDueEntities();
+
+		/// <summary>
+		/// Removes the scheduled wake at the given index of the wake heap, detaching it from its Entity.
+		/// </summary>
+		/// <param name="index">Index within the wake heap.</param>
+		void RemoveWakeAt(const std::size_t index);
+
+		/// <summary>
+		/// Moves the scheduled wake at the given index towards the front of the wake heap until it is ordered.
+		/// </summary>
+		/// <param name="index">Index within the wake heap.</param>
+		void SiftWakeUp(std::size_t index);
+
+		/// <summary>
+		/// Moves the scheduled wake at the given index towards the back of the wake heap until it is ordered.
+		/// </summary>
+		/// <param name="index">Index within the wake heap.</param>
+		void SiftWakeDown(std::size_t index);
+
+		/// <summary>
+		/// Stores a scheduled wake at the given index of the wake heap, and records the index in its Entity.
+		/// </summary>
+		/// <param name="index">Index within the wake heap.</param>
+		/// <param name="wakeTimer">Scheduled wake to be stored.</param>
+		void PlaceWake(const std::size_t index, const WakeTimer wakeTimer);
+
+		/// <summary>
+		/// Gets the current total game time, or zero when the World has no GameTime.
+		/// </summary>
+		/// <returns>Current total game time.</returns>
+		std::chrono::milliseconds CurrentTime() const;
+#pragma endregion Sleep Scheduling
+
 #pragma region Game Loop
 	public:
 		/// <summary>
@@ -151,6 +280,36 @@ namespace Library
 		/// Represents whether the game loop is running.
 		/// </summary>
 		bool IsRunning{ false };
+
+		/// <summary>
+		/// Min heap of scheduled wakes, ordered by wake time. Each sleeping Entity records the index of its wake, so cancelling it takes logarithmic time.
+		/// </summary>
+		Vector<WakeTimer> mWakeTimers{ Vector<WakeTimer>::EqualityFunctor() };
+
+		/// <summary>
+		/// Entity objects destroyed within the World, awaiting deletion.
+		/// </summary>
+		ReclamationQueue mReclamationQueue;
+
+		/// <summary>
+		/// Maximum number of queued Entity objects deleted at the end of each Update.
+		/// </summary>
+		std::size_t mReclaimBudget{ ReclamationQueue::All };
+
+		/// <summary>
+		/// Batched ActionExpression objects within the World, evaluated at the end of each Update.
+		/// </summary>
+		ExpressionBatch mExpressionBatch;
+
+		/// <summary>
+		/// Batched ActionIncrement objects within the World, applied at the end of each Update.
+		/// </summary>
+		IncrementBatch mIncrementBatch;
+
+		/// <summary>
+		/// AnimatorComponent objects within the World playing a clip this Update, evaluated at the end of each Update.
+		/// </summary>
+		AnimationBatch mAnimationBatch;
 #pragma endregion Data Members
 	};
 }
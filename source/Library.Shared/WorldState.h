@@ -34,11 +34,13 @@ namespace Library
 
 		/// <summary>
 		/// Handle to the current Sector. May be null.
+		/// Only valid during the current call. Store the EntityHandle of the Sector to refer to it later.
 		/// </summary>
 		class Entity* Sector{ nullptr };
 
 		/// <summary>
 		/// Handle to the current Entity. May be null.
+		/// Only valid during the current call. Store the EntityHandle of the Entity to refer to it later.
 		/// </summary>
 		class Entity* Entity{ nullptr };
 	};
@@ -75,11 +77,13 @@ namespace Library
 
 		/// <summary>
 		/// Handle to the current Sector. May be null.
+		/// Only valid during the current call. Store the EntityHandle of the Sector to refer to it later.
 		/// </summary>
 		const class Entity* Sector{ nullptr };
 
 		/// <summary>
 		/// Handle to the current Entity. May be null.
+		/// Only valid during the current call. Store the EntityHandle of the Entity to refer to it later.
 		/// </summary>
 		const class Entity* Entity{ nullptr };
 	};
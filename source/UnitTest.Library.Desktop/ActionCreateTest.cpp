@@ -3,6 +3,8 @@
 #include "ToStringSpecialization.h"
 #include "ActionCreate.h"
 #include "Entity.h"
+#include "World.h"
+#include "StopWatch.h"
 
 using namespace std::string_literals;
 
@@ -132,6 +134,131 @@ namespace EntitySystemTests::ActionTests
 			Assert::AreEqual(addedAction, *entity.FindChild("Added")->As<ActionCreate>());
 		}
 
+		TEST_METHOD(CreateN)
+		{
+			Entity root;
+			ActionCreate& create = static_cast<ActionCreate&>(root.CreateChild("ActionCreate"s, "Create"s));
+			Assert::AreEqual(0_z, create.CreateN(3));
+			Assert::IsFalse(create.IsCompiled());
+
+			Entity prototype("Enemy");
+			CreatePrototype(prototype);
+			*create.Find(ActionCreate::EntityPrototypeKey) = prototype.As<Scope>();
+
+			Assert::AreEqual(3_z, create.CreateN(3));
+			Assert::IsTrue(create.IsCompiled());
+			Assert::AreEqual(4_z, root.ChildCount());
+
+			for (auto* instance : root.FindChildArray("Enemy"))
+			{
+				Assert::AreEqual(prototype, *instance);
+				Assert::AreEqual(3_z, instance->ChildCount());
+				Assert::AreEqual("Weapon"s, instance->ChildAt(0).Name());
+				Assert::AreEqual(7, instance->ChildAt(2).FindChild("Detail")->Find("Value")->Get<int>());
+			}
+
+			/* Changes to the prototype's values are picked up without invalidating */
+
+			*prototype.Find("Health") = 50;
+			create.CreateN(1);
+			Assert::AreEqual(50, root.FindChildArray("Enemy")[3]->Find("Health")->Get<int>());
+
+			*prototype.ChildAt(2).FindChild("Detail")->Find("Value") = 9;
+			create.CreateN(1);
+			Assert::AreEqual(9, root.FindChildArray("Enemy")[4]->ChildAt(2).FindChild("Detail")->Find("Value")->Get<int>());
+			Assert::AreEqual(6_z, root.ChildCount());
+
+			create.InvalidatePrototype();
+			Assert::IsFalse(create.IsCompiled());
+
+			/* Children added to the prototype are picked up without invalidating */
+
+			create.CreateN(1);
+			Assert::IsTrue(create.IsCompiled());
+
+			prototype.CreateChild("Entity", "Shield");
+
+			create.CreateN(1);
+			Assert::AreEqual(4_z, root.FindChildArray("Enemy")[6]->ChildCount());
+			Assert::IsNotNull(root.FindChildArray("Enemy")[6]->FindChild("Shield"));
+		}
+
+		TEST_METHOD(Count)
+		{
+			World world;
+			Entity& entity = world.CreateChild("Entity", "Root");
+			ActionCreate& create = static_cast<ActionCreate&>(entity.CreateChild("ActionCreate"s, "Create"s));
+
+			Entity prototype("Added");
+			*create.Find(ActionCreate::EntityPrototypeKey) = prototype.As<Scope>();
+			*create.Find(ActionCreate::CountKey) = 4;
+
+			world.Update();
+			Assert::AreEqual(5_z, entity.ChildCount());
+			Assert::IsTrue(entity.FindChild("Added") != nullptr);
+
+			*create.Find(ActionCreate::CountKey) = 0;
+			world.Update();
+			Assert::AreEqual(5_z, entity.ChildCount());
+		}
+
+		TEST_METHOD(SpawnThroughput)
+		{
+			const std::size_t spawnCount = 10000;
+
+			Entity prototype("Enemy");
+			CreatePrototype(prototype);
+
+			StopWatch stopWatch;
+
+			/* Clones the prototype directly */
+
+			auto* cloned = new Entity();
+
+			stopWatch.Start();
+			for (std::size_t i = 0; i < spawnCount; ++i)
+			{
+				cloned->AddChild(static_cast<Entity&>(*prototype.Clone()));
+			}
+			stopWatch.Stop();
+
+			const double cloneTime = std::chrono::duration<double, std::milli>(stopWatch.Elapsed()).count();
+			Assert::AreEqual(spawnCount, cloned->ChildCount());
+			stopWatch.Reset();
+
+			stopWatch.Start();
+			delete cloned;
+			stopWatch.Stop();
+
+			const double cloneDestroyTime = std::chrono::duration<double, std::milli>(stopWatch.Elapsed()).count();
+			stopWatch.Reset();
+
+			/* Instantiates the compiled template */
+
+			auto* created = new Entity();
+			ActionCreate& create = static_cast<ActionCreate&>(created->CreateChild("ActionCreate"s, "Create"s));
+			*create.Find(ActionCreate::EntityPrototypeKey) = prototype.As<Scope>();
+
+			stopWatch.Start();
+			create.CreateN(spawnCount);
+			stopWatch.Stop();
+
+			const double createTime = std::chrono::duration<double, std::milli>(stopWatch.Elapsed()).count();
+			Assert::AreEqual(spawnCount + 1, created->ChildCount());
+			stopWatch.Reset();
+
+			stopWatch.Start();
+			delete created;
+			stopWatch.Stop();
+
+			const double createDestroyTime = std::chrono::duration<double, std::milli>(stopWatch.Elapsed()).count();
+
+			std::wostringstream message;
+			message << spawnCount << L" nested entities. Clone: " << cloneTime << L"ms (destroy " << cloneDestroyTime
+				<< L"ms), CreateN: " << createTime << L"ms (destroy " << createDestroyTime << L"ms).\n";
+			Logger::WriteMessage(message.str().c_str());
+		}
+
 		TEST_METHOD(ToString)
 		{
 			const ActionCreate actionCreate("Create");
@@ -139,6 +266,24 @@ namespace EntitySystemTests::ActionTests
 		}
 
 	private:
+		static void CreatePrototype(Entity& prototype)
+		{
+			prototype.Append("Health") = 100;
+			prototype.Append("Speed") = 2.5f;
+			prototype.Append("Tag") = "Hostile"s;
+			prototype.Append("Position") = glm::vec4(1.0f, 2.0f, 3.0f, 1.0f);
+
+			for (const auto& name : { "Weapon"s, "Armor"s, "Brain"s })
+			{
+				Entity& part = prototype.CreateChild("Entity"s, name);
+				part.Append("Level") = 3;
+				part.Append("Weight") = 1.5f;
+
+				Entity& detail = part.CreateChild("Entity"s, "Detail"s);
+				detail.Append("Value") = 7;
+			}
+		}
+
 		static _CrtMemState sStartMemState;
 
 		ActionCreateFactory actionCreateFactory;
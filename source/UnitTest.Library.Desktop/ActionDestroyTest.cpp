@@ -120,6 +120,40 @@ namespace EntitySystemTests::ActionTests
 			Assert::AreEqual(1_z, entity.ChildCount());
 		}
 
+		TEST_METHOD(SetTarget)
+		{
+			World world;
+			Entity& sector = world.CreateChild("Entity", "Sector");
+
+			Entity& target = sector.CreateChild("Entity", "Target");
+			ActionDestroy& actionDestroy = *sector.CreateChild("ActionDestroy"s, "Destroy"s).As<ActionDestroy>();
+
+			actionDestroy.SetTarget(target);
+			Assert::AreEqual("Target"s, actionDestroy.Find(ActionDestroy::TargetKey)->Get<std::string>());
+
+			world.Update();
+			Assert::AreEqual(1_z, sector.ChildCount());
+
+			world.Update();
+			Assert::AreEqual(1_z, sector.ChildCount());
+
+			const EntityHandle replacement = sector.CreateChild("Entity", "Target").Handle();
+
+			world.Update();
+			Assert::AreEqual(1_z, sector.ChildCount());
+			Assert::IsNull(replacement.Resolve());
+
+			const EntityHandle other = sector.CreateChild("Entity", "Other").Handle();
+
+			world.Update();
+			Assert::IsNotNull(other.Resolve());
+
+			*actionDestroy.Find(ActionDestroy::TargetKey) = "Other"s;
+
+			world.Update();
+			Assert::IsNull(other.Resolve());
+		}
+
 		TEST_METHOD(ToString)
 		{
 			const ActionDestroy actionDestroy("Destroy");
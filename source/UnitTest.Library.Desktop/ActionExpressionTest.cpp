@@ -0,0 +1,307 @@
+#include "pch.h"
+
+#include "ToStringSpecialization.h"
+#include "ActionExpression.h"
+#include "Entity.h"
+#include "StopWatch.h"
+
+using namespace std::string_literals;
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+using namespace UnitTests;
+
+
+namespace EntitySystemTests::ActionTests
+{
+	TEST_CLASS(ActionExpressionTest)
+	{
+	public:
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+			TypeManager::Create();
+
+			RegisterType<Entity>();
+			RegisterType<ActionExpression>();
+
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&sStartMemState);
+#endif
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &sStartMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+
+			TypeManager::Destroy();
+		}
+
+		TEST_METHOD(Constructor)
+		{
+			ActionExpression actionExpression("Expression");
+			Assert::AreEqual("Expression"s, actionExpression.Name());
+			Assert::IsFalse(actionExpression.IsCompiled());
+
+			const auto expression = actionExpression.Find(ActionExpression::ExpressionKey);
+			Assert::IsNotNull(expression);
+			Assert::AreEqual(Scope::Types::String, expression->Type());
+			Assert::AreEqual(std::string(), expression->Get<std::string>());
+
+			const auto result = actionExpression.Find(ActionExpression::ResultKey);
+			Assert::IsNotNull(result);
+			Assert::AreEqual(Scope::Types::Reference, result->Type());
+			Assert::IsNotNull(result->Get<Datum*>());
+		}
+
+		TEST_METHOD(Update)
+		{
+			Entity entity;
+			Datum& a = entity.Append("A") = 3;
+			entity.Append("B") = 0.5f;
+
+			ActionExpression& expression = static_cast<ActionExpression&>(entity.CreateChild("ActionExpression"s, "Expression"s));
+			*expression.Find(ActionExpression::ExpressionKey) = "(A + 1) * B"s;
+
+			WorldState worldState;
+			worldState.Entity = &entity;
+
+			entity.Update(worldState);
+			Assert::IsTrue(expression.IsCompiled());
+
+			Datum* result = expression.Find(ActionExpression::ResultKey)->Get<Datum*>();
+			Assert::AreEqual(Datum::Types::Float, result->Type());
+			Assert::AreEqual(2.0f, result->Get<float>());
+
+			a = 5;
+			entity.Update(worldState);
+			Assert::AreEqual(3.0f, result->Get<float>());
+
+			Datum& target = entity.Append("Target") = 0;
+			expression.Find(ActionExpression::ResultKey)->Set<Datum*>(&target);
+			expression.SetExpression("A % 4 == 1 && B < 1");
+			Assert::IsFalse(expression.IsCompiled());
+
+			entity.Update(worldState);
+			Assert::AreEqual(1, target.Get<int>());
+			Assert::AreEqual(3.0f, result->Get<float>());
+		}
+
+		TEST_METHOD(InitializeCompiles)
+		{
+			Entity entity;
+			entity.Append("A") = 1;
+
+			ActionExpression& expression = static_cast<ActionExpression&>(entity.CreateChild("ActionExpression"s, "Expression"s));
+			expression.SetExpression("A + 1");
+
+			WorldState worldState;
+			entity.Initialize(worldState);
+			Assert::IsTrue(expression.IsCompiled());
+			Assert::AreEqual(Datum::Types::Integer, expression.Program().ResultType());
+
+			expression.SetExpression("Missing + 1");
+			Assert::ExpectException<std::runtime_error>([&entity, &worldState] { entity.Initialize(worldState); });
+		}
+
+		TEST_METHOD(Reparent)
+		{
+			Entity first;
+			first.Append("A") = 1;
+
+			Entity second;
+			second.Append("A") = 10;
+
+			ActionExpression& expression = static_cast<ActionExpression&>(first.CreateChild("ActionExpression"s, "Expression"s));
+			expression.SetExpression("A + 1");
+
+			WorldState worldState;
+			first.Update(worldState);
+			Assert::IsTrue(expression.IsCompiled());
+
+			Datum* result = expression.Find(ActionExpression::ResultKey)->Get<Datum*>();
+			Assert::AreEqual(2, result->Get<int>());
+
+			second.AddChild(expression);
+			Assert::IsFalse(expression.IsCompiled());
+
+			second.Update(worldState);
+			Assert::IsTrue(expression.IsCompiled());
+			Assert::AreEqual(11, result->Get<int>());
+
+			*first.Find("A") = 100;
+			second.Update(worldState);
+			Assert::AreEqual(11, result->Get<int>());
+		}
+
+		TEST_METHOD(HierarchyChanges)
+		{
+			Entity root;
+			root.Append("A") = 1;
+			root.Append("B") = 3;
+
+			Entity& middle = root.CreateChild("Entity"s, "Middle"s);
+			ActionExpression& expression = static_cast<ActionExpression&>(middle.CreateChild("ActionExpression"s, "Expression"s));
+			expression.SetExpression("A + B");
+
+			WorldState worldState;
+			root.Update(worldState);
+
+			Datum* result = expression.Find(ActionExpression::ResultKey)->Get<Datum*>();
+			Assert::AreEqual(4, result->Get<int>());
+
+			/* Recompiles when an operand is added nearer */
+
+			middle.Append("A") = 20;
+			Assert::IsFalse(expression.IsCompiled());
+
+			root.Update(worldState);
+			Assert::AreEqual(23, result->Get<int>());
+
+			/* Recompiles when an ancestor changes parent */
+
+			Entity other;
+			other.Append("B") = 7;
+			other.AddChild(middle);
+			Assert::IsFalse(expression.IsCompiled());
+
+			other.Update(worldState);
+			Assert::AreEqual(27, result->Get<int>());
+
+			/* Recompiles when the expression is edited through its Attribute */
+
+			*expression.Find(ActionExpression::ExpressionKey) = "B * 2"s;
+			Assert::IsFalse(expression.IsCompiled());
+
+			other.Update(worldState);
+			Assert::IsTrue(expression.IsCompiled());
+			Assert::AreEqual(14, result->Get<int>());
+		}
+
+		TEST_METHOD(CopyAndMove)
+		{
+			ActionExpression expression;
+			expression.Append("A") = 2;
+			expression.SetExpression("A * 3");
+
+			WorldState worldState;
+			expression.Update(worldState);
+
+			ActionExpression copy(expression);
+			Assert::AreEqual("A * 3"s, copy.Expression());
+			Assert::IsFalse(copy.IsCompiled());
+
+			Datum* copyResult = copy.Find(ActionExpression::ResultKey)->Get<Datum*>();
+			Assert::IsTrue(expression.Find(ActionExpression::ResultKey)->Get<Datum*>() != copyResult);
+
+			*copy.Find("A") = 5;
+			copy.Update(worldState);
+			Assert::AreEqual(15, copyResult->Get<int>());
+			Assert::AreEqual(6, expression.Find(ActionExpression::ResultKey)->Get<Datum*>()->Get<int>());
+
+			ActionExpression moved(std::move(copy));
+			Assert::AreEqual("A * 3"s, moved.Expression());
+			moved.Update(worldState);
+			Assert::AreEqual(15, moved.Find(ActionExpression::ResultKey)->Get<Datum*>()->Get<int>());
+
+			ActionExpression assigned;
+			assigned = expression;
+			assigned.Update(worldState);
+			Assert::AreEqual(6, assigned.Find(ActionExpression::ResultKey)->Get<Datum*>()->Get<int>());
+		}
+
+		TEST_METHOD(Clone)
+		{
+			ActionExpression actionExpression;
+			Scope* clone = actionExpression.Clone();
+
+			const bool notNull = clone;
+			const bool isActionExpression = notNull ? clone->Is(ActionExpression::TypeIdClass()) : false;
+
+			delete clone;
+
+			Assert::IsTrue(notNull && isActionExpression);
+		}
+
+		TEST_METHOD(EvaluationThroughput)
+		{
+			const std::size_t expressionCount = 10000;
+			const std::size_t frameCount = 10;
+			const std::string source = "(A + B) * C - A / 2 + (C > 1.5 && B != 0)";
+
+			Entity root;
+			root.Append("A") = 7;
+			root.Append("B") = 3;
+			root.Append("C") = 2.5f;
+
+			Vector<ActionExpression*> expressions;
+			for (std::size_t i = 0; i < expressionCount; ++i)
+			{
+				auto& expression = static_cast<ActionExpression&>(root.CreateChild("ActionExpression"s, "Expression" + std::to_string(i)));
+				expression.SetExpression(source);
+				expressions.PushBack(&expression);
+			}
+
+			WorldState worldState;
+			root.Initialize(worldState);
+
+			StopWatch stopWatch;
+
+			stopWatch.Start();
+			for (std::size_t frame = 0; frame < frameCount; ++frame)
+			{
+				root.Update(worldState);
+			}
+			stopWatch.Stop();
+
+			const double compiledTime = std::chrono::duration<double, std::micro>(stopWatch.Elapsed()).count() / frameCount;
+			stopWatch.Reset();
+
+			Datum interpreted;
+
+			stopWatch.Start();
+			for (std::size_t frame = 0; frame < frameCount; ++frame)
+			{
+				for (auto* expression : expressions)
+				{
+					CompiledExpression::Compile(expression->Expression(), *expression).Evaluate(interpreted);
+				}
+			}
+			stopWatch.Stop();
+
+			const double interpretedTime = std::chrono::duration<double, std::micro>(stopWatch.Elapsed()).count() / frameCount;
+
+			const float expected = (7 + 3) * 2.5f - 7 / 2 + 1;
+			Assert::AreEqual(expected, interpreted.Get<float>());
+			Assert::AreEqual(expected, expressions.Back()->Find(ActionExpression::ResultKey)->Get<Datum*>()->Get<float>());
+
+			std::wostringstream message;
+			message << expressionCount << L" expressions per frame. Compiled: " << compiledTime
+				<< L"us, parsed every frame: " << interpretedTime << L"us.\n";
+			Logger::WriteMessage(message.str().c_str());
+		}
+
+		TEST_METHOD(ToString)
+		{
+			const ActionExpression actionExpression("Expression");
+			Assert::AreEqual("Expression: '' (ActionExpression)"s, actionExpression.ToString());
+		}
+
+	private:
+		static _CrtMemState sStartMemState;
+
+		ActionExpressionFactory actionExpressionFactory;
+		EntityFactory entityFactory;
+	};
+
+	_CrtMemState ActionExpressionTest::sStartMemState;
+}
@@ -138,6 +138,100 @@ namespace EntitySystemTests::ActionTests
 			Assert::AreEqual(3, integer2);
 		}
 
+		TEST_METHOD(Bind)
+		{
+			Entity entity;
+			entity.Append("Integer") = 0;
+			entity.Append("Float") = 1.0f;
+
+			Entity& child = entity.CreateChild("Entity"s, "Child"s);
+			child.Append("Integer") = 10;
+
+			ActionIncrement& increment = static_cast<ActionIncrement&>(entity.CreateChild("ActionIncrement"s, "Increment"s));
+			Assert::IsFalse(increment.IsBound());
+			Assert::IsNull(increment.Target());
+
+			increment.SetOperand("Integer"s);
+			increment.Bind();
+			Assert::IsTrue(increment.IsBound());
+			Assert::IsTrue(increment.Target() == entity.Find("Integer"));
+
+			WorldState worldState;
+			increment.Update(worldState);
+			Assert::AreEqual(1, entity.Find("Integer")->Get<int>());
+
+			/* Rebinds when the operand name changes */
+
+			*increment.Find(ActionIncrement::OperandKey) = "Float"s;
+			Assert::IsFalse(increment.IsBound());
+
+			increment.Update(worldState);
+			Assert::IsFalse(increment.IsBound());
+			Assert::IsNull(increment.Target());
+			Assert::AreEqual(1.0f, entity.Find("Float")->Get<float>());
+
+			/* Finds an operand added after a miss */
+
+			increment.SetOperand("Later"s);
+			increment.Update(worldState);
+			Assert::IsNull(increment.Target());
+
+			entity.Append("Later") = 5;
+			increment.Update(worldState);
+			Assert::IsTrue(increment.IsBound());
+			Assert::AreEqual(6, entity.Find("Later")->Get<int>());
+
+			/* Rebinds when the parent changes */
+
+			increment.SetOperand("Integer"s);
+			increment.Update(worldState);
+			Assert::AreEqual(2, entity.Find("Integer")->Get<int>());
+
+			child.AddChild(increment);
+			Assert::IsFalse(increment.IsBound());
+
+			increment.Update(worldState);
+			Assert::IsTrue(increment.Target() == child.Find("Integer"));
+			Assert::AreEqual(11, child.Find("Integer")->Get<int>());
+			Assert::AreEqual(2, entity.Find("Integer")->Get<int>());
+
+			/* Rebinds when an attribute of the same name is added nearer */
+
+			increment.SetOperand("Later"s);
+			increment.Update(worldState);
+			Assert::AreEqual(7, entity.Find("Later")->Get<int>());
+
+			child.Append("Later") = 100;
+			Assert::IsFalse(increment.IsBound());
+
+			increment.Update(worldState);
+			Assert::AreEqual(101, child.Find("Later")->Get<int>());
+			Assert::AreEqual(7, entity.Find("Later")->Get<int>());
+
+			/* Rebinds when an ancestor changes parent */
+
+			Entity other;
+			other.Append("Root") = 0;
+			entity.Append("Root") = 0;
+
+			increment.SetOperand("Root"s);
+			increment.Update(worldState);
+			Assert::AreEqual(1, entity.Find("Root")->Get<int>());
+
+			other.AddChild(child);
+			Assert::IsFalse(increment.IsBound());
+
+			increment.Update(worldState);
+			Assert::AreEqual(1, other.Find("Root")->Get<int>());
+			Assert::AreEqual(1, entity.Find("Root")->Get<int>());
+
+			/* Copies bind on their own */
+
+			ActionIncrement copy(increment);
+			Assert::IsFalse(copy.IsBound());
+			Assert::AreEqual("Integer"s, copy.Operand());
+		}
+
 		TEST_METHOD(ToString)
 		{
 			const ActionIncrement actionIncrement("Increment");
@@ -77,6 +77,18 @@ namespace EntitySystemTests::ActionTests
 			Assert::IsNotNull(condition);
 			Assert::AreEqual(Scope::Types::Integer, condition->Type());
 			Assert::AreEqual(0, condition->Get<int>());
+
+			const auto maxIterations = actionListWhile.Find(ActionListWhile::MaxIterationsKey);
+			Assert::IsNotNull(maxIterations);
+			Assert::AreEqual(ActionListWhile::DefaultMaxIterations, maxIterations->Get<int>());
+
+			const auto budget = actionListWhile.Find(ActionListWhile::BudgetKey);
+			Assert::IsNotNull(budget);
+			Assert::AreEqual(0.0f, budget->Get<float>());
+
+			Assert::AreEqual(0, actionListWhile.Find(ActionListWhile::IterationsKey)->Get<int>());
+			Assert::AreEqual(0, actionListWhile.Find(ActionListWhile::OverrunsKey)->Get<int>());
+			Assert::IsFalse(actionListWhile.IsSuspended());
 		}
 
 		TEST_METHOD(Clone)
@@ -115,6 +127,101 @@ namespace EntitySystemTests::ActionTests
 
 			Assert::AreEqual(0, condition);
 			Assert::AreEqual(10, loopCount);
+			Assert::AreEqual(10, actionListWhile.Iterations());
+			Assert::AreEqual(0, actionListWhile.Overruns());
+		}
+
+		TEST_METHOD(IterationCap)
+		{
+			ActionListWhile actionListWhile;
+			int& condition = (*actionListWhile.Find(ActionListWhile::ConditionKey) = 1).Get<int>();
+			*actionListWhile.Find(ActionListWhile::MaxIterationsKey) = 5;
+			int& loopCount = (actionListWhile.Append("LoopCount") = 0).Get<int>();
+
+			ActionIncrement* incrementCounter = new ActionIncrement("IncrementCount");
+			*incrementCounter->Find(ActionIncrement::OperandKey) = "LoopCount"s;
+			actionListWhile.AddChild(*incrementCounter);
+
+			WorldState worldState;
+			actionListWhile.Update(worldState);
+
+			Assert::AreEqual(5, loopCount);
+			Assert::AreEqual(5, actionListWhile.Iterations());
+			Assert::AreEqual(1, actionListWhile.Overruns());
+			Assert::IsFalse(actionListWhile.IsSuspended());
+
+			actionListWhile.Update(worldState);
+			Assert::AreEqual(10, loopCount);
+			Assert::AreEqual(2, actionListWhile.Overruns());
+
+			condition = 0;
+			actionListWhile.Update(worldState);
+			Assert::AreEqual(10, loopCount);
+			Assert::AreEqual(0, actionListWhile.Iterations());
+			Assert::AreEqual(2, actionListWhile.Overruns());
+
+			*actionListWhile.Find(ActionListWhile::MaxIterationsKey) = 0;
+			*actionListWhile.Find(ActionListWhile::ConditionKey) = 2000;
+
+			ActionIncrement* decrementCondition = new ActionIncrement("DecrementCondition");
+			*decrementCondition->Find(ActionIncrement::OperandKey) = ActionListWhile::ConditionKey;
+			*decrementCondition->Find(ActionIncrement::IncrementStepKey) = -1;
+			actionListWhile.AddChild(*decrementCondition);
+
+			actionListWhile.Update(worldState);
+			Assert::AreEqual(2010, loopCount);
+			Assert::AreEqual(2000, actionListWhile.Iterations());
+			Assert::AreEqual(2, actionListWhile.Overruns());
+		}
+
+		TEST_METHOD(BudgetYield)
+		{
+			ActionListWhile actionListWhile;
+			*actionListWhile.Find(ActionListWhile::ConditionKey) = 1;
+			*actionListWhile.Find(ActionListWhile::BudgetKey) = 0.001f;
+			int& innerCount = (actionListWhile.Append("InnerCount") = 0).Get<int>();
+			int& outerCount = (actionListWhile.Append("OuterCount") = 0).Get<int>();
+
+			// A nested loop that is never cleared, and whose iteration cap alone takes far longer than the outer budget.
+			ActionListWhile* innerLoop = new ActionListWhile("InnerLoop");
+			*innerLoop->Find(ActionListWhile::ConditionKey) = 1;
+			*innerLoop->Find(ActionListWhile::MaxIterationsKey) = 20000;
+
+			ActionIncrement* incrementInner = new ActionIncrement("IncrementInner");
+			*incrementInner->Find(ActionIncrement::OperandKey) = "InnerCount"s;
+			innerLoop->AddChild(*incrementInner);
+
+			actionListWhile.AddChild(*innerLoop);
+
+			ActionIncrement* incrementOuter = new ActionIncrement("IncrementOuter");
+			*incrementOuter->Find(ActionIncrement::OperandKey) = "OuterCount"s;
+			actionListWhile.AddChild(*incrementOuter);
+
+			WorldState worldState;
+			actionListWhile.Update(worldState);
+
+			Assert::AreEqual(20000, innerCount);
+			Assert::AreEqual(0, outerCount);
+			Assert::IsTrue(actionListWhile.IsSuspended());
+			Assert::AreEqual(0, actionListWhile.Iterations());
+			Assert::AreEqual(1, actionListWhile.Overruns());
+			Assert::AreEqual(1, innerLoop->Overruns());
+
+			actionListWhile.Update(worldState);
+
+			Assert::AreEqual(1, outerCount);
+			Assert::AreEqual(1, actionListWhile.Iterations());
+			Assert::AreEqual(2, actionListWhile.Overruns());
+
+			*actionListWhile.Find(ActionListWhile::ConditionKey) = 0;
+			while (actionListWhile.IsSuspended())
+			{
+				actionListWhile.Update(worldState);
+			}
+
+			actionListWhile.Update(worldState);
+			Assert::AreEqual(0, actionListWhile.Iterations());
+			Assert::IsFalse(actionListWhile.IsSuspended());
 		}
 
 		TEST_METHOD(ToString)
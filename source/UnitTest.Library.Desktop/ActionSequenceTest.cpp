@@ -0,0 +1,443 @@
+#include "pch.h"
+
+#include "ToStringSpecialization.h"
+#include "ActionSequence.h"
+#include "ActionWait.h"
+#include "ActionWaitForEvent.h"
+#include "ActionIncrement.h"
+#include "EventMessageAttributed.h"
+#include "Event.h"
+#include "EventQueue.h"
+#include "GameTime.h"
+#include "World.h"
+#include "JsonParseMaster.h"
+#include "JsonEntityParseHelper.h"
+
+using namespace std::string_literals;
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+using namespace UnitTests;
+
+
+namespace EntitySystemTests::ActionTests
+{
+	TEST_CLASS(ActionSequenceTest)
+	{
+	public:
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+			TypeManager::Create();
+
+			RegisterType<Entity>();
+			RegisterType<World>();
+			RegisterType<ActionSequence>();
+			RegisterType<ActionWait>();
+			RegisterType<ActionWaitForEvent>();
+			RegisterType<ActionIncrement>();
+			RegisterType<EventMessageAttributed>();
+
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&sStartMemState);
+#endif
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+			Event<EventMessageAttributed>::UnsubscribeAll();
+			Event<EventMessageAttributed>::SubscriberShrinkToFit();
+
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &sStartMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+
+			TypeManager::Destroy();
+		}
+
+		TEST_METHOD(RTTITest)
+		{
+			ActionSequence sequenceA;
+			ActionSequence sequenceB;
+
+			Assert::IsTrue(sequenceA.Is(Entity::TypeIdClass()));
+			Assert::IsTrue(sequenceA.Equals(&sequenceB));
+
+			Entity* newSequence = new ActionSequence();
+			Entity* createdSequence = newSequence->CreateAs<Entity>();
+			const bool isActionSequence = createdSequence ? createdSequence->Is(ActionSequence::TypeIdClass()) : false;
+
+			delete newSequence;
+			delete createdSequence;
+
+			Assert::IsTrue(isActionSequence);
+		}
+
+		TEST_METHOD(Clone)
+		{
+			ActionSequence sequence("Sequence");
+			CreateIncrement(sequence, "Step", "Count");
+
+			Scope* clone = sequence.Clone();
+
+			const bool notNull = clone;
+			const bool isActionSequence = notNull ? clone->Is(ActionSequence::TypeIdClass()) : false;
+			const bool equal = *sequence.As<Entity>() == *clone->As<Entity>();
+
+			delete clone;
+
+			Assert::IsTrue(notNull && isActionSequence && equal);
+		}
+
+		TEST_METHOD(Update)
+		{
+			ActionSequence sequence;
+			int& count = (sequence.Append("Count") = 0).Get<int>();
+
+			CreateIncrement(sequence, "First", "Count");
+			CreateIncrement(sequence, "Second", "Count").SetEnabled(false);
+			CreateIncrement(sequence, "Third", "Count");
+
+			WorldState worldState;
+			sequence.Update(worldState);
+
+			Assert::AreEqual(2, count);
+			Assert::AreEqual(0_z, sequence.CurrentStep());
+			Assert::IsFalse(sequence.IsSleeping());
+
+			sequence.Update(worldState);
+			Assert::AreEqual(4, count);
+		}
+
+		TEST_METHOD(LatentSteps)
+		{
+			GameTime gameTime;
+			EventQueue queue;
+
+			World world("World", &gameTime, &queue);
+			Entity& sector = world.CreateChild("Entity", "Sector");
+			int& first = (sector.Append("First") = 0).Get<int>();
+			int& second = (sector.Append("Second") = 0).Get<int>();
+			int& third = (sector.Append("Third") = 0).Get<int>();
+
+			ActionSequence& sequence = *sector.CreateChild("ActionSequence", "Sequence").As<ActionSequence>();
+			CreateIncrement(sequence, "IncrementFirst", "First");
+			sequence.CreateChild("ActionWait", "Wait").Find(ActionWait::DurationKey)->Set(1);
+			CreateIncrement(sequence, "IncrementSecond", "Second");
+			ActionWaitForEvent& waitForEvent = *new ActionWaitForEvent("WaitForEvent", "Go");
+			sequence.AddChild(waitForEvent);
+			CreateIncrement(sequence, "IncrementThird", "Third");
+
+			world.Update();
+			Assert::AreEqual(1, first);
+			Assert::AreEqual(0, second);
+			Assert::AreEqual(1_z, sequence.CurrentStep());
+			Assert::IsTrue(sequence.IsSleeping());
+
+			while (second == 0)
+			{
+				world.Update();
+			}
+
+			Assert::AreEqual(1, first);
+			Assert::AreEqual(3_z, sequence.CurrentStep());
+			Assert::IsTrue(waitForEvent.IsWaiting());
+			Assert::IsTrue(sequence.IsSleeping());
+
+			world.Update();
+			Assert::AreEqual(0_z, sector.ActiveChildCount());
+			Assert::AreEqual(0, third);
+
+			EventMessageAttributed message;
+			message.SetSubtype("Go");
+			queue.Enqueue(std::make_shared<Event<EventMessageAttributed>>(message));
+
+			world.Update();
+			Assert::AreEqual(1, first);
+			Assert::AreEqual(1, third);
+			Assert::AreEqual(0_z, sequence.CurrentStep());
+			Assert::IsFalse(sequence.IsSleeping());
+
+			world.Update();
+			Assert::AreEqual(2, first);
+			Assert::AreEqual(1_z, sequence.CurrentStep());
+		}
+
+		TEST_METHOD(RemoveSteps)
+		{
+			ActionSequence sequence;
+			int& a = (sequence.Append("A") = 0).Get<int>();
+			int& b = (sequence.Append("B") = 0).Get<int>();
+			int& c = (sequence.Append("C") = 0).Get<int>();
+
+			Entity& incrementA = CreateIncrement(sequence, "IncrementA", "A");
+			Entity& gate = sequence.CreateChild("Entity", "Gate");
+			CreateIncrement(sequence, "IncrementB", "B");
+			CreateIncrement(sequence, "IncrementC", "C");
+
+			WorldState worldState;
+			gate.Sleep();
+			sequence.Update(worldState);
+			Assert::AreEqual(1, a);
+			Assert::AreEqual(1_z, sequence.CurrentStep());
+			Assert::IsTrue(sequence.IsSleeping());
+
+			sequence.DestroyChild(incrementA);
+			gate.Wake();
+			Assert::IsFalse(sequence.IsSleeping());
+			Assert::AreEqual(0_z, sequence.CurrentStep());
+
+			sequence.Update(worldState);
+			Assert::AreEqual(1, b);
+			Assert::AreEqual(1, c);
+			Assert::AreEqual(0_z, sequence.CurrentStep());
+
+			gate.Sleep();
+			sequence.Update(worldState);
+			Assert::AreEqual(0_z, sequence.CurrentStep());
+
+			sequence.DestroyChild(gate);
+			CreateIncrement(sequence, "IncrementA", "A");
+
+			sequence.Update(worldState);
+			Assert::AreEqual(2, a);
+			Assert::AreEqual(2, b);
+			Assert::AreEqual(2, c);
+			Assert::AreEqual(0_z, sequence.CurrentStep());
+		}
+
+		TEST_METHOD(StepOrder)
+		{
+			ActionSequence sequence;
+			int& a = (sequence.Append("A") = 0).Get<int>();
+			int& b = (sequence.Append("B") = 0).Get<int>();
+
+			CreateIncrement(sequence, "IncrementA", "A");
+			Entity& gate = sequence.CreateChild("Entity", "Gate");
+			CreateIncrement(sequence, "IncrementB", "B");
+			CreateIncrement(sequence, "Unlisted", "A");
+
+			*sequence.Find(ActionSequence::StepsKey) = { "IncrementB"s, "Gate"s, "IncrementA"s, "Missing"s };
+
+			WorldState worldState;
+			gate.Sleep();
+			sequence.Update(worldState);
+			Assert::AreEqual(0, a);
+			Assert::AreEqual(1, b);
+			Assert::AreEqual(1_z, sequence.CurrentStep());
+			Assert::IsTrue(sequence.IsSleeping());
+
+			gate.Wake();
+			sequence.Update(worldState);
+			Assert::AreEqual(1, a);
+			Assert::AreEqual(1, b);
+			Assert::AreEqual(0_z, sequence.CurrentStep());
+
+			/* Editing the order starts the script over */
+
+			gate.Sleep();
+			sequence.Update(worldState);
+			Assert::AreEqual(1_z, sequence.CurrentStep());
+
+			gate.Wake();
+			Assert::IsFalse(sequence.IsSleeping());
+
+			sequence.Find(ActionSequence::StepsKey)->Set("IncrementA"s, 0);
+			sequence.Find(ActionSequence::StepsKey)->Set("IncrementA"s, 2);
+			sequence.Update(worldState);
+			Assert::AreEqual(3, a);
+			Assert::AreEqual(2, b);
+
+			/* An empty order runs every child */
+
+			sequence.Find(ActionSequence::StepsKey)->Clear();
+			sequence.Update(worldState);
+			Assert::AreEqual(5, a);
+			Assert::AreEqual(3, b);
+		}
+
+		TEST_METHOD(NestedSequences)
+		{
+			GameTime gameTime;
+			EventQueue queue;
+
+			World world("World", &gameTime, &queue);
+			Entity& sector = world.CreateChild("Entity", "Sector");
+			int& inner = (sector.Append("InnerCount") = 0).Get<int>();
+			int& outer = (sector.Append("OuterCount") = 0).Get<int>();
+
+			ActionSequence& outerSequence = *sector.CreateChild("ActionSequence", "Outer").As<ActionSequence>();
+			ActionSequence& innerSequence = *outerSequence.CreateChild("ActionSequence", "Inner").As<ActionSequence>();
+			innerSequence.CreateChild("ActionWait", "Wait").Find(ActionWait::DurationKey)->Set(1);
+			CreateIncrement(innerSequence, "IncrementInner", "InnerCount");
+			CreateIncrement(outerSequence, "IncrementOuter", "OuterCount");
+
+			world.Update();
+			Assert::IsTrue(innerSequence.IsSleeping());
+			Assert::IsTrue(outerSequence.IsSleeping());
+			Assert::AreEqual(0, inner);
+			Assert::AreEqual(0, outer);
+
+			while (outer == 0)
+			{
+				world.Update();
+			}
+
+			Assert::AreEqual(1, inner);
+			Assert::AreEqual(1, outer);
+			Assert::AreEqual(0_z, innerSequence.CurrentStep());
+			Assert::AreEqual(0_z, outerSequence.CurrentStep());
+		}
+
+		TEST_METHOD(ParseFromJson)
+		{
+			Entity sector;
+
+			JsonEntityParseHelper::SharedData sharedData;
+			sharedData.SetEntity(sector);
+
+			JsonEntityParseHelper helper;
+			JsonParseMaster parser;
+
+			parser.AddHelper(helper);
+			parser.SetSharedData(sharedData);
+
+			const std::string json = R"({
+				"Count": {
+				  "type": "integer",
+				  "value": 0
+				},
+				"Script": {
+				  "type": "ActionSequence",
+				  "value": {
+				    "Step1": {
+				      "type": "ActionIncrement",
+				      "value": {
+				        "Operand": { "type": "string", "value": "Count" }
+				      }
+				    },
+				    "Step2": {
+				      "type": "ActionWait",
+				      "value": {
+				        "Duration": { "type": "integer", "value": 500 }
+				      }
+				    },
+				    "Step3": {
+				      "type": "ActionWaitForEvent",
+				      "value": {
+				        "Subtype": { "type": "string", "value": "Go" }
+				      }
+				    }
+				  }
+				}
+			})"s;
+
+			parser.Parse(json);
+
+			ActionSequence* script = sector.FindChild<ActionSequence>("Script");
+			Assert::IsNotNull(script);
+			Assert::AreEqual(3_z, script->ChildCount());
+			Assert::IsTrue(script->ChildAt(0).Is(ActionIncrement::TypeIdClass()));
+			Assert::AreEqual(500, script->ChildAt(1).Find(ActionWait::DurationKey)->Get<int>());
+			Assert::AreEqual("Go"s, script->ChildAt(2).Find(ActionWaitForEvent::SubtypeKey)->Get<std::string>());
+		}
+
+		TEST_METHOD(ParseStepOrder)
+		{
+			Entity sector;
+			int& first = (sector.Append("First") = 0).Get<int>();
+			int& second = (sector.Append("Second") = 0).Get<int>();
+
+			JsonEntityParseHelper::SharedData sharedData;
+			sharedData.SetEntity(sector);
+
+			JsonEntityParseHelper helper;
+			JsonParseMaster parser;
+
+			parser.AddHelper(helper);
+			parser.SetSharedData(sharedData);
+
+			// Keys are written out of alphabetical order, which the parser does not preserve.
+			const std::string json = R"({
+				"Script": {
+				  "type": "ActionSequence",
+				  "value": {
+				    "Steps": {
+				      "type": "string",
+				      "value": [ "Zeta", "Gate", "Alpha" ]
+				    },
+				    "Zeta": {
+				      "type": "ActionIncrement",
+				      "value": {
+				        "Operand": { "type": "string", "value": "First" }
+				      }
+				    },
+				    "Gate": {
+				      "type": "Entity",
+				      "value": {}
+				    },
+				    "Alpha": {
+				      "type": "ActionIncrement",
+				      "value": {
+				        "Operand": { "type": "string", "value": "Second" }
+				      }
+				    }
+				  }
+				}
+			})"s;
+
+			parser.Parse(json);
+
+			ActionSequence* script = sector.FindChild<ActionSequence>("Script");
+			Assert::IsNotNull(script);
+			Assert::AreEqual(3_z, script->ChildCount());
+			Assert::AreEqual(3_z, script->Find(ActionSequence::StepsKey)->Size());
+
+			Entity& gate = *script->FindChild("Gate");
+			gate.Sleep();
+
+			WorldState worldState;
+			script->Update(worldState);
+			Assert::AreEqual(1, first);
+			Assert::AreEqual(0, second);
+			Assert::AreEqual(1_z, script->CurrentStep());
+
+			gate.Wake();
+			script->Update(worldState);
+			Assert::AreEqual(1, first);
+			Assert::AreEqual(1, second);
+			Assert::AreEqual(0_z, script->CurrentStep());
+		}
+
+		TEST_METHOD(ToString)
+		{
+			const ActionSequence sequence("Sequence");
+			Assert::AreEqual("Sequence (ActionSequence)"s, sequence.ToString());
+		}
+
+	private:
+		static Entity& CreateIncrement(Entity& parent, const std::string& name, const std::string& operand)
+		{
+			Entity& increment = parent.CreateChild("ActionIncrement"s, name);
+			*increment.Find(ActionIncrement::OperandKey) = operand;
+
+			return increment;
+		}
+
+		static _CrtMemState sStartMemState;
+
+		EntityFactory entityFactory;
+		ActionSequenceFactory actionSequenceFactory;
+		ActionWaitFactory actionWaitFactory;
+		ActionWaitForEventFactory actionWaitForEventFactory;
+		ActionIncrementFactory actionIncrementFactory;
+	};
+
+	_CrtMemState ActionSequenceTest::sStartMemState;
+}
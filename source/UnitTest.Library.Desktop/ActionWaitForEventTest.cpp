@@ -0,0 +1,189 @@
+#include "pch.h"
+
+#include "ToStringSpecialization.h"
+#include "ActionWaitForEvent.h"
+#include "EventMessageAttributed.h"
+#include "Event.h"
+#include "EventQueue.h"
+#include "GameTime.h"
+#include "World.h"
+
+using namespace std::string_literals;
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+using namespace UnitTests;
+
+
+namespace EntitySystemTests::ActionTests
+{
+	TEST_CLASS(ActionWaitForEventTest)
+	{
+	public:
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+			TypeManager::Create();
+
+			RegisterType<Entity>();
+			RegisterType<ActionWaitForEvent>();
+			RegisterType<EventMessageAttributed>();
+			RegisterType<World>();
+
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&sStartMemState);
+#endif
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+			Event<EventMessageAttributed>::UnsubscribeAll();
+			Event<EventMessageAttributed>::SubscriberShrinkToFit();
+
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &sStartMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+
+			TypeManager::Destroy();
+		}
+
+		TEST_METHOD(RTTITest)
+		{
+			ActionWaitForEvent waitA;
+			ActionWaitForEvent waitB;
+
+			Assert::IsTrue(waitA.Is(Entity::TypeIdClass()));
+			Assert::IsTrue(waitA.Equals(&waitB));
+
+			Entity* newWait = new ActionWaitForEvent();
+			Entity* createdWait = newWait->CreateAs<Entity>();
+			const bool isActionWaitForEvent = createdWait ? createdWait->Is(ActionWaitForEvent::TypeIdClass()) : false;
+
+			delete newWait;
+			delete createdWait;
+
+			Assert::IsTrue(isActionWaitForEvent);
+		}
+
+		TEST_METHOD(Constructor)
+		{
+			Assert::AreEqual(0_z, Event<EventMessageAttributed>::SubscriberCount());
+
+			{
+				ActionWaitForEvent wait("Wait", "Door");
+				Assert::AreEqual("Wait"s, wait.Name());
+				Assert::IsFalse(wait.IsWaiting());
+				Assert::AreEqual(1_z, Event<EventMessageAttributed>::SubscriberCount());
+
+				const auto subtype = wait.Find(ActionWaitForEvent::SubtypeKey);
+				Assert::IsNotNull(subtype);
+				Assert::AreEqual(Scope::Types::String, subtype->Type());
+				Assert::AreEqual("Door"s, subtype->Get<std::string>());
+
+				ActionWaitForEvent copy(wait);
+				ActionWaitForEvent move(std::move(copy));
+				Assert::AreEqual(3_z, Event<EventMessageAttributed>::SubscriberCount());
+			}
+
+			Assert::AreEqual(0_z, Event<EventMessageAttributed>::SubscriberCount());
+		}
+
+		TEST_METHOD(Clone)
+		{
+			ActionWaitForEvent wait("Wait", "Door");
+			Scope* clone = wait.Clone();
+
+			const bool notNull = clone;
+			const bool isActionWaitForEvent = notNull ? clone->Is(ActionWaitForEvent::TypeIdClass()) : false;
+			const bool equal = *wait.As<Entity>() == *clone->As<Entity>();
+
+			delete clone;
+
+			Assert::IsTrue(notNull && isActionWaitForEvent && equal);
+		}
+
+		TEST_METHOD(Update)
+		{
+			GameTime gameTime;
+			EventQueue queue;
+
+			Entity parent;
+			ActionWaitForEvent& wait = *new ActionWaitForEvent("Wait", "Door");
+			parent.AddChild(wait);
+
+			Publish(queue, gameTime, "Door");
+			Assert::IsFalse(wait.IsWaiting());
+
+			WorldState worldState;
+			parent.Update(worldState);
+			Assert::IsTrue(wait.IsWaiting());
+			Assert::IsTrue(wait.IsSleeping());
+
+			parent.Update(worldState);
+			Assert::AreEqual(0_z, parent.ActiveChildCount());
+
+			Publish(queue, gameTime, "Window");
+			Assert::IsTrue(wait.IsSleeping());
+
+			Publish(queue, gameTime, "Door");
+			Assert::IsFalse(wait.IsWaiting());
+			Assert::IsFalse(wait.IsSleeping());
+			Assert::AreEqual(1_z, parent.ActiveChildCount());
+
+			parent.Update(worldState);
+			Assert::IsFalse(wait.IsWaiting());
+			Assert::IsFalse(wait.IsSleeping());
+
+			parent.Update(worldState);
+			Assert::IsTrue(wait.IsWaiting());
+		}
+
+		TEST_METHOD(UnsubscribeWhenReclaimed)
+		{
+			GameTime gameTime;
+			EventQueue queue;
+
+			World world("World", &gameTime, &queue);
+			world.SetReclaimBudget(0);
+
+			Entity& wait = world.CreateChild("ActionWaitForEvent", "Wait");
+			Assert::AreEqual(1_z, Event<EventMessageAttributed>::SubscriberCount());
+
+			world.DestroyChild(wait);
+			Assert::AreEqual(1_z, world.GetReclamationQueue().Size());
+			Assert::AreEqual(0_z, Event<EventMessageAttributed>::SubscriberCount());
+			Assert::IsFalse(wait.Enabled());
+
+			world.GetReclamationQueue().Drain();
+			Assert::IsTrue(world.GetReclamationQueue().IsEmpty());
+		}
+
+		TEST_METHOD(ToString)
+		{
+			const ActionWaitForEvent wait("Wait");
+			Assert::AreEqual("Wait (ActionWaitForEvent)"s, wait.ToString());
+		}
+
+	private:
+		static void Publish(EventQueue& queue, const GameTime& gameTime, const std::string& subtype)
+		{
+			EventMessageAttributed message;
+			message.SetSubtype(subtype);
+
+			queue.Enqueue(std::make_shared<Event<EventMessageAttributed>>(message));
+			queue.Update(gameTime);
+		}
+
+		static _CrtMemState sStartMemState;
+
+		ActionWaitForEventFactory actionWaitForEventFactory;
+	};
+
+	_CrtMemState ActionWaitForEventTest::sStartMemState;
+}
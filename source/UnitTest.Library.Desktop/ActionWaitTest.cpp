@@ -0,0 +1,144 @@
+#include "pch.h"
+
+#include "ToStringSpecialization.h"
+#include "ActionWait.h"
+#include "World.h"
+#include "GameTime.h"
+#include "EventQueue.h"
+
+using namespace std::string_literals;
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+using namespace UnitTests;
+
+
+namespace EntitySystemTests::ActionTests
+{
+	TEST_CLASS(ActionWaitTest)
+	{
+	public:
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+			TypeManager::Create();
+
+			RegisterType<Entity>();
+			RegisterType<ActionWait>();
+			RegisterType<World>();
+
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&sStartMemState);
+#endif
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &sStartMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+
+			TypeManager::Destroy();
+		}
+
+		TEST_METHOD(RTTITest)
+		{
+			ActionWait waitA;
+			ActionWait waitB;
+
+			Assert::IsTrue(waitA.Is(Entity::TypeIdClass()));
+			Assert::IsTrue(waitA.Equals(&waitB));
+
+			Entity* newWait = new ActionWait();
+			bool isAction = newWait->Is(Entity::TypeIdClass());
+
+			Entity* createdWait = isAction ? newWait->CreateAs<Entity>() : nullptr;
+			bool wasCreated = createdWait != nullptr;
+
+			bool isActionWait = wasCreated ? createdWait->Is(ActionWait::TypeIdClass()) : false;
+
+			delete newWait;
+			delete createdWait;
+
+			Assert::IsTrue(isAction && wasCreated && isActionWait);
+		}
+
+		TEST_METHOD(Constructor)
+		{
+			ActionWait wait("Wait", 250);
+			Assert::AreEqual("Wait"s, wait.Name());
+			Assert::IsFalse(wait.IsWaiting());
+
+			const auto duration = wait.Find(ActionWait::DurationKey);
+			Assert::IsNotNull(duration);
+			Assert::AreEqual(Scope::Types::Integer, duration->Type());
+			Assert::AreEqual(250, duration->Get<int>());
+		}
+
+		TEST_METHOD(Clone)
+		{
+			ActionWait wait("Wait", 250);
+			Scope* clone = wait.Clone();
+
+			const bool notNull = clone;
+			const bool isActionWait = notNull ? clone->Is(ActionWait::TypeIdClass()) : false;
+			const bool equal = *wait.As<Entity>() == *clone->As<Entity>();
+
+			delete clone;
+
+			Assert::IsTrue(notNull && isActionWait && equal);
+		}
+
+		TEST_METHOD(Update)
+		{
+			GameTime gameTime;
+			EventQueue queue;
+
+			World world("World", &gameTime, &queue);
+			Entity& sector = world.CreateChild("Entity", "Sector");
+			ActionWait& wait = *sector.CreateChild("ActionWait", "Wait").As<ActionWait>();
+
+			world.Update();
+			Assert::IsFalse(wait.IsWaiting());
+			Assert::IsFalse(wait.IsSleeping());
+
+			*wait.Find(ActionWait::DurationKey) = 1;
+			world.Update();
+			Assert::IsTrue(wait.IsWaiting());
+			Assert::IsTrue(wait.IsSleeping());
+			Assert::AreEqual(1_z, world.PendingWakeCount());
+
+			while (wait.IsSleeping())
+			{
+				world.Update();
+			}
+
+			Assert::IsFalse(wait.IsWaiting());
+			Assert::AreEqual(0_z, world.PendingWakeCount());
+
+			WorldState worldState;
+			Assert::ExpectException<std::runtime_error>([&wait, &worldState] { wait.Update(worldState); });
+		}
+
+		TEST_METHOD(ToString)
+		{
+			const ActionWait wait("Wait");
+			Assert::AreEqual("Wait (ActionWait)"s, wait.ToString());
+		}
+
+	private:
+		static _CrtMemState sStartMemState;
+
+		ActionWaitFactory actionWaitFactory;
+		EntityFactory entityFactory;
+	};
+
+	_CrtMemState ActionWaitTest::sStartMemState;
+}
@@ -0,0 +1,382 @@
+#include "pch.h"
+
+#include "ToStringSpecialization.h"
+#include "AnimationTestHelper.h"
+#include "AnimationBatch.h"
+#include "AnimatorComponent.h"
+#include "Model.h"
+#include "GameTime.h"
+#include "WorldState.h"
+
+using namespace std::string_literals;
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+using namespace UnitTests;
+using namespace Library;
+
+namespace EntitySystemTests
+{
+	TEST_CLASS(AnimationBatchTest)
+	{
+	public:
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+			TypeManager::Create();
+
+			RegisterType<Entity>();
+			RegisterType<Model>();
+			RegisterType<AnimatorComponent>();
+
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&sStartMemState);
+#endif
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &sStartMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+
+			TypeManager::Destroy();
+		}
+
+		TEST_METHOD(AddOncePerEvaluation)
+		{
+			auto model = CreateBoneChainModel(3);
+			auto clip = AddBoneChainClip(*model, "Walk"s, 4);
+
+			AnimatorComponent first(model, "First"s);
+			AnimatorComponent second(model, "Second"s);
+			first.StartClip(clip);
+			second.StartClip(clip);
+
+			AnimationBatch batch(1);
+			Assert::IsTrue(batch.IsEmpty());
+
+			batch.Add(first);
+			batch.Add(second);
+			batch.Add(first);
+			Assert::AreEqual(2_z, batch.Size());
+
+			// A copy carries the index of the component it was copied from, but is not itself queued.
+			AnimatorComponent copy(first);
+			batch.Add(copy);
+			batch.Add(copy);
+			Assert::AreEqual(3_z, batch.Size());
+
+			batch.Evaluate();
+			Assert::IsTrue(batch.IsEmpty());
+			Assert::AreEqual(9_z, batch.Palette().size());
+
+			batch.Add(second);
+			batch.Add(second);
+			Assert::AreEqual(1_z, batch.Size());
+
+			batch.Clear();
+			Assert::IsTrue(batch.IsEmpty());
+
+			batch.Add(second);
+			Assert::AreEqual(1_z, batch.Size());
+		}
+
+		TEST_METHOD(PaletteOffsets)
+		{
+			auto smallModel = CreateBoneChainModel(2);
+			auto largeModel = CreateBoneChainModel(5);
+			auto smallClip = AddBoneChainClip(*smallModel, "Small"s, 4);
+			auto largeClip = AddBoneChainClip(*largeModel, "Large"s, 6);
+
+			AnimatorComponent first(largeModel);
+			AnimatorComponent second(smallModel);
+			AnimatorComponent third(largeModel);
+			first.StartClip(largeClip);
+			second.StartClip(smallClip);
+			third.StartClip(largeClip);
+
+			GameTime gameTime;
+			gameTime.SetElapsedGameTime(std::chrono::milliseconds(700));
+
+			WorldState worldState;
+			worldState.GameTime = &gameTime;
+
+			// Outside of a World, Update evaluates the pose immediately, so each component's transforms are known before the batch runs.
+			third.Update(worldState);
+
+			AnimationBatch batch(1);
+			batch.Add(first);
+			batch.Add(second);
+			batch.Add(third);
+			batch.Evaluate();
+
+			Assert::AreEqual(0_z, first.PaletteOffset());
+			Assert::AreEqual(5_z, second.PaletteOffset());
+			Assert::AreEqual(7_z, third.PaletteOffset());
+
+			const auto palette = batch.Palette();
+			Assert::AreEqual(12_z, palette.size());
+
+			for (const AnimatorComponent* animator : { &first, &second, &third })
+			{
+				const auto& boneTransforms = animator->BoneTransforms();
+
+				for (std::size_t i = 0; i < boneTransforms.Size(); ++i)
+				{
+					Assert::AreEqual(boneTransforms[i], palette[animator->PaletteOffset() + i]);
+				}
+			}
+
+			Assert::AreNotEqual(palette[0], palette[7]);
+
+			// Offsets follow the registration order of each evaluation.
+			batch.Add(second);
+			batch.Add(third);
+			batch.Evaluate();
+
+			Assert::AreEqual(0_z, second.PaletteOffset());
+			Assert::AreEqual(2_z, third.PaletteOffset());
+			Assert::AreEqual(7_z, batch.Palette().size());
+		}
+
+		TEST_METHOD(ParallelEvaluation)
+		{
+			const std::size_t animatorCount = 200;
+			const std::size_t threadCount = 4;
+
+			auto model = CreateBoneChainModel(6);
+			auto clip = AddBoneChainClip(*model, "Walk"s, 8);
+
+			GameTime gameTime;
+			gameTime.SetElapsedGameTime(std::chrono::milliseconds(30));
+
+			WorldState worldState;
+			worldState.GameTime = &gameTime;
+
+			Vector<AnimatorComponent> animators(animatorCount, Vector<AnimatorComponent>::EqualityFunctor());
+			Vector<glm::mat4x4> expected;
+
+			// Each component is advanced a different number of frames, evaluating its pose serially.
+			for (std::size_t i = 0; i < animatorCount; ++i)
+			{
+				AnimatorComponent& animator = animators.EmplaceBack(model);
+				animator.StartClip(clip);
+
+				for (std::size_t frame = 0; frame <= i % 50; ++frame)
+				{
+					animator.Update(worldState);
+				}
+
+				for (const auto& boneTransform : animator.BoneTransforms())
+				{
+					expected.EmplaceBack(boneTransform);
+				}
+			}
+
+			AnimationBatch batch(threadCount);
+			Assert::AreEqual(threadCount, batch.ThreadCount());
+			Assert::IsTrue(animatorCount >= threadCount * AnimationBatch::MinimumPerWorker);
+
+			for (auto& animator : animators)
+			{
+				batch.Add(animator);
+			}
+
+			batch.Evaluate();
+
+			Assert::AreEqual(animatorCount, batch.EvaluatedCount());
+
+			const auto palette = batch.Palette();
+			Assert::AreEqual(expected.Size(), palette.size());
+
+			for (std::size_t i = 0; i < expected.Size(); ++i)
+			{
+				Assert::AreEqual(expected[i], palette[i]);
+			}
+		}
+
+		TEST_METHOD(IntervalSelection)
+		{
+			auto model = CreateBoneChainModel(3);
+			auto clip = AddBoneChainClip(*model, "Walk"s, 4);
+
+			AnimatorComponent full(model);
+			AnimatorComponent half(model);
+			AnimatorComponent quarter(model);
+			full.StartClip(clip);
+			half.StartClip(clip);
+			quarter.StartClip(clip);
+			half.SetImportance(0.5f);
+			quarter.SetImportance(0.25f);
+
+			AnimationBatch batch(1);
+
+			// Every component is due on its first evaluation. After that, each is evaluated once per interval, of one, two and four frames.
+			for (const std::size_t expected : { 3_z, 1_z, 2_z, 1_z, 3_z, 1_z, 2_z, 1_z, 3_z })
+			{
+				batch.Add(full);
+				batch.Add(half);
+				batch.Add(quarter);
+				batch.Evaluate();
+
+				Assert::AreEqual(expected, batch.EvaluatedCount());
+			}
+
+			// Raising the importance shortens the interval at once, rather than after the one in progress.
+			quarter.SetImportance(1.0f);
+
+			for (std::uint32_t frame = 0; frame < 3; ++frame)
+			{
+				batch.Add(quarter);
+				batch.Evaluate();
+
+				Assert::AreEqual(1_z, batch.EvaluatedCount());
+			}
+		}
+
+		TEST_METHOD(FrozenThenThawed)
+		{
+			auto model = CreateBoneChainModel(3);
+			auto clip = AddBoneChainClip(*model, "Walk"s, 4);
+
+			AnimatorComponent animator(model);
+			animator.StartClip(clip);
+			animator.SetImportance(0.0f);
+
+			AnimationBatch batch(1);
+
+			auto evaluate = [&batch, &animator]
+			{
+				batch.Add(animator);
+				batch.Evaluate();
+				return batch.EvaluatedCount();
+			};
+
+			for (std::uint32_t frame = 0; frame < 5; ++frame)
+			{
+				Assert::AreEqual(0_z, evaluate());
+			}
+
+			// Due as soon as it thaws, then every eighth frame.
+			animator.SetImportance(0.125f);
+			Assert::AreEqual(1_z, evaluate());
+
+			for (std::uint32_t frame = 1; frame < AnimationBatch::MaxUpdateInterval; ++frame)
+			{
+				Assert::AreEqual(0_z, evaluate());
+			}
+
+			Assert::AreEqual(1_z, evaluate());
+
+			// Frozen for longer than its interval, it has grown stale, so it is again due as soon as it thaws.
+			animator.SetImportance(0.0f);
+
+			for (std::uint32_t frame = 0; frame < 10; ++frame)
+			{
+				Assert::AreEqual(0_z, evaluate());
+			}
+
+			animator.SetImportance(0.125f);
+			Assert::AreEqual(1_z, evaluate());
+			Assert::AreEqual(0_z, evaluate());
+		}
+
+		TEST_METHOD(BoneBudget)
+		{
+			auto model = CreateBoneChainModel(3);
+			auto clip = AddBoneChainClip(*model, "Walk"s, 8);
+
+			GameTime gameTime;
+			gameTime.SetElapsedGameTime(std::chrono::milliseconds(200));
+
+			WorldState worldState;
+			worldState.GameTime = &gameTime;
+
+			// Listed from least to most important, so the order of evaluation is not the order of registration.
+			const float importances[] = { 0.6f, 0.7f, 0.8f, 0.9f };
+			Vector<AnimatorComponent> animators(std::size(importances), Vector<AnimatorComponent>::EqualityFunctor());
+
+			for (const float importance : importances)
+			{
+				AnimatorComponent& animator = animators.EmplaceBack(model);
+				animator.StartClip(clip);
+				animator.SetImportance(importance);
+			}
+
+			AnimationBatch batch(1);
+			Assert::AreEqual(0_z, batch.BoneBudget());
+
+			// Two components of three bones fit within seven bones.
+			batch.SetBoneBudget(7);
+			Assert::AreEqual(7_z, batch.BoneBudget());
+
+			// Outside of a World, Update poses each component at its current time. An evaluation then moves its transforms
+			// toward the pose of its next evaluation, which a deferred component, interpolating over a single frame, does not.
+			Vector<glm::mat4x4> transforms;
+
+			for (auto& animator : animators)
+			{
+				animator.Update(worldState);
+
+				for (const auto& boneTransform : animator.BoneTransforms())
+				{
+					transforms.EmplaceBack(boneTransform);
+				}
+
+				batch.Add(animator);
+			}
+
+			batch.Evaluate();
+			Assert::AreEqual(2_z, batch.EvaluatedCount());
+
+			for (std::size_t i = 0; i < animators.Size(); ++i)
+			{
+				const bool isEvaluated = (i >= 2);
+				Assert::AreEqual(isEvaluated, animators[i].BoneTransforms()[2] != transforms[i * 3 + 2]);
+			}
+
+			// The deferred components are now the stalest, and the evaluated ones are not yet due again.
+			for (auto& animator : animators)
+			{
+				batch.Add(animator);
+			}
+
+			batch.Evaluate();
+			Assert::AreEqual(2_z, batch.EvaluatedCount());
+
+			// A budget smaller than any component still evaluates the most important due component.
+			batch.SetBoneBudget(1);
+
+			for (auto& animator : animators)
+			{
+				animator.SetImportance(1.0f);
+				batch.Add(animator);
+			}
+
+			batch.Evaluate();
+			Assert::AreEqual(1_z, batch.EvaluatedCount());
+
+			batch.SetBoneBudget(0);
+
+			for (auto& animator : animators)
+			{
+				batch.Add(animator);
+			}
+
+			batch.Evaluate();
+			Assert::AreEqual(animators.Size(), batch.EvaluatedCount());
+		}
+
+	private:
+		static _CrtMemState sStartMemState;
+	};
+
+	_CrtMemState AnimationBatchTest::sStartMemState;
+}
@@ -0,0 +1,235 @@
+#include "pch.h"
+
+#include "ToStringSpecialization.h"
+#include "AnimationTestHelper.h"
+#include "AnimationClip.h"
+#include "AnimationCompressor.h"
+#include "AnimatorComponent.h"
+#include "BoneAnimation.h"
+#include "Bone.h"
+#include "Keyframe.h"
+#include "Model.h"
+#include "Transform.h"
+#include "GameTime.h"
+#include "WorldState.h"
+
+#pragma warning(disable : 4201)
+#include <glm/gtc/quaternion.hpp>
+#pragma warning(default : 4201)
+
+using namespace std::string_literals;
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+using namespace UnitTests;
+using namespace Library;
+
+namespace EntitySystemTests
+{
+	TEST_CLASS(AnimationClipTest)
+	{
+	public:
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+			TypeManager::Create();
+
+			RegisterType<Entity>();
+			RegisterType<Model>();
+			RegisterType<AnimatorComponent>();
+
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&sStartMemState);
+#endif
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &sStartMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+
+			TypeManager::Destroy();
+		}
+
+		TEST_METHOD(SampleInterpolatedPoseMatchesTracks)
+		{
+			// Track counts around multiples of four, so the last group of lanes is full, partial, or a single track.
+			for (std::uint32_t trackCount = 1; trackCount <= 9; ++trackCount)
+			{
+				auto model = CreateBoneChainModel(trackCount);
+				auto clip = AddBoneChainClip(*model, "Clip"s, 5, 0.3f * trackCount);
+
+				Vector<std::uint32_t> cursors;
+				Vector<BonePose> poses;
+				Vector<glm::mat4x4> localTransforms;
+				cursors.Resize(trackCount);
+				poses.Resize(trackCount);
+				localTransforms.Resize(trackCount);
+
+				for (const float time : { -0.5f, 0.0f, 0.4f, 1.0f, 2.75f, 3.999f, 4.0f, 5.0f })
+				{
+					clip->SampleInterpolatedPose(time, MakeSpan(cursors), MakeSpan(poses));
+					clip->SampleInterpolatedPose(time, MakeSpan(cursors), MakeSpan(localTransforms));
+
+					for (const auto& boneAnimation : clip->BoneAnimations())
+					{
+						const std::uint32_t boneIndex = boneAnimation->GetBone().Index();
+
+						Transform expected;
+						boneAnimation->GetInterpolatedTransform(time, expected);
+
+						const BonePose& pose = poses[boneIndex];
+						AssertNear(expected.Translation(), pose.Translation);
+						AssertNear(expected.Scale(), pose.Scale);
+						AssertNear(glm::vec4(expected.Rotation().x, expected.Rotation().y, expected.Rotation().z, expected.Rotation().w),
+							glm::vec4(pose.Rotation.x, pose.Rotation.y, pose.Rotation.z, pose.Rotation.w));
+
+						for (glm::length_t column = 0; column < 4; ++column)
+						{
+							AssertNear(expected.Matrix()[column], localTransforms[boneIndex][column]);
+						}
+					}
+				}
+			}
+		}
+
+		TEST_METHOD(TransformOrder)
+		{
+			auto model = CreateBoneChainModel(1);
+
+			// Scaled first, then rotated a quarter turn about z, then translated.
+			const glm::vec3 translation(1.0f, 2.0f, 3.0f);
+			const glm::quat rotation = glm::angleAxis(glm::half_pi<float>(), glm::vec3(0.0f, 0.0f, 1.0f));
+			const glm::vec3 scale(2.0f, 1.0f, 1.0f);
+			const glm::vec4 point(1.0f, 0.0f, 0.0f, 1.0f);
+			const glm::vec4 expected(1.0f, 4.0f, 3.0f, 1.0f);
+
+			AnimationClipData clipData("Pose"s, 1.0f, 1.0f);
+			clipData.KeyframeCount = 2;
+
+			BoneAnimationData boneAnimationData;
+			boneAnimationData.Keyframes.EmplaceBack(std::make_shared<const Keyframe>(0.0f, translation, rotation, scale));
+			boneAnimationData.Keyframes.EmplaceBack(std::make_shared<const Keyframe>(1.0f, translation, rotation, scale));
+			clipData.BoneAnimations.EmplaceBack(std::make_shared<const BoneAnimation>(*model, std::move(boneAnimationData)));
+
+			const AnimationClip clip(std::move(clipData));
+
+			Vector<std::uint32_t> cursors;
+			Vector<glm::mat4x4> localTransforms;
+			cursors.Resize(1);
+			localTransforms.Resize(1);
+
+			clip.SamplePose(0.5f, MakeSpan(cursors), MakeSpan(localTransforms));
+			AssertNear(expected, localTransforms[0] * point);
+
+			localTransforms[0] = glm::mat4x4(0.0f);
+			clip.SampleInterpolatedPose(0.5f, MakeSpan(cursors), MakeSpan(localTransforms));
+			AssertNear(expected, localTransforms[0] * point);
+
+			AssertNear(expected, BonePose{ translation, rotation, scale }.Matrix() * point);
+			AssertNear(expected, Transform(translation, rotation, scale).Matrix() * point);
+		}
+
+		TEST_METHOD(CompressWhilePlaying)
+		{
+			auto model = CreateBoneChainModel(3);
+			auto clip = AddBoneChainClip(*model, "Walk"s, 30);
+			const auto reference = std::make_shared<AnimationClip>(*clip);
+
+			GameTime gameTime;
+			gameTime.SetElapsedGameTime(std::chrono::milliseconds(250));
+
+			WorldState worldState;
+			worldState.GameTime = &gameTime;
+
+			AnimatorComponent animator(model);
+			AnimatorComponent referenceAnimator(model);
+			animator.StartClip(clip);
+			referenceAnimator.StartClip(reference);
+
+			animator.Update(worldState);
+			referenceAnimator.Update(worldState);
+			animator.SetCurrentKeyFrame(2);
+			Assert::IsFalse(clip->IsCompressed());
+
+			const AnimationCompressionReport report = AnimationCompressor::Compress(*clip);
+			Assert::IsTrue(clip->IsCompressed());
+			Assert::IsFalse(reference->IsCompressed());
+			Assert::AreEqual(90U, report.KeyframeCount);
+
+			// The playing component samples the compressed tracks, within the compression tolerances of the originals.
+			for (std::uint32_t frame = 0; frame < 20; ++frame)
+			{
+				animator.Update(worldState);
+				referenceAnimator.Update(worldState);
+			}
+
+			for (std::size_t i = 0; i < animator.BoneTransforms().Size(); ++i)
+			{
+				for (glm::length_t column = 0; column < 4; ++column)
+				{
+					const glm::vec4 difference = animator.BoneTransforms()[i][column] - referenceAnimator.BoneTransforms()[i][column];
+					Assert::IsTrue(glm::length(difference) < 1e-2f);
+				}
+			}
+
+			Assert::ExpectException<std::runtime_error>([&animator] { animator.SetCurrentKeyFrame(2); });
+			referenceAnimator.SetCurrentKeyFrame(2);
+		}
+
+		TEST_METHOD(CompressEmptyTrack)
+		{
+			auto model = CreateBoneChainModel(2);
+
+			AnimationClipData clipData("Partial"s, 1.0f, 1.0f);
+			clipData.KeyframeCount = 2;
+
+			BoneAnimationData emptyData;
+			emptyData.BoneIndex = 0;
+
+			BoneAnimationData boneAnimationData;
+			boneAnimationData.BoneIndex = 1;
+			boneAnimationData.Keyframes.EmplaceBack(std::make_shared<const Keyframe>(0.0f, glm::vec3(0.0f), glm::quat(1.0f, 0.0f, 0.0f, 0.0f), glm::vec3(1.0f)));
+			boneAnimationData.Keyframes.EmplaceBack(std::make_shared<const Keyframe>(1.0f, glm::vec3(1.0f), glm::quat(1.0f, 0.0f, 0.0f, 0.0f), glm::vec3(1.0f)));
+
+			clipData.BoneAnimations.EmplaceBack(std::make_shared<const BoneAnimation>(*model, std::move(emptyData)));
+			clipData.BoneAnimations.EmplaceBack(std::make_shared<const BoneAnimation>(*model, std::move(boneAnimationData)));
+
+			AnimationClip clip(std::move(clipData));
+			const AnimationCompressionReport report = AnimationCompressor::Compress(clip);
+
+			Assert::AreEqual(2U, report.KeyframeCount);
+			Assert::AreEqual(0U, report.RemovedKeyframeCount);
+			Assert::AreEqual(0U, clip.BoneAnimations()[0]->KeyframeCount());
+			Assert::AreEqual(2U, clip.BoneAnimations()[1]->KeyframeCount());
+			Assert::AreEqual(2U, clip.KeyframeCount());
+		}
+
+	private:
+		template <typename T>
+		static gsl::span<T> MakeSpan(Vector<T>& vector)
+		{
+			return gsl::span<T>(&vector[0], vector.Size());
+		}
+
+		template <typename TVector>
+		static void AssertNear(const TVector& expected, const TVector& actual)
+		{
+			for (glm::length_t i = 0; i < TVector::length(); ++i)
+			{
+				Assert::AreEqual(expected[i], actual[i], 1e-5f);
+			}
+		}
+
+		static _CrtMemState sStartMemState;
+	};
+
+	_CrtMemState AnimationClipTest::sStartMemState;
+}
@@ -0,0 +1,79 @@
+#include "pch.h"
+#include "AnimationTestHelper.h"
+
+#include <cmath>
+
+#pragma warning(disable : 4201)
+#include <glm/gtc/quaternion.hpp>
+#include <glm/gtx/transform.hpp>
+#pragma warning(default : 4201)
+
+#include "Model.h"
+#include "Bone.h"
+#include "AnimationClip.h"
+#include "BoneAnimation.h"
+#include "Keyframe.h"
+
+using namespace Library;
+
+namespace UnitTests
+{
+	std::shared_ptr<Model> CreateBoneChainModel(const std::uint32_t boneCount)
+	{
+		ModelData modelData;
+		modelData.RootNode = std::make_shared<SceneNode>("Root");
+
+		std::shared_ptr<SceneNode> parent = modelData.RootNode;
+
+		for (std::uint32_t i = 0; i < boneCount; ++i)
+		{
+			const std::string name = "Bone" + std::to_string(i);
+
+			auto bone = std::make_shared<Bone>(name, i, glm::translate(glm::vec3(-static_cast<float>(i + 1), 0.0f, 0.0f)));
+			bone->SetTransform(glm::translate(glm::vec3(1.0f, 0.0f, 0.0f)));
+			bone->SetParent(parent);
+			parent->Children().EmplaceBack(bone);
+
+			modelData.Bones.EmplaceBack(bone);
+			modelData.BoneIndexMapping[name] = i;
+			parent = std::move(bone);
+		}
+
+		return std::make_shared<Model>(std::move(modelData));
+	}
+
+	std::shared_ptr<AnimationClip> AddBoneChainClip(Model& model, const std::string& name, const std::uint32_t keyframeCount, const float phase)
+	{
+		AnimationClipData clipData(name, static_cast<float>(keyframeCount - 1), 1.0f);
+		clipData.KeyframeCount = keyframeCount;
+
+		for (const auto& bone : model.Bones())
+		{
+			const float boneOffset = phase + 0.1f * bone->Index();
+
+			BoneAnimationData boneAnimationData;
+			boneAnimationData.BoneIndex = bone->Index();
+
+			for (std::uint32_t i = 0; i < keyframeCount; ++i)
+			{
+				const float time = static_cast<float>(i);
+				const glm::vec3 translation(1.0f, std::sin(time + boneOffset), 0.0f);
+				const glm::quat rotation = glm::angleAxis(0.5f * std::cos(time + boneOffset), glm::vec3(0.0f, 0.0f, 1.0f));
+				const glm::vec3 scale(1.0f + 0.25f * std::sin(0.5f * time + boneOffset));
+
+				boneAnimationData.Keyframes.EmplaceBack(std::make_shared<const Keyframe>(time, translation, rotation, scale));
+			}
+
+			auto boneAnimation = std::make_shared<const BoneAnimation>(model, std::move(boneAnimationData));
+			clipData.BoneAnimationsByBone[bone.get()] = boneAnimation;
+			clipData.BoneAnimations.EmplaceBack(std::move(boneAnimation));
+		}
+
+		auto clip = std::make_shared<AnimationClip>(std::move(clipData));
+		model.Data().Animations.EmplaceBack(clip);
+		model.Data().AnimationsByName[name] = clip;
+		model.FlattenSkeleton();
+
+		return clip;
+	}
+}
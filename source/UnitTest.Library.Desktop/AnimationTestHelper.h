@@ -0,0 +1,32 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace Library
+{
+	class Model;
+	class AnimationClip;
+}
+
+namespace UnitTests
+{
+	/// <summary>
+	/// Creates a Model whose bones form a chain below a root node, each one unit along x from its parent.
+	/// </summary>
+	/// <param name="boneCount">Number of bones in the chain.</param>
+	/// <returns>Model, with its skeleton flattened.</returns>
+	std::shared_ptr<Library::Model> CreateBoneChainModel(const std::uint32_t boneCount);
+
+	/// <summary>
+	/// Adds a clip animating every bone of a Model, then flattens the skeleton again so the clip's tracks are ordered by depth.
+	/// Each bone translates, rotates about z and scales over keyframes one tick apart, at one tick per second.
+	/// </summary>
+	/// <param name="model">Model animated by the clip.</param>
+	/// <param name="name">Name of the clip.</param>
+	/// <param name="keyframeCount">Keyframes of each bone.</param>
+	/// <param name="phase">Offset of the motion, so clips of the same Model differ.</param>
+	/// <returns>Clip, owned by the Model.</returns>
+	std::shared_ptr<Library::AnimationClip> AddBoneChainClip(Library::Model& model, const std::string& name, const std::uint32_t keyframeCount, const float phase=0.0f);
+}
@@ -0,0 +1,337 @@
+#include "pch.h"
+
+#include "ToStringSpecialization.h"
+#include "AnimationTestHelper.h"
+#include "AnimatorComponent.h"
+#include "AnimationClip.h"
+#include "BoneAnimation.h"
+#include "Keyframe.h"
+#include "Model.h"
+#include "GameTime.h"
+#include "WorldState.h"
+
+#include <cmath>
+
+#pragma warning(disable : 4201)
+#include <glm/gtc/quaternion.hpp>
+#pragma warning(default : 4201)
+
+using namespace std::string_literals;
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+using namespace UnitTests;
+using namespace Library;
+
+namespace EntitySystemTests
+{
+	TEST_CLASS(AnimatorComponentTest)
+	{
+	public:
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+			TypeManager::Create();
+
+			RegisterType<Entity>();
+			RegisterType<Model>();
+			RegisterType<AnimatorComponent>();
+
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&sStartMemState);
+#endif
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &sStartMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+
+			TypeManager::Destroy();
+		}
+
+		TEST_METHOD(AddAndRemoveLayers)
+		{
+			auto model = CreateBoneChainModel(2);
+			auto walk = AddBoneChainClip(*model, "Walk"s, 4);
+			auto run = AddBoneChainClip(*model, "Run"s, 4, 1.0f);
+
+			AnimatorComponent animator(model);
+			animator.StartClip(walk);
+			Assert::AreEqual(0_z, animator.LayerCount());
+
+			Assert::AreEqual(0_z, animator.AddLayer(run));
+			Assert::AreEqual(1_z, animator.AddLayer(walk, 0.5f, AnimationBlendMode::Additive));
+			Assert::AreEqual(2_z, animator.AddLayer(run, 0.25f, AnimationBlendMode::Override, false));
+			Assert::AreEqual(3_z, animator.LayerCount());
+
+			Assert::AreEqual(1.0f, animator.LayerWeight(0));
+			Assert::AreEqual(0.5f, animator.LayerWeight(1));
+			Assert::AreEqual(0.25f, animator.LayerWeight(2));
+
+			animator.SetLayerWeight(0, 0.75f);
+			Assert::AreEqual(0.75f, animator.LayerWeight(0));
+
+			// Layers above a removed layer move down an index.
+			animator.RemoveLayer(1);
+			Assert::AreEqual(2_z, animator.LayerCount());
+			Assert::AreEqual(0.75f, animator.LayerWeight(0));
+			Assert::AreEqual(0.25f, animator.LayerWeight(1));
+
+			Assert::ExpectException<std::out_of_range>([&animator] { animator.RemoveLayer(2); });
+			Assert::ExpectException<std::out_of_range>([&animator] { animator.LayerWeight(2); });
+			Assert::ExpectException<std::out_of_range>([&animator] { animator.SetLayerWeight(2, 1.0f); });
+			Assert::ExpectException<std::out_of_range>([&animator] { animator.FadeLayer(2, 1.0f, 1.0f); });
+
+			animator.ClearLayers();
+			Assert::AreEqual(0_z, animator.LayerCount());
+			Assert::ExpectException<std::out_of_range>([&animator] { animator.RemoveLayer(0); });
+
+			Assert::AreEqual(0_z, animator.AddLayer(run));
+			Assert::AreEqual(1_z, animator.LayerCount());
+		}
+
+		TEST_METHOD(FadeLayer)
+		{
+			auto model = CreateBoneChainModel(2);
+			auto walk = AddBoneChainClip(*model, "Walk"s, 4);
+			auto run = AddBoneChainClip(*model, "Run"s, 4, 1.0f);
+
+			GameTime gameTime;
+			gameTime.SetElapsedGameTime(std::chrono::milliseconds(250));
+
+			WorldState worldState;
+			worldState.GameTime = &gameTime;
+
+			AnimatorComponent animator(model);
+			animator.StartClip(walk);
+			animator.AddLayer(run, 0.0f);
+
+			// Fading to less than full weight never replaces the current clip.
+			animator.FadeLayer(0, 0.5f, 1.0f);
+			Assert::AreEqual(0.0f, animator.LayerWeight(0));
+
+			for (const float expected : { 0.125f, 0.25f, 0.375f, 0.5f, 0.5f })
+			{
+				animator.Update(worldState);
+				Assert::AreEqual(expected, animator.LayerWeight(0), 1e-6f);
+			}
+
+			animator.FadeLayer(0, 0.0f, 0.5f);
+			animator.Update(worldState);
+			Assert::AreEqual(0.25f, animator.LayerWeight(0), 1e-6f);
+			animator.Update(worldState);
+			Assert::AreEqual(0.0f, animator.LayerWeight(0), 1e-6f);
+
+			animator.FadeLayer(0, 0.75f, 0.0f);
+			Assert::AreEqual(0.75f, animator.LayerWeight(0));
+
+			// Setting the weight stops a fade in progress.
+			animator.FadeLayer(0, 0.0f, 1.0f);
+			animator.SetLayerWeight(0, 0.5f);
+			animator.Update(worldState);
+			Assert::AreEqual(0.5f, animator.LayerWeight(0));
+
+			Assert::AreEqual(1_z, animator.LayerCount());
+			Assert::IsTrue(animator.CurrentClip() == walk);
+		}
+
+		TEST_METHOD(CrossfadePromotesLayer)
+		{
+			auto model = CreateBoneChainModel(3);
+			auto walk = AddBoneChainClip(*model, "Walk"s, 6);
+			auto run = AddBoneChainClip(*model, "Run"s, 6, 1.0f);
+			auto wave = CreatePartialClip(*model, 2);
+
+			GameTime gameTime;
+			gameTime.SetElapsedGameTime(std::chrono::milliseconds(250));
+
+			WorldState worldState;
+			worldState.GameTime = &gameTime;
+
+			AnimatorComponent animator(model);
+			animator.StartClip(walk);
+			animator.AddLayer(wave, 0.5f);
+			animator.AddLayer(run, 0.0f);
+			animator.AddLayer(wave, 0.25f);
+			animator.FadeLayer(1, 1.0f, 0.5f);
+
+			// The same pose, played without the crossfade.
+			AnimatorComponent reference(model);
+			reference.StartClip(run);
+			reference.AddLayer(wave, 0.25f);
+
+			animator.Update(worldState);
+			reference.Update(worldState);
+			Assert::AreEqual(3_z, animator.LayerCount());
+			Assert::AreEqual(0.5f, animator.LayerWeight(1), 1e-6f);
+
+			// At full weight, the run layer replaces the current clip and the layer beneath it. The layer above it moves down.
+			animator.Update(worldState);
+			reference.Update(worldState);
+			Assert::AreEqual(1_z, animator.LayerCount());
+			Assert::AreEqual(0.25f, animator.LayerWeight(0));
+			Assert::IsTrue(animator.CurrentClip() == run);
+			Assert::AreEqual(reference.CurrentTime(), animator.CurrentTime());
+			Assert::IsTrue(animator.IsClipLooped());
+			Assert::IsTrue(animator.IsPlayingClip());
+
+			for (std::uint32_t frame = 0; frame < 30; ++frame)
+			{
+				for (std::size_t i = 0; i < animator.BoneTransforms().Size(); ++i)
+				{
+					Assert::AreEqual(reference.BoneTransforms()[i], animator.BoneTransforms()[i]);
+				}
+
+				animator.Update(worldState);
+				reference.Update(worldState);
+			}
+		}
+
+		TEST_METHOD(CrossfadeKeepsPartialLayer)
+		{
+			auto model = CreateBoneChainModel(3);
+			auto walk = AddBoneChainClip(*model, "Walk"s, 6);
+			auto wave = CreatePartialClip(*model, 1);
+
+			GameTime gameTime;
+			gameTime.SetElapsedGameTime(std::chrono::milliseconds(250));
+
+			WorldState worldState;
+			worldState.GameTime = &gameTime;
+
+			// The wave animates one bone, so the current clip still shows through on the others.
+			AnimatorComponent animator(model);
+			animator.StartClip(walk);
+			animator.AddLayer(wave, 0.0f);
+			animator.FadeLayer(0, 1.0f, 0.25f);
+
+			for (std::uint32_t frame = 0; frame < 4; ++frame)
+			{
+				animator.Update(worldState);
+				Assert::AreEqual(1_z, animator.LayerCount());
+				Assert::AreEqual(1.0f, animator.LayerWeight(0));
+				Assert::IsTrue(animator.CurrentClip() == walk);
+			}
+		}
+
+		TEST_METHOD(AdditiveZeroReferenceScale)
+		{
+			auto model = CreateBoneChainModel(1);
+			auto walk = AddBoneChainClip(*model, "Walk"s, 4);
+
+			// Flattened along x at its first keyframe, then stretched along y.
+			AnimationClipData clipData("Stretch"s, 1.0f, 1.0f);
+			clipData.KeyframeCount = 2;
+
+			BoneAnimationData boneAnimationData;
+			boneAnimationData.BoneIndex = 0;
+			boneAnimationData.Keyframes.EmplaceBack(std::make_shared<const Keyframe>(0.0f, glm::vec3(0.0f), glm::quat(1.0f, 0.0f, 0.0f, 0.0f), glm::vec3(0.0f, 1.0f, 1.0f)));
+			boneAnimationData.Keyframes.EmplaceBack(std::make_shared<const Keyframe>(1.0f, glm::vec3(0.0f), glm::quat(1.0f, 0.0f, 0.0f, 0.0f), glm::vec3(0.0f, 2.0f, 1.0f)));
+			clipData.BoneAnimations.EmplaceBack(std::make_shared<const BoneAnimation>(*model, std::move(boneAnimationData)));
+
+			auto stretch = std::make_shared<AnimationClip>(std::move(clipData));
+
+			GameTime gameTime;
+			gameTime.SetElapsedGameTime(std::chrono::milliseconds(500));
+
+			WorldState worldState;
+			worldState.GameTime = &gameTime;
+
+			AnimatorComponent animator(model);
+			AnimatorComponent reference(model);
+			animator.StartClip(walk);
+			reference.StartClip(walk);
+			animator.AddLayer(stretch, 1.0f, AnimationBlendMode::Additive);
+
+			animator.Update(worldState);
+			reference.Update(worldState);
+
+			const glm::mat4x4& transform = animator.BoneTransforms()[0];
+			for (glm::length_t column = 0; column < 4; ++column)
+			{
+				for (glm::length_t row = 0; row < 4; ++row)
+				{
+					Assert::IsTrue(std::isfinite(transform[column][row]));
+				}
+			}
+
+			// The x axis is left as the current clip poses it; the y axis is stretched by half.
+			Assert::AreEqual(glm::length(reference.BoneTransforms()[0][0]), glm::length(transform[0]), 1e-5f);
+			Assert::AreEqual(1.5f * glm::length(reference.BoneTransforms()[0][1]), glm::length(transform[1]), 1e-5f);
+		}
+
+		TEST_METHOD(LayerPoolReuse)
+		{
+			auto model = CreateBoneChainModel(3);
+			auto walk = AddBoneChainClip(*model, "Walk"s, 6);
+			auto run = AddBoneChainClip(*model, "Run"s, 6, 1.0f);
+			auto wave = CreatePartialClip(*model, 2);
+
+			GameTime gameTime;
+			gameTime.SetElapsedGameTime(std::chrono::milliseconds(300));
+
+			WorldState worldState;
+			worldState.GameTime = &gameTime;
+
+			AnimatorComponent animator(model);
+			animator.StartClip(walk);
+
+			// Leaves a used layer, with its cursors, pose and reference pose, in the pool.
+			animator.AddLayer(run, 0.5f, AnimationBlendMode::Additive);
+			animator.Update(worldState);
+			animator.Update(worldState);
+			animator.RemoveLayer(0);
+			Assert::AreEqual(0_z, animator.AddLayer(wave, 0.75f, AnimationBlendMode::Additive));
+
+			// A reused layer poses the model as a new one does.
+			AnimatorComponent reference(model);
+			reference.StartClip(walk);
+			reference.AddLayer(wave, 0.75f, AnimationBlendMode::Additive);
+
+			for (std::uint32_t frame = 0; frame < 10; ++frame)
+			{
+				animator.Update(worldState);
+				reference.Update(worldState);
+
+				for (std::size_t i = 0; i < animator.BoneTransforms().Size(); ++i)
+				{
+					Assert::AreEqual(reference.BoneTransforms()[i], animator.BoneTransforms()[i]);
+				}
+			}
+		}
+
+	private:
+		/// <summary>
+		/// Creates a clip animating a single bone of a Model, rotating it back and forth about z.
+		/// </summary>
+		static std::shared_ptr<AnimationClip> CreatePartialClip(Model& model, const std::uint32_t boneIndex)
+		{
+			AnimationClipData clipData("Wave"s, 2.0f, 1.0f);
+			clipData.KeyframeCount = 3;
+
+			BoneAnimationData boneAnimationData;
+			boneAnimationData.BoneIndex = boneIndex;
+
+			for (std::uint32_t i = 0; i < 3; ++i)
+			{
+				const glm::quat rotation = glm::angleAxis(0.5f * (static_cast<float>(i) - 1.0f), glm::vec3(0.0f, 0.0f, 1.0f));
+				boneAnimationData.Keyframes.EmplaceBack(std::make_shared<const Keyframe>(static_cast<float>(i), glm::vec3(1.0f, 0.0f, 0.0f), rotation, glm::vec3(1.0f)));
+			}
+
+			clipData.BoneAnimations.EmplaceBack(std::make_shared<const BoneAnimation>(model, std::move(boneAnimationData)));
+			return std::make_shared<AnimationClip>(std::move(clipData));
+		}
+
+		static _CrtMemState sStartMemState;
+	};
+
+	_CrtMemState AnimatorComponentTest::sStartMemState;
+}
@@ -0,0 +1,156 @@
+#include "pch.h"
+
+#include "ToStringSpecialization.h"
+#include "AnimationTestHelper.h"
+#include "BoneAnimation.h"
+#include "Keyframe.h"
+#include "Model.h"
+#include "Transform.h"
+
+using namespace std::string_literals;
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+using namespace UnitTests;
+using namespace Library;
+
+namespace EntitySystemTests
+{
+	TEST_CLASS(BoneAnimationTest)
+	{
+	public:
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+			TypeManager::Create();
+
+			RegisterType<Entity>();
+			RegisterType<Model>();
+
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&sStartMemState);
+#endif
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &sStartMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+
+			TypeManager::Destroy();
+		}
+
+		TEST_METHOD(FindKeyframeIndex)
+		{
+			auto model = CreateBoneChainModel(1);
+
+			// Uneven spacing, so a step can land within the cursor's keyframe, its successor, or further ahead.
+			Vector<float> times;
+			BoneAnimationData boneAnimationData;
+
+			float time = 0.5f;
+			for (std::uint32_t i = 0; i < 20; ++i)
+			{
+				times.EmplaceBack(time);
+				boneAnimationData.Keyframes.EmplaceBack(std::make_shared<const Keyframe>(time, glm::vec3(static_cast<float>(i)), glm::quat(1.0f, 0.0f, 0.0f, 0.0f), glm::vec3(1.0f)));
+				time += 0.1f + 0.4f * (i % 3);
+			}
+
+			const BoneAnimation boneAnimation(*model, std::move(boneAnimationData));
+			Assert::AreEqual(20U, boneAnimation.KeyframeCount());
+
+			const float duration = times.Back() + 1.0f;
+			std::uint32_t cursor = 0;
+
+			auto assertMatches = [&boneAnimation, &times, &cursor](const float sampleTime)
+			{
+				const std::uint32_t expected = LinearKeyframeIndex(times, sampleTime);
+
+				// Carried cursor, then a fresh one, which searches whenever the time is past the first two keyframes.
+				Assert::AreEqual(expected, boneAnimation.FindKeyframeIndex(sampleTime, cursor));
+				Assert::AreEqual(expected, cursor);
+
+				std::uint32_t freshCursor = 0;
+				Assert::AreEqual(expected, boneAnimation.FindKeyframeIndex(sampleTime, freshCursor));
+
+				Transform transform;
+				Assert::AreEqual(expected, boneAnimation.GetTransform(sampleTime, transform));
+			};
+
+			// Forward play, at steps shorter than, close to, and longer than the keyframe spacing.
+			for (const float step : { 0.03f, 0.35f, 1.7f })
+			{
+				cursor = 0;
+
+				for (float sampleTime = 0.0f; sampleTime < duration; sampleTime += step)
+				{
+					assertMatches(sampleTime);
+				}
+			}
+
+			// Seeks, backward and forward, onto exact keyframe times and between them.
+			for (const float sampleTime : { 5.0f, 1.0f, times[7], times[6], 0.0f, times[19], times[12] + 0.01f, times[0], duration, times[3] - 0.01f })
+			{
+				assertMatches(sampleTime);
+			}
+
+			// Looped play, wrapping back to the start twice.
+			cursor = 0;
+			float loopTime = 0.0f;
+
+			for (std::uint32_t frame = 0; frame < 200; ++frame)
+			{
+				loopTime = std::fmod(loopTime + 0.27f, times.Back());
+				assertMatches(loopTime);
+			}
+
+			// A cursor that was never valid for this track.
+			cursor = 1000;
+			assertMatches(times[10] + 0.05f);
+		}
+
+		TEST_METHOD(FindKeyframeIndexSingleKeyframe)
+		{
+			auto model = CreateBoneChainModel(1);
+
+			BoneAnimationData boneAnimationData;
+			boneAnimationData.Keyframes.EmplaceBack(std::make_shared<const Keyframe>(1.0f, glm::vec3(0.0f), glm::quat(1.0f, 0.0f, 0.0f, 0.0f), glm::vec3(1.0f)));
+
+			const BoneAnimation boneAnimation(*model, std::move(boneAnimationData));
+
+			std::uint32_t cursor = 0;
+			for (const float sampleTime : { 0.0f, 1.0f, 2.0f })
+			{
+				Assert::AreEqual(0U, boneAnimation.FindKeyframeIndex(sampleTime, cursor));
+				Assert::AreEqual(0U, cursor);
+			}
+		}
+
+	private:
+		/// <summary>
+		/// Index of the last keyframe at or before a time, found by scanning every keyframe.
+		/// </summary>
+		static std::uint32_t LinearKeyframeIndex(const Vector<float>& times, const float time)
+		{
+			std::uint32_t index = 0;
+
+			while (index + std::size_t(1) < times.Size() && times[index + std::size_t(1)] <= time)
+			{
+				++index;
+			}
+
+			return index;
+		}
+
+		static _CrtMemState sStartMemState;
+	};
+
+	_CrtMemState BoneAnimationTest::sStartMemState;
+}
@@ -0,0 +1,229 @@
+#include "pch.h"
+
+#include "ToStringSpecialization.h"
+#include "CompiledExpression.h"
+#include "Scope.h"
+
+#include <limits>
+
+using namespace std::string_literals;
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+using namespace UnitTests;
+
+
+namespace EntitySystemTests::ActionTests
+{
+	TEST_CLASS(CompiledExpressionTest)
+	{
+	public:
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&sStartMemState);
+#endif
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &sStartMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+		}
+
+		TEST_METHOD(Empty)
+		{
+			Scope scope;
+
+			CompiledExpression expression;
+			Assert::IsTrue(expression.IsEmpty());
+			Assert::AreEqual(Datum::Types::Unknown, expression.ResultType());
+
+			expression = CompiledExpression::Compile(" \t"s, scope);
+			Assert::IsTrue(expression.IsEmpty());
+
+			Datum result;
+			expression.Evaluate(result);
+			Assert::AreEqual(Datum::Types::Unknown, result.Type());
+		}
+
+		TEST_METHOD(Literals)
+		{
+			Scope scope;
+
+			Assert::AreEqual(7, EvaluateInteger("1 + 2 * 3", scope));
+			Assert::AreEqual(9, EvaluateInteger("(1 + 2) * 3", scope));
+			Assert::AreEqual(1, EvaluateInteger("7 - 4 - 2", scope));
+			Assert::AreEqual(1, EvaluateInteger("17 / 5 % 2", scope));
+			Assert::AreEqual(-5, EvaluateInteger("-(2 + 3)", scope));
+			Assert::AreEqual(3, EvaluateInteger("- -3", scope));
+
+			Assert::AreEqual(2.5f, EvaluateFloat("5 / 2.0", scope));
+			Assert::AreEqual(3.5f, EvaluateFloat("1.5 + 2", scope));
+			Assert::AreEqual(0.25f, EvaluateFloat(".5 * .5", scope));
+		}
+
+		TEST_METHOD(Comparisons)
+		{
+			Scope scope;
+
+			Assert::AreEqual(1, EvaluateInteger("1 < 2", scope));
+			Assert::AreEqual(0, EvaluateInteger("2 < 2", scope));
+			Assert::AreEqual(1, EvaluateInteger("2 <= 2", scope));
+			Assert::AreEqual(1, EvaluateInteger("3 > 2.5", scope));
+			Assert::AreEqual(0, EvaluateInteger("2.5 >= 3", scope));
+			Assert::AreEqual(1, EvaluateInteger("2 == 2.0", scope));
+			Assert::AreEqual(1, EvaluateInteger("2 != 3", scope));
+
+			Assert::AreEqual(1, EvaluateInteger("1 < 2 && 3 > 2", scope));
+			Assert::AreEqual(0, EvaluateInteger("1 > 2 && 3 > 2", scope));
+			Assert::AreEqual(1, EvaluateInteger("0 || 0.5", scope));
+			Assert::AreEqual(0, EvaluateInteger("0.0 || 0", scope));
+			Assert::AreEqual(1, EvaluateInteger("1 || 0 && 0", scope));
+			Assert::AreEqual(1, EvaluateInteger("!0", scope));
+			Assert::AreEqual(0, EvaluateInteger("!2.5", scope));
+			Assert::AreEqual(1, EvaluateInteger("!(1 > 2)", scope));
+		}
+
+		TEST_METHOD(Operands)
+		{
+			Scope parent;
+			Datum& a = parent.Append("A") = 4;
+			Datum& b = parent.Append("B") = 0.5f;
+
+			Scope* child = new Scope();
+			parent.Adopt(*child, "Child");
+			Datum& c = child->Append("C") = 3;
+
+			const CompiledExpression expression = CompiledExpression::Compile("A * C + B * A"s, *child);
+			Assert::AreEqual(Datum::Types::Float, expression.ResultType());
+			Assert::AreEqual(std::size_t(3), expression.Operands().Size());
+			Assert::AreEqual(std::size_t(0), expression.Constants().Size());
+			Assert::AreEqual(14.0f, expression.Evaluate().Float);
+
+			a = 2;
+			b = 1.5f;
+			c = 10;
+			Assert::AreEqual(23.0f, expression.Evaluate().Float);
+
+			Datum result;
+			expression.Evaluate(result);
+			Assert::AreEqual(Datum::Types::Float, result.Type());
+			Assert::AreEqual(23.0f, result.Get<float>());
+
+			Datum integerResult = 0;
+			expression.Evaluate(integerResult);
+			Assert::AreEqual(23, integerResult.Get<int>());
+
+			Datum stringResult = "Result"s;
+			Assert::ExpectException<std::runtime_error>([&expression, &stringResult] { expression.Evaluate(stringResult); });
+		}
+
+		TEST_METHOD(CompileErrors)
+		{
+			Scope scope;
+			scope.Append("Integer") = 1;
+			scope.Append("Float") = 1.0f;
+			scope.Append("String") = "String"s;
+			scope.Append("Empty").SetType(Datum::Types::Integer);
+
+			Assert::ExpectException<std::runtime_error>([&scope] { CompiledExpression::Compile("Missing + 1"s, scope); });
+			Assert::ExpectException<std::runtime_error>([&scope] { CompiledExpression::Compile("String + 1"s, scope); });
+			Assert::ExpectException<std::runtime_error>([&scope] { CompiledExpression::Compile("Empty + 1"s, scope); });
+			Assert::ExpectException<std::runtime_error>([&scope] { CompiledExpression::Compile("Float % 2"s, scope); });
+			Assert::ExpectException<std::runtime_error>([&scope] { CompiledExpression::Compile("(Integer + 1"s, scope); });
+			Assert::ExpectException<std::runtime_error>([&scope] { CompiledExpression::Compile("Integer +"s, scope); });
+			Assert::ExpectException<std::runtime_error>([&scope] { CompiledExpression::Compile("Integer = 1"s, scope); });
+			Assert::ExpectException<std::runtime_error>([&scope] { CompiledExpression::Compile("1.2.3"s, scope); });
+			Assert::ExpectException<std::runtime_error>([&scope] { CompiledExpression::Compile("Integer $ 1"s, scope); });
+		}
+
+		TEST_METHOD(DivideByZero)
+		{
+			Scope scope;
+			Datum& divisor = scope.Append("Divisor") = 0;
+
+			const CompiledExpression division = CompiledExpression::Compile("10 / Divisor"s, scope);
+			const CompiledExpression modulo = CompiledExpression::Compile("10 % Divisor"s, scope);
+
+			Assert::ExpectException<std::runtime_error>([&division] { division.Evaluate(); });
+			Assert::ExpectException<std::runtime_error>([&modulo] { modulo.Evaluate(); });
+
+			divisor = 3;
+			Assert::AreEqual(3, division.Evaluate().Integer);
+			Assert::AreEqual(1, modulo.Evaluate().Integer);
+
+			const CompiledExpression floatDivision = CompiledExpression::Compile("1.0 / 0"s, scope);
+			Assert::IsTrue(std::isinf(floatDivision.Evaluate().Float));
+		}
+
+		TEST_METHOD(DivideOverflow)
+		{
+			const int min = std::numeric_limits<int>::min();
+
+			Scope scope;
+			scope.Append("Dividend") = min;
+			Datum& divisor = scope.Append("Divisor") = -1;
+
+			const CompiledExpression division = CompiledExpression::Compile("Dividend / Divisor"s, scope);
+			const CompiledExpression modulo = CompiledExpression::Compile("Dividend % Divisor"s, scope);
+
+			// Wraps rather than trapping.
+			Assert::AreEqual(min, division.Evaluate().Integer);
+			Assert::AreEqual(0, modulo.Evaluate().Integer);
+
+			divisor = 2;
+			Assert::AreEqual(min / 2, division.Evaluate().Integer);
+			Assert::AreEqual(0, modulo.Evaluate().Integer);
+
+			scope["Dividend"] = 7;
+			divisor = -1;
+			Assert::AreEqual(-7, division.Evaluate().Integer);
+			Assert::AreEqual(0, modulo.Evaluate().Integer);
+		}
+
+		TEST_METHOD(CopyAndMove)
+		{
+			Scope scope;
+			Datum& a = scope.Append("A") = 2;
+
+			CompiledExpression expression = CompiledExpression::Compile("A * (A + 1)"s, scope);
+
+			const CompiledExpression copy(expression);
+			Assert::AreEqual(6, copy.Evaluate().Integer);
+
+			const CompiledExpression moved(std::move(expression));
+			a = 3;
+			Assert::AreEqual(12, moved.Evaluate().Integer);
+			Assert::AreEqual(12, copy.Evaluate().Integer);
+		}
+
+	private:
+		static int EvaluateInteger(const std::string& source, Scope& scope)
+		{
+			const CompiledExpression expression = CompiledExpression::Compile(source, scope);
+			Assert::AreEqual(Datum::Types::Integer, expression.ResultType());
+			return expression.Evaluate().Integer;
+		}
+
+		static float EvaluateFloat(const std::string& source, Scope& scope)
+		{
+			const CompiledExpression expression = CompiledExpression::Compile(source, scope);
+			Assert::AreEqual(Datum::Types::Float, expression.ResultType());
+			return expression.Evaluate().Float;
+		}
+
+		static _CrtMemState sStartMemState;
+	};
+
+	_CrtMemState CompiledExpressionTest::sStartMemState;
+}
@@ -0,0 +1,184 @@
+#include "pch.h"
+
+#include "ToStringSpecialization.h"
+#include "JsonParseMaster.h"
+#include "JsonEntityParseHelper.h"
+#include "EntityCooker.h"
+#include "MemoryMappedFile.h"
+#include "Entity.h"
+#include "FooEntity.h"
+#include "World.h"
+
+#include <cstdio>
+#include <cstring>
+
+using namespace std::string_literals;
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+using namespace UnitTests;
+using namespace Library;
+
+namespace EntitySystemTests
+{
+	TEST_CLASS(EntityCookerTest)
+	{
+	public:
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+			TypeManager::Create();
+			RegisterType<Entity>();
+			RegisterType<FooEntity>();
+			RegisterType<World>();
+
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&sStartMemState);
+#endif
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &sStartMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+
+			TypeManager::Destroy();
+		}
+
+		TEST_METHOD(RoundTrip)
+		{
+			const std::string filename = "EntityCookerTest.bin"s;
+
+			World world;
+
+			{
+				JsonEntityParseHelper::SharedData sharedData;
+				sharedData.SetEntity(world);
+
+				JsonEntityParseHelper helper;
+				JsonParseMaster parser;
+
+				parser.AddHelper(helper);
+				parser.SetSharedData(sharedData);
+				parser.ParseFromFile("Content/World.json");
+			}
+
+			world["Float"] = 2.5f;
+			world["Vector"] = { glm::vec4(1, 2, 3, 4), glm::vec4(5, 6, 7, 8) };
+			world["Matrix"] = glm::mat4(3);
+			world["Strings"] = { "Sector1"s, ""s, "Unique"s };
+			world["Empty"].SetType(Entity::Types::Integer);
+
+			FooEntity& foo = static_cast<FooEntity&>(world.CreateChild("FooEntity"s, "Foo"s));
+			foo["Data"] = 30.0f;
+			foo.SetEnabled(false);
+
+			EntityCooker::CookToFile(world, filename);
+
+			World loaded;
+			EntityCooker::LoadFromFile(loaded, filename);
+			std::remove(filename.c_str());
+
+			Assert::IsTrue(world == loaded);
+			Assert::AreEqual(world.ChildCount(), loaded.ChildCount());
+
+			Assert::AreEqual(2.5f, loaded.Find("Float")->Get<float>());
+			Assert::AreEqual(glm::vec4(5, 6, 7, 8), loaded.Find("Vector")->Get<glm::vec4>(1));
+			Assert::AreEqual(glm::mat4(3), loaded.Find("Matrix")->Get<glm::mat4>());
+			Assert::AreEqual(3_z, loaded.Find("Strings")->Size());
+			Assert::AreEqual("Unique"s, loaded.Find("Strings")->Get<std::string>(2));
+			Assert::AreEqual(Entity::Types::Integer, loaded.Find("Empty")->Type());
+			Assert::AreEqual(0_z, loaded.Find("Empty")->Size());
+
+			Entity* sector2 = loaded.FindChild("Sector2");
+			Assert::IsNotNull(sector2);
+			Assert::IsTrue(sector2->GetParent() == &loaded);
+			Assert::AreEqual(3_z, sector2->ChildCount());
+			Assert::AreEqual(20, sector2->Find("Entity2")->Get<Scope*>(0)->Find("AuxiliaryInt")->Get<int>());
+			Assert::AreEqual(30, sector2->Find("Entity2")->Get<Scope*>(1)->Find("AuxiliaryInt")->Get<int>());
+
+			FooEntity* loadedFoo = loaded.FindChild<FooEntity>("Foo");
+			Assert::IsNotNull(loadedFoo);
+			Assert::IsFalse(loadedFoo->Enabled());
+			Assert::AreEqual(30.0f, loadedFoo->Find("Data")->Get<float>());
+			Assert::IsTrue(loadedFoo->Find("Data")->Get<float>() == loadedFoo->Data());
+		}
+
+		TEST_METHOD(LoadInvalid)
+		{
+			Entity root;
+
+			Assert::ExpectException<std::runtime_error>([&root] { EntityCooker::Load(root, gsl::span<const std::byte>()); });
+			Assert::ExpectException<std::runtime_error>([&root] { EntityCooker::LoadFromFile(root, "Missing.bin"s); });
+
+			Entity source;
+			source.CreateChild("Entity"s, "Child"s)["Value"] = 10;
+
+			std::ostringstream output(std::ios::binary);
+			EntityCooker::Cook(source, output);
+
+			// Copied into 8 byte aligned storage, as a mapped file would be.
+			const std::string cooked = output.str();
+			Vector<std::uint64_t> storage(cooked.size() / sizeof(std::uint64_t) + 1);
+			storage.Resize(storage.Capacity());
+			std::memcpy(&storage[0], cooked.data(), cooked.size());
+
+			gsl::span<std::byte> bytes(reinterpret_cast<std::byte*>(&storage[0]), cooked.size());
+
+			EntityCooker::Load(root, bytes);
+			Assert::AreEqual(10, root.FindChild("Child")->Find("Value")->Get<int>());
+
+			// Truncated
+			Entity truncated;
+			Assert::ExpectException<std::runtime_error>([&truncated, &bytes] { EntityCooker::Load(truncated, bytes.first(bytes.size() - 1)); });
+
+			// Integer array too large for the data section, rejected before its Datum is resized.
+			// Attribute records are 24 bytes, with their type at 4 and their size at 8. The header holds their count at 12 and offset at 32.
+			std::uint32_t attributeCount = 0;
+			std::uint64_t attributesOffset = 0;
+			std::memcpy(&attributeCount, &bytes[12], sizeof(attributeCount));
+			std::memcpy(&attributesOffset, &bytes[32], sizeof(attributesOffset));
+
+			std::byte* sizeBytes = nullptr;
+
+			for (std::uint32_t i = 0; i < attributeCount && sizeBytes == nullptr; ++i)
+			{
+				std::byte* record = &bytes[attributesOffset + i * 24];
+
+				std::int32_t type = 0;
+				std::uint32_t size = 0;
+				std::memcpy(&type, record + 4, sizeof(type));
+				std::memcpy(&size, record + 8, sizeof(size));
+
+				if (type == static_cast<std::int32_t>(Datum::Types::Integer) && size == 1) sizeBytes = record + 8;
+			}
+
+			Assert::IsNotNull(sizeBytes);
+
+			const std::uint32_t oversized = 0xFFFFFFFF;
+			std::memcpy(sizeBytes, &oversized, sizeof(oversized));
+
+			Entity tooLarge;
+			Assert::ExpectException<std::runtime_error>([&tooLarge, &bytes] { EntityCooker::Load(tooLarge, bytes); });
+
+			// Unknown version
+			bytes[4] = std::byte(EntityCooker::Version + 1);
+			Assert::ExpectException<std::runtime_error>([&truncated, &bytes] { EntityCooker::Load(truncated, bytes); });
+		}
+
+	private:
+		static _CrtMemState sStartMemState;
+
+		EntityFactory entityFactory;
+		FooEntityFactory fooEntityFactory;
+	};
+
+	_CrtMemState EntityCookerTest::sStartMemState;
+}
@@ -0,0 +1,185 @@
+#include "pch.h"
+
+#include "ToStringSpecialization.h"
+#include "Entity.h"
+#include "EntityHandle.h"
+#include "FooEntity.h"
+#include "StopWatch.h"
+
+using namespace std::string_literals;
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+using namespace UnitTests;
+
+
+namespace EntitySystemTests
+{
+	TEST_CLASS(EntityHandleTest)
+	{
+	public:
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+			TypeManager::Create();
+			RegisterType<Entity>();
+			RegisterType<FooEntity>();
+
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&sStartMemState);
+#endif
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &sStartMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+
+			TypeManager::Destroy();
+		}
+
+		TEST_METHOD(NullHandle)
+		{
+			const EntityHandle handle;
+			Assert::IsTrue(handle.IsNull());
+			Assert::IsFalse(handle.IsValid());
+			Assert::IsNull(handle.Resolve());
+			Assert::AreEqual(0ULL, static_cast<unsigned long long>(handle.Value()));
+
+			Assert::IsNull(EntityHandle::FromValue(0xFFFFFFFFFFFFFFFF).Resolve());
+		}
+
+		TEST_METHOD(Resolve)
+		{
+			EntityHandle handle;
+
+			{
+				Entity entity("Entity");
+				handle = entity.Handle();
+
+				Assert::IsFalse(handle.IsNull());
+				Assert::IsTrue(handle.IsValid());
+				Assert::AreEqual(&entity, handle.Resolve());
+
+				const EntityHandle copy = EntityHandle::FromValue(handle.Value());
+				Assert::IsTrue(copy == handle);
+				Assert::AreEqual(handle.Index(), copy.Index());
+				Assert::AreEqual(handle.Generation(), copy.Generation());
+
+				Entity other("Other");
+				Assert::IsTrue(other.Handle() != handle);
+				Assert::AreEqual(&other, other.Handle().Resolve());
+			}
+
+			Assert::IsFalse(handle.IsValid());
+			Assert::IsNull(handle.Resolve());
+
+			Entity reused("Reused");
+			Assert::IsNull(handle.Resolve());
+			Assert::AreEqual(&reused, reused.Handle().Resolve());
+		}
+
+		TEST_METHOD(CopyAndMove)
+		{
+			Entity entity("Entity");
+			const EntityHandle handle = entity.Handle();
+
+			Entity copyConstructed(entity);
+			Assert::IsTrue(copyConstructed.Handle() != handle);
+			Assert::AreEqual(&copyConstructed, copyConstructed.Handle().Resolve());
+
+			Entity copyAssigned;
+			const EntityHandle copyAssignedHandle = copyAssigned.Handle();
+			copyAssigned = entity;
+			Assert::IsTrue(copyAssigned.Handle() == copyAssignedHandle);
+			Assert::AreEqual(&entity, handle.Resolve());
+
+			Entity moveConstructed(std::move(entity));
+			Assert::IsTrue(moveConstructed.Handle() == handle);
+			Assert::AreEqual(&moveConstructed, handle.Resolve());
+
+			Entity moveAssigned;
+			const EntityHandle overwrittenHandle = moveAssigned.Handle();
+			moveAssigned = std::move(moveConstructed);
+			Assert::IsTrue(moveAssigned.Handle() == handle);
+			Assert::AreEqual(&moveAssigned, handle.Resolve());
+			Assert::IsNull(overwrittenHandle.Resolve());
+		}
+
+		TEST_METHOD(DestroyChild)
+		{
+			Entity root;
+			Entity& child = root.CreateChild("FooEntity", "Child");
+			const EntityHandle handle = child.Handle();
+
+			Assert::IsTrue(handle.Resolve()->Is(FooEntity::TypeIdClass()));
+
+			root.DestroyChild(child);
+			Assert::IsNull(handle.Resolve());
+		}
+
+		TEST_METHOD(ResolveThroughput)
+		{
+			const std::size_t childCount = 1000;
+			const std::size_t handleLookupCount = 1000000;
+			const std::size_t nameLookupCount = 10000;
+
+			Entity root;
+			Vector<EntityHandle> handles(Vector<EntityHandle>::EqualityFunctor{});
+			Vector<std::string> names;
+
+			for (std::size_t i = 0; i < childCount; ++i)
+			{
+				names.PushBack("Child" + std::to_string(i));
+				handles.PushBack(root.CreateChild("Entity", names.Back()).Handle());
+			}
+
+			std::size_t resolved = 0;
+			StopWatch stopWatch;
+
+			stopWatch.Start();
+			for (std::size_t i = 0; i < handleLookupCount; ++i)
+			{
+				resolved += handles[i % childCount].Resolve() != nullptr;
+			}
+			stopWatch.Stop();
+
+			const double handleTime = std::chrono::duration<double, std::nano>(stopWatch.Elapsed()).count() / handleLookupCount;
+			Assert::AreEqual(handleLookupCount, resolved);
+
+			resolved = 0;
+			stopWatch.Reset();
+
+			stopWatch.Start();
+			for (std::size_t i = 0; i < nameLookupCount; ++i)
+			{
+				resolved += root.FindChild(names[i % childCount]) != nullptr;
+			}
+			stopWatch.Stop();
+
+			const double nameTime = std::chrono::duration<double, std::nano>(stopWatch.Elapsed()).count() / nameLookupCount;
+			Assert::AreEqual(nameLookupCount, resolved);
+
+			std::wostringstream message;
+			message << L"Lookup over " << childCount << L" children. EntityHandle::Resolve: " << handleTime 
+				<< L"ns, FindChild by name: " << nameTime << L"ns.\n";
+			Logger::WriteMessage(message.str().c_str());
+		}
+
+	private:
+		static _CrtMemState sStartMemState;
+
+		EntityFactory entityFactory;
+		FooEntityFactory fooEntityFactory;
+	};
+
+	_CrtMemState EntityHandleTest::sStartMemState;
+}
@@ -148,6 +148,164 @@ namespace EntitySystemTests
 			Assert::IsTrue(fooEntity.IsUpdated());
 		}
 
+		TEST_METHOD(SleepAndWake)
+		{
+			Entity root;
+			WorldState worldState;
+
+			FooEntity& awake = *root.CreateChild("FooEntity", "Awake").As<FooEntity>();
+			FooEntity& sleeping = *root.CreateChild("FooEntity", "Sleeping").As<FooEntity>();
+			FooEntity& disabled = *root.CreateChild("FooEntity", "Disabled").As<FooEntity>();
+			Assert::AreEqual(3_z, root.ActiveChildCount());
+
+			sleeping.Sleep();
+			disabled.SetEnabled(false);
+			Assert::IsTrue(sleeping.IsSleeping());
+			Assert::IsFalse(sleeping.IsActive());
+			Assert::IsFalse(disabled.IsActive());
+
+			root.Update(worldState);
+			Assert::IsTrue(awake.IsUpdated());
+			Assert::IsFalse(sleeping.IsUpdated());
+			Assert::IsFalse(disabled.IsUpdated());
+			Assert::AreEqual(1_z, root.ActiveChildCount());
+			Assert::AreEqual(3_z, root.ChildCount());
+
+			sleeping.Wake();
+			disabled.SetEnabled(true);
+			Assert::AreEqual(3_z, root.ActiveChildCount());
+
+			root.Update(worldState);
+			Assert::IsTrue(sleeping.IsUpdated());
+			Assert::IsTrue(disabled.IsUpdated());
+
+			sleeping.Sleep();
+			root.DestroyChild(sleeping);
+			Assert::AreEqual(2_z, root.ChildCount());
+			Assert::AreEqual(2_z, root.ActiveChildCount());
+
+			Assert::ExpectException<std::runtime_error>([&awake, &worldState] { awake.SleepFor(worldState, std::chrono::milliseconds(1)); });
+		}
+
+		TEST_METHOD(ChildHandles)
+		{
+			Entity root;
+
+			Entity& child1 = root.CreateChild("Entity", "Child1");
+			Entity& child2 = root.CreateChild("Entity", "Child2");
+
+			const Entity::ChildHandle handle1 = root.GetChildHandle(child1);
+			const Entity::ChildHandle handle2 = root.GetChildHandle(child2);
+			Assert::IsTrue(handle1 != handle2);
+			Assert::AreEqual(&child1, root.FindChild(handle1));
+			Assert::AreEqual(&child2, root.FindChild(handle2));
+			Assert::IsNull(root.FindChild<FooEntity>(handle1));
+			Assert::IsNull(root.FindChild(Entity::ChildHandle()));
+
+			root.DestroyChild(handle1);
+			Assert::AreEqual(1_z, root.ChildCount());
+			Assert::IsNull(root.FindChild(handle1));
+			Assert::IsNull(root.FindChild("Child1"));
+			Assert::AreEqual(&child2, root.FindChild(handle2));
+
+			root.DestroyChild(handle1);
+			Assert::AreEqual(1_z, root.ChildCount());
+
+			Entity& child3 = root.CreateChild("Entity", "Child3");
+			const Entity::ChildHandle handle3 = root.GetChildHandle(child3);
+			Assert::AreEqual(handle1.Slot, handle3.Slot);
+			Assert::IsTrue(handle1 != handle3);
+			Assert::IsNull(root.FindChild(handle1));
+			Assert::AreEqual(&child3, root.FindChild(handle3));
+
+			Entity orphan;
+			Assert::ExpectException<std::runtime_error>([&root, &orphan] { root.GetChildHandle(orphan); });
+		}
+
+		TEST_METHOD(SpawnDespawnCycles)
+		{
+			Entity root;
+			Vector<Entity::ChildHandle> handles(Vector<Entity::ChildHandle>::EqualityFunctor{});
+
+			for (int cycle = 0; cycle < 3; ++cycle)
+			{
+				for (int i = 0; i < 500; ++i)
+				{
+					Entity& child = root.CreateChild("Entity", "Child" + std::to_string(i));
+					handles.PushBack(root.GetChildHandle(child));
+				}
+
+				Assert::AreEqual(500_z, root.ChildCount());
+
+				for (std::size_t i = 0; i < handles.Size(); i += 2)
+				{
+					root.DestroyChild(handles[i]);
+				}
+
+				Assert::AreEqual(250_z, root.ChildCount());
+
+				for (std::size_t i = 0; i < handles.Size(); ++i)
+				{
+					Entity* child = root.FindChild(handles[i]);
+					Assert::AreEqual(i % 2 == 1, child != nullptr);
+					if (child) Assert::AreEqual("Child"s + std::to_string(i), child->Name());
+				}
+
+				for (std::size_t i = 1; i < handles.Size(); i += 2)
+				{
+					root.DestroyChild(handles[i]);
+				}
+
+				Assert::AreEqual(0_z, root.ChildCount());
+				handles.Clear();
+			}
+		}
+
+		TEST_METHOD(ChildOrderAfterRemoval)
+		{
+			Entity root;
+			const Entity& constRoot = root;
+
+			for (int i = 0; i < 10; ++i)
+			{
+				root.CreateChild("Entity", "Child" + std::to_string(i));
+			}
+
+			root.DestroyChild(*root.FindChild("Child2"));
+			root.DestroyChild(*root.FindChild("Child5"));
+			Assert::AreEqual(8_z, root.ChildCount());
+
+			const int expected[] = { 0, 1, 3, 4, 6, 7, 8, 9 };
+
+			for (std::size_t i = 0; i < std::size(expected); ++i)
+			{
+				Assert::AreEqual("Child"s + std::to_string(expected[i]), constRoot.ChildAt(i).Name());
+				Assert::AreEqual("Child"s + std::to_string(expected[i]), root.ChildAt(i).Name());
+			}
+
+			Assert::ExpectException<std::out_of_range>([&constRoot] { constRoot.ChildAt(8); });
+			Assert::ExpectException<std::out_of_range>([&root] { root.ChildAt(8); });
+
+			root.DestroyChild(*root.FindChild("Child9"));
+			Assert::AreEqual("Child8"s, root.ChildAt(root.ChildCount() - 1).Name());
+		}
+
+		TEST_METHOD(UniquelyNamedChildrenDoNotGrowTable)
+		{
+			Entity root;
+			const std::size_t prescribedSize = root.Size();
+
+			for (int i = 0; i < 1000; ++i)
+			{
+				Entity& child = root.CreateChild("Entity", "Child" + std::to_string(i));
+				root.DestroyChild(child);
+			}
+
+			Assert::AreEqual(0_z, root.ChildCount());
+			Assert::IsNull(root.Find("Child0"));
+			Assert::IsTrue(root.Size() <= prescribedSize * 2 + 1);
+		}
+
 		TEST_METHOD(Clone)
 		{
  			Entity entity;
@@ -0,0 +1,304 @@
+#include "pch.h"
+
+#include "ToStringSpecialization.h"
+#include "ActionExpression.h"
+#include "ExpressionBatch.h"
+#include "World.h"
+#include "GameTime.h"
+#include "EventQueue.h"
+#include "StopWatch.h"
+
+using namespace std::string_literals;
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+using namespace UnitTests;
+
+
+namespace EntitySystemTests::ActionTests
+{
+	TEST_CLASS(ExpressionBatchTest)
+	{
+	public:
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+			TypeManager::Create();
+
+			RegisterType<Entity>();
+			RegisterType<ActionExpression>();
+			RegisterType<World>();
+
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&sStartMemState);
+#endif
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &sStartMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+
+			TypeManager::Destroy();
+		}
+
+		TEST_METHOD(GroupsByShape)
+		{
+			Entity root;
+			ExpressionBatch batch;
+			Assert::IsTrue(batch.IsEmpty());
+
+			ActionExpression& first = CreateExpression(root, "First", "Health + Regen * 2", 10, 1.5f);
+			ActionExpression& second = CreateExpression(root, "Second", "Health + Regen * 2", 20, 0.5f);
+			ActionExpression& third = CreateExpression(root, "Third", "Health - Regen", 5, 2.0f);
+
+			batch.Add(first);
+			batch.Add(second);
+			batch.Add(third);
+			batch.Add(first);
+
+			Assert::AreEqual(std::size_t(3), batch.Size());
+			Assert::AreEqual(std::size_t(2), batch.ShapeCount());
+
+			batch.Evaluate();
+			Assert::IsTrue(batch.IsEmpty());
+			Assert::AreEqual(std::size_t(2), batch.ShapeCount());
+			Assert::AreEqual(13.0f, Result(first).Get<float>());
+			Assert::AreEqual(21.0f, Result(second).Get<float>());
+			Assert::AreEqual(3.0f, Result(third).Get<float>());
+
+			*first.Find("Health") = 0;
+			*second.Find("Health") = 0;
+			batch.Add(first);
+			batch.Evaluate();
+			Assert::AreEqual(3.0f, Result(first).Get<float>());
+			Assert::AreEqual(21.0f, Result(second).Get<float>());
+		}
+
+		TEST_METHOD(MatchesPerInstance)
+		{
+			const std::string source = "(A * 3 - B / 2) % 7 + (C < 0.5 || !(A == B)) - -C / (B + 1.0) + (A > B && C != 0)";
+			const std::size_t count = 64;
+
+			Entity root;
+			ExpressionBatch batch;
+			Vector<ActionExpression*> expressions;
+
+			for (std::size_t i = 0; i < count; ++i)
+			{
+				ActionExpression& expression = static_cast<ActionExpression&>(root.CreateChild("ActionExpression"s, "Expression" + std::to_string(i)));
+				expression.Append("A") = static_cast<int>(i * 7 % 11) - 3;
+				expression.Append("B") = static_cast<int>(i % 5);
+				expression.Append("C") = static_cast<float>(i) * 0.25f - 4.0f;
+				expression.SetExpression(source);
+
+				batch.Add(expression);
+				expressions.PushBack(&expression);
+			}
+
+			Assert::AreEqual(std::size_t(1), batch.ShapeCount());
+			batch.Evaluate();
+
+			for (auto* expression : expressions)
+			{
+				Assert::AreEqual(expression->Program().Evaluate().Float, Result(*expression).Get<float>());
+			}
+		}
+
+		TEST_METHOD(StaleInstances)
+		{
+			Entity root;
+			ExpressionBatch batch;
+
+			ActionExpression& destroyed = CreateExpression(root, "Destroyed", "Health + Regen", 1, 1.0f);
+			ActionExpression& recompiled = CreateExpression(root, "Recompiled", "Health + Regen", 2, 1.0f);
+			ActionExpression& unbatched = CreateExpression(root, "Unbatched", "Health + Regen", 3, 1.0f);
+			ActionExpression& kept = CreateExpression(root, "Kept", "Health + Regen", 4, 1.0f);
+
+			batch.Add(destroyed);
+			batch.Add(recompiled);
+			batch.Add(unbatched);
+			batch.Add(kept);
+			Assert::AreEqual(std::size_t(4), batch.Size());
+
+			root.DestroyChild(destroyed);
+			recompiled.SetExpression("Health * Regen");
+			unbatched.SetBatched(false);
+
+			batch.Evaluate();
+			Assert::IsTrue(batch.IsEmpty());
+			Assert::AreEqual(5.0f, Result(kept).Get<float>());
+			Assert::AreEqual(Datum::Types::Unknown, Result(recompiled).Type());
+			Assert::AreEqual(Datum::Types::Unknown, Result(unbatched).Type());
+
+			batch.Add(recompiled);
+			batch.Add(unbatched);
+			batch.Add(kept);
+			Assert::AreEqual(std::size_t(3), batch.Size());
+			Assert::AreEqual(std::size_t(2), batch.ShapeCount());
+
+			recompiled.SetExpression("Health - Regen");
+			batch.Add(recompiled);
+			Assert::AreEqual(std::size_t(4), batch.Size());
+			Assert::AreEqual(std::size_t(3), batch.ShapeCount());
+
+			batch.Evaluate();
+			Assert::IsTrue(batch.IsEmpty());
+			Assert::AreEqual(1.0f, Result(recompiled).Get<float>());
+			Assert::AreEqual(4.0f, Result(unbatched).Get<float>());
+
+			batch.Add(kept);
+			batch.Clear();
+			Assert::IsTrue(batch.IsEmpty());
+			Assert::AreEqual(std::size_t(0), batch.ShapeCount());
+
+			batch.Add(kept);
+			Assert::AreEqual(std::size_t(1), batch.Size());
+		}
+
+		TEST_METHOD(DivideByZero)
+		{
+			Entity root;
+			ExpressionBatch batch;
+
+			ActionExpression& expression = CreateExpression(root, "Expression", "10 / Divisor", 0, 0.0f);
+			expression.Append("Divisor") = 0;
+
+			batch.Add(expression);
+			Assert::ExpectException<std::runtime_error>([&batch] { batch.Evaluate(); });
+			Assert::IsTrue(batch.IsEmpty());
+
+			*expression.Find("Divisor") = 4;
+			batch.Add(expression);
+			batch.Evaluate();
+			Assert::AreEqual(2, Result(expression).Get<int>());
+		}
+
+		TEST_METHOD(WorldUpdate)
+		{
+			GameTime gameTime;
+			EventQueue queue;
+
+			World world("World", &gameTime, &queue);
+			Entity& sector = world.CreateChild("Entity", "Sector");
+
+			ActionExpression& batched = CreateExpression(sector, "Batched", "Health + Regen", 10, 2.0f);
+			ActionExpression& direct = CreateExpression(sector, "Direct", "Health + Regen", 20, 2.0f);
+			direct.SetBatched(false);
+
+			world.Initialize();
+			Assert::IsTrue(batched.IsCompiled());
+			Assert::IsTrue(world.GetExpressionBatch().IsEmpty());
+
+			world.Update();
+			Assert::AreEqual(12.0f, Result(batched).Get<float>());
+			Assert::AreEqual(22.0f, Result(direct).Get<float>());
+			Assert::IsTrue(world.GetExpressionBatch().IsEmpty());
+
+			batched.SetExpression("Health - Regen");
+			world.Update();
+			Assert::AreEqual(8.0f, Result(batched).Get<float>());
+			Assert::AreEqual(std::size_t(2), world.GetExpressionBatch().ShapeCount());
+
+			*batched.Find("Health") = 20;
+			sector.DestroyChild(batched);
+			world.Update();
+			Assert::IsTrue(world.GetExpressionBatch().IsEmpty());
+		}
+
+		TEST_METHOD(EvaluationThroughput)
+		{
+			const std::size_t groupCount = 100;
+			const std::size_t groupSize = 1000;
+			const std::size_t expressionCount = groupCount * groupSize;
+			const std::size_t frameCount = 10;
+
+			Entity root;
+			root.Append("Dt") = 0.016f;
+
+			ExpressionBatch batch;
+
+			for (std::size_t group = 0; group < groupCount; ++group)
+			{
+				Entity& parent = root.CreateChild("Entity"s, "Group" + std::to_string(group));
+
+				for (std::size_t i = 0; i < groupSize; ++i)
+				{
+					ActionExpression& expression = CreateExpression(parent, "Expression" + std::to_string(i), "Health + Regen * Dt",
+						static_cast<int>(i), static_cast<float>(group));
+					batch.Add(expression);
+				}
+			}
+
+			// Outside of a World, batched expressions are still evaluated by their own Update.
+			WorldState worldState;
+			StopWatch stopWatch;
+
+			stopWatch.Start();
+			for (std::size_t frame = 0; frame < frameCount; ++frame)
+			{
+				root.Update(worldState);
+			}
+			stopWatch.Stop();
+
+			const double instanceTime = std::chrono::duration<double, std::micro>(stopWatch.Elapsed()).count() / frameCount;
+			stopWatch.Reset();
+
+			Assert::AreEqual(expressionCount, batch.Size());
+			Assert::AreEqual(std::size_t(1), batch.ShapeCount());
+			batch.Evaluate();
+
+			stopWatch.Start();
+			for (std::size_t frame = 0; frame < frameCount; ++frame)
+			{
+				root.ForEachChild([&batch](Entity& parent)
+				{
+					parent.ForEachChild([&batch](Entity& child) { batch.Add(static_cast<ActionExpression&>(child)); });
+				});
+
+				batch.Evaluate();
+			}
+			stopWatch.Stop();
+
+			const double batchTime = std::chrono::duration<double, std::micro>(stopWatch.Elapsed()).count() / frameCount;
+			Assert::IsTrue(batch.IsEmpty());
+
+			std::wostringstream message;
+			message << expressionCount << L" expressions per frame. Per instance: " << instanceTime
+				<< L"us, batched: " << batchTime << L"us.\n";
+			Logger::WriteMessage(message.str().c_str());
+		}
+
+	private:
+		static ActionExpression& CreateExpression(Entity& parent, const std::string& name, const std::string& source, const int health, const float regen)
+		{
+			ActionExpression& expression = static_cast<ActionExpression&>(parent.CreateChild("ActionExpression"s, name));
+			expression.Append("Health") = health;
+			expression.Append("Regen") = regen;
+			expression.SetExpression(source);
+			expression.SetBatched(true);
+
+			return expression;
+		}
+
+		static Datum& Result(ActionExpression& expression)
+		{
+			return *expression.Find(ActionExpression::ResultKey)->Get<Datum*>();
+		}
+
+		static _CrtMemState sStartMemState;
+
+		ActionExpressionFactory actionExpressionFactory;
+		EntityFactory entityFactory;
+	};
+
+	_CrtMemState ExpressionBatchTest::sStartMemState;
+}
@@ -343,13 +343,37 @@ namespace UnitTests
 			auto tmp = hashMap.Insert({ TKey(i), TData(i) });
 		}
 
+		Vector<const TData*> addresses;
+
+		for (int i = 0; i < 10 * 21; i += 10)
+		{
+			addresses.PushBack(&hashMap.Find(TKey(i))->second);
+		}
+
 		Assert::IsFalse(hashMap.Remove(HashMap<TKey,TData>::Iterator()));
 		Assert::IsTrue(hashMap.Remove(TKey(10)));
 		Assert::IsFalse(hashMap.ContainsKey(TKey(10)));
+		Assert::IsFalse(hashMap.Remove(TKey(10)));
+		Assert::AreEqual(20_z, hashMap.Size());
+
+		for (int i = 20; i < 10 * 21; i += 10)
+		{
+			Assert::IsTrue(addresses[i / 10] == &hashMap.Find(TKey(i))->second);
+		}
+
+		hashMap.Rehash(13);
+		Assert::AreEqual(13_z, hashMap.BucketCount());
+		Assert::AreEqual(20_z, hashMap.Size());
+
+		for (int i = 20; i < 10 * 21; i += 10)
+		{
+			Assert::IsTrue(addresses[i / 10] == &hashMap.Find(TKey(i))->second);
+		}
 
 		auto tmp = hashMap.Insert({ TKey(10), TData(10) }).first;
 		Assert::IsTrue(hashMap.Remove(tmp));
 		Assert::IsFalse(hashMap.ContainsKey(TKey(10)));
+		Assert::AreEqual(20_z, hashMap.Size());
 	}
 
 	template<typename TKey, typename TData>
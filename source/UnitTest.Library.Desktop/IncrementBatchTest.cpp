@@ -0,0 +1,311 @@
+#include "pch.h"
+
+#include "ToStringSpecialization.h"
+#include "ActionIncrement.h"
+#include "IncrementBatch.h"
+#include "World.h"
+#include "GameTime.h"
+#include "EventQueue.h"
+#include "StopWatch.h"
+
+using namespace std::string_literals;
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+using namespace UnitTests;
+
+
+namespace EntitySystemTests::ActionTests
+{
+	TEST_CLASS(IncrementBatchTest)
+	{
+	public:
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+			TypeManager::Create();
+
+			RegisterType<Entity>();
+			RegisterType<ActionIncrement>();
+			RegisterType<World>();
+
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&sStartMemState);
+#endif
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &sStartMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+
+			TypeManager::Destroy();
+		}
+
+		TEST_METHOD(GroupsByTarget)
+		{
+			Entity root;
+			root.Append("Health") = 10;
+			root.Append("Score") = 0;
+
+			IncrementBatch batch;
+			Assert::IsTrue(batch.IsEmpty());
+
+			ActionIncrement& first = CreateIncrement(root, "First", "Health", 2);
+			ActionIncrement& second = CreateIncrement(root, "Second", "Health", -5);
+			ActionIncrement& third = CreateIncrement(root, "Third", "Score", 1);
+			ActionIncrement& missing = CreateIncrement(root, "Missing", "Missing", 1);
+
+			batch.Add(first);
+			batch.Add(second);
+			batch.Add(third);
+			batch.Add(missing);
+
+			// Queuing an instance again counts its step again, as when updated several times in a frame.
+			batch.Add(first);
+
+			Assert::AreEqual(3_z, batch.Size());
+			Assert::AreEqual(2_z, batch.TargetCount());
+			Assert::IsTrue(missing.IsBatched());
+
+			batch.Apply();
+			Assert::IsTrue(batch.IsEmpty());
+			Assert::AreEqual(9, root.Find("Health")->Get<int>());
+			Assert::AreEqual(1, root.Find("Score")->Get<int>());
+
+			*second.Find(ActionIncrement::IncrementStepKey) = 3;
+			batch.Add(first);
+			batch.Add(second);
+			batch.Apply();
+			Assert::AreEqual(14, root.Find("Health")->Get<int>());
+			Assert::AreEqual(1, root.Find("Score")->Get<int>());
+			Assert::AreEqual(2_z, batch.TargetCount());
+
+			batch.Add(first);
+			batch.Apply();
+			Assert::AreEqual(16, root.Find("Health")->Get<int>());
+			Assert::AreEqual(1_z, batch.TargetCount());
+		}
+
+		TEST_METHOD(StaleInstances)
+		{
+			Entity root;
+			root.Append("Health") = 0;
+			root.Append("Score") = 0;
+
+			IncrementBatch batch;
+
+			ActionIncrement& destroyed = CreateIncrement(root, "Destroyed", "Health", 1);
+			ActionIncrement& rebound = CreateIncrement(root, "Rebound", "Health", 2);
+			ActionIncrement& unbatched = CreateIncrement(root, "Unbatched", "Health", 4);
+			ActionIncrement& kept = CreateIncrement(root, "Kept", "Health", 8);
+
+			batch.Add(destroyed);
+			batch.Add(rebound);
+			batch.Add(unbatched);
+			batch.Add(kept);
+			Assert::AreEqual(4_z, batch.Size());
+
+			root.DestroyChild(destroyed);
+			rebound.SetOperand("Score"s);
+			unbatched.SetBatched(false);
+
+			batch.Apply();
+			Assert::IsTrue(batch.IsEmpty());
+			Assert::AreEqual(8, root.Find("Health")->Get<int>());
+			Assert::AreEqual(0, root.Find("Score")->Get<int>());
+
+			batch.Add(rebound);
+			batch.Add(kept);
+			Assert::AreEqual(2_z, batch.TargetCount());
+
+			rebound.SetOperand("Health"s);
+			batch.Add(rebound);
+			Assert::AreEqual(3_z, batch.Size());
+
+			batch.Apply();
+			Assert::IsTrue(batch.IsEmpty());
+			Assert::AreEqual(18, root.Find("Health")->Get<int>());
+			Assert::AreEqual(0, root.Find("Score")->Get<int>());
+
+			batch.Add(kept);
+			batch.Clear();
+			Assert::IsTrue(batch.IsEmpty());
+			Assert::AreEqual(0_z, batch.TargetCount());
+
+			batch.Add(kept);
+			Assert::AreEqual(1_z, batch.Size());
+		}
+
+		TEST_METHOD(WorldUpdate)
+		{
+			GameTime gameTime;
+			EventQueue queue;
+
+			World world("World", &gameTime, &queue);
+			Entity& sector = world.CreateChild("Entity", "Sector");
+			sector.Append("Health") = 0;
+
+			ActionIncrement& batched = CreateIncrement(sector, "Batched", "Health", 1);
+			ActionIncrement& direct = CreateIncrement(sector, "Direct", "Health", 10);
+			direct.SetBatched(false);
+
+			world.Initialize();
+			Assert::IsTrue(batched.IsBound());
+			Assert::IsTrue(world.GetIncrementBatch().IsEmpty());
+
+			world.Update();
+			Assert::AreEqual(11, sector.Find("Health")->Get<int>());
+			Assert::IsTrue(world.GetIncrementBatch().IsEmpty());
+
+			world.Update();
+			Assert::AreEqual(22, sector.Find("Health")->Get<int>());
+
+			sector.DestroyChild(batched);
+			world.Update();
+			Assert::IsTrue(world.GetIncrementBatch().IsEmpty());
+			Assert::AreEqual(32, sector.Find("Health")->Get<int>());
+		}
+
+		TEST_METHOD(RepeatedUpdates)
+		{
+			Entity root;
+			root.Append("Health") = 0;
+
+			IncrementBatch batch;
+			ActionIncrement& increment = CreateIncrement(root, "Increment", "Health", 2);
+
+			for (std::size_t i = 0; i < 3; ++i)
+			{
+				batch.Add(increment);
+			}
+
+			Assert::AreEqual(1_z, batch.Size());
+
+			// The Datum only changes once the batch is applied.
+			Assert::AreEqual(0, root.Find("Health")->Get<int>());
+
+			batch.Apply();
+			Assert::AreEqual(6, root.Find("Health")->Get<int>());
+
+			// Queuing again after a rebind discards the count of the previous binding.
+			batch.Add(increment);
+			root.Append("Other") = 0;
+			batch.Add(increment);
+			batch.Add(increment);
+			Assert::AreEqual(2_z, batch.Size());
+
+			batch.Apply();
+			Assert::AreEqual(10, root.Find("Health")->Get<int>());
+		}
+
+		TEST_METHOD(UpdateThroughput)
+		{
+			const std::size_t groupCount = 100;
+			const std::size_t groupSize = 1000;
+			const std::size_t incrementCount = groupCount * groupSize;
+			const std::size_t frameCount = 10;
+
+			Entity root;
+			root.Append("Score") = 0;
+
+			IncrementBatch batch;
+			Vector<ActionIncrement*> increments;
+			increments.Reserve(incrementCount);
+
+			for (std::size_t group = 0; group < groupCount; ++group)
+			{
+				Entity& parent = root.CreateChild("Entity"s, "Group" + std::to_string(group));
+				parent.Append("Health") = 0;
+
+				for (std::size_t i = 0; i < groupSize; ++i)
+				{
+					ActionIncrement& increment = CreateIncrement(parent, "Increment" + std::to_string(i), i % 2 ? "Health" : "Score", 1);
+					batch.Add(increment);
+					increments.PushBack(&increment);
+				}
+			}
+
+			WorldState worldState;
+			StopWatch stopWatch;
+
+			// Resolves every operand by name each frame, as Update did before binding.
+			stopWatch.Start();
+			for (std::size_t frame = 0; frame < frameCount; ++frame)
+			{
+				for (auto* increment : increments)
+				{
+					Datum* operand = increment->Search(increment->Operand());
+					if (operand && operand->Type() == Datum::Types::Integer && operand->Size() > 0) operand->Get<int>() += 1;
+				}
+			}
+			stopWatch.Stop();
+
+			const double searchTime = std::chrono::duration<double, std::micro>(stopWatch.Elapsed()).count() / frameCount;
+			stopWatch.Reset();
+
+			// Outside of a World, batched increments are still applied by their own Update.
+			stopWatch.Start();
+			for (std::size_t frame = 0; frame < frameCount; ++frame)
+			{
+				root.Update(worldState);
+			}
+			stopWatch.Stop();
+
+			const double boundTime = std::chrono::duration<double, std::micro>(stopWatch.Elapsed()).count() / frameCount;
+			stopWatch.Reset();
+
+			Assert::AreEqual(incrementCount, batch.Size());
+			Assert::AreEqual(groupCount + 1, batch.TargetCount());
+
+			stopWatch.Start();
+			for (std::size_t frame = 0; frame < frameCount; ++frame)
+			{
+				for (auto* increment : increments)
+				{
+					batch.Add(*increment);
+				}
+
+				batch.Apply();
+			}
+			stopWatch.Stop();
+
+			const double batchTime = std::chrono::duration<double, std::micro>(stopWatch.Elapsed()).count() / frameCount;
+
+			Assert::IsTrue(batch.IsEmpty());
+			Assert::AreEqual(groupCount + 1, batch.TargetCount());
+			Assert::AreEqual(static_cast<int>(incrementCount / 2 * frameCount * 3), root.Find("Score")->Get<int>());
+
+			std::wostringstream message;
+			message << incrementCount << L" increments per frame. Search: " << searchTime
+				<< L"us, bound: " << boundTime << L"us, batched: " << batchTime << L"us.\n";
+			Logger::WriteMessage(message.str().c_str());
+		}
+
+	private:
+		static ActionIncrement& CreateIncrement(Entity& parent, const std::string& name, const std::string& operand, const int step)
+		{
+			ActionIncrement& increment = static_cast<ActionIncrement&>(parent.CreateChild("ActionIncrement"s, name));
+			increment.SetOperand(operand);
+			*increment.Find(ActionIncrement::IncrementStepKey) = step;
+			increment.SetBatched(true);
+
+			return increment;
+		}
+
+		static _CrtMemState sStartMemState;
+
+		ActionIncrementFactory actionIncrementFactory;
+		EntityFactory entityFactory;
+	};
+
+	_CrtMemState IncrementBatchTest::sStartMemState;
+}
@@ -3,6 +3,7 @@
 #include "ToStringSpecialization.h"
 #include "JsonParseMaster.h"
 #include "JsonEntityParseHelper.h"
+#include "JsonTestParseHelper.h"
 #include "Entity.h"
 #include "FooEntity.h"
 #include "World.h"
@@ -198,6 +199,189 @@ namespace EntitySystemTests
 			Assert::AreEqual(30, sector2->Find("Entity2")->Get<Scope*>(1)->Find("AuxiliaryInt")->Get<int>());
 		}
 
+		TEST_METHOD(ParseStreamWorld)
+		{
+			World world;
+
+			JsonEntityParseHelper::SharedData sharedData;
+			sharedData.SetEntity(world);
+
+			JsonEntityParseHelper helper;
+			JsonParseMaster parser;
+
+			parser.AddHelper(helper);
+			parser.SetSharedData(sharedData);
+
+			parser.ParseStreamFromFile("Content/World.json");
+			Assert::AreEqual(2_z, world.ChildCount());
+
+			Entity* sector1 = world.FindChild("Sector1");
+			Assert::IsNotNull(sector1);
+			Assert::AreEqual(2_z, sector1->ChildCount());
+			Assert::AreEqual(10, sector1->FindChild("Entity1")->Find("AuxiliaryInt")->Get<int>());
+			Assert::AreEqual(20, sector1->FindChild("Entity2")->Find("AuxiliaryInt")->Get<int>());
+
+			Entity* sector2 = world.FindChild("Sector2");
+			Assert::IsNotNull(sector2);
+			Assert::AreEqual(3_z, sector2->ChildCount());
+			Assert::AreEqual(10, sector2->FindChild("Entity1")->Find("AuxiliaryInt")->Get<int>());
+			Assert::AreEqual(20, sector2->Find("Entity2")->Get<Scope*>(0)->Find("AuxiliaryInt")->Get<int>());
+			Assert::AreEqual(30, sector2->Find("Entity2")->Get<Scope*>(1)->Find("AuxiliaryInt")->Get<int>());
+		}
+
+		TEST_METHOD(ParseStreamValues)
+		{
+			Entity entity;
+
+			JsonEntityParseHelper::SharedData sharedData;
+			sharedData.SetEntity(entity);
+
+			JsonEntityParseHelper helper;
+			JsonParseMaster parser;
+
+			parser.AddHelper(helper);
+			parser.SetSharedData(sharedData);
+
+			std::istringstream input(R"({
+				"Integers": {
+				  "type": "integer",
+				  "value": [ 1, 2, 3, 4, 5 ]
+				},
+				"Float": {
+				  "type": "float",
+				  "value": 2
+				},
+				"Ignored": [ { "Nested": true }, null ],
+				"String": {
+				  "type": "string",
+				  "value": "Hello"
+				}
+			})"s);
+
+			parser.ParseStream(input);
+
+			const auto* integers = entity.Find("Integers");
+			Assert::IsNotNull(integers);
+			Assert::AreEqual(5_z, integers->Size());
+
+			for (std::size_t i = 0; i < integers->Size(); ++i)
+			{
+				Assert::AreEqual(static_cast<int>(i + 1), integers->Get<int>(i));
+			}
+
+			Assert::AreEqual(2.0f, entity.Find("Float")->Get<float>());
+			Assert::AreEqual("Hello"s, entity.Find("String")->Get<std::string>());
+			Assert::IsNull(entity.Find("Ignored"));
+		}
+
+		TEST_METHOD(ParseValueOrder)
+		{
+			JsonEntityParseHelper::SharedData sharedData;
+			JsonEntityParseHelper helper;
+			JsonParseMaster parser;
+
+			parser.AddHelper(helper);
+			parser.SetSharedData(sharedData);
+
+			const std::string json = R"({
+				"Late": { "value": 1, "type": "integer" },
+				"LateFloats": { "value": [ 1.5, 2.5 ], "type": "float" },
+				"LateChild": { "value": { "Inner": { "value": "Hi", "type": "string" } }, "type": "Entity" },
+				"Empty": { "type": "integer", "value": [] }
+			})"s;
+
+			// The parsed and streamed paths accept a value before its type, and both replace previous contents with an empty array.
+			const auto verify = [](const Entity& parsed)
+			{
+				Assert::AreEqual(1, parsed.Find("Late")->Get<int>());
+				Assert::AreEqual(2_z, parsed.Find("LateFloats")->Size());
+				Assert::AreEqual(2.5f, parsed.Find("LateFloats")->Get<float>(1));
+				Assert::AreEqual("Hi"s, parsed.FindChild("LateChild")->Find("Inner")->Get<std::string>());
+				Assert::AreEqual(0_z, parsed.Find("Empty")->Size());
+			};
+
+			Entity parsed;
+			parsed.Append("Empty") = 7;
+			sharedData.SetEntity(parsed);
+			parser.Parse(json);
+			verify(parsed);
+
+			Entity streamed;
+			streamed.Append("Empty") = 7;
+			sharedData.SetEntity(streamed);
+			std::istringstream input(json);
+			parser.ParseStream(input);
+			verify(streamed);
+
+			// An object value streamed before its type is created before its class is known.
+			Entity conflicting;
+			sharedData.SetEntity(conflicting);
+			std::istringstream lateClass(R"({ "Foo": { "value": {}, "type": "FooEntity" } })"s);
+			Assert::ExpectException<std::runtime_error>([&parser, &lateClass] { parser.ParseStream(lateClass); });
+
+			std::istringstream mismatched(R"({ "Mixed": { "value": [ 1, "two" ], "type": "integer" } })"s);
+			Assert::ExpectException<std::runtime_error>([&parser, &mismatched] { parser.ParseStream(mismatched); });
+		}
+
+		TEST_METHOD(ParseRoutes)
+		{
+			Entity entity;
+
+			JsonEntityParseHelper::SharedData sharedData;
+			sharedData.SetEntity(entity);
+
+			JsonTestParseHelper testHelper;
+			JsonEntityParseHelper helper;
+			JsonParseMaster parser;
+
+			// Every value is routed to the test helper first, which declines data it does not own.
+			parser.AddHelper(testHelper);
+			parser.AddHelper(helper);
+			parser.SetSharedData(sharedData);
+
+			const std::string json = R"({
+				"Child": {
+				  "type": "Entity",
+				  "value": {
+					"Integer": {
+					  "Type": "integer",
+					  "VALUE": 10
+					},
+					"Floats": {
+					  "TYPE": "float",
+					  "Value": [ 1.5, 2.5 ]
+					},
+					"Ignored": [ 1, 2 ],
+					"Flag": true
+				  }
+				}
+			})"s;
+
+			parser.Parse(json);
+
+			Entity* child = entity.FindChild("Child");
+			Assert::IsNotNull(child);
+			Assert::AreEqual(10, child->Find("Integer")->Get<int>());
+			Assert::AreEqual(2_z, child->Find("Floats")->Size());
+			Assert::AreEqual(2.5f, child->Find("Floats")->Get<float>(1));
+			Assert::IsNull(child->Find("Ignored"));
+			Assert::IsNull(child->Find("Flag"));
+
+			Assert::IsTrue(parser.RemoveHelper(testHelper));
+
+			Entity streamed;
+			sharedData.SetEntity(streamed);
+
+			std::istringstream input(json);
+			parser.ParseStream(input);
+
+			child = streamed.FindChild("Child");
+			Assert::IsNotNull(child);
+			Assert::AreEqual(10, child->Find("Integer")->Get<int>());
+			Assert::AreEqual(1.5f, child->Find("Floats")->Get<float>(0));
+			Assert::IsNull(child->Find("Ignored"));
+		}
+
 		TEST_METHOD(Prescribed)
 		{
 			FooEntity entity(10);
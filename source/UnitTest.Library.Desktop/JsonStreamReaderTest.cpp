@@ -0,0 +1,196 @@
+#include "pch.h"
+
+#include "ToStringSpecialization.h"
+#include "JsonStreamReader.h"
+
+
+using namespace std::string_literals;
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+using namespace UnitTests;
+using namespace Library;
+
+namespace JsonParseTests
+{
+	TEST_CLASS(JsonStreamReaderTest)
+	{
+		using Token = JsonStreamReader::Token;
+
+	public:
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&sStartMemState);
+#endif
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &sStartMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+		}
+
+		TEST_METHOD(Tokens)
+		{
+			std::istringstream input(R"({
+				"Integer": -12,
+				"Float": 2.5e1,
+				"Large": 4294967296,
+				"String": "Hello",
+				"True": true,
+				"False": false,
+				"Null": null,
+				"Array": [ 1, { }, [ ] ],
+				"Object": { "Key": "Value" }
+			})"s);
+
+			JsonStreamReader reader(input);
+			Assert::AreEqual(Token::None, reader.Current());
+
+			Assert::AreEqual(Token::ObjectStart, reader.Next());
+
+			Assert::AreEqual(Token::Key, reader.Next());
+			Assert::AreEqual("Integer"s, reader.Text());
+			Assert::AreEqual(Token::Integer, reader.Next());
+			Assert::AreEqual(-12, reader.Integer());
+			Assert::AreEqual(-12.0, reader.Float());
+			Assert::IsTrue(reader.IsScalar());
+
+			Assert::AreEqual(Token::Key, reader.Next());
+			Assert::AreEqual(Token::Float, reader.Next());
+			Assert::AreEqual(25.0, reader.Float());
+
+			Assert::AreEqual(Token::Key, reader.Next());
+			Assert::AreEqual(Token::Float, reader.Next());
+			Assert::AreEqual(4294967296.0, reader.Float());
+
+			Assert::AreEqual(Token::Key, reader.Next());
+			Assert::AreEqual(Token::String, reader.Next());
+			Assert::AreEqual("Hello"s, reader.Text());
+
+			Assert::AreEqual(Token::Key, reader.Next());
+			Assert::AreEqual(Token::Boolean, reader.Next());
+			Assert::IsTrue(reader.Boolean());
+
+			Assert::AreEqual(Token::Key, reader.Next());
+			Assert::AreEqual(Token::Boolean, reader.Next());
+			Assert::IsFalse(reader.Boolean());
+
+			Assert::AreEqual(Token::Key, reader.Next());
+			Assert::AreEqual(Token::Null, reader.Next());
+
+			Assert::AreEqual(Token::Key, reader.Next());
+			Assert::AreEqual(Token::ArrayStart, reader.Next());
+			Assert::IsFalse(reader.IsScalar());
+			Assert::AreEqual(Token::Integer, reader.Next());
+			Assert::AreEqual(Token::ObjectStart, reader.Next());
+			Assert::AreEqual(Token::ObjectEnd, reader.Next());
+			Assert::AreEqual(Token::ArrayStart, reader.Next());
+			Assert::AreEqual(Token::ArrayEnd, reader.Next());
+			Assert::AreEqual(Token::ArrayEnd, reader.Next());
+
+			Assert::AreEqual(Token::Key, reader.Next());
+			Assert::AreEqual("Object"s, reader.Text());
+			Assert::AreEqual(Token::ObjectStart, reader.Next());
+			Assert::AreEqual(Token::Key, reader.Next());
+			Assert::AreEqual(Token::String, reader.Next());
+			Assert::AreEqual("Value"s, reader.Text());
+			Assert::AreEqual(Token::ObjectEnd, reader.Next());
+
+			Assert::AreEqual(Token::ObjectEnd, reader.Next());
+			Assert::AreEqual(Token::End, reader.Next());
+			Assert::AreEqual(Token::End, reader.Next());
+			Assert::AreEqual(11_z, reader.Line());
+		}
+
+		TEST_METHOD(Strings)
+		{
+			std::istringstream input(R"([ "Quote \" Slash \\ \/ Tab \t", "é€😀", "" ])"s);
+
+			// A small buffer forces strings to span refills.
+			JsonStreamReader reader(input, 3);
+
+			Assert::AreEqual(Token::ArrayStart, reader.Next());
+
+			Assert::AreEqual(Token::String, reader.Next());
+			Assert::AreEqual("Quote \" Slash \\ / Tab \t"s, reader.Text());
+
+			Assert::AreEqual(Token::String, reader.Next());
+			Assert::AreEqual("\xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80"s, reader.Text());
+
+			Assert::AreEqual(Token::String, reader.Next());
+			Assert::IsTrue(reader.Text().empty());
+
+			Assert::AreEqual(Token::ArrayEnd, reader.Next());
+			Assert::AreEqual(Token::End, reader.Next());
+		}
+
+		TEST_METHOD(Skip)
+		{
+			std::istringstream input(R"({ "Skipped": { "A": [ 1, [ 2, { "B": 3 } ] ] }, "Kept": 4, "Scalar": 5, "Last": 6 })"s);
+			JsonStreamReader reader(input);
+
+			Assert::AreEqual(Token::ObjectStart, reader.Next());
+			Assert::AreEqual(Token::Key, reader.Next());
+
+			reader.Skip();
+			Assert::AreEqual(Token::ObjectEnd, reader.Current());
+
+			Assert::AreEqual(Token::Key, reader.Next());
+			Assert::AreEqual("Kept"s, reader.Text());
+			Assert::AreEqual(Token::Integer, reader.Next());
+			Assert::AreEqual(4, reader.Integer());
+
+			Assert::AreEqual(Token::Key, reader.Next());
+			Assert::AreEqual(Token::Integer, reader.Next());
+			reader.Skip();
+			Assert::AreEqual(Token::Integer, reader.Current());
+
+			Assert::AreEqual(Token::Key, reader.Next());
+			Assert::AreEqual("Last"s, reader.Text());
+		}
+
+		TEST_METHOD(Malformed)
+		{
+			const std::string documents[] =
+			{
+				R"({ "A" 1 })"s,
+				R"({ "A": 1 "B": 2 })"s,
+				R"({ A: 1 })"s,
+				R"([ 1, 2 )"s,
+				R"([ tru ])"s,
+				R"([ "Unterminated ])"s,
+				R"([ "\q" ])"s,
+				R"([ "\ud83d" ])"s,
+				R"([ 1.2.3 ])"s,
+				R"([ ] ])"s,
+				R"([ @ ])"s,
+			};
+
+			for (const auto& document : documents)
+			{
+				std::istringstream input(document);
+				JsonStreamReader reader(input);
+
+				Assert::ExpectException<std::runtime_error>([&reader]
+				{
+					while (reader.Next() != Token::End);
+				});
+			}
+		}
+
+	private:
+		static _CrtMemState sStartMemState;
+	};
+
+	_CrtMemState JsonStreamReaderTest::sStartMemState;
+}
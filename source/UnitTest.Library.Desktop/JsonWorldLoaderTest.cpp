@@ -0,0 +1,205 @@
+#include "pch.h"
+
+#include "ToStringSpecialization.h"
+#include "JsonParseMaster.h"
+#include "JsonEntityParseHelper.h"
+#include "JsonWorldLoader.h"
+#include "Entity.h"
+#include "FooEntity.h"
+#include "World.h"
+
+#include <cstdio>
+#include <fstream>
+
+using namespace std::string_literals;
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+using namespace UnitTests;
+using namespace Library;
+
+namespace EntitySystemTests
+{
+	TEST_CLASS(JsonWorldLoaderTest)
+	{
+	public:
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+			TypeManager::Create();
+			RegisterType<Entity>();
+			RegisterType<FooEntity>();
+			RegisterType<World>();
+
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&sStartMemState);
+#endif
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &sStartMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+
+			TypeManager::Destroy();
+		}
+
+		TEST_METHOD(LoadFromFile)
+		{
+			JsonEntityParseHelper::SharedData sharedData;
+			JsonEntityParseHelper helper;
+			JsonParseMaster parser;
+
+			parser.AddHelper(helper);
+			parser.SetSharedData(sharedData);
+
+			for (std::size_t threadCount = 1; threadCount <= 4; ++threadCount)
+			{
+				World world;
+
+				JsonWorldLoader loader(parser, threadCount);
+				Assert::AreEqual(threadCount, loader.ThreadCount());
+
+				loader.LoadFromFile(world, "Content/World.json");
+				Assert::AreEqual(2_z, world.ChildCount());
+
+				Entity* sector1 = world.FindChild("Sector1");
+				Assert::IsNotNull(sector1);
+				Assert::IsTrue(sector1->GetParent() == &world);
+				Assert::AreEqual(2_z, sector1->ChildCount());
+				Assert::AreEqual(10, sector1->FindChild("Entity1")->Find("AuxiliaryInt")->Get<int>());
+				Assert::AreEqual(20, sector1->FindChild("Entity2")->Find("AuxiliaryInt")->Get<int>());
+
+				Entity* sector2 = world.FindChild("Sector2");
+				Assert::IsNotNull(sector2);
+				Assert::AreEqual(3_z, sector2->ChildCount());
+				Assert::AreEqual(10, sector2->FindChild("Entity1")->Find("AuxiliaryInt")->Get<int>());
+				Assert::AreEqual(20, sector2->Find("Entity2")->Get<Scope*>(0)->Find("AuxiliaryInt")->Get<int>());
+				Assert::AreEqual(30, sector2->Find("Entity2")->Get<Scope*>(1)->Find("AuxiliaryInt")->Get<int>());
+			}
+
+			Assert::IsTrue(JsonWorldLoader(parser).ThreadCount() > 0);
+		}
+
+		TEST_METHOD(Load)
+		{
+			JsonEntityParseHelper::SharedData sharedData;
+			JsonEntityParseHelper helper;
+			JsonParseMaster parser;
+
+			parser.AddHelper(helper);
+			parser.SetSharedData(sharedData);
+
+			std::string json = R"({ "Data": { "type": "float", "value": 20.0 }, "Names": { "type": "string", "value": [ "A, {", "B \"}]" ] })"s;
+
+			for (int i = 0; i < 32; ++i)
+			{
+				json += R"(, "Sector)"s + std::to_string(i) + R"(": { "type": "Entity", "value": { "Index": { "type": "integer", "value": )"s + std::to_string(i) + " } } }"s;
+			}
+
+			json += " }"s;
+
+			FooEntity root(10);
+			std::istringstream input(json);
+
+			JsonWorldLoader loader(parser, 4);
+			loader.Load(root, input);
+
+			Assert::AreEqual(20.0f, root.Find("Data")->Get<float>());
+			Assert::AreEqual(2_z, root.Find("Names")->Size());
+			Assert::AreEqual("A, {"s, root.Find("Names")->Get<std::string>(0));
+			Assert::AreEqual("B \"}]"s, root.Find("Names")->Get<std::string>(1));
+
+			Assert::AreEqual(32_z, root.ChildCount());
+
+			for (int i = 0; i < 32; ++i)
+			{
+				Entity* sector = root.FindChild("Sector"s + std::to_string(i));
+				Assert::IsNotNull(sector);
+				Assert::AreEqual(i, sector->Find("Index")->Get<int>());
+			}
+
+			Entity empty;
+			std::istringstream emptyInput(" { } "s);
+			loader.Load(empty, emptyInput);
+			Assert::AreEqual(0_z, empty.ChildCount());
+		}
+
+		TEST_METHOD(LoadFromFiles)
+		{
+			JsonEntityParseHelper::SharedData sharedData;
+			JsonEntityParseHelper helper;
+			JsonParseMaster parser;
+
+			parser.AddHelper(helper);
+			parser.SetSharedData(sharedData);
+
+			const Vector<std::string> filenames = { "JsonWorldLoaderTest0.json"s, "JsonWorldLoaderTest1.json"s };
+
+			for (std::size_t i = 0; i < filenames.Size(); ++i)
+			{
+				std::ofstream file(filenames[i]);
+				file << R"({ "Sector)" << i << R"(": { "type": "Entity", "value": { } } })";
+			}
+
+			World world;
+
+			JsonWorldLoader loader(parser, 2);
+			loader.LoadFromFiles(world, filenames);
+
+			for (const auto& filename : filenames)
+			{
+				std::remove(filename.c_str());
+			}
+
+			Assert::AreEqual(2_z, world.ChildCount());
+			Assert::IsNotNull(world.FindChild("Sector0"));
+			Assert::IsNotNull(world.FindChild("Sector1"));
+
+			Assert::ExpectException<std::runtime_error>([&loader, &world] { loader.LoadFromFile(world, "Missing.json"s); });
+		}
+
+		TEST_METHOD(Malformed)
+		{
+			JsonEntityParseHelper::SharedData sharedData;
+			JsonEntityParseHelper helper;
+			JsonParseMaster parser;
+
+			parser.AddHelper(helper);
+			parser.SetSharedData(sharedData);
+
+			JsonWorldLoader loader(parser, 4);
+
+			const std::string documents[] =
+			{
+				R"([ 1, 2 ])"s,
+				R"({ "Sector": { "type": "Entity", "value": { } })"s,
+				R"({ "A": { "type": "Entity", "value": { } }, "B": { "type": "Unregistered", "value": { } } })"s,
+			};
+
+			for (const auto& document : documents)
+			{
+				Entity root;
+				std::istringstream input(document);
+
+				Assert::ExpectException<std::runtime_error>([&loader, &root, &input] { loader.Load(root, input); });
+				Assert::AreEqual(0_z, root.ChildCount());
+			}
+		}
+
+	private:
+		static _CrtMemState sStartMemState;
+
+		EntityFactory entityFactory;
+		FooEntityFactory fooEntityFactory;
+	};
+
+	_CrtMemState JsonWorldLoaderTest::sStartMemState;
+}
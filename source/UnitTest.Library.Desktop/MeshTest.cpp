@@ -0,0 +1,280 @@
+#include "pch.h"
+
+#include "ToStringSpecialization.h"
+#include "Mesh.h"
+#include "Model.h"
+#include "Bone.h"
+#include "VertexFormat.h"
+
+#include <cstring>
+
+#include <glm/gtc/type_precision.hpp>
+
+using namespace std::string_literals;
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+using namespace UnitTests;
+using namespace Library;
+
+namespace EntitySystemTests
+{
+	TEST_CLASS(MeshTest)
+	{
+	public:
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+			TypeManager::Create();
+
+			RegisterType<Entity>();
+			RegisterType<Model>();
+
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&sStartMemState);
+#endif
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &sStartMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+
+			TypeManager::Destroy();
+		}
+
+		TEST_METHOD(VertexFormatLayout)
+		{
+			VertexFormat format;
+			Assert::AreEqual(0U, format.Stride());
+			Assert::IsTrue(format.Elements().IsEmpty());
+
+			format.Add(VertexSemantic::Position, VertexElementFormat::Float3)
+				.Add(VertexSemantic::Normal, VertexElementFormat::SNorm8x4)
+				.Add(VertexSemantic::TextureCoordinate, VertexElementFormat::Half2, 1)
+				.Add(VertexSemantic::Color, VertexElementFormat::UNorm8x4)
+				.Add(VertexSemantic::BoneIndices, VertexElementFormat::UInt16x4)
+				.Add(VertexSemantic::BoneWeights, VertexElementFormat::UNorm16x4);
+
+			// Packed in the order they are added.
+			const std::uint32_t offsets[] = { 0, 12, 16, 20, 24, 32 };
+			const auto& elements = format.Elements();
+			Assert::AreEqual(std::size(offsets), elements.Size());
+
+			for (std::size_t i = 0; i < elements.Size(); ++i)
+			{
+				Assert::AreEqual(offsets[i], elements[i].Offset);
+			}
+
+			Assert::AreEqual(40U, format.Stride());
+			Assert::IsTrue(elements[2].Semantic == VertexSemantic::TextureCoordinate);
+			Assert::IsTrue(elements[2].Format == VertexElementFormat::Half2);
+			Assert::AreEqual(1U, elements[2].Channel);
+			Assert::AreEqual(0U, elements[3].Channel);
+
+			for (const auto [elementFormat, size] : { std::pair(VertexElementFormat::Float2, 8U), std::pair(VertexElementFormat::Float3, 12U), std::pair(VertexElementFormat::Float4, 16U),
+				std::pair(VertexElementFormat::Half2, 4U), std::pair(VertexElementFormat::Half4, 8U), std::pair(VertexElementFormat::SNorm8x4, 4U),
+				std::pair(VertexElementFormat::SNorm16x4, 8U), std::pair(VertexElementFormat::UNorm8x4, 4U), std::pair(VertexElementFormat::UNorm16x2, 4U),
+				std::pair(VertexElementFormat::UNorm16x4, 8U), std::pair(VertexElementFormat::UInt8x4, 4U), std::pair(VertexElementFormat::UInt16x4, 8U) })
+			{
+				Assert::AreEqual(size, VertexFormat::FormatSize(elementFormat));
+			}
+
+			VertexFormat copy(format);
+			Assert::IsTrue(copy == format);
+
+			copy.Add(VertexSemantic::Tangent, VertexElementFormat::Float3);
+			Assert::IsTrue(copy != format);
+			Assert::AreEqual(52U, copy.Stride());
+		}
+
+		TEST_METHOD(VertexFormatInvalid)
+		{
+			VertexFormat format;
+			format.Add(VertexSemantic::Position, VertexElementFormat::Float3);
+
+			// Bone indices are integers, or floats; nothing else is.
+			Assert::ExpectException<std::runtime_error>([&format] { format.Add(VertexSemantic::BoneIndices, VertexElementFormat::UNorm8x4); });
+			Assert::ExpectException<std::runtime_error>([&format] { format.Add(VertexSemantic::BoneIndices, VertexElementFormat::Half4); });
+			Assert::ExpectException<std::runtime_error>([&format] { format.Add(VertexSemantic::Position, VertexElementFormat::UInt8x4); });
+			Assert::ExpectException<std::runtime_error>([&format] { format.Add(VertexSemantic::BoneWeights, VertexElementFormat::UInt16x4); });
+
+			// Only texture coordinates and colors have channels.
+			Assert::ExpectException<std::runtime_error>([&format] { format.Add(VertexSemantic::Normal, VertexElementFormat::Float3, 1); });
+			Assert::ExpectException<std::runtime_error>([&format] { format.Add(VertexSemantic::BoneWeights, VertexElementFormat::Float4, 2); });
+
+			// A rejected element leaves the format as it was.
+			Assert::AreEqual(1_z, format.Elements().Size());
+			Assert::AreEqual(12U, format.Stride());
+
+			format.Add(VertexSemantic::BoneIndices, VertexElementFormat::Float4)
+				.Add(VertexSemantic::TextureCoordinate, VertexElementFormat::Float2, 3)
+				.Add(VertexSemantic::Color, VertexElementFormat::Float4, 1);
+			Assert::AreEqual(4_z, format.Elements().Size());
+		}
+
+		TEST_METHOD(InterleaveBoneWeights)
+		{
+			Model model;
+
+			MeshData meshData;
+			meshData.Vertices = { glm::vec3(0, 0, 0), glm::vec3(1, 0, 0), glm::vec3(2, 0, 0), glm::vec3(3, 0, 0), glm::vec3(4, 0, 0) };
+			meshData.BoneWeights.Resize(meshData.Vertices.Size());
+
+			// Thirds, quarters that each round up, uneven weights that are not normalized, and a vertex without weights.
+			for (std::uint32_t bone = 0; bone < 3; ++bone) meshData.BoneWeights[0].AddWeight(1.0f / 3.0f, bone);
+			for (std::uint32_t bone = 0; bone < 4; ++bone) meshData.BoneWeights[1].AddWeight(0.25f, 10 + bone);
+			meshData.BoneWeights[2].AddWeight(1.0f, 7);
+			meshData.BoneWeights[2].AddWeight(0.6f, 5);
+			meshData.BoneWeights[2].AddWeight(0.3f, 3);
+			meshData.BoneWeights[2].AddWeight(0.1f, 1);
+			meshData.BoneWeights[3].AddWeight(0.2f, 255);
+
+			const Mesh mesh(model, std::move(meshData));
+			Assert::IsTrue(mesh.HasBoneWeights());
+
+			VertexFormat format;
+			format.Add(VertexSemantic::Position, VertexElementFormat::Float3)
+				.Add(VertexSemantic::BoneIndices, VertexElementFormat::UInt8x4)
+				.Add(VertexSemantic::BoneWeights, VertexElementFormat::UNorm8x4);
+			Assert::AreEqual(20U, format.Stride());
+
+			const Vector<std::byte> vertices = mesh.Interleave(format);
+			Assert::AreEqual(5_z * format.Stride(), vertices.Size());
+
+			const glm::u8vec4 expectedIndices[] = { glm::u8vec4(0, 1, 2, 0), glm::u8vec4(10, 11, 12, 13), glm::u8vec4(7, 5, 3, 1), glm::u8vec4(255, 0, 0, 0), glm::u8vec4(0) };
+			const glm::vec4 expectedWeights[] = { glm::vec4(1.0f / 3.0f, 1.0f / 3.0f, 1.0f / 3.0f, 0.0f), glm::vec4(0.25f), glm::vec4(0.5f, 0.3f, 0.15f, 0.05f), glm::vec4(1.0f, 0.0f, 0.0f, 0.0f), glm::vec4(0.0f) };
+
+			for (std::size_t i = 0; i < 5; ++i)
+			{
+				const std::byte* vertex = &vertices[i * format.Stride()];
+
+				glm::vec3 position;
+				glm::u8vec4 indices;
+				glm::u8vec4 weights;
+				std::memcpy(&position, vertex, sizeof(position));
+				std::memcpy(&indices, vertex + 12, sizeof(indices));
+				std::memcpy(&weights, vertex + 16, sizeof(weights));
+
+				Assert::IsTrue(position == glm::vec3(static_cast<float>(i), 0.0f, 0.0f));
+				Assert::IsTrue(indices == expectedIndices[i]);
+
+				// Quantized weights sum to exactly 255, so skinning neither grows nor shrinks the vertex.
+				const int sum = weights.x + weights.y + weights.z + weights.w;
+				Assert::AreEqual(i < 4 ? 255 : 0, sum);
+
+				for (glm::length_t j = 0; j < 4; ++j)
+				{
+					Assert::AreEqual(expectedWeights[i][j] * 255.0f, static_cast<float>(weights[j]), 1.0f);
+				}
+			}
+		}
+
+		TEST_METHOD(InterleaveMissingStreams)
+		{
+			Model model;
+
+			MeshData meshData;
+			meshData.Vertices = { glm::vec3(1, 2, 3), glm::vec3(4, 5, 6) };
+			meshData.Normals = { glm::vec3(0, 0, 1), glm::vec3(0, 1, 0) };
+			meshData.TextureCoordinates.EmplaceBack(Vector<glm::vec3>{ glm::vec3(0.5f, 0.25f, 0.0f) });
+
+			const Mesh mesh(model, std::move(meshData));
+			Assert::IsFalse(mesh.HasBoneWeights());
+
+			// Streams the Mesh lacks, or that are shorter than its vertices, are written as zero.
+			VertexFormat format;
+			format.Add(VertexSemantic::Position, VertexElementFormat::Float3)
+				.Add(VertexSemantic::Normal, VertexElementFormat::Float3)
+				.Add(VertexSemantic::Tangent, VertexElementFormat::SNorm16x4)
+				.Add(VertexSemantic::TextureCoordinate, VertexElementFormat::Float2)
+				.Add(VertexSemantic::TextureCoordinate, VertexElementFormat::Half2, 1)
+				.Add(VertexSemantic::Color, VertexElementFormat::UNorm8x4)
+				.Add(VertexSemantic::BoneIndices, VertexElementFormat::UInt16x4)
+				.Add(VertexSemantic::BoneWeights, VertexElementFormat::Float4);
+
+			const std::uint32_t zeroFilledOffset = 24;
+			Assert::AreEqual(72U, format.Stride());
+
+			Vector<std::byte> vertices;
+			vertices.Resize(2 * format.Stride());
+			std::fill(vertices.begin(), vertices.end(), std::byte(0xCD));
+
+			Assert::ExpectException<std::runtime_error>([&mesh, &format, &vertices] { mesh.Interleave(format, gsl::span<std::byte>(&vertices[0], vertices.Size() - 1)); });
+
+			mesh.Interleave(format, gsl::span<std::byte>(&vertices[0], vertices.Size()));
+
+			for (std::size_t i = 0; i < 2; ++i)
+			{
+				const std::byte* vertex = &vertices[i * format.Stride()];
+
+				glm::vec3 position;
+				glm::vec3 normal;
+				std::memcpy(&position, vertex, sizeof(position));
+				std::memcpy(&normal, vertex + 12, sizeof(normal));
+				Assert::IsTrue(position == mesh.Vertices()[i]);
+				Assert::IsTrue(normal == mesh.Normals()[i]);
+
+				for (std::uint32_t offset = zeroFilledOffset; offset < format.Stride(); ++offset)
+				{
+					Assert::IsTrue(vertex[offset] == std::byte(0));
+				}
+			}
+
+			Assert::IsTrue(mesh.Interleave(format) == vertices);
+		}
+
+		TEST_METHOD(InterleaveBoneIndexRange)
+		{
+			Model model;
+
+			MeshData meshData;
+			meshData.Vertices = { glm::vec3(0), glm::vec3(1) };
+			meshData.BoneWeights.Resize(2);
+			meshData.BoneWeights[0].AddWeight(1.0f, 2);
+			meshData.BoneWeights[1].AddWeight(0.5f, 255);
+			meshData.BoneWeights[1].AddWeight(0.5f, 256);
+
+			const Mesh mesh(model, std::move(meshData));
+
+			// Bone 256 does not fit a byte.
+			VertexFormat bytes;
+			bytes.Add(VertexSemantic::BoneIndices, VertexElementFormat::UInt8x4);
+			Assert::ExpectException<std::runtime_error>([&mesh, &bytes] { mesh.Interleave(bytes); });
+
+			VertexFormat shorts;
+			shorts.Add(VertexSemantic::BoneIndices, VertexElementFormat::UInt16x4);
+			Vector<std::byte> vertices = mesh.Interleave(shorts);
+
+			glm::u16vec4 indices;
+			std::memcpy(&indices, &vertices[shorts.Stride()], sizeof(indices));
+			Assert::IsTrue(indices == glm::u16vec4(255, 256, 0, 0));
+
+			VertexFormat floats;
+			floats.Add(VertexSemantic::BoneIndices, VertexElementFormat::Float4);
+			vertices = mesh.Interleave(floats);
+
+			glm::vec4 floatIndices;
+			std::memcpy(&floatIndices, &vertices[floats.Stride()], sizeof(floatIndices));
+			Assert::AreEqual(glm::vec4(255.0f, 256.0f, 0.0f, 0.0f), floatIndices);
+
+			// Without bone weights, bone indices are written as zero rather than range checked.
+			MeshData unweightedData;
+			unweightedData.Vertices = { glm::vec3(0) };
+			const Mesh unweighted(model, std::move(unweightedData));
+			Assert::AreEqual(4_z, unweighted.Interleave(bytes).Size());
+		}
+
+	private:
+		static _CrtMemState sStartMemState;
+	};
+
+	_CrtMemState MeshTest::sStartMemState;
+}
@@ -0,0 +1,231 @@
+#include "pch.h"
+
+#include "ToStringSpecialization.h"
+#include "AnimationTestHelper.h"
+#include "ModelCooker.h"
+#include "Model.h"
+#include "ModelMaterial.h"
+#include "Mesh.h"
+#include "Bone.h"
+#include "AnimationClip.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+
+using namespace std::string_literals;
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+using namespace UnitTests;
+using namespace Library;
+
+namespace EntitySystemTests
+{
+	TEST_CLASS(ModelCookerTest)
+	{
+	public:
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+			TypeManager::Create();
+
+			RegisterType<Entity>();
+			RegisterType<Model>();
+
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&sStartMemState);
+#endif
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &sStartMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+
+			TypeManager::Destroy();
+		}
+
+		TEST_METHOD(RoundTrip)
+		{
+			const std::string filename = "ModelCookerTest.bin"s;
+
+			auto model = CreateBoneChainModel(2);
+			AddBoneChainClip(*model, "Walk"s, 4);
+			AddMeshes(*model);
+
+			ModelCooker::CookToFile(*model, filename);
+			Assert::IsTrue(ModelCooker::IsCookedFile(filename));
+
+			{
+				Model loaded;
+				ModelCooker::LoadFromFile(loaded, filename);
+
+				Assert::AreEqual(2_z, loaded.Bones().Size());
+				Assert::AreEqual("Bone1"s, loaded.Bones()[1]->Name());
+				Assert::AreEqual(1_z, loaded.Animations().Size());
+				Assert::AreEqual("Walk"s, loaded.Animations()[0]->Name());
+				Assert::AreEqual(1_z, loaded.Materials().Size());
+				Assert::AreEqual("Skin"s, loaded.Materials()[0]->Name());
+				Assert::AreEqual(model->Meshes().Size(), loaded.Meshes().Size());
+
+				for (std::size_t i = 0; i < model->Meshes().Size(); ++i)
+				{
+					const Mesh& expected = *model->Meshes()[i];
+					const Mesh& actual = *loaded.Meshes()[i];
+
+					Assert::IsTrue(actual.IsMapped());
+					Assert::AreEqual(expected.Name(), actual.Name());
+					Assert::AreEqual(expected.FaceCount(), actual.FaceCount());
+					Assert::IsTrue((expected.GetMaterial() == nullptr) == (actual.GetMaterial() == nullptr));
+
+					AssertSpansEqual(expected.Vertices(), actual.Vertices());
+					AssertSpansEqual(expected.Normals(), actual.Normals());
+					AssertSpansEqual(expected.Tangents(), actual.Tangents());
+					AssertSpansEqual(expected.BiNormals(), actual.BiNormals());
+					AssertSpansEqual(expected.Indices(), actual.Indices());
+					AssertSpansEqual(expected.Streams().BoneWeightOffsets, actual.Streams().BoneWeightOffsets);
+					AssertSpansEqual(expected.Streams().BoneWeights, actual.Streams().BoneWeights);
+
+					Assert::AreEqual(expected.TextureCoordinates().Size(), actual.TextureCoordinates().Size());
+					for (std::size_t channel = 0; channel < expected.TextureCoordinates().Size(); ++channel)
+					{
+						AssertSpansEqual(expected.TextureCoordinates()[channel], actual.TextureCoordinates()[channel]);
+					}
+
+					Assert::AreEqual(expected.VertexColors().Size(), actual.VertexColors().Size());
+					for (std::size_t channel = 0; channel < expected.VertexColors().Size(); ++channel)
+					{
+						AssertSpansEqual(expected.VertexColors()[channel], actual.VertexColors()[channel]);
+					}
+				}
+
+				Assert::AreEqual("Skin"s, loaded.Meshes()[0]->GetMaterial()->Name());
+				Assert::AreEqual(2_z, loaded.Meshes()[0]->BoneWeights(0).size());
+
+				// A second Model loaded from the same file shares its mapping, and the file cannot be cooked over while it is mapped.
+				Model shared;
+				ModelCooker::LoadFromFile(shared, filename);
+				Assert::IsTrue(shared.Meshes()[0]->Vertices().data() == loaded.Meshes()[0]->Vertices().data());
+
+				Assert::ExpectException<std::runtime_error>([&model, &filename] { ModelCooker::CookToFile(*model, filename); });
+			}
+
+			// Once no Model maps it, it can be.
+			ModelCooker::CookToFile(*model, filename);
+
+			{
+				Model loaded;
+				ModelCooker::LoadFromFile(loaded, filename);
+				Assert::AreEqual(model->Meshes().Size(), loaded.Meshes().Size());
+			}
+
+			std::remove(filename.c_str());
+		}
+
+		TEST_METHOD(LoadInvalid)
+		{
+			const std::string filename = "ModelCookerTest.Invalid.bin"s;
+
+			Model missing;
+			Assert::ExpectException<std::runtime_error>([&missing] { ModelCooker::LoadFromFile(missing, "Missing.bin"s); });
+
+			// A single mesh of three vertices, weighted to two, one and one bones.
+			auto model = CreateBoneChainModel(2);
+			AddMeshes(*model);
+			model->Data().Meshes.PopBack();
+
+			std::ostringstream output(std::ios::binary);
+			ModelCooker::Cook(*model, output);
+			const std::string cooked = output.str();
+
+			const auto loadCorrupted = [&filename](const std::string& bytes)
+			{
+				{
+					std::ofstream file(filename, std::ios::binary);
+					file.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+				}
+
+				Model loaded;
+				ModelCooker::LoadFromFile(loaded, filename);
+			};
+
+			loadCorrupted(cooked);
+
+			// Bone weight offsets out of order, though still ending at the number of weights.
+			const std::uint32_t offsets[] = { 0, 2, 3, 4 };
+			const std::uint32_t unordered[] = { 0, 3, 2, 4 };
+			const std::string offsetBytes(reinterpret_cast<const char*>(offsets), sizeof(offsets));
+
+			const std::size_t offsetsPosition = cooked.find(offsetBytes);
+			Assert::IsTrue(offsetsPosition != std::string::npos);
+
+			std::string corrupted = cooked;
+			corrupted.replace(offsetsPosition, sizeof(unordered), reinterpret_cast<const char*>(unordered), sizeof(unordered));
+			Assert::ExpectException<std::runtime_error>([&loadCorrupted, &corrupted] { loadCorrupted(corrupted); });
+
+			// One vertex fewer than the offsets describe. The vertex count of the first mesh record follows the 64 byte header and 40 bytes of the record.
+			corrupted = cooked;
+			Assert::AreEqual(3, static_cast<int>(corrupted[104]));
+			corrupted[104] = 2;
+			Assert::ExpectException<std::runtime_error>([&loadCorrupted, &corrupted] { loadCorrupted(corrupted); });
+
+			std::remove(filename.c_str());
+		}
+
+	private:
+		/// <summary>
+		/// Adds a material, a skinned mesh using it with every stream, and a mesh of vertices alone.
+		/// </summary>
+		static void AddMeshes(Model& model)
+		{
+			ModelMaterialData materialData;
+			materialData.Name = "Skin"s;
+			auto material = std::make_shared<ModelMaterial>(model, std::move(materialData));
+			model.Data().Materials.EmplaceBack(material);
+
+			MeshData meshData;
+			meshData.Name = "Body"s;
+			meshData.Material = material;
+			meshData.Vertices = { glm::vec3(0, 0, 0), glm::vec3(1, 0, 0), glm::vec3(0, 1, 0) };
+			meshData.Normals = { glm::vec3(0, 0, 1), glm::vec3(0, 0, 1), glm::vec3(0, 0, 1) };
+			meshData.Tangents = { glm::vec3(1, 0, 0), glm::vec3(1, 0, 0), glm::vec3(1, 0, 0) };
+			meshData.BiNormals = { glm::vec3(0, 1, 0), glm::vec3(0, 1, 0), glm::vec3(0, 1, 0) };
+			meshData.TextureCoordinates.EmplaceBack(Vector<glm::vec3>{ glm::vec3(0, 0, 0), glm::vec3(1, 0, 0), glm::vec3(0, 1, 0) });
+			meshData.VertexColors.EmplaceBack(Vector<glm::vec4>{ glm::vec4(1, 0, 0, 1), glm::vec4(0, 1, 0, 1), glm::vec4(0, 0, 1, 1) });
+			meshData.FaceCount = 1;
+			meshData.Indices = { 0, 1, 2 };
+
+			meshData.BoneWeights.Resize(3);
+			meshData.BoneWeights[0].AddWeight(0.75f, 0);
+			meshData.BoneWeights[0].AddWeight(0.25f, 1);
+			meshData.BoneWeights[1].AddWeight(1.0f, 1);
+			meshData.BoneWeights[2].AddWeight(1.0f, 0);
+
+			model.Data().Meshes.EmplaceBack(std::make_shared<Mesh>(model, std::move(meshData)));
+
+			MeshData pointsData;
+			pointsData.Name = "Points"s;
+			pointsData.Vertices = { glm::vec3(2, 0, 0), glm::vec3(3, 0, 0) };
+			model.Data().Meshes.EmplaceBack(std::make_shared<Mesh>(model, std::move(pointsData)));
+		}
+
+		template <typename T>
+		static void AssertSpansEqual(gsl::span<const T> expected, gsl::span<const T> actual)
+		{
+			Assert::AreEqual(expected.size(), actual.size());
+			Assert::IsTrue(std::equal(expected.begin(), expected.end(), actual.begin()));
+		}
+
+		static _CrtMemState sStartMemState;
+	};
+
+	_CrtMemState ModelCookerTest::sStartMemState;
+}
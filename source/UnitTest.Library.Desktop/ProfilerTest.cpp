@@ -0,0 +1,241 @@
+#include "pch.h"
+
+#include "ToStringSpecialization.h"
+
+#include <atomic>
+#include <sstream>
+#include <thread>
+
+#include "Profiler.h"
+#include "Foo.h"
+
+using namespace std::string_literals;
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+using namespace UnitTests;
+using namespace Library;
+
+namespace UtilityTests
+{
+	TEST_CLASS(ProfilerTest)
+	{
+	public:
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&sStartMemState);
+#endif
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+			Profiler::Destroy();
+
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &sStartMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+		}
+
+		TEST_METHOD(CreateDestroy)
+		{
+			Assert::IsNull(Profiler::Instance());
+
+			{
+				const Profiler::ScopedSample sample("Inactive");
+			}
+
+			Profiler::Create();
+			Profiler* profiler = Profiler::Instance();
+			Assert::IsNotNull(profiler);
+			Assert::IsTrue(profiler->Collect().IsEmpty());
+
+			Profiler::Create();
+			Assert::IsTrue(profiler == Profiler::Instance());
+
+			Profiler::Destroy();
+			Assert::IsNull(Profiler::Instance());
+
+			Profiler::Destroy();
+			Assert::IsNull(Profiler::Instance());
+		}
+
+		TEST_METHOD(NestedScopes)
+		{
+			Profiler::Create();
+			Profiler* profiler = Profiler::Instance();
+
+			profiler->BeginFrame();
+			Assert::AreEqual(1ULL, static_cast<unsigned long long>(profiler->Frame()));
+
+			{
+				const Profiler::ScopedSample outer("Outer");
+
+				for (int i = 0; i < 3; ++i)
+				{
+					const Profiler::ScopedSample inner("Inner");
+				}
+			}
+
+			const auto samples = profiler->Collect();
+			Assert::AreEqual(4_z, samples.Size());
+
+			Assert::AreEqual("Outer"s, std::string(samples[0].Name));
+			Assert::AreEqual(0U, samples[0].Depth);
+			Assert::AreEqual(1ULL, static_cast<unsigned long long>(samples[0].Frame));
+
+			for (std::size_t i = 1; i < samples.Size(); ++i)
+			{
+				Assert::AreEqual("Inner"s, std::string(samples[i].Name));
+				Assert::AreEqual(1U, samples[i].Depth);
+				Assert::IsTrue(samples[i].Start >= samples[0].Start);
+				Assert::IsTrue(samples[i].Start + samples[i].Duration <= samples[0].Start + samples[0].Duration);
+			}
+
+			profiler->Clear();
+			Assert::IsTrue(profiler->Collect().IsEmpty());
+		}
+
+		TEST_METHOD(Aggregate)
+		{
+			Profiler::Create();
+			Profiler* profiler = Profiler::Instance();
+
+			Foo foo;
+
+			for (int i = 0; i < 5; ++i)
+			{
+				const Profiler::ScopedSample sample(foo.TypeNameInstance());
+			}
+
+			{
+				const Profiler::ScopedSample sample("Other");
+			}
+
+			const auto stats = profiler->Aggregate();
+			Assert::AreEqual(2_z, stats.Size());
+			Assert::IsTrue(stats.ContainsKey("Foo"s));
+			Assert::AreEqual(5_z, stats.At("Foo"s).Count);
+			Assert::IsTrue(stats.At("Foo"s).Max <= stats.At("Foo"s).Total);
+			Assert::AreEqual(1_z, stats.At("Other"s).Count);
+		}
+
+		TEST_METHOD(RingBufferWraps)
+		{
+			Profiler::Create(6);
+			Profiler* profiler = Profiler::Instance();
+
+			for (std::uint64_t i = 0; i < 20; ++i)
+			{
+				profiler->BeginFrame();
+				const Profiler::ScopedSample sample("Frame");
+			}
+
+			const auto samples = profiler->Collect();
+			Assert::AreEqual(8_z, samples.Size());
+			Assert::AreEqual(13ULL, static_cast<unsigned long long>(samples.Front().Frame));
+			Assert::AreEqual(20ULL, static_cast<unsigned long long>(samples.Back().Frame));
+		}
+
+		TEST_METHOD(MultipleThreads)
+		{
+			Profiler::Create();
+			Profiler* profiler = Profiler::Instance();
+
+			{
+				const Profiler::ScopedSample sample("Main");
+			}
+
+			std::thread worker([]
+			{
+				const Profiler::ScopedSample sample("Worker");
+			});
+			worker.join();
+
+			const auto samples = profiler->Collect();
+			Assert::AreEqual(2_z, samples.Size());
+			Assert::AreEqual("Main"s, std::string(samples[0].Name));
+			Assert::AreEqual(0U, samples[0].ThreadIndex);
+			Assert::AreEqual("Worker"s, std::string(samples[1].Name));
+			Assert::AreEqual(1U, samples[1].ThreadIndex);
+		}
+
+		TEST_METHOD(CollectWhileRecording)
+		{
+			Profiler::Create(64);
+			Profiler* profiler = Profiler::Instance();
+
+			const char* const name = "Worker";
+			std::atomic<bool> isRecording{ true };
+
+			std::thread worker([name, &isRecording]
+			{
+				while (isRecording.load())
+				{
+					const Profiler::ScopedSample sample(name);
+				}
+			});
+
+			// Samples overwritten while being collected are dropped rather than returned torn.
+			for (std::size_t i = 0; i < 1000; ++i)
+			{
+				const auto samples = profiler->Collect();
+				Assert::IsTrue(samples.Size() <= 64_z);
+
+				for (const auto& sample : samples)
+				{
+					Assert::IsTrue(sample.Name == name);
+					Assert::AreEqual(0U, sample.Depth);
+					Assert::AreEqual(0U, sample.ThreadIndex);
+				}
+
+				if (i % 10 == 0) profiler->Clear();
+			}
+
+			isRecording.store(false);
+			worker.join();
+
+			profiler->Clear();
+			Assert::IsTrue(profiler->Collect().IsEmpty());
+
+			// Samples recorded after a Clear are kept.
+			std::thread([name] { const Profiler::ScopedSample sample(name); }).join();
+			Assert::AreEqual(1_z, profiler->Collect().Size());
+		}
+
+		TEST_METHOD(Reports)
+		{
+			Profiler::Create();
+			Profiler* profiler = Profiler::Instance();
+
+			{
+				const Profiler::ScopedSample outer("Outer");
+				const Profiler::ScopedSample inner("Inner");
+				std::this_thread::sleep_for(std::chrono::milliseconds(2));
+			}
+
+			std::ostringstream trace;
+			profiler->WriteChromeTrace(trace);
+			Assert::IsTrue(trace.str().find("\"traceEvents\"") != std::string::npos);
+			Assert::IsTrue(trace.str().find("\"name\":\"Outer\"") != std::string::npos);
+			Assert::IsTrue(trace.str().find("\"name\":\"Inner\"") != std::string::npos);
+
+			std::ostringstream folded;
+			profiler->WriteFoldedStacks(folded);
+			Assert::IsTrue(folded.str().find("Outer;Inner ") != std::string::npos);
+			Assert::IsTrue(folded.str().find("Inner;Outer") == std::string::npos);
+		}
+
+	private:
+		static _CrtMemState sStartMemState;
+	};
+
+	_CrtMemState ProfilerTest::sStartMemState;
+}
@@ -0,0 +1,125 @@
+#include "pch.h"
+
+#include "ToStringSpecialization.h"
+
+#include <atomic>
+
+#include "ReclamationQueue.h"
+#include "Scope.h"
+
+using namespace std::string_literals;
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace UnitTests;
+
+namespace EntitySystemTests
+{
+	class ReclaimedScope final : public Scope
+	{
+	public:
+		virtual ~ReclaimedScope() override
+		{
+			++sDestroyedCount;
+		}
+
+		inline static std::atomic<std::size_t> sDestroyedCount{ 0 };
+	};
+
+	TEST_CLASS(ReclamationQueueTest)
+	{
+	public:
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+			ReclaimedScope::sDestroyedCount = 0;
+
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&sStartMemState);
+#endif
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &sStartMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+		}
+
+		TEST_METHOD(Drain)
+		{
+			ReclamationQueue queue;
+			Assert::IsTrue(queue.IsEmpty());
+			Assert::AreEqual(0_z, queue.Drain());
+
+			for (int i = 0; i < 10; ++i)
+			{
+				queue.Enqueue(new ReclaimedScope);
+			}
+
+			Assert::AreEqual(10_z, queue.Size());
+
+			Assert::AreEqual(4_z, queue.Drain(4));
+			Assert::AreEqual(6_z, queue.Size());
+			Assert::AreEqual(4_z, ReclaimedScope::sDestroyedCount.load());
+
+			Assert::AreEqual(0_z, queue.Drain(0));
+			Assert::AreEqual(6_z, queue.Size());
+
+			Assert::AreEqual(6_z, queue.Drain());
+			Assert::IsTrue(queue.IsEmpty());
+			Assert::AreEqual(10_z, ReclaimedScope::sDestroyedCount.load());
+		}
+
+		TEST_METHOD(DrainAsync)
+		{
+			ReclamationQueue queue;
+			queue.DrainAsync();
+			Assert::IsFalse(queue.IsDraining());
+
+			for (int i = 0; i < 100; ++i)
+			{
+				queue.Enqueue(new ReclaimedScope);
+			}
+
+			queue.DrainAsync();
+			Assert::IsTrue(queue.IsEmpty());
+
+			for (int i = 0; i < 100; ++i)
+			{
+				queue.Enqueue(new ReclaimedScope);
+			}
+
+			queue.DrainAsync();
+			queue.Wait();
+			Assert::IsFalse(queue.IsDraining());
+			Assert::AreEqual(200_z, ReclaimedScope::sDestroyedCount.load());
+		}
+
+		TEST_METHOD(Destructor)
+		{
+			{
+				ReclamationQueue queue;
+
+				Scope* scope = new ReclaimedScope;
+				scope->AppendScope("Child");
+				queue.Enqueue(scope);
+
+				queue.Enqueue(new ReclaimedScope);
+				queue.DrainAsync();
+				queue.Enqueue(new ReclaimedScope);
+			}
+
+			Assert::AreEqual(3_z, ReclaimedScope::sDestroyedCount.load());
+		}
+
+	private:
+		static _CrtMemState sStartMemState;
+	};
+
+	_CrtMemState ReclamationQueueTest::sStartMemState;
+}
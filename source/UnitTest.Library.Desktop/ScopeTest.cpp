@@ -279,6 +279,33 @@ namespace ReflectionSystemTests
 			Assert::AreEqual(50_z, scope.Capacity());
 		}
 
+		TEST_METHOD(Compact)
+		{
+			Scope scope(30);
+			scope.Append("int") = 10;
+			scope.Append("string") = "string"s;
+			Scope& child = scope.AppendScope("child");
+			child.Append("float") = 1.5f;
+
+			int external = 20;
+			scope.Append("external").SetStorage(gsl::span<int>(&external, 1));
+
+			const Scope copy = scope;
+			scope.Compact();
+
+			Assert::AreEqual(4_z, scope.Capacity());
+			Assert::AreEqual(copy, scope);
+			Assert::AreEqual(&child, &scope[2][0]);
+			Assert::AreEqual(&scope, child.GetParent());
+
+			external = 30;
+			Assert::AreEqual(30, scope["external"].Get<int>());
+
+			scope.Append("appended") = 40;
+			Assert::AreEqual(40, scope.Find("appended")->Get<int>());
+			Assert::AreEqual(10, scope.Find("int")->Get<int>());
+		}
+
 		TEST_METHOD(GetParent)
 		{
 			Scope scope;
@@ -677,6 +704,32 @@ namespace ReflectionSystemTests
 			Assert::ExpectException<std::runtime_error>([&scope] { Scope notFound; scope.Orphan(notFound); });
 		}
 
+		TEST_METHOD(OrphanWithKey)
+		{
+			Scope scope;
+
+			Scope& child0_0 = scope.AppendScope("child0");
+			Scope& child0_1 = scope.AppendScope("child0");
+			Scope& child1_0 = scope.AppendScope("child1");
+
+			Scope* tmp = scope.Orphan(child0_0, "child0");
+			Assert::IsNull(tmp->GetParent());
+			delete tmp;
+
+			Assert::AreEqual(1_z, scope.Find("child0")->Size());
+			Assert::AreEqual(&child0_1, scope.Find("child0")->Get<Scope*>());
+
+			tmp = scope.Orphan(child1_0, "child0");
+			Assert::IsNull(tmp->GetParent());
+			delete tmp;
+
+			Assert::AreEqual(0_z, scope.Find("child1")->Size());
+			Assert::AreEqual(&child0_1, scope.Find("child0")->Get<Scope*>());
+			Assert::AreEqual(&scope, child0_1.GetParent());
+
+			Assert::ExpectException<std::runtime_error>([&scope] { Scope notFound; scope.Orphan(notFound, "child0"); });
+		}
+
 		TEST_METHOD(Adopt)
 		{
 			Scope scope;
@@ -745,6 +798,60 @@ namespace ReflectionSystemTests
 			Assert::IsNull(scope.Find("child1"));
 		}
 
+		TEST_METHOD(Lineage)
+		{
+			Scope root;
+			root.Append("int") = 10;
+			Scope& child = root.AppendScope("child");
+			Scope& grandchild = child.AppendScope("grandchild");
+
+			const Scope::Lineage empty;
+			Assert::IsTrue(empty.IsEmpty());
+			Assert::IsFalse(empty.Matches(grandchild));
+
+			Scope::Lineage lineage(grandchild);
+			Assert::IsFalse(lineage.IsEmpty());
+			Assert::IsTrue(lineage.Matches(grandchild));
+			Assert::IsFalse(lineage.Matches(child));
+
+			/* Value changes are not structure changes */
+
+			const std::uint64_t version = root.StructureVersion();
+			root["int"] = 20;
+			root.Append("int");
+			Assert::AreEqual(version, root.StructureVersion());
+			Assert::IsTrue(lineage.Matches(grandchild));
+
+			/* Attributes added to an ancestor */
+
+			root.Append("float") = 1.5f;
+			Assert::IsTrue(version != root.StructureVersion());
+			Assert::IsFalse(lineage.Matches(grandchild));
+
+			/* Ancestors moved to a new parent */
+
+			lineage = Scope::Lineage(grandchild);
+			Scope other;
+			other.Adopt(child, "child");
+			Assert::IsFalse(lineage.Matches(grandchild));
+
+			/* Attributes moved to new storage */
+
+			lineage = Scope::Lineage(grandchild);
+			Assert::IsTrue(lineage.Matches(grandchild));
+			other.Compact();
+			Assert::IsFalse(lineage.Matches(grandchild));
+
+			/* Attributes removed */
+
+			lineage = Scope::Lineage(grandchild);
+			grandchild.Clear();
+			Assert::IsFalse(lineage.Matches(grandchild));
+
+			lineage.Clear();
+			Assert::IsTrue(lineage.IsEmpty());
+		}
+
 	private:
 		static _CrtMemState sStartMemState;
 	};
@@ -0,0 +1,146 @@
+#include "pch.h"
+
+#include "ToStringSpecialization.h"
+#include "StreamHelper.h"
+
+#include <cstring>
+#include <limits>
+
+using namespace std::string_literals;
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+using namespace UnitTests;
+using namespace Library;
+
+namespace UtilityTests
+{
+	TEST_CLASS(StreamHelperTest)
+	{
+	public:
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&sStartMemState);
+#endif
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &sStartMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+		}
+
+		TEST_METHOD(RoundTrip)
+		{
+			std::stringstream stream(std::ios::in | std::ios::out | std::ios::binary);
+
+			{
+				Vector<glm::vec4> colors = { glm::vec4(1, 2, 3, 4), glm::vec4(5, 6, 7, 8) };
+				Vector<std::uint32_t> indices = { 0, 1, 2 };
+				const float weights[] = { 0.25f, 0.75f };
+
+				OutputStreamHelper output(stream);
+				output << "Mesh"s << glm::mat4(2);
+				output.WriteArray(colors);
+				output.WriteArray(Vector<glm::vec4>());
+				output.WriteArray(indices);
+				output.WriteArray(gsl::span<const float>(weights));
+			}
+
+			InputStreamHelper input(stream);
+
+			std::string name;
+			glm::mat4 matrix;
+			input >> name >> matrix;
+			Assert::AreEqual("Mesh"s, name);
+			Assert::AreEqual(glm::mat4(2), matrix);
+
+			Vector<glm::vec4> colors;
+			input.ReadArray(colors);
+			Assert::AreEqual(2_z, colors.Size());
+			Assert::AreEqual(glm::vec4(5, 6, 7, 8), colors[1]);
+
+			Vector<glm::vec4> empty = { glm::vec4(1) };
+			input.ReadArray(empty);
+			Assert::IsTrue(empty.IsEmpty());
+
+			Vector<std::uint32_t> indices;
+			input.ReadArray(indices);
+			Assert::AreEqual(3_z, indices.Size());
+			Assert::AreEqual(2U, indices[2]);
+
+			float weights[2];
+			input.ReadArray(gsl::span<float>(weights));
+			Assert::AreEqual(0.25f, weights[0]);
+			Assert::AreEqual(0.75f, weights[1]);
+
+			Assert::IsTrue(stream.peek() == std::char_traits<char>::eof());
+		}
+
+		TEST_METHOD(ArraysAreLittleEndian)
+		{
+			std::ostringstream stream(std::ios::binary);
+			OutputStreamHelper output(stream);
+
+			const std::uint32_t values[] = { 0x04030201 };
+			output.WriteArray(gsl::span<const std::uint32_t>(values));
+
+			Assert::AreEqual("\x01\x02\x03\x04"s, stream.str());
+
+			std::byte bytes[] = { std::byte(1), std::byte(2), std::byte(3), std::byte(4) };
+			SwapScalarBytes<std::uint16_t>(gsl::span<std::byte>(bytes));
+			Assert::IsTrue(bytes[0] == std::byte(2) && bytes[1] == std::byte(1) && bytes[2] == std::byte(4) && bytes[3] == std::byte(3));
+		}
+
+		TEST_METHOD(FloatsAreLittleEndian)
+		{
+			std::stringstream stream(std::ios::in | std::ios::out | std::ios::binary);
+
+			// Single floats are ordered as the elements of a float array are.
+			const float value = 1.0f;
+			OutputStreamHelper output(stream);
+			output << value;
+			output.WriteArray(gsl::span<const float>(&value, 1));
+
+			const std::string bytes = { '\x00', '\x00', '\x80', '\x3F' };
+			Assert::AreEqual(bytes + bytes, stream.str());
+
+			const float values[] = { -0.0f, 3.5e-42f, -1.25e30f, std::numeric_limits<float>::infinity(), std::numeric_limits<float>::quiet_NaN() };
+			for (const float written : values)
+			{
+				output << written;
+			}
+
+			InputStreamHelper input(stream);
+
+			float read;
+			input >> read;
+			Assert::AreEqual(1.0f, read);
+			input >> read;
+			Assert::AreEqual(1.0f, read);
+
+			// Read back bit for bit, including the sign of zero, denormals and NaN.
+			for (const float written : values)
+			{
+				input >> read;
+				Assert::AreEqual(0, std::memcmp(&written, &read, sizeof(float)));
+			}
+
+			Assert::IsTrue(stream.peek() == std::char_traits<char>::eof());
+		}
+
+	private:
+		static _CrtMemState sStartMemState;
+	};
+
+	_CrtMemState StreamHelperTest::sStartMemState;
+}
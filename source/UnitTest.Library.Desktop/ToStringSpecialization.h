@@ -19,6 +19,7 @@
 #include "Scope.h"
 #include "TypeManager.h"
 #include "JsonParseMaster.h"
+#include "JsonStreamReader.h"
 #include "Entity.h"
 #include "World.h"
 #include "GameTime.h"
@@ -1485,6 +1486,24 @@ namespace Microsoft::VisualStudio::CppUnitTestFramework
 	{
 		RETURN_WIDE_STRING(t);
 	}
+
+	template<>
+	inline std::wstring ToString<JsonStreamReader::Token>(const JsonStreamReader::Token& t)
+	{
+		RETURN_WIDE_STRING(static_cast<int>(t));
+	}
+
+	template<>
+	inline std::wstring ToString<JsonStreamReader::Token>(const JsonStreamReader::Token* t)
+	{
+		RETURN_WIDE_STRING(t);
+	}
+
+	template<>
+	inline std::wstring ToString<JsonStreamReader::Token>(JsonStreamReader::Token* t)
+	{
+		RETURN_WIDE_STRING(t);
+	}
 #pragma endregion JSON Parser
 
 #pragma region Entity
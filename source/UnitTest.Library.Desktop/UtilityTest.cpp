@@ -3,6 +3,10 @@
 #include "ToStringSpecialization.h"
 #include "Utility.h"
 #include "MathUtility.h"
+#include "Float4.h"
+
+#include <cmath>
+#include <cstring>
 
 
 using namespace std::string_literals;
@@ -68,6 +72,126 @@ namespace UtilityTests
 			Assert::AreEqual("Test.", aggregate.what());
 			Assert::AreEqual(exceptionsCopy.Size(), aggregate.Exceptions.Size());
 		}
+
+		TEST_METHOD(PackQuaternion)
+		{
+			Vector<glm::quat> quaternions;
+			quaternions.EmplaceBack(1.0f, 0.0f, 0.0f, 0.0f);
+			quaternions.EmplaceBack(-1.0f, 0.0f, 0.0f, 0.0f);
+			quaternions.EmplaceBack(0.0f, 1.0f, 0.0f, 0.0f);
+			quaternions.EmplaceBack(0.0f, 0.0f, -1.0f, 0.0f);
+			quaternions.EmplaceBack(0.0f, 0.0f, 0.0f, 1.0f);
+
+			// Every component in turn the largest, of either sign.
+			for (float angle = -3.0f; angle <= 3.0f; angle += 0.37f)
+			{
+				quaternions.EmplaceBack(glm::angleAxis(angle, glm::normalize(glm::vec3(1.0f, 0.2f, -0.3f))));
+				quaternions.EmplaceBack(glm::angleAxis(angle, glm::normalize(glm::vec3(-0.1f, 1.0f, 0.4f))));
+				quaternions.EmplaceBack(glm::angleAxis(angle, glm::normalize(glm::vec3(0.3f, -0.2f, -1.0f))));
+				quaternions.EmplaceBack(glm::angleAxis(angle, glm::normalize(glm::vec3(0.5f, 0.6f, 0.7f))));
+			}
+
+			for (const auto& quaternion : quaternions)
+			{
+				const glm::quat unpacked = Math::UnpackQuaternion(Math::PackQuaternion(quaternion));
+
+				// q and -q are the same rotation, and unpacking may return either.
+				const float sign = (glm::dot(unpacked, quaternion) < 0.0f ? -1.0f : 1.0f);
+
+				for (glm::length_t i = 0; i < 4; ++i)
+				{
+					Assert::AreEqual(quaternion[i] * sign, unpacked[i], 1e-4f);
+				}
+
+				Assert::AreEqual(1.0f, glm::length(unpacked), 1e-4f);
+
+				// Packing an unpacked quaternion again loses nothing more.
+				const glm::quat repacked = Math::UnpackQuaternion(Math::PackQuaternion(unpacked));
+				for (glm::length_t i = 0; i < 4; ++i)
+				{
+					Assert::AreEqual(unpacked[i], repacked[i], 1e-4f);
+				}
+			}
+		}
+
+		TEST_METHOD(Float4Lanes)
+		{
+			// Every operation must match the same operation on each lane alone, whether built with SSE or LIBRARY_FLOAT4_SCALAR.
+			const float lhsValues[] = { 1.5f, -2.25f, 0.0f, 3e-3f };
+			const float rhsValues[] = { -0.5f, 4.0f, -0.0f, 3e-3f };
+			const float factors[] = { 0.0f, 0.25f, 1.0f, 0.5f };
+
+			const Float4 lhs = Float4::Load(lhsValues);
+			const Float4 rhs = Float4::Load(rhsValues);
+			const Float4 factor = Float4::Load(factors);
+
+			float results[4];
+
+			Float4(7.0f).Store(results);
+			for (float result : results) Assert::AreEqual(7.0f, result);
+
+			(lhs + rhs).Store(results);
+			for (std::size_t i = 0; i < 4; ++i) Assert::AreEqual(lhsValues[i] + rhsValues[i], results[i]);
+
+			(lhs - rhs).Store(results);
+			for (std::size_t i = 0; i < 4; ++i) Assert::AreEqual(lhsValues[i] - rhsValues[i], results[i]);
+
+			(lhs * rhs).Store(results);
+			for (std::size_t i = 0; i < 4; ++i) Assert::AreEqual(lhsValues[i] * rhsValues[i], results[i]);
+
+			(lhs / Float4(4.0f)).Store(results);
+			for (std::size_t i = 0; i < 4; ++i) Assert::AreEqual(lhsValues[i] / 4.0f, results[i]);
+
+			(-lhs).Store(results);
+			for (std::size_t i = 0; i < 4; ++i)
+			{
+				Assert::AreEqual(-lhsValues[i], results[i]);
+				Assert::AreNotEqual(std::signbit(lhsValues[i]), std::signbit(results[i]));
+			}
+
+			Float4::Lerp(lhs, rhs, factor).Store(results);
+			for (std::size_t i = 0; i < 4; ++i) Assert::AreEqual(lhsValues[i] + (rhsValues[i] - lhsValues[i]) * factors[i], results[i]);
+
+			// Equal lanes, including zeros of opposite sign, give the right hand side, as SSE does.
+			Float4::Min(lhs, rhs).Store(results);
+			for (std::size_t i = 0; i < 4; ++i)
+			{
+				Assert::AreEqual(lhsValues[i] < rhsValues[i] ? lhsValues[i] : rhsValues[i], results[i]);
+				Assert::AreEqual(lhsValues[i] < rhsValues[i] ? std::signbit(lhsValues[i]) : std::signbit(rhsValues[i]), std::signbit(results[i]));
+			}
+
+			Float4::Max(lhs, rhs).Store(results);
+			for (std::size_t i = 0; i < 4; ++i)
+			{
+				Assert::AreEqual(lhsValues[i] > rhsValues[i] ? lhsValues[i] : rhsValues[i], results[i]);
+				Assert::AreEqual(lhsValues[i] > rhsValues[i] ? std::signbit(lhsValues[i]) : std::signbit(rhsValues[i]), std::signbit(results[i]));
+			}
+
+			// Masks have every bit set or clear.
+			auto assertMask = [](const Float4& mask, const bool (&expected)[4])
+			{
+				float lanes[4];
+				mask.Store(lanes);
+
+				for (std::size_t i = 0; i < 4; ++i)
+				{
+					std::uint32_t bits;
+					std::memcpy(&bits, &lanes[i], sizeof(bits));
+					Assert::AreEqual(expected[i] ? 0xFFFFFFFFU : 0U, bits);
+				}
+			};
+
+			assertMask(lhs < rhs, { false, true, false, false });
+			assertMask(lhs > rhs, { true, false, false, false });
+
+			Float4::Select(lhs < rhs, lhs, rhs).Store(results);
+			for (std::size_t i = 0; i < 4; ++i)
+			{
+				const float expected = lhsValues[i] < rhsValues[i] ? lhsValues[i] : rhsValues[i];
+				Assert::AreEqual(expected, results[i]);
+				Assert::AreEqual(std::signbit(expected), std::signbit(results[i]));
+			}
+		}
 		
 	private:
 		static _CrtMemState sStartMemState;
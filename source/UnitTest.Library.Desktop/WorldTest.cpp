@@ -201,6 +201,160 @@ namespace EntitySystemTests
 			Assert::IsTrue(fooEntity2.As<FooEntity>()->IsUpdated());
 		}
 
+		TEST_METHOD(SleepFor)
+		{
+			GameTime gameTime;
+			EventQueue queue;
+			
+			World world("World", &gameTime, &queue);
+			Entity& sector = world.CreateChild("Entity", "Sector");
+
+			FooEntity& napping = *sector.CreateChild("FooEntity", "Napping").As<FooEntity>();
+			FooEntity& hibernating = *sector.CreateChild("FooEntity", "Hibernating").As<FooEntity>();
+
+			napping.SleepFor(world.GetWorldState(), std::chrono::milliseconds(0));
+			hibernating.SleepFor(world.GetWorldState(), std::chrono::hours(1));
+			Assert::AreEqual(2_z, world.PendingWakeCount());
+
+			world.Update();
+			Assert::IsTrue(napping.IsUpdated());
+			Assert::IsFalse(napping.IsSleeping());
+			Assert::IsFalse(hibernating.IsUpdated());
+			Assert::AreEqual(1_z, world.PendingWakeCount());
+
+			hibernating.Sleep();
+			Assert::AreEqual(0_z, world.PendingWakeCount());
+
+			hibernating.SleepFor(world.GetWorldState(), std::chrono::hours(1));
+			hibernating.Wake();
+			Assert::AreEqual(0_z, world.PendingWakeCount());
+
+			world.Update();
+			Assert::IsTrue(hibernating.IsUpdated());
+
+			hibernating.SleepFor(world.GetWorldState(), std::chrono::hours(1));
+			sector.DestroyChild(hibernating);
+			Assert::AreEqual(0_z, world.PendingWakeCount());
+		}
+
+		TEST_METHOD(CancelWakeKeepsSchedule)
+		{
+			GameTime gameTime;
+			EventQueue queue;
+
+			World world("World", &gameTime, &queue);
+			Entity& sector = world.CreateChild("Entity", "Sector");
+
+			const std::size_t entityCount = 300;
+			Vector<FooEntity*> entities;
+
+			for (std::size_t i = 0; i < entityCount; ++i)
+			{
+				entities.PushBack(sector.CreateChild("FooEntity", "Foo" + std::to_string(i)).As<FooEntity>());
+				entities.Back()->SleepFor(world.GetWorldState(), i % 2 == 0 ? std::chrono::milliseconds(0) : std::chrono::hours(1 + i % 7));
+			}
+
+			for (std::size_t i = 0; i < entityCount; i += 3)
+			{
+				entities[i]->Sleep();
+			}
+
+			Assert::AreEqual(entityCount - entityCount / 3, world.PendingWakeCount());
+
+			world.Update();
+
+			std::size_t hibernatingCount = 0;
+
+			for (std::size_t i = 0; i < entityCount; ++i)
+			{
+				const bool isDue = i % 2 == 0 && i % 3 != 0;
+				Assert::AreEqual(isDue, entities[i]->IsUpdated());
+				Assert::AreEqual(!isDue, entities[i]->IsSleeping());
+
+				if (i % 2 != 0 && i % 3 != 0) ++hibernatingCount;
+			}
+
+			Assert::AreEqual(hibernatingCount, world.PendingWakeCount());
+		}
+
+		TEST_METHOD(ActiveSubset)
+		{
+			World world;
+			Entity& sector = world.CreateChild("Entity", "Sector");
+
+			const std::size_t entityCount = 1000;
+			Vector<FooEntity*> entities;
+
+			for (std::size_t i = 0; i < entityCount; ++i)
+			{
+				entities.PushBack(sector.CreateChild("FooEntity", "Foo" + std::to_string(i)).As<FooEntity>());
+				if (i % 100 != 0) entities.Back()->Sleep();
+			}
+
+			world.Update();
+			Assert::AreEqual(entityCount / 100, sector.ActiveChildCount());
+
+			for (std::size_t i = 0; i < entityCount; ++i)
+			{
+				Assert::AreEqual(i % 100 == 0, entities[i]->IsUpdated());
+			}
+		}
+
+		TEST_METHOD(DeferredReclamation)
+		{
+			GameTime gameTime;
+			EventQueue queue;
+			
+			World world("World", &gameTime, &queue);
+			world.SetReclaimBudget(100);
+			Assert::AreEqual(100_z, world.ReclaimBudget());
+
+			Entity& sector = world.CreateChild("Entity", "Sector");
+
+			const std::size_t entityCount = 1000;
+
+			for (std::size_t i = 0; i < entityCount; ++i)
+			{
+				Entity& entity = sector.CreateChild("FooEntity", "Foo" + std::to_string(i));
+				entity.CreateChild("Entity", "Child").SleepFor(world.GetWorldState(), std::chrono::hours(1));
+			}
+
+			Assert::AreEqual(entityCount, world.PendingWakeCount());
+
+			sector.ForEachChild([&sector](Entity& entity)
+			{
+				sector.DestroyChild(entity);
+				sector.DestroyChild(entity);
+			});
+
+			Assert::AreEqual(entityCount, sector.ChildCount());
+
+			world.Update();
+			Assert::AreEqual(0_z, sector.ChildCount());
+			Assert::AreEqual(0_z, world.PendingWakeCount());
+			Assert::AreEqual(entityCount - 100, world.GetReclamationQueue().Size());
+
+			world.Update();
+			Assert::AreEqual(entityCount - 200, world.GetReclamationQueue().Size());
+
+			world.SetReclaimBudget(0);
+			world.Update();
+			Assert::AreEqual(entityCount - 200, world.GetReclamationQueue().Size());
+
+			world.GetReclamationQueue().DrainAsync();
+			Assert::IsTrue(world.GetReclamationQueue().IsEmpty());
+
+			world.GetReclamationQueue().Wait();
+			Assert::IsFalse(world.GetReclamationQueue().IsDraining());
+
+			Entity& immediate = sector.CreateChild("Entity", "Immediate");
+			sector.DestroyChild(immediate);
+			Assert::AreEqual(1_z, world.GetReclamationQueue().Size());
+
+			world.Shutdown();
+			Assert::IsTrue(world.GetReclamationQueue().IsEmpty());
+		}
+
 		TEST_METHOD(Clone)
 		{
  			World sector;